@@ -1,7 +1,7 @@
 @echo off
 setlocal
 
-set CFLAGS=-O2 -s WASM=1 -s EXPORTED_RUNTIME_METHODS=["ccall","cwrap","HEAPF32","HEAPU8","HEAP32"] -s EXPORTED_FUNCTIONS=["_malloc","_free","_init_webgl","_init_grid","_render_grid","_set_cell_color","_set_cell_text","_update_grid_buffer","_get_cell_at","_set_cursor"] -s ALLOW_MEMORY_GROWTH=1 --no-entry
+set CFLAGS=-O2 -s WASM=1 -s EXPORTED_RUNTIME_METHODS=["ccall","cwrap","HEAPF32","HEAPU8","HEAP32","HEAPF64"] -s EXPORTED_FUNCTIONS=["_malloc","_free","_init_webgl","_init_grid","_render_grid","_request_render","_set_cell_color","_clear_cell_color","_set_cell_text","_set_cell_number","_set_cell_numbers","_set_cells_text","_set_cell_style","_set_text_style","_add_format_rule","_clear_format_rules","_set_format_background","_set_column_align","_set_gpu_text_layout","_update_grid_buffer","_get_cell_at","_set_cursor","_set_selection","_set_viewport","_set_frozen","_set_header_span","_clear_header_spans","_scroll_to_px","_scroll_by_px","_scroll_to","_scroll_by","_scroll_cell_into_view","_set_column_width","_set_row_height","_get_scroll_row","_get_scroll_col"] -s ALLOW_MEMORY_GROWTH=1 --no-entry
 
 if not exist src\wasm mkdir src\wasm
 
@@ -0,0 +1,3427 @@
+// Generated by tools/gen_font_sdf.py from DejaVuSansMono.ttf. Do not edit.
+//
+// Signed-distance-field glyphs for printable ASCII and Latin-1, one
+// FONT_SDF_CELL_W x FONT_SDF_CELL_H cell each, PackBits encoded per glyph.
+// 128 is the glyph edge; values saturate FONT_SDF_SPREAD texels away.
+// Metrics are in texels; the pen origin is FONT_SDF_ORIGIN_X from a cell's
+// left edge and the baseline FONT_SDF_BASELINE from its top.
+
+#define FONT_SDF_GLYPH_COUNT 191
+#define FONT_SDF_CELL_W 21
+#define FONT_SDF_CELL_H 35
+#define FONT_SDF_SPREAD 3
+#define FONT_SDF_ORIGIN_X 3
+#define FONT_SDF_BASELINE 26
+#define FONT_SDF_ADVANCE 14.4492f
+#define FONT_SDF_CAP_HEIGHT 17.4961f
+
+// Code point of each glyph
+static const unsigned char font_sdf_codes[191] = {
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 160,
+    161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+    177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+    193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+    225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240,
+    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+};
+
+// Glyph i is font_sdf_rle[font_sdf_offsets[i], font_sdf_offsets[i + 1])
+static const unsigned int font_sdf_offsets[192] = {
+    0, 12, 268, 453, 878, 1307, 1707, 2144, 2278, 2577, 2878, 3152,
+    3409, 3558, 3656, 3772, 4064, 4481, 4794, 5149, 5561, 5909, 6293, 6711,
+    6992, 7416, 7834, 8042, 8281, 8557, 8704, 8983, 9306, 9799, 10183, 10600,
+    10977, 11391, 11717, 12016, 12448, 12894, 13202, 13532, 13970, 14237, 14717, 15176,
+    15606, 15980, 16441, 16874, 17294, 17568, 18008, 18395, 18852, 19275, 19619, 19926,
+    20254, 20546, 20869, 21078, 21151, 21272, 21615, 22023, 22341, 22744, 23070, 23397,
+    23824, 24232, 24550, 24913, 25313, 25616, 26011, 26367, 26703, 27111, 27504, 27775,
+    28095, 28431, 28783, 29098, 29469, 29822, 30202, 30463, 30827, 31152, 31515, 31700,
+    31712, 31966, 32346, 32717, 33016, 33420, 33712, 34130, 34260, 34641, 34903, 35175,
+    35319, 35417, 35798, 35893, 36082, 36377, 36589, 36821, 36940, 37363, 37774, 37884,
+    38015, 38218, 38482, 38757, 39190, 39622, 40083, 40415, 40857, 41297, 41755, 42227,
+    42698, 43156, 43567, 44002, 44397, 44792, 45196, 45605, 45982, 46356, 46739, 47129,
+    47549, 48086, 48565, 49043, 49532, 50036, 50539, 50841, 51314, 51810, 52305, 52806,
+    53321, 53722, 54106, 54542, 54953, 55365, 55783, 56217, 56639, 57089, 57477, 57853,
+    58246, 58639, 59041, 59449, 59784, 60118, 60463, 60812, 61232, 61676, 62080, 62485,
+    62898, 63328, 63745, 63981, 64358, 64777, 65197, 65619, 66046, 66495, 66956, 67411,
+};
+
+static const unsigned char font_sdf_rle[67411] = {
+    0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xA2, 0x00, 0x81, 0x00, 0xFC, 0x00, 0x01, 0x14, 0x27, 0xFE,
+    0x2A, 0x01, 0x1F, 0x05, 0xF4, 0x00, 0x02, 0x0B, 0x31, 0x4F, 0xFE, 0x55, 0x01, 0x41, 0x1E, 0xF4, 0x00, 0x07, 0x13, 0x3E,
+    0x68, 0x7F, 0x7F, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07,
+    0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4,
+    0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52,
+    0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7,
+    0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3D, 0x67, 0x92, 0xA6, 0x7C, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x10, 0x3B, 0x65,
+    0x8F, 0xA3, 0x79, 0x4F, 0x24, 0xF4, 0x00, 0x07, 0x0E, 0x38, 0x63, 0x8D, 0xA1, 0x77, 0x4C, 0x22, 0xF4, 0x00, 0x07, 0x0B,
+    0x36, 0x60, 0x8A, 0x9E, 0x74, 0x4A, 0x1F, 0xF4, 0x00, 0x07, 0x09, 0x33, 0x5D, 0x7A, 0x7A, 0x71, 0x47, 0x1D, 0xF4, 0x00,
+    0x07, 0x01, 0x25, 0x45, 0x4F, 0x4F, 0x4D, 0x35, 0x12, 0xF4, 0x00, 0x02, 0x11, 0x3A, 0x5F, 0xFE, 0x69, 0x01, 0x4D, 0x25,
+    0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x94, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C,
+    0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x95, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x02, 0x11, 0x3A, 0x60, 0xFE,
+    0x6A, 0x01, 0x4D, 0x25, 0xF4, 0x00, 0x02, 0x02, 0x24, 0x3C, 0xFE, 0x40, 0x01, 0x31, 0x13, 0xF3, 0x00, 0x01, 0x03, 0x13,
+    0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00, 0xFE, 0x00, 0x05, 0x16, 0x28, 0x2A, 0x2A, 0x28, 0x21, 0xFE,
+    0x2A, 0x01, 0x20, 0x07, 0xF8, 0x00, 0x06, 0x0F, 0x34, 0x51, 0x55, 0x55, 0x50, 0x45, 0xFE, 0x55, 0x01, 0x43, 0x20, 0xF8,
+    0x00, 0x06, 0x17, 0x41, 0x6C, 0x7F, 0x7F, 0x6A, 0x57, 0xFE, 0x7F, 0x01, 0x55, 0x2A, 0xF8, 0x00, 0x0B, 0x17, 0x41, 0x6C,
+    0x96, 0x95, 0x6A, 0x57, 0x82, 0xAA, 0x7F, 0x55, 0x2A, 0xF8, 0x00, 0x0B, 0x17, 0x41, 0x6C, 0x96, 0x95, 0x6A, 0x57, 0x82,
+    0xAA, 0x7F, 0x55, 0x2A, 0xF8, 0x00, 0x0B, 0x17, 0x41, 0x6C, 0x96, 0x95, 0x6A, 0x57, 0x82, 0xAA, 0x7F, 0x55, 0x2A, 0xF8,
+    0x00, 0x0B, 0x17, 0x41, 0x6C, 0x96, 0x95, 0x6A, 0x57, 0x82, 0xAA, 0x7F, 0x55, 0x2A, 0xF8, 0x00, 0x0B, 0x17, 0x41, 0x6C,
+    0x96, 0x95, 0x6A, 0x57, 0x82, 0xAA, 0x7F, 0x55, 0x2A, 0xF8, 0x00, 0x0B, 0x17, 0x41, 0x6C, 0x95, 0x95, 0x6A, 0x57, 0x82,
+    0x95, 0x7F, 0x55, 0x2A, 0xF8, 0x00, 0x06, 0x15, 0x3E, 0x63, 0x6B, 0x6B, 0x62, 0x52, 0xFE, 0x6B, 0x01, 0x50, 0x27, 0xF8,
+    0x00, 0x06, 0x05, 0x27, 0x3D, 0x40, 0x40, 0x3D, 0x34, 0xFE, 0x40, 0x01, 0x33, 0x15, 0xF7, 0x00, 0x05, 0x05, 0x14, 0x16,
+    0x16, 0x13, 0x0E, 0xFE, 0x16, 0x00, 0x0D, 0x81, 0x00, 0x81, 0x00, 0x96, 0x00, 0x81, 0x00, 0xFC, 0x00, 0x0A, 0x08, 0x1B,
+    0x1F, 0x1F, 0x1D, 0x0E, 0x1D, 0x1F, 0x1F, 0x1A, 0x06, 0xF8, 0x00, 0x0B, 0x03, 0x27, 0x43, 0x49, 0x49, 0x46, 0x2F, 0x47,
+    0x49, 0x49, 0x41, 0x24, 0xF8, 0x00, 0x0C, 0x10, 0x39, 0x62, 0x74, 0x74, 0x68, 0x43, 0x6B, 0x74, 0x74, 0x5F, 0x35, 0x0B,
+    0xF9, 0x00, 0x0C, 0x1A, 0x43, 0x6D, 0x96, 0x8D, 0x64, 0x4D, 0x77, 0x9E, 0x83, 0x5A, 0x31, 0x08, 0xF9, 0x00, 0x0B, 0x24,
+    0x4E, 0x77, 0xA0, 0x83, 0x5A, 0x58, 0x81, 0xA2, 0x79, 0x50, 0x26, 0xFC, 0x00, 0x10, 0x07, 0x1D, 0x25, 0x25, 0x2F, 0x58,
+    0x81, 0xA2, 0x79, 0x4F, 0x62, 0x8C, 0x98, 0x6E, 0x45, 0x25, 0x19, 0xFD, 0x00, 0x01, 0x22, 0x43, 0xFE, 0x4F, 0x11, 0x62,
+    0x8C, 0x97, 0x6E, 0x4F, 0x6D, 0x96, 0x8D, 0x64, 0x4F, 0x4F, 0x3C, 0x1A, 0x00, 0x00, 0x05, 0x30, 0x5A, 0xFD, 0x7A, 0x01,
+    0x96, 0x8D, 0xFE, 0x7A, 0x0C, 0xA0, 0x83, 0x7A, 0x7A, 0x78, 0x50, 0x26, 0x00, 0x00, 0x05, 0x30, 0x5A, 0x85, 0xFE, 0xA4,
+    0x01, 0xAC, 0xA6, 0xFE, 0xA4, 0x00, 0xAF, 0xFE, 0xA4, 0x07, 0x7B, 0x51, 0x26, 0x00, 0x00, 0x05, 0x30, 0x5A, 0xFE, 0x7D,
+    0x01, 0x81, 0xA2, 0xFE, 0x7D, 0x01, 0x8B, 0x98, 0xFE, 0x7D, 0x02, 0x7B, 0x51, 0x26, 0xFE, 0x00, 0x2A, 0x24, 0x45, 0x53,
+    0x53, 0x62, 0x8B, 0x98, 0x6F, 0x53, 0x6C, 0x95, 0x8E, 0x64, 0x53, 0x53, 0x52, 0x3F, 0x1C, 0x00, 0x00, 0x19, 0x2E, 0x31,
+    0x31, 0x43, 0x6C, 0x95, 0x8E, 0x65, 0x4D, 0x76, 0xA0, 0x83, 0x5A, 0x31, 0x2E, 0x28, 0x1C, 0x03, 0x00, 0x0E, 0x35, 0x55,
+    0xFE, 0x5B, 0x11, 0x76, 0xA0, 0x83, 0x5B, 0x5B, 0x81, 0xA2, 0x79, 0x5B, 0x5B, 0x57, 0x38, 0x11, 0x00, 0x00, 0x14, 0x3F,
+    0x69, 0xFD, 0x86, 0x00, 0xA5, 0xFE, 0x86, 0x01, 0x8B, 0x9B, 0xFE, 0x86, 0x0C, 0x6D, 0x42, 0x18, 0x00, 0x00, 0x14, 0x3F,
+    0x69, 0x94, 0x9B, 0x9B, 0xA1, 0xA0, 0xFE, 0x9B, 0x0C, 0xA8, 0x9C, 0x9B, 0x9B, 0x97, 0x6D, 0x42, 0x18, 0x00, 0x00, 0x13,
+    0x3D, 0x65, 0xFE, 0x71, 0x06, 0x96, 0x8D, 0x71, 0x71, 0x77, 0xA0, 0x83, 0xFE, 0x71, 0x17, 0x67, 0x40, 0x17, 0x00, 0x00,
+    0x06, 0x29, 0x42, 0x46, 0x4E, 0x77, 0xA0, 0x83, 0x5A, 0x58, 0x81, 0xA2, 0x78, 0x4F, 0x46, 0x46, 0x43, 0x2B, 0x09, 0xFE,
+    0x00, 0x10, 0x08, 0x19, 0x2F, 0x58, 0x81, 0xA2, 0x78, 0x4F, 0x62, 0x8C, 0x97, 0x6E, 0x45, 0x1C, 0x1C, 0x1A, 0x0A, 0xFC,
+    0x00, 0x0C, 0x10, 0x39, 0x62, 0x8C, 0x97, 0x6E, 0x45, 0x6D, 0x96, 0x8D, 0x64, 0x3B, 0x11, 0xF9, 0x00, 0x0C, 0x1A, 0x44,
+    0x6D, 0x95, 0x8D, 0x63, 0x4E, 0x77, 0x95, 0x83, 0x59, 0x30, 0x07, 0xF9, 0x00, 0x06, 0x1A, 0x43, 0x66, 0x6A, 0x6A, 0x57,
+    0x4D, 0xFE, 0x6A, 0x01, 0x4E, 0x26, 0xF8, 0x00, 0x06, 0x0A, 0x2A, 0x3E, 0x40, 0x40, 0x37, 0x31, 0xFE, 0x40, 0x01, 0x32,
+    0x14, 0xF7, 0x00, 0x05, 0x07, 0x14, 0x15, 0x15, 0x10, 0x0C, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0xFB, 0x00, 0x90, 0x00,
+    0x04, 0x0D, 0x1D, 0x1F, 0x1E, 0x0F, 0xF2, 0x00, 0x06, 0x0B, 0x2E, 0x47, 0x4A, 0x47, 0x30, 0x0D, 0xF3, 0x00, 0x06, 0x17,
+    0x41, 0x6A, 0x74, 0x6B, 0x43, 0x19, 0xF4, 0x00, 0x09, 0x09, 0x18, 0x42, 0x6D, 0x97, 0x6F, 0x45, 0x1D, 0x14, 0x09, 0xF7,
+    0x00, 0x0B, 0x1A, 0x30, 0x40, 0x4C, 0x6D, 0x97, 0x6F, 0x4E, 0x47, 0x3E, 0x32, 0x1C, 0xF9, 0x00, 0x0D, 0x1E, 0x3B, 0x54,
+    0x68, 0x75, 0x7D, 0x97, 0x7D, 0x78, 0x71, 0x67, 0x58, 0x36, 0x0E, 0xFB, 0x00, 0x0E, 0x14, 0x38, 0x5A, 0x77, 0x8E, 0x9E,
+    0x9C, 0xA4, 0x9D, 0xA2, 0x9A, 0x90, 0x67, 0x3D, 0x12, 0xFB, 0x00, 0x0E, 0x26, 0x4D, 0x73, 0x96, 0x9A, 0x80, 0x72, 0x97,
+    0x72, 0x7A, 0x85, 0x92, 0x67, 0x3D, 0x12, 0xFC, 0x00, 0x0F, 0x07, 0x31, 0x5B, 0x84, 0xAA, 0x82, 0x5E, 0x6D, 0x97, 0x6F,
+    0x50, 0x5E, 0x6E, 0x65, 0x3C, 0x12, 0xFC, 0x00, 0x0F, 0x0B, 0x36, 0x60, 0x8B, 0xA4, 0x79, 0x4F, 0x6D, 0x97, 0x6F, 0x44,
+    0x36, 0x48, 0x46, 0x2B, 0x06, 0xFC, 0x00, 0x0E, 0x0A, 0x34, 0x5E, 0x88, 0xA8, 0x80, 0x5B, 0x6D, 0x97, 0x6F, 0x44, 0x21,
+    0x1F, 0x1D, 0x0B, 0xFB, 0x00, 0x0E, 0x03, 0x2B, 0x54, 0x7B, 0xA0, 0x98, 0x7E, 0x6F, 0x97, 0x6F, 0x56, 0x49, 0x38, 0x22,
+    0x09, 0xFA, 0x00, 0x0E, 0x1C, 0x41, 0x64, 0x83, 0x9C, 0xA4, 0x99, 0x9C, 0x89, 0x7F, 0x70, 0x5D, 0x44, 0x27, 0x07, 0xFB,
+    0x00, 0x0E, 0x06, 0x29, 0x47, 0x61, 0x76, 0x85, 0x90, 0x9F, 0xA0, 0xA7, 0x97, 0x80, 0x64, 0x43, 0x1F, 0xFA, 0x00, 0x0E,
+    0x0B, 0x26, 0x3D, 0x4F, 0x5C, 0x6D, 0x97, 0x76, 0x83, 0x99, 0xA0, 0x7E, 0x59, 0x32, 0x09, 0xFC, 0x00, 0x0F, 0x05, 0x18,
+    0x1D, 0x17, 0x27, 0x42, 0x6D, 0x97, 0x6F, 0x5D, 0x7D, 0xA4, 0x90, 0x67, 0x3D, 0x13, 0xFC, 0x00, 0x0F, 0x23, 0x40, 0x47,
+    0x34, 0x21, 0x42, 0x6D, 0x97, 0x6F, 0x47, 0x71, 0x9C, 0x97, 0x6C, 0x42, 0x17, 0xFD, 0x00, 0x10, 0x0B, 0x35, 0x5E, 0x6E,
+    0x59, 0x48, 0x42, 0x6D, 0x97, 0x6F, 0x4E, 0x75, 0x9E, 0x93, 0x69, 0x3F, 0x15, 0xFD, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B,
+    0x80, 0x70, 0x64, 0x6D, 0x97, 0x6F, 0x6D, 0x89, 0xA7, 0x84, 0x5D, 0x35, 0x0D, 0xFD, 0x00, 0x0F, 0x0C, 0x36, 0x61, 0x8B,
+    0xA3, 0x98, 0x8D, 0x87, 0x98, 0x8A, 0x93, 0xA2, 0x8A, 0x6C, 0x4A, 0x25, 0xFC, 0x00, 0x0F, 0x09, 0x32, 0x58, 0x6D, 0x7B,
+    0x86, 0x8E, 0x93, 0xA0, 0x92, 0x8B, 0x7D, 0x68, 0x4E, 0x30, 0x0E, 0xFB, 0x00, 0x0D, 0x1C, 0x36, 0x45, 0x52, 0x5D, 0x64,
+    0x6D, 0x98, 0x6F, 0x62, 0x56, 0x44, 0x2D, 0x12, 0xF9, 0x00, 0x0B, 0x0E, 0x1D, 0x29, 0x33, 0x43, 0x6D, 0x98, 0x6F, 0x45,
+    0x2D, 0x1E, 0x09, 0xF5, 0x00, 0x06, 0x18, 0x43, 0x6D, 0x98, 0x6F, 0x45, 0x1A, 0xF3, 0x00, 0x06, 0x18, 0x42, 0x6D, 0x81,
+    0x6F, 0x44, 0x1A, 0xF3, 0x00, 0x06, 0x10, 0x36, 0x52, 0x56, 0x53, 0x37, 0x12, 0xF2, 0x00, 0x04, 0x18, 0x2A, 0x2C, 0x2A,
+    0x19, 0xEF, 0x00, 0x00, 0x01, 0xCD, 0x00, 0x81, 0x00, 0xFE, 0x00, 0x03, 0x04, 0x0B, 0x0B, 0x06, 0xF2, 0x00, 0x07, 0x09,
+    0x1E, 0x2D, 0x35, 0x36, 0x2F, 0x22, 0x0E, 0xF5, 0x00, 0x09, 0x0E, 0x2B, 0x44, 0x55, 0x5F, 0x60, 0x58, 0x48, 0x31, 0x15,
+    0xF7, 0x00, 0x0B, 0x07, 0x2A, 0x4A, 0x67, 0x7D, 0x89, 0x8B, 0x80, 0x6C, 0x51, 0x32, 0x0F, 0xF8, 0x00, 0x0B, 0x1A, 0x41,
+    0x65, 0x86, 0xA1, 0x90, 0x8E, 0x9C, 0x8D, 0x6D, 0x49, 0x24, 0xF8, 0x00, 0x0C, 0x28, 0x51, 0x79, 0xA0, 0x81, 0x67, 0x64,
+    0x79, 0x9A, 0x83, 0x5B, 0x32, 0x09, 0xFA, 0x00, 0x11, 0x04, 0x2E, 0x59, 0x83, 0x95, 0x6B, 0x45, 0x3D, 0x61, 0x8A, 0x8E,
+    0x64, 0x3A, 0x0F, 0x14, 0x24, 0x29, 0x1A, 0xFE, 0x00, 0x12, 0x04, 0x2E, 0x59, 0x83, 0x96, 0x6C, 0x46, 0x3F, 0x62, 0x8B,
+    0x8E, 0x64, 0x39, 0x2C, 0x3C, 0x4C, 0x52, 0x3A, 0x15, 0xFE, 0x00, 0x11, 0x27, 0x50, 0x78, 0x9E, 0x82, 0x6A, 0x67, 0x7B,
+    0x9B, 0x82, 0x5A, 0x44, 0x53, 0x63, 0x73, 0x74, 0x4D, 0x26, 0xFE, 0x00, 0x27, 0x19, 0x3F, 0x63, 0x84, 0x9F, 0x92, 0x91,
+    0x9E, 0x8B, 0x6C, 0x5B, 0x6B, 0x7B, 0x8B, 0x98, 0x85, 0x5D, 0x33, 0x08, 0x00, 0x00, 0x05, 0x28, 0x48, 0x64, 0x7A, 0x86,
+    0x87, 0x7E, 0x6A, 0x73, 0x83, 0x92, 0x90, 0x81, 0x71, 0x61, 0x4E, 0x2B, 0x03, 0xFE, 0x00, 0x10, 0x18, 0x2C, 0x41, 0x52,
+    0x5C, 0x6B, 0x7B, 0x8A, 0x98, 0x88, 0x79, 0x69, 0x59, 0x49, 0x3A, 0x2A, 0x12, 0xFE, 0x00, 0x11, 0x0E, 0x34, 0x53, 0x63,
+    0x73, 0x82, 0x92, 0x90, 0x80, 0x71, 0x6E, 0x7B, 0x7F, 0x77, 0x65, 0x4C, 0x2F, 0x0D, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A,
+    0x8A, 0x98, 0x88, 0x78, 0x69, 0x59, 0x78, 0x93, 0x9D, 0x99, 0x9F, 0x88, 0x6B, 0x49, 0x24, 0xFE, 0x00, 0x12, 0x0C, 0x34,
+    0x5C, 0x80, 0x70, 0x61, 0x51, 0x45, 0x6D, 0x92, 0x8E, 0x75, 0x6F, 0x7E, 0x9B, 0x83, 0x5D, 0x36, 0x0D, 0xFE, 0x00, 0x11,
+    0x25, 0x47, 0x57, 0x49, 0x39, 0x2A, 0x4F, 0x79, 0x9F, 0x77, 0x52, 0x45, 0x60, 0x87, 0x93, 0x6A, 0x40, 0x16, 0xFE, 0x00,
+    0x11, 0x0B, 0x24, 0x2D, 0x22, 0x12, 0x27, 0x51, 0x7C, 0x9C, 0x71, 0x48, 0x31, 0x58, 0x82, 0x97, 0x6C, 0x42, 0x17, 0xFC,
+    0x00, 0x0F, 0x02, 0x00, 0x00, 0x22, 0x4C, 0x75, 0x9D, 0x81, 0x62, 0x59, 0x6D, 0x8F, 0x8E, 0x66, 0x3C, 0x13, 0xF9, 0x00,
+    0x0C, 0x17, 0x3E, 0x64, 0x87, 0x9D, 0x89, 0x83, 0x8F, 0x9A, 0x79, 0x55, 0x2F, 0x08, 0xF9, 0x00, 0x0B, 0x05, 0x29, 0x4B,
+    0x69, 0x82, 0x91, 0x94, 0x8C, 0x79, 0x5E, 0x3E, 0x1B, 0xF7, 0x00, 0x0A, 0x0F, 0x2D, 0x47, 0x5C, 0x67, 0x6A, 0x64, 0x54,
+    0x3E, 0x22, 0x02, 0xF6, 0x00, 0x08, 0x0D, 0x23, 0x34, 0x3D, 0x3F, 0x3A, 0x2E, 0x1A, 0x02, 0xF3, 0x00, 0x04, 0x0B, 0x13,
+    0x15, 0x10, 0x06, 0x81, 0x00, 0xFE, 0x00, 0x90, 0x00, 0x04, 0x07, 0x0C, 0x0D, 0x0A, 0x03, 0xF3, 0x00, 0x08, 0x15, 0x26,
+    0x31, 0x37, 0x37, 0x34, 0x2C, 0x21, 0x12, 0xF7, 0x00, 0x0B, 0x03, 0x21, 0x3A, 0x4E, 0x5B, 0x61, 0x62, 0x5E, 0x56, 0x4A,
+    0x34, 0x12, 0xF8, 0x00, 0x0B, 0x1D, 0x3F, 0x5C, 0x74, 0x84, 0x8C, 0x8C, 0x88, 0x7F, 0x71, 0x49, 0x1F, 0xF9, 0x00, 0x0C,
+    0x0C, 0x33, 0x59, 0x7B, 0x98, 0xA4, 0x97, 0x95, 0x9A, 0x9F, 0x75, 0x4A, 0x20, 0xF9, 0x00, 0x0C, 0x18, 0x42, 0x6A, 0x92,
+    0x9F, 0x80, 0x6E, 0x6A, 0x70, 0x7E, 0x75, 0x4A, 0x20, 0xF9, 0x00, 0x0C, 0x1E, 0x49, 0x73, 0x9D, 0x8F, 0x66, 0x45, 0x40,
+    0x47, 0x59, 0x63, 0x44, 0x1C, 0xF9, 0x00, 0x0C, 0x1E, 0x49, 0x73, 0x9D, 0x8F, 0x66, 0x3D, 0x15, 0x1F, 0x34, 0x3A, 0x28,
+    0x09, 0xF9, 0x00, 0x0B, 0x18, 0x42, 0x6B, 0x93, 0x9B, 0x75, 0x4F, 0x2C, 0x09, 0x0C, 0x10, 0x04, 0xF8, 0x00, 0x0F, 0x0D,
+    0x35, 0x5C, 0x82, 0xA7, 0x8A, 0x67, 0x44, 0x22, 0x00, 0x00, 0x0E, 0x11, 0x11, 0x10, 0x01, 0xFD, 0x00, 0x11, 0x03, 0x24,
+    0x44, 0x61, 0x7C, 0x9A, 0xA2, 0x80, 0x5E, 0x3C, 0x19, 0x1E, 0x36, 0x3C, 0x3C, 0x39, 0x24, 0x04, 0xFE, 0x00, 0x7F, 0x1A,
+    0x3E, 0x60, 0x80, 0x9D, 0x8D, 0x97, 0x99, 0x77, 0x55, 0x33, 0x35, 0x5A, 0x66, 0x66, 0x60, 0x3D, 0x15, 0x00, 0x00, 0x08,
+    0x2F, 0x54, 0x79, 0x9C, 0x8D, 0x6D, 0x7E, 0xA0, 0x90, 0x6E, 0x4C, 0x39, 0x63, 0x8E, 0x91, 0x6D, 0x42, 0x18, 0x00, 0x00,
+    0x16, 0x3E, 0x67, 0x8E, 0x9B, 0x75, 0x51, 0x65, 0x87, 0xA9, 0x88, 0x66, 0x43, 0x62, 0x8D, 0x96, 0x6C, 0x41, 0x17, 0x00,
+    0x00, 0x1F, 0x49, 0x72, 0x9C, 0x8E, 0x64, 0x3C, 0x4B, 0x6E, 0x90, 0xA1, 0x7F, 0x5D, 0x65, 0x8F, 0x91, 0x67, 0x3D, 0x13,
+    0x00, 0x00, 0x23, 0x4D, 0x78, 0xA2, 0x89, 0x5F, 0x35, 0x32, 0x54, 0x77, 0x99, 0x98, 0x76, 0x6D, 0x96, 0x89, 0x60, 0x36,
+    0x0D, 0x00, 0x00, 0x22, 0x4C, 0x77, 0xA1, 0x8E, 0x65, 0x3D, 0x19, 0x3B, 0x5D, 0x80, 0xA2, 0x90, 0x7D, 0xA3, 0x7C, 0x54,
+    0x2B, 0x03, 0x00, 0x00, 0x1C, 0x45, 0x6F, 0x0E, 0x97, 0x9C, 0x76, 0x54, 0x38, 0x2A, 0x44, 0x66, 0x89, 0xA9, 0x9A, 0x8E,
+    0x6A, 0x44, 0x1D, 0xFE, 0x00, 0x11, 0x11, 0x39, 0x60, 0x86, 0xA9, 0x90, 0x73, 0x5E, 0x54, 0x56, 0x64, 0x79, 0x9A, 0xA3,
+    0x7E, 0x5C, 0x3A, 0x18, 0xFE, 0x00, 0x12, 0x01, 0x27, 0x4B, 0x6D, 0x8D, 0xA8, 0x97, 0x87, 0x7F, 0x80, 0x8B, 0x9E, 0x91,
+    0x9A, 0x97, 0x75, 0x53, 0x31, 0x0F, 0xFE, 0x00, 0x11, 0x10, 0x31, 0x51, 0x6C, 0x84, 0x95, 0xA0, 0xA3, 0xA0, 0x96, 0x85,
+    0x6F, 0x81, 0x95, 0x8E, 0x6C, 0x49, 0x20, 0xFD, 0x00, 0x10, 0x15, 0x31, 0x49, 0x5E, 0x6D, 0x76, 0x79, 0x76, 0x6D, 0x5F,
+    0x4C, 0x66, 0x6A, 0x6A, 0x69, 0x49, 0x20, 0xFC, 0x00, 0x0F, 0x0F, 0x25, 0x37, 0x44, 0x4C, 0x4E, 0x4C, 0x44, 0x38, 0x2B,
+    0x3E, 0x40, 0x40, 0x3F, 0x2E, 0x0F, 0xFA, 0x00, 0x08, 0x0F, 0x1B, 0x22, 0x24, 0x21, 0x1B, 0x0F, 0x07, 0x14, 0xFE, 0x15,
+    0x00, 0x0A, 0x81, 0x00, 0x81, 0x00, 0xFC, 0x00, 0x01, 0x10, 0x25, 0xFE, 0x2A, 0x00, 0x1B, 0xF3, 0x00, 0x07, 0x06, 0x2C,
+    0x4C, 0x55, 0x55, 0x53, 0x3B, 0x16, 0xF4, 0x00, 0x07, 0x0D, 0x38, 0x62, 0x7F, 0x7F, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07,
+    0x0D, 0x38, 0x62, 0x8D, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0D, 0x38, 0x62, 0x8D, 0x9E, 0x74, 0x49, 0x1F, 0xF4,
+    0x00, 0x07, 0x0D, 0x38, 0x62, 0x8D, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0D, 0x38, 0x62, 0x8D, 0x9E, 0x74, 0x49,
+    0x1F, 0xF4, 0x00, 0x07, 0x0D, 0x38, 0x62, 0x8D, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0D, 0x38, 0x62, 0x8D, 0x95,
+    0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0B, 0x35, 0x5C, 0x6B, 0x6B, 0x68, 0x45, 0x1D, 0xF3, 0x00, 0x06, 0x20, 0x3A, 0x40,
+    0x40, 0x3F, 0x2C, 0x0C, 0xF2, 0x00, 0x04, 0x12, 0x16, 0x16, 0x15, 0x09, 0x81, 0x00, 0x81, 0x00, 0x94, 0x00, 0x8E, 0x00,
+    0x00, 0x15, 0xFE, 0x1E, 0x00, 0x13, 0xF2, 0x00, 0x06, 0x1B, 0x3A, 0x49, 0x49, 0x48, 0x37, 0x16, 0xF4, 0x00, 0x07, 0x0C,
+    0x31, 0x55, 0x73, 0x73, 0x72, 0x4E, 0x24, 0xF4, 0x00, 0x07, 0x21, 0x46, 0x6B, 0x8F, 0x91, 0x6C, 0x47, 0x20, 0xF5, 0x00,
+    0x08, 0x0F, 0x35, 0x5B, 0x80, 0xA4, 0x7E, 0x58, 0x32, 0x0D, 0xF5, 0x00, 0x07, 0x20, 0x47, 0x6E, 0x94, 0x93, 0x6C, 0x45,
+    0x1F, 0xF5, 0x00, 0x08, 0x09, 0x31, 0x58, 0x7F, 0xA6, 0x83, 0x5B, 0x34, 0x0D, 0xF5, 0x00, 0x07, 0x17, 0x3F, 0x67, 0x8F,
+    0x9D, 0x75, 0x4D, 0x25, 0xF4, 0x00, 0x07, 0x23, 0x4C, 0x75, 0x9D, 0x92, 0x69, 0x40, 0x17, 0xF5, 0x00, 0x08, 0x04, 0x2D,
+    0x57, 0x80, 0xA9, 0x88, 0x5E, 0x35, 0x0C, 0xF5, 0x00, 0x08, 0x0B, 0x35, 0x5F, 0x89, 0xAA, 0x80, 0x56, 0x2C, 0x02, 0xF5,
+    0x00, 0x07, 0x11, 0x3B, 0x65, 0x90, 0xA5, 0x7B, 0x50, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA2, 0x77, 0x4D,
+    0x22, 0xF4, 0x00, 0x07, 0x16, 0x40, 0x6B, 0x95, 0xA1, 0x76, 0x4C, 0x21, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x93, 0xA2,
+    0x77, 0x4D, 0x23, 0xF4, 0x00, 0x07, 0x11, 0x3B, 0x65, 0x8F, 0xA5, 0x7B, 0x51, 0x27, 0xF4, 0x00, 0x08, 0x0B, 0x35, 0x5F,
+    0x88, 0xAB, 0x81, 0x57, 0x2D, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2D, 0x56, 0x7F, 0xA8, 0x89, 0x5F, 0x36, 0x0C, 0xF4, 0x00,
+    0x07, 0x22, 0x4B, 0x74, 0x9C, 0x93, 0x69, 0x41, 0x18, 0xF4, 0x00, 0x07, 0x16, 0x3E, 0x66, 0x8E, 0x9E, 0x76, 0x4E, 0x26,
+    0xF4, 0x00, 0x08, 0x08, 0x2F, 0x57, 0x7E, 0xA5, 0x84, 0x5C, 0x35, 0x0E, 0xF4, 0x00, 0x07, 0x1F, 0x46, 0x6C, 0x93, 0x94,
+    0x6D, 0x46, 0x20, 0xF4, 0x00, 0x08, 0x0D, 0x33, 0x59, 0x7F, 0xA4, 0x7F, 0x59, 0x33, 0x0E, 0xF4, 0x00, 0x07, 0x20, 0x45,
+    0x6A, 0x8E, 0x92, 0x6D, 0x48, 0x21, 0xF4, 0x00, 0x07, 0x0B, 0x30, 0x54, 0x71, 0x71, 0x70, 0x4D, 0x24, 0xF3, 0x00, 0x06,
+    0x19, 0x39, 0x47, 0x47, 0x46, 0x35, 0x15, 0xF2, 0x00, 0x00, 0x14, 0xFE, 0x1C, 0x00, 0x11, 0xBC, 0x00, 0x93, 0x00, 0x05,
+    0x09, 0x1B, 0x1E, 0x1E, 0x1B, 0x0A, 0xF3, 0x00, 0x07, 0x05, 0x29, 0x43, 0x49, 0x49, 0x44, 0x2A, 0x07, 0xF4, 0x00, 0x07,
+    0x11, 0x3B, 0x64, 0x73, 0x73, 0x65, 0x41, 0x1D, 0xF4, 0x00, 0x08, 0x0E, 0x36, 0x5B, 0x80, 0x9E, 0x7C, 0x57, 0x32, 0x0C,
+    0xF4, 0x00, 0x07, 0x22, 0x47, 0x6D, 0x93, 0x91, 0x6B, 0x46, 0x20, 0xF4, 0x00, 0x08, 0x0E, 0x34, 0x5B, 0x81, 0xA5, 0x7F,
+    0x58, 0x32, 0x0B, 0xF4, 0x00, 0x07, 0x23, 0x4A, 0x71, 0x99, 0x91, 0x6A, 0x42, 0x1B, 0xF4, 0x00, 0x07, 0x13, 0x3B, 0x63,
+    0x8B, 0xA1, 0x79, 0x51, 0x29, 0xF4, 0x00, 0x08, 0x05, 0x2E, 0x56, 0x7F, 0xA9, 0x87, 0x5E, 0x35, 0x0C, 0xF4, 0x00, 0x07,
+    0x22, 0x4C, 0x75, 0x9F, 0x92, 0x69, 0x40, 0x16, 0xF4, 0x00, 0x07, 0x1A, 0x44, 0x6D, 0x97, 0x9C, 0x72, 0x48, 0x1E, 0xF4,
+    0x00, 0x07, 0x13, 0x3D, 0x68, 0x92, 0xA2, 0x78, 0x4E, 0x24, 0xF4, 0x00, 0x07, 0x0F, 0x3A, 0x64, 0x8F, 0xA7, 0x7C, 0x52,
+    0x28, 0xF4, 0x00, 0x07, 0x0E, 0x39, 0x63, 0x8D, 0xA8, 0x7E, 0x53, 0x29, 0xF4, 0x00, 0x07, 0x10, 0x3A, 0x64, 0x8F, 0xA6,
+    0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x68, 0x92, 0xA2, 0x78, 0x4E, 0x24, 0xF4, 0x00, 0x07, 0x1A, 0x44, 0x6E,
+    0x98, 0x9B, 0x71, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x23, 0x4D, 0x76, 0xA0, 0x92, 0x69, 0x3F, 0x16, 0xF5, 0x00, 0x08, 0x06,
+    0x2F, 0x57, 0x80, 0xA9, 0x86, 0x5E, 0x35, 0x0C, 0xF5, 0x00, 0x07, 0x14, 0x3C, 0x64, 0x8C, 0xA0, 0x78, 0x50, 0x28, 0xF4,
+    0x00, 0x07, 0x24, 0x4B, 0x72, 0x9A, 0x90, 0x69, 0x41, 0x1A, 0xF5, 0x00, 0x08, 0x0F, 0x35, 0x5C, 0x83, 0xA4, 0x7E, 0x58,
+    0x31, 0x0A, 0xF5, 0x00, 0x07, 0x23, 0x48, 0x6E, 0x94, 0x90, 0x6B, 0x45, 0x1F, 0xF5, 0x00, 0x08, 0x0E, 0x37, 0x5C, 0x82,
+    0x9C, 0x7A, 0x56, 0x31, 0x0C, 0xF5, 0x00, 0x07, 0x11, 0x3B, 0x63, 0x71, 0x71, 0x64, 0x40, 0x1C, 0xF4, 0x00, 0x07, 0x04,
+    0x28, 0x42, 0x47, 0x47, 0x42, 0x29, 0x06, 0xF3, 0x00, 0x05, 0x08, 0x19, 0x1C, 0x1C, 0x1A, 0x08, 0xB8, 0x00, 0x90, 0x00,
+    0x03, 0x05, 0x0D, 0x0D, 0x0A, 0xF1, 0x00, 0x05, 0x0F, 0x2B, 0x38, 0x38, 0x33, 0x1D, 0xF5, 0x00, 0x0B, 0x02, 0x0C, 0x06,
+    0x24, 0x4A, 0x62, 0x62, 0x59, 0x35, 0x0D, 0x0B, 0x08, 0xF9, 0x00, 0x0D, 0x0C, 0x28, 0x36, 0x2D, 0x28, 0x53, 0x7D, 0x8D,
+    0x66, 0x3B, 0x23, 0x35, 0x31, 0x1A, 0xFA, 0x00, 0x0E, 0x22, 0x47, 0x60, 0x52, 0x3C, 0x53, 0x7D, 0x90, 0x66, 0x3B, 0x48,
+    0x5D, 0x56, 0x33, 0x0E, 0xFC, 0x00, 0x0F, 0x11, 0x37, 0x5C, 0x81, 0x76, 0x60, 0x53, 0x7D, 0x90, 0x66, 0x56, 0x6C, 0x82,
+    0x6D, 0x48, 0x23, 0xFC, 0x00, 0x0F, 0x17, 0x42, 0x6C, 0x86, 0x9A, 0x84, 0x6E, 0x7D, 0x90, 0x66, 0x7A, 0x90, 0x90, 0x7B,
+    0x55, 0x2B, 0xFC, 0x00, 0x0F, 0x0D, 0x32, 0x4D, 0x61, 0x75, 0x8A, 0x93, 0x7D, 0x90, 0x89, 0x93, 0x7E, 0x6A, 0x56, 0x40,
+    0x1E, 0xFB, 0x00, 0x0E, 0x13, 0x28, 0x3C, 0x50, 0x64, 0x79, 0x90, 0xA3, 0x82, 0x6D, 0x59, 0x45, 0x31, 0x1C, 0x04, 0xFC,
+    0x00, 0x0F, 0x07, 0x29, 0x41, 0x55, 0x69, 0x7D, 0x92, 0x89, 0x93, 0x95, 0x87, 0x72, 0x5E, 0x4A, 0x35, 0x17, 0xFC, 0x00,
+    0x0F, 0x16, 0x3F, 0x65, 0x7A, 0x8E, 0x90, 0x7A, 0x7D, 0x90, 0x70, 0x86, 0x98, 0x83, 0x6F, 0x51, 0x29, 0xFC, 0x00, 0x0F,
+    0x15, 0x3E, 0x63, 0x88, 0x82, 0x6C, 0x56, 0x7D, 0x90, 0x66, 0x62, 0x78, 0x8E, 0x74, 0x4F, 0x27, 0xFC, 0x00, 0x0F, 0x04,
+    0x29, 0x4E, 0x6E, 0x5D, 0x47, 0x53, 0x7D, 0x90, 0x66, 0x3D, 0x53, 0x69, 0x5E, 0x3A, 0x15, 0xFB, 0x00, 0x0D, 0x14, 0x33,
+    0x44, 0x39, 0x28, 0x53, 0x7D, 0x90, 0x66, 0x3B, 0x2F, 0x42, 0x3D, 0x23, 0xF9, 0x00, 0x0C, 0x0F, 0x19, 0x13, 0x27, 0x50,
+    0x70, 0x70, 0x62, 0x3A, 0x10, 0x18, 0x15, 0x03, 0xF6, 0x00, 0x06, 0x17, 0x36, 0x45, 0x45, 0x40, 0x26, 0x03, 0xF2, 0x00,
+    0x04, 0x11, 0x1B, 0x1B, 0x18, 0x06, 0x81, 0x00, 0x81, 0x00, 0xE8, 0x00, 0x81, 0x00, 0xBC, 0x00, 0x00, 0x05, 0xFE, 0x09,
+    0xF1, 0x00, 0x06, 0x16, 0x2E, 0x34, 0x34, 0x33, 0x22, 0x04, 0xF4, 0x00, 0x07, 0x07, 0x2F, 0x52, 0x5E, 0x5E, 0x5C, 0x3F,
+    0x18, 0xF4, 0x00, 0x07, 0x0B, 0x36, 0x60, 0x89, 0x89, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x0B, 0x36, 0x60, 0x8B, 0x9D,
+    0x73, 0x48, 0x1E, 0xF6, 0x00, 0x09, 0x01, 0x01, 0x0B, 0x36, 0x60, 0x8B, 0x9D, 0x73, 0x48, 0x1E, 0xFE, 0x01, 0xFB, 0x00,
+    0x01, 0x15, 0x28, 0xFE, 0x2B, 0x05, 0x36, 0x60, 0x8B, 0x9D, 0x73, 0x48, 0xFD, 0x2B, 0x01, 0x20, 0x05, 0xFE, 0x00, 0x02,
+    0x0C, 0x32, 0x50, 0xFD, 0x56, 0x03, 0x60, 0x8B, 0x9D, 0x73, 0xFC, 0x56, 0x01, 0x41, 0x1E, 0xFE, 0x00, 0x02, 0x14, 0x3E,
+    0x69, 0xFC, 0x80, 0x01, 0x8B, 0x9D, 0xFC, 0x80, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x03, 0x14, 0x3E, 0x69, 0x93, 0xFD,
+    0xA9, 0x01, 0xAA, 0xB3, 0xFD, 0xA9, 0x03, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02, 0x14, 0x3E, 0x69, 0xFC, 0x7E, 0x01,
+    0x8B, 0x9D, 0xFC, 0x7E, 0x02, 0x7C, 0x51, 0x27, 0xFE, 0x00, 0x02, 0x0B, 0x31, 0x4E, 0xFD, 0x54, 0x03, 0x60, 0x8B, 0x9D,
+    0x73, 0xFC, 0x54, 0x01, 0x40, 0x1D, 0xFD, 0x00, 0x01, 0x14, 0x26, 0xFE, 0x29, 0x05, 0x36, 0x60, 0x8B, 0x9D, 0x73, 0x48,
+    0xFD, 0x29, 0x01, 0x1E, 0x04, 0xF9, 0x00, 0x07, 0x0B, 0x36, 0x60, 0x8B, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x0B,
+    0x36, 0x60, 0x8B, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x0B, 0x36, 0x60, 0x87, 0x87, 0x73, 0x48, 0x1E, 0xF4, 0x00,
+    0x07, 0x06, 0x2E, 0x51, 0x5C, 0x5C, 0x5A, 0x3E, 0x18, 0xF3, 0x00, 0x06, 0x15, 0x2C, 0x32, 0x32, 0x31, 0x20, 0x03, 0xF2,
+    0x00, 0x00, 0x03, 0xFE, 0x07, 0x81, 0x00, 0xE5, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xEA, 0x00, 0x00, 0x01, 0xFE,
+    0x02, 0xF1, 0x00, 0x01, 0x1A, 0x2B, 0xFE, 0x2D, 0x01, 0x28, 0x13, 0xF4, 0x00, 0x02, 0x12, 0x38, 0x54, 0xFE, 0x57, 0x02,
+    0x4E, 0x2E, 0x07, 0xF5, 0x00, 0x02, 0x1A, 0x45, 0x6F, 0xFE, 0x82, 0x02, 0x63, 0x39, 0x0E, 0xF5, 0x00, 0x08, 0x1A, 0x45,
+    0x6F, 0x9A, 0xAC, 0x8E, 0x63, 0x39, 0x0E, 0xF5, 0x00, 0x08, 0x1A, 0x45, 0x6F, 0x9A, 0xB8, 0x8E, 0x63, 0x39, 0x0E, 0xF5,
+    0x00, 0x08, 0x24, 0x4D, 0x76, 0xA0, 0xA6, 0x80, 0x5A, 0x34, 0x0B, 0xF6, 0x00, 0x08, 0x06, 0x2F, 0x58, 0x81, 0xAA, 0x92,
+    0x6D, 0x47, 0x21, 0xF5, 0x00, 0x08, 0x10, 0x39, 0x63, 0x8C, 0xA5, 0x7F, 0x59, 0x33, 0x0E, 0xF5, 0x00, 0x07, 0x1B, 0x44,
+    0x6D, 0x96, 0x91, 0x6C, 0x46, 0x20, 0xF4, 0x00, 0x07, 0x21, 0x4B, 0x74, 0x7A, 0x7A, 0x58, 0x32, 0x0C, 0xF4, 0x00, 0x06,
+    0x15, 0x39, 0x4E, 0x4F, 0x4F, 0x40, 0x1F, 0xF2, 0x00, 0x05, 0x17, 0x24, 0x25, 0x25, 0x1C, 0x04, 0xB9, 0x00, 0x81, 0x00,
+    0x81, 0x00, 0xBF, 0x00, 0xFA, 0x01, 0xF5, 0x00, 0x01, 0x12, 0x27, 0xFB, 0x2C, 0x02, 0x2B, 0x1D, 0x01, 0xF8, 0x00, 0x02,
+    0x07, 0x2D, 0x4E, 0xFB, 0x56, 0x02, 0x55, 0x3D, 0x19, 0xF8, 0x00, 0x02, 0x0E, 0x38, 0x63, 0xFB, 0x81, 0x02, 0x76, 0x4C,
+    0x21, 0xF8, 0x00, 0x03, 0x0E, 0x38, 0x63, 0x8D, 0xFD, 0xA5, 0x03, 0xA1, 0x76, 0x4C, 0x21, 0xF8, 0x00, 0x02, 0x0E, 0x38,
+    0x63, 0xFB, 0x7B, 0x02, 0x75, 0x4B, 0x21, 0xF8, 0x00, 0x02, 0x04, 0x2A, 0x48, 0xFB, 0x50, 0x02, 0x4F, 0x39, 0x16, 0xF7,
+    0x00, 0x01, 0x0D, 0x21, 0xFB, 0x26, 0x01, 0x25, 0x18, 0x81, 0x00, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x81, 0x00,
+    0x81, 0x00, 0xEA, 0x00, 0xFD, 0x03, 0xF2, 0x00, 0x02, 0x02, 0x1E, 0x2D, 0xFE, 0x2E, 0x01, 0x27, 0x0F, 0xF4, 0x00, 0x02,
+    0x19, 0x3E, 0x57, 0xFE, 0x58, 0x02, 0x4B, 0x29, 0x02, 0xF5, 0x00, 0x02, 0x21, 0x4B, 0x76, 0xFE, 0x83, 0x02, 0x5D, 0x32,
+    0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0, 0xAD, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0,
+    0xB2, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0x95, 0x95, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x02,
+    0x1E, 0x47, 0x68, 0xFE, 0x6A, 0x02, 0x57, 0x2F, 0x06, 0xF5, 0x00, 0x02, 0x0D, 0x2D, 0x3F, 0xFE, 0x40, 0x01, 0x37, 0x1B,
+    0xF3, 0x00, 0x00, 0x09, 0xFD, 0x15, 0x00, 0x10, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00, 0xF8, 0x00, 0x01, 0x0A, 0x22, 0xFE,
+    0x2A, 0x01, 0x23, 0x0B, 0xF3, 0x00, 0x01, 0x23, 0x46, 0xFE, 0x55, 0x01, 0x47, 0x26, 0xF4, 0x00, 0x02, 0x0F, 0x36, 0x5C,
+    0xFE, 0x7F, 0x02, 0x5B, 0x31, 0x06, 0xF5, 0x00, 0x07, 0x21, 0x48, 0x6E, 0x95, 0x9A, 0x73, 0x4D, 0x26, 0xF5, 0x00, 0x08,
+    0x0D, 0x33, 0x5A, 0x80, 0xA7, 0x88, 0x61, 0x3B, 0x14, 0xF5, 0x00, 0x08, 0x1F, 0x45, 0x6C, 0x92, 0x9C, 0x76, 0x4F, 0x29,
+    0x02, 0xF6, 0x00, 0x08, 0x0A, 0x31, 0x57, 0x7E, 0xA4, 0x8A, 0x64, 0x3D, 0x17, 0xF5, 0x00, 0x08, 0x1C, 0x43, 0x69, 0x90,
+    0x9F, 0x78, 0x52, 0x2B, 0x05, 0xF6, 0x00, 0x08, 0x08, 0x2E, 0x55, 0x7B, 0xA2, 0x8D, 0x66, 0x40, 0x19, 0xF5, 0x00, 0x08,
+    0x1A, 0x40, 0x67, 0x8D, 0xA1, 0x7B, 0x54, 0x2E, 0x07, 0xF6, 0x00, 0x08, 0x05, 0x2C, 0x52, 0x79, 0x9F, 0x8F, 0x69, 0x42,
+    0x1C, 0xF5, 0x00, 0x08, 0x17, 0x3E, 0x64, 0x8B, 0xA4, 0x7D, 0x57, 0x30, 0x0A, 0xF6, 0x00, 0x08, 0x03, 0x29, 0x50, 0x76,
+    0x9D, 0x92, 0x6B, 0x45, 0x1E, 0xF5, 0x00, 0x08, 0x15, 0x3B, 0x62, 0x88, 0xA6, 0x80, 0x59, 0x33, 0x0C, 0xF5, 0x00, 0x07,
+    0x27, 0x4D, 0x74, 0x9A, 0x94, 0x6E, 0x47, 0x21, 0xF5, 0x00, 0x08, 0x12, 0x39, 0x5F, 0x86, 0xA9, 0x82, 0x5C, 0x35, 0x0F,
+    0xF5, 0x00, 0x07, 0x24, 0x4B, 0x71, 0x98, 0x97, 0x70, 0x4A, 0x23, 0xF5, 0x00, 0x08, 0x10, 0x36, 0x5D, 0x83, 0xAA, 0x85,
+    0x5E, 0x38, 0x11, 0xF5, 0x00, 0x07, 0x22, 0x48, 0x6F, 0x95, 0x99, 0x73, 0x4C, 0x26, 0xF5, 0x00, 0x08, 0x0D, 0x34, 0x5A,
+    0x81, 0xA7, 0x87, 0x61, 0x3A, 0x14, 0xF5, 0x00, 0x08, 0x1F, 0x46, 0x6C, 0x93, 0x9C, 0x75, 0x4F, 0x28, 0x02, 0xF6, 0x00,
+    0x08, 0x09, 0x31, 0x58, 0x7E, 0x9E, 0x8A, 0x64, 0x3D, 0x16, 0xF5, 0x00, 0x02, 0x0C, 0x37, 0x60, 0xFE, 0x74, 0x02, 0x52,
+    0x2B, 0x05, 0xF5, 0x00, 0x02, 0x01, 0x25, 0x42, 0xFE, 0x49, 0x01, 0x39, 0x18, 0xF3, 0x00, 0x01, 0x07, 0x1A, 0xFE, 0x1F,
+    0x00, 0x15, 0xA0, 0x00, 0x90, 0x00, 0x03, 0x06, 0x0B, 0x0D, 0x09, 0xF2, 0x00, 0x08, 0x11, 0x23, 0x2F, 0x36, 0x37, 0x33,
+    0x2A, 0x19, 0x05, 0xF6, 0x00, 0x0A, 0x1C, 0x35, 0x4A, 0x58, 0x60, 0x62, 0x5D, 0x51, 0x40, 0x28, 0x0C, 0xF8, 0x00, 0x0C,
+    0x1B, 0x3B, 0x58, 0x70, 0x82, 0x8B, 0x8C, 0x86, 0x78, 0x63, 0x48, 0x2A, 0x08, 0xFA, 0x00, 0x0D, 0x0E, 0x34, 0x56, 0x77,
+    0x93, 0xA9, 0x9B, 0x98, 0xA2, 0x9E, 0x84, 0x65, 0x43, 0x1F, 0xFA, 0x00, 0x0E, 0x22, 0x48, 0x6D, 0x91, 0xA7, 0x88, 0x72,
+    0x6E, 0x7C, 0x98, 0xA1, 0x7E, 0x59, 0x33, 0x0C, 0xFC, 0x00, 0x0F, 0x09, 0x31, 0x59, 0x80, 0xA7, 0x90, 0x6B, 0x4C, 0x44,
+    0x5C, 0x7F, 0xA5, 0x92, 0x6A, 0x42, 0x1B, 0xFC, 0x00, 0x0F, 0x13, 0x3C, 0x66, 0x8F, 0xA9, 0x80, 0x58, 0x31, 0x20, 0x46,
+    0x6E, 0x96, 0xA1, 0x78, 0x4F, 0x26, 0xFC, 0x00, 0x10, 0x1B, 0x45, 0x6F, 0x99, 0x9F, 0x75, 0x4B, 0x22, 0x24, 0x39, 0x62,
+    0x8C, 0xAC, 0x82, 0x58, 0x2E, 0x04, 0xFD, 0x00, 0x10, 0x22, 0x4C, 0x76, 0xA0, 0x99, 0x6E, 0x44, 0x4C, 0x4F, 0x43, 0x5B,
+    0x86, 0xB0, 0x89, 0x5F, 0x35, 0x0A, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA4, 0x95, 0x6A, 0x5B, 0x74, 0x79, 0x67, 0x57,
+    0x82, 0xAC, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x27, 0x52, 0x7C, 0xA7, 0x93, 0x68, 0x73, 0x97, 0xA2, 0x84, 0x5D,
+    0x80, 0xAA, 0x8F, 0x65, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x28, 0x52, 0x7D, 0xA7, 0x92, 0x68, 0x78, 0xA1, 0xB1, 0x8A, 0x61,
+    0x7F, 0xAA, 0x90, 0x65, 0x3B, 0x10, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7C, 0xA6, 0x93, 0x69, 0x68, 0x84, 0x8A, 0x75, 0x56,
+    0x80, 0xAB, 0x8F, 0x64, 0x3A, 0x0F, 0xFD, 0x00, 0x10, 0x24, 0x4E, 0x78, 0xA3, 0x96, 0x6C, 0x49, 0x5D, 0x60, 0x53, 0x59,
+    0x83, 0xAD, 0x8B, 0x61, 0x37, 0x0C, 0xFD, 0x00, 0x10, 0x1F, 0x49, 0x73, 0x9D, 0x9B, 0x71, 0x47, 0x33, 0x36, 0x34, 0x5E,
+    0x88, 0xB0, 0x86, 0x5C, 0x32, 0x08, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6B, 0x94, 0xA3, 0x7A, 0x51, 0x28, 0x16, 0x3E, 0x67,
+    0x90, 0xA7, 0x7E, 0x54, 0x2B, 0x01, 0xFD, 0x00, 0x0F, 0x0E, 0x37, 0x60, 0x88, 0xAE, 0x87, 0x60, 0x3C, 0x2F, 0x4F, 0x75,
+    0x9D, 0x9A, 0x72, 0x4A, 0x21, 0xFC, 0x00, 0x0F, 0x02, 0x2A, 0x51, 0x78, 0x9E, 0x99, 0x77, 0x5D, 0x58, 0x6A, 0x8A, 0xAE,
+    0x89, 0x63, 0x3B, 0x14, 0xFB, 0x00, 0x0E, 0x19, 0x3F, 0x63, 0x86, 0xA4, 0x97, 0x85, 0x82, 0x8E, 0xA6, 0x94, 0x72, 0x4F,
+    0x2A, 0x04, 0xFB, 0x00, 0x0D, 0x05, 0x28, 0x4A, 0x68, 0x83, 0x96, 0xA1, 0xA2, 0x9C, 0x8D, 0x75, 0x58, 0x37, 0x15, 0xF9,
+    0x00, 0x0B, 0x0E, 0x2C, 0x48, 0x5E, 0x6E, 0x77, 0x78, 0x73, 0x66, 0x52, 0x39, 0x1C, 0xF7, 0x00, 0x09, 0x0D, 0x24, 0x37,
+    0x45, 0x4C, 0x4D, 0x49, 0x3F, 0x2E, 0x17, 0xF4, 0x00, 0x06, 0x10, 0x1C, 0x22, 0x23, 0x20, 0x16, 0x07, 0x81, 0x00, 0xFC,
+    0x00, 0x81, 0x00, 0xFE, 0x00, 0x08, 0x05, 0x0E, 0x17, 0x20, 0x29, 0x2A, 0x2A, 0x29, 0x1A, 0xF6, 0x00, 0x0A, 0x1D, 0x2E,
+    0x37, 0x41, 0x4A, 0x53, 0x55, 0x55, 0x53, 0x39, 0x14, 0xF8, 0x00, 0x0B, 0x14, 0x3A, 0x57, 0x61, 0x6A, 0x73, 0x7C, 0x7F,
+    0x7F, 0x72, 0x48, 0x1D, 0xF8, 0x00, 0x0B, 0x1A, 0x45, 0x6F, 0x8A, 0x94, 0x9D, 0xA6, 0xAA, 0x9D, 0x72, 0x48, 0x1D, 0xF8,
+    0x00, 0x0B, 0x1A, 0x45, 0x6F, 0x9A, 0x9B, 0x92, 0x88, 0x9C, 0x9D, 0x72, 0x48, 0x1D, 0xF8, 0x00, 0x0B, 0x1A, 0x45, 0x6F,
+    0x7B, 0x72, 0x68, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D, 0xF8, 0x00, 0x0B, 0x12, 0x38, 0x53, 0x51, 0x48, 0x46, 0x71, 0x9B,
+    0x9D, 0x72, 0x48, 0x1D, 0xF7, 0x00, 0x0A, 0x19, 0x2A, 0x28, 0x1F, 0x46, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00,
+    0x07, 0x1C, 0x46, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x1C, 0x46, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D,
+    0xF4, 0x00, 0x07, 0x1C, 0x46, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x1C, 0x46, 0x71, 0x9B, 0x9D, 0x72,
+    0x48, 0x1D, 0xF4, 0x00, 0x07, 0x1C, 0x46, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x1C, 0x46, 0x71, 0x9B,
+    0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x1C, 0x46, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D, 0xF6, 0x00, 0x0B, 0x11, 0x15,
+    0x1C, 0x46, 0x71, 0x9B, 0x9D, 0x72, 0x48, 0x1D, 0x15, 0x11, 0xF9, 0x00, 0x0D, 0x20, 0x39, 0x3F, 0x3F, 0x46, 0x71, 0x9B,
+    0x9D, 0x72, 0x48, 0x3F, 0x3F, 0x39, 0x20, 0xFB, 0x00, 0x02, 0x0C, 0x36, 0x5C, 0xFE, 0x6A, 0x03, 0x71, 0x9B, 0x9D, 0x72,
+    0xFE, 0x6A, 0x02, 0x5B, 0x35, 0x0C, 0xFC, 0x00, 0x03, 0x0E, 0x39, 0x63, 0x8E, 0xFE, 0x94, 0x01, 0xA2, 0xA3, 0xFE, 0x94,
+    0x03, 0x8D, 0x63, 0x38, 0x0E, 0xFC, 0x00, 0x03, 0x0E, 0x39, 0x63, 0x8E, 0xF9, 0x95, 0x03, 0x8D, 0x63, 0x38, 0x0E, 0xFC,
+    0x00, 0x02, 0x0C, 0x36, 0x5C, 0xF7, 0x6A, 0x02, 0x5C, 0x35, 0x0C, 0xFB, 0x00, 0x01, 0x20, 0x3A, 0xF7, 0x40, 0x01, 0x3A,
+    0x20, 0xF9, 0x00, 0x00, 0x12, 0xF7, 0x15, 0x00, 0x11, 0x81, 0x00, 0x01, 0x00, 0x00, 0x91, 0x00, 0x04, 0x05, 0x0B, 0x0D,
+    0x0C, 0x06, 0xF4, 0x00, 0x0A, 0x0A, 0x19, 0x25, 0x2F, 0x35, 0x38, 0x36, 0x30, 0x26, 0x16, 0x02, 0xF8, 0x00, 0x0C, 0x1C,
+    0x31, 0x41, 0x4E, 0x59, 0x60, 0x62, 0x61, 0x5A, 0x4E, 0x3C, 0x26, 0x0C, 0xFA, 0x00, 0x0E, 0x12, 0x39, 0x57, 0x68, 0x77,
+    0x82, 0x8A, 0x8D, 0x8B, 0x83, 0x75, 0x61, 0x48, 0x2B, 0x0A, 0xFB, 0x00, 0x0E, 0x19, 0x43, 0x6E, 0x90, 0x9F, 0xAA, 0xA0,
+    0x9D, 0x9F, 0xAB, 0x9B, 0x84, 0x67, 0x46, 0x23, 0xFB, 0x00, 0x0F, 0x19, 0x43, 0x6E, 0x98, 0x90, 0x81, 0x77, 0x72, 0x75,
+    0x84, 0x9E, 0xA3, 0x81, 0x5C, 0x36, 0x0E, 0xFC, 0x00, 0x0F, 0x19, 0x43, 0x6E, 0x7C, 0x69, 0x59, 0x4D, 0x48, 0x4C, 0x62,
+    0x83, 0xA9, 0x95, 0x6D, 0x44, 0x1A, 0xFC, 0x00, 0x0F, 0x14, 0x3B, 0x5A, 0x57, 0x43, 0x31, 0x24, 0x1D, 0x26, 0x4B, 0x73,
+    0x9D, 0x9F, 0x75, 0x4B, 0x20, 0xFB, 0x00, 0x0E, 0x1F, 0x33, 0x31, 0x1D, 0x0A, 0x00, 0x00, 0x1B, 0x46, 0x70, 0x9B, 0xA0,
+    0x76, 0x4C, 0x21, 0xFA, 0x00, 0x01, 0x09, 0x08, 0xFE, 0x00, 0x08, 0x06, 0x2A, 0x50, 0x78, 0xA1, 0x98, 0x6F, 0x46, 0x1C,
+    0xF5, 0x00, 0x08, 0x1F, 0x41, 0x64, 0x88, 0xAD, 0x88, 0x61, 0x3A, 0x11, 0xF6, 0x00, 0x09, 0x1A, 0x39, 0x5A, 0x7C, 0x9F,
+    0x95, 0x72, 0x4E, 0x29, 0x02, 0xF7, 0x00, 0x09, 0x17, 0x36, 0x56, 0x75, 0x96, 0x9C, 0x7C, 0x5A, 0x38, 0x14, 0xF7, 0x00,
+    0x09, 0x14, 0x34, 0x53, 0x72, 0x92, 0xA0, 0x80, 0x60, 0x40, 0x1F, 0xF7, 0x00, 0x0A, 0x12, 0x31, 0x50, 0x70, 0x8F, 0xA2,
+    0x83, 0x64, 0x44, 0x24, 0x04, 0xF8, 0x00, 0x0A, 0x10, 0x2F, 0x4E, 0x6D, 0x8C, 0xA4, 0x85, 0x66, 0x47, 0x28, 0x08, 0xF8,
+    0x00, 0x09, 0x0F, 0x2E, 0x4C, 0x6B, 0x8A, 0xA6, 0x87, 0x68, 0x49, 0x2A, 0xFE, 0x15, 0x00, 0x0B, 0xFB, 0x00, 0x08, 0x0B,
+    0x2C, 0x4B, 0x6A, 0x89, 0xA7, 0x89, 0x6A, 0x4B, 0xFC, 0x3F, 0x01, 0x30, 0x12, 0xFC, 0x00, 0x06, 0x1C, 0x45, 0x68, 0x87,
+    0xA6, 0x8A, 0x6C, 0xFA, 0x6A, 0x01, 0x4C, 0x24, 0xFC, 0x00, 0x04, 0x1F, 0x49, 0x74, 0x9E, 0xAA, 0xF9, 0x94, 0x02, 0x7C,
+    0x51, 0x27, 0xFC, 0x00, 0x02, 0x1F, 0x49, 0x74, 0xF7, 0x95, 0x02, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x02, 0x1C, 0x45, 0x67,
+    0xF6, 0x6A, 0x01, 0x4D, 0x24, 0xFC, 0x00, 0x02, 0x0B, 0x2C, 0x3F, 0xF6, 0x40, 0x01, 0x31, 0x12, 0xFB, 0x00, 0x00, 0x08,
+    0xF5, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x00, 0x00, 0x91, 0x00, 0x04, 0x06, 0x0B, 0x0D, 0x0C, 0x07, 0xF5, 0x00, 0x0B,
+    0x03, 0x14, 0x1F, 0x28, 0x30, 0x35, 0x38, 0x36, 0x31, 0x27, 0x18, 0x04, 0xF8, 0x00, 0x0C, 0x23, 0x3D, 0x48, 0x52, 0x5A,
+    0x60, 0x62, 0x61, 0x5A, 0x4F, 0x3E, 0x28, 0x0E, 0xFA, 0x00, 0x0E, 0x0E, 0x38, 0x5F, 0x71, 0x7B, 0x84, 0x8A, 0x8D, 0x8B,
+    0x84, 0x76, 0x63, 0x4A, 0x2D, 0x0C, 0xFB, 0x00, 0x0E, 0x10, 0x3A, 0x65, 0x8F, 0xA5, 0xA5, 0x9F, 0x9C, 0x9F, 0xA9, 0x9D,
+    0x86, 0x69, 0x48, 0x24, 0xFB, 0x00, 0x0F, 0x10, 0x3A, 0x65, 0x8F, 0x86, 0x7C, 0x75, 0x72, 0x75, 0x82, 0x99, 0xA5, 0x83,
+    0x5E, 0x37, 0x0F, 0xFC, 0x00, 0x0F, 0x0E, 0x38, 0x60, 0x6B, 0x5D, 0x52, 0x4B, 0x47, 0x4B, 0x5D, 0x7E, 0xA4, 0x95, 0x6D,
+    0x43, 0x1A, 0xFC, 0x00, 0x0F, 0x01, 0x25, 0x3F, 0x43, 0x35, 0x29, 0x20, 0x1D, 0x23, 0x47, 0x70, 0x9A, 0x9E, 0x73, 0x49,
+    0x1E, 0xFB, 0x00, 0x03, 0x05, 0x17, 0x19, 0x17, 0xFE, 0x23, 0x07, 0x2A, 0x48, 0x71, 0x9B, 0x9C, 0x72, 0x48, 0x1E, 0xF9,
+    0x00, 0x0C, 0x18, 0x3A, 0x4D, 0x4E, 0x4E, 0x53, 0x64, 0x82, 0xA7, 0x8F, 0x68, 0x40, 0x17, 0xF9, 0x00, 0x0C, 0x25, 0x4F,
+    0x76, 0x78, 0x78, 0x7C, 0x89, 0x9F, 0x93, 0x77, 0x55, 0x30, 0x0A, 0xF9, 0x00, 0x0B, 0x25, 0x50, 0x7A, 0xA3, 0xA3, 0xA6,
+    0x99, 0x80, 0x6F, 0x58, 0x3B, 0x1A, 0xF8, 0x00, 0x0C, 0x25, 0x50, 0x7A, 0x85, 0x85, 0x89, 0x94, 0x9D, 0x8A, 0x70, 0x52,
+    0x2F, 0x0B, 0xF9, 0x00, 0x01, 0x1E, 0x43, 0xFE, 0x5A, 0x07, 0x5F, 0x6E, 0x87, 0xA7, 0x8D, 0x6A, 0x44, 0x1D, 0xF9, 0x00,
+    0x0C, 0x07, 0x22, 0x2F, 0x30, 0x30, 0x36, 0x4B, 0x6D, 0x93, 0xA3, 0x7B, 0x52, 0x29, 0xFB, 0x00, 0x03, 0x07, 0x10, 0x0A,
+    0x00, 0xFE, 0x05, 0x08, 0x0F, 0x35, 0x5F, 0x89, 0xAE, 0x84, 0x5A, 0x2F, 0x05, 0xFD, 0x00, 0x10, 0x0F, 0x2C, 0x3B, 0x31,
+    0x1F, 0x11, 0x09, 0x07, 0x10, 0x36, 0x5F, 0x89, 0xAF, 0x85, 0x5A, 0x30, 0x06, 0xFD, 0x00, 0x10, 0x22, 0x4A, 0x65, 0x57,
+    0x47, 0x3A, 0x33, 0x31, 0x37, 0x4C, 0x6D, 0x93, 0xA9, 0x7F, 0x56, 0x2C, 0x02, 0xFD, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0x7E,
+    0x6F, 0x64, 0x5D, 0x5C, 0x61, 0x6F, 0x88, 0xA8, 0x98, 0x72, 0x4A, 0x22, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA5, 0x98,
+    0x8D, 0x87, 0x86, 0x8A, 0x96, 0xA9, 0x9C, 0x7F, 0x5D, 0x39, 0x13, 0xFC, 0x00, 0x0E, 0x26, 0x51, 0x7B, 0x8A, 0x94, 0x9C,
+    0xA1, 0xA3, 0xA1, 0x9A, 0x8D, 0x7A, 0x61, 0x43, 0x22, 0xFB, 0x00, 0x0E, 0x1C, 0x3F, 0x55, 0x61, 0x6B, 0x72, 0x77, 0x79,
+    0x77, 0x71, 0x65, 0x55, 0x3F, 0x25, 0x07, 0xFB, 0x00, 0x0D, 0x03, 0x1D, 0x2C, 0x38, 0x41, 0x48, 0x4D, 0x4E, 0x4D, 0x47,
+    0x3D, 0x2F, 0x1B, 0x03, 0xF8, 0x00, 0x09, 0x04, 0x0F, 0x18, 0x1E, 0x22, 0x24, 0x22, 0x1D, 0x14, 0x07, 0x81, 0x00, 0xFC,
+    0x00, 0x81, 0x00, 0xFA, 0x00, 0x01, 0x0F, 0x25, 0xFE, 0x2A, 0x01, 0x27, 0x14, 0xF4, 0x00, 0x02, 0x07, 0x2B, 0x4B, 0xFE,
+    0x55, 0x02, 0x4F, 0x32, 0x0C, 0xF5, 0x00, 0x02, 0x1E, 0x41, 0x65, 0xFE, 0x7F, 0x02, 0x69, 0x3E, 0x14, 0xF6, 0x00, 0x09,
+    0x10, 0x34, 0x58, 0x7C, 0xA0, 0xAA, 0x93, 0x69, 0x3E, 0x14, 0xF7, 0x00, 0x0A, 0x03, 0x27, 0x4B, 0x6F, 0x93, 0x88, 0xA6,
+    0x93, 0x69, 0x3E, 0x14, 0xF7, 0x00, 0x0A, 0x1A, 0x3E, 0x62, 0x86, 0x96, 0x7B, 0xA5, 0x93, 0x69, 0x3E, 0x14, 0xF8, 0x00,
+    0x0B, 0x0D, 0x31, 0x55, 0x79, 0x9C, 0x80, 0x7B, 0xA5, 0x93, 0x69, 0x3E, 0x14, 0xF8, 0x00, 0x0B, 0x24, 0x48, 0x6B, 0x8F,
+    0x8F, 0x6A, 0x7B, 0xA5, 0x93, 0x69, 0x3E, 0x14, 0xF9, 0x00, 0x0C, 0x17, 0x3A, 0x5E, 0x82, 0x9D, 0x79, 0x54, 0x7B, 0xA5,
+    0x93, 0x69, 0x3E, 0x14, 0xFA, 0x00, 0x0D, 0x09, 0x2D, 0x51, 0x75, 0x99, 0x88, 0x63, 0x50, 0x7B, 0xA5, 0x93, 0x69, 0x3E,
+    0x14, 0xFA, 0x00, 0x0D, 0x20, 0x44, 0x68, 0x8C, 0x96, 0x72, 0x4D, 0x50, 0x7B, 0xA5, 0x93, 0x69, 0x3E, 0x14, 0xFB, 0x00,
+    0x0F, 0x13, 0x37, 0x5B, 0x7F, 0xA3, 0x81, 0x5C, 0x38, 0x50, 0x7B, 0xA5, 0x93, 0x69, 0x3E, 0x19, 0x0D, 0xFD, 0x00, 0x11,
+    0x04, 0x2A, 0x4E, 0x72, 0x96, 0x8F, 0x6B, 0x46, 0x44, 0x50, 0x7B, 0xA5, 0x93, 0x69, 0x44, 0x43, 0x31, 0x11, 0xFE, 0x00,
+    0x05, 0x0D, 0x37, 0x62, 0x88, 0x9E, 0x7A, 0xFD, 0x6E, 0x07, 0x7B, 0xA5, 0x93, 0x6E, 0x6E, 0x6C, 0x4A, 0x20, 0xFE, 0x00,
+    0x04, 0x0D, 0x37, 0x62, 0x8C, 0xA3, 0xFB, 0x99, 0x06, 0xAD, 0xA0, 0x99, 0x99, 0x77, 0x4D, 0x22, 0xFE, 0x00, 0x03, 0x0D,
+    0x37, 0x62, 0x8C, 0xFA, 0x8D, 0x06, 0xA8, 0x98, 0x8D, 0x8D, 0x77, 0x4D, 0x22, 0xFE, 0x00, 0x02, 0x09, 0x32, 0x56, 0xFA,
+    0x63, 0x07, 0x7B, 0xA5, 0x93, 0x69, 0x63, 0x62, 0x45, 0x1E, 0xFD, 0x00, 0x01, 0x1A, 0x33, 0xFB, 0x38, 0x08, 0x50, 0x7B,
+    0xA5, 0x93, 0x69, 0x3E, 0x38, 0x28, 0x0A, 0xFC, 0x00, 0x00, 0x0A, 0xFC, 0x0E, 0x08, 0x26, 0x50, 0x7B, 0xA5, 0x93, 0x69,
+    0x3E, 0x14, 0x03, 0xF5, 0x00, 0x07, 0x26, 0x50, 0x7B, 0x95, 0x93, 0x69, 0x3E, 0x14, 0xF4, 0x00, 0x01, 0x23, 0x4C, 0xFE,
+    0x6A, 0x02, 0x60, 0x3B, 0x12, 0xF4, 0x00, 0x01, 0x11, 0x30, 0xFE, 0x40, 0x02, 0x3C, 0x24, 0x02, 0xF3, 0x00, 0x00, 0x0B,
+    0xFE, 0x15, 0x01, 0x13, 0x03, 0x81, 0x00, 0xFE, 0x00, 0x81, 0x00, 0x02, 0x00, 0x09, 0x22, 0xF7, 0x2A, 0x01, 0x1C, 0x01,
+    0xFA, 0x00, 0x01, 0x23, 0x45, 0xF8, 0x55, 0x02, 0x54, 0x3D, 0x18, 0xFB, 0x00, 0x02, 0x03, 0x2E, 0x58, 0xF8, 0x7F, 0x02,
+    0x76, 0x4C, 0x21, 0xFB, 0x00, 0x03, 0x03, 0x2E, 0x58, 0x83, 0xFA, 0xAA, 0x03, 0xA1, 0x76, 0x4C, 0x21, 0xFB, 0x00, 0x05,
+    0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0xFB, 0x7F, 0x02, 0x76, 0x4C, 0x21, 0xFB, 0x00, 0x06, 0x03, 0x2E, 0x58, 0x83, 0xAD,
+    0x83, 0x58, 0xFC, 0x55, 0x02, 0x54, 0x3D, 0x18, 0xFB, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x2C,
+    0xFD, 0x2A, 0x01, 0x1C, 0x01, 0xFB, 0x00, 0x0D, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x58, 0x56, 0x50, 0x44, 0x33,
+    0x1C, 0x02, 0xFA, 0x00, 0x0E, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x7E, 0x82, 0x80, 0x79, 0x6B, 0x57, 0x3E, 0x22, 0x02,
+    0xFB, 0x00, 0x0E, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x9E, 0xA7, 0xA8, 0xAA, 0xA1, 0x91, 0x7A, 0x5E, 0x3E, 0x1C, 0xFB, 0x00,
+    0x0F, 0x03, 0x2E, 0x58, 0x83, 0x8D, 0x82, 0x7D, 0x7D, 0x84, 0x94, 0xAB, 0x9A, 0x7A, 0x56, 0x32, 0x0B, 0xFC, 0x00, 0x0F,
+    0x03, 0x2D, 0x57, 0x76, 0x65, 0x59, 0x53, 0x53, 0x5C, 0x70, 0x8D, 0xAF, 0x90, 0x6A, 0x42, 0x1A, 0xFB, 0x00, 0x0E, 0x1F,
+    0x3F, 0x4C, 0x3D, 0x2F, 0x28, 0x29, 0x35, 0x51, 0x75, 0x9C, 0xA0, 0x77, 0x4E, 0x24, 0xFB, 0x00, 0x0E, 0x03, 0x1A, 0x22,
+    0x17, 0x06, 0x00, 0x00, 0x16, 0x3E, 0x68, 0x91, 0xA9, 0x7F, 0x54, 0x2A, 0xFB, 0x00, 0x02, 0x03, 0x0D, 0x08, 0xFD, 0x00,
+    0x08, 0x0F, 0x3A, 0x64, 0x8F, 0xAB, 0x80, 0x56, 0x2C, 0x01, 0xFD, 0x00, 0x0F, 0x0A, 0x28, 0x37, 0x30, 0x1D, 0x0F, 0x08,
+    0x08, 0x1A, 0x40, 0x69, 0x93, 0xA7, 0x7D, 0x53, 0x29, 0xFC, 0x00, 0x0F, 0x1F, 0x46, 0x61, 0x55, 0x45, 0x38, 0x32, 0x32,
+    0x3C, 0x56, 0x78, 0x9F, 0x9D, 0x74, 0x4B, 0x22, 0xFC, 0x00, 0x0F, 0x23, 0x4E, 0x78, 0x7C, 0x6D, 0x62, 0x5C, 0x5C, 0x64,
+    0x76, 0x92, 0xAE, 0x8B, 0x65, 0x3E, 0x16, 0xFC, 0x00, 0x0F, 0x23, 0x4E, 0x78, 0xA3, 0x95, 0x8C, 0x87, 0x87, 0x8D, 0x9B,
+    0xAB, 0x91, 0x72, 0x50, 0x2C, 0x06, 0xFC, 0x00, 0x0E, 0x23, 0x4E, 0x78, 0x8F, 0x99, 0x9F, 0xA2, 0xA3, 0x9F, 0x96, 0x86,
+    0x70, 0x55, 0x36, 0x15, 0xFB, 0x00, 0x0D, 0x1B, 0x40, 0x59, 0x66, 0x6F, 0x75, 0x78, 0x78, 0x75, 0x6D, 0x5F, 0x4C, 0x35,
+    0x19, 0xFA, 0x00, 0x0C, 0x04, 0x20, 0x31, 0x3D, 0x45, 0x4B, 0x4E, 0x4E, 0x4B, 0x44, 0x38, 0x28, 0x12, 0xF7, 0x00, 0x08,
+    0x08, 0x13, 0x1B, 0x20, 0x23, 0x23, 0x21, 0x1B, 0x10, 0x81, 0x00, 0xFB, 0x00, 0x8F, 0x00, 0x04, 0x07, 0x0C, 0x0D, 0x0A,
+    0x03, 0xF4, 0x00, 0x09, 0x05, 0x19, 0x27, 0x31, 0x36, 0x38, 0x34, 0x2D, 0x22, 0x13, 0xF7, 0x00, 0x0B, 0x0F, 0x29, 0x3F,
+    0x4F, 0x5B, 0x60, 0x62, 0x5E, 0x56, 0x4A, 0x39, 0x1C, 0xF9, 0x00, 0x0D, 0x0F, 0x2F, 0x4B, 0x63, 0x77, 0x84, 0x8B, 0x8D,
+    0x88, 0x7F, 0x72, 0x56, 0x2E, 0x04, 0xFB, 0x00, 0x0E, 0x05, 0x29, 0x4B, 0x6B, 0x87, 0x9E, 0xA9, 0x9F, 0x9D, 0xA0, 0xA8,
+    0x84, 0x5A, 0x2F, 0x05, 0xFB, 0x00, 0x0E, 0x1A, 0x40, 0x64, 0x87, 0xA7, 0x96, 0x81, 0x75, 0x72, 0x77, 0x82, 0x84, 0x5A,
+    0x2F, 0x05, 0xFC, 0x00, 0x0F, 0x03, 0x2B, 0x52, 0x79, 0x9E, 0x97, 0x76, 0x5B, 0x4B, 0x48, 0x4D, 0x5A, 0x6D, 0x56, 0x2D,
+    0x03, 0xFC, 0x00, 0x0E, 0x10, 0x38, 0x61, 0x89, 0xA8, 0x81, 0x5C, 0x3A, 0x2D, 0x2B, 0x25, 0x33, 0x43, 0x38, 0x1B, 0xFB,
+    0x00, 0x0D, 0x19, 0x43, 0x6C, 0x96, 0x9B, 0x72, 0x49, 0x54, 0x58, 0x56, 0x4E, 0x40, 0x2D, 0x15, 0xFA, 0x00, 0x0E, 0x20,
+    0x4B, 0x75, 0x9E, 0x91, 0x68, 0x6F, 0x7D, 0x82, 0x80, 0x77, 0x67, 0x50, 0x35, 0x16, 0xFB, 0x00, 0x0F, 0x25, 0x4F, 0x79,
+    0xA4, 0x8C, 0x79, 0x94, 0xA5, 0xA1, 0xA6, 0x9F, 0x8B, 0x71, 0x51, 0x2F, 0x0A, 0xFC, 0x00, 0x0F, 0x27, 0x51, 0x7C, 0xA6,
+    0x8A, 0x94, 0x8D, 0x7B, 0x77, 0x7D, 0x91, 0xAD, 0x8D, 0x69, 0x44, 0x1D, 0xFC, 0x00, 0x10, 0x28, 0x52, 0x7D, 0xA7, 0x9D,
+    0x8F, 0x6D, 0x53, 0x4C, 0x56, 0x72, 0x96, 0xA3, 0x7C, 0x54, 0x2B, 0x02, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7C, 0xA6, 0xA5,
+    0x7D, 0x55, 0x31, 0x22, 0x37, 0x5E, 0x86, 0xB0, 0x88, 0x5F, 0x34, 0x0A, 0xFD, 0x00, 0x10, 0x24, 0x4E, 0x79, 0xA3, 0x9D,
+    0x73, 0x49, 0x1F, 0x01, 0x2B, 0x55, 0x7F, 0xA9, 0x8E, 0x64, 0x3A, 0x0F, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x9B,
+    0x71, 0x46, 0x1C, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x90, 0x65, 0x3B, 0x10, 0xFD, 0x00, 0x10, 0x19, 0x43, 0x6D, 0x96, 0x9F,
+    0x74, 0x4B, 0x21, 0x03, 0x2C, 0x56, 0x80, 0xAA, 0x8D, 0x63, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x10, 0x39, 0x62, 0x8B, 0xA8,
+    0x80, 0x59, 0x37, 0x2B, 0x3D, 0x62, 0x8A, 0xAE, 0x85, 0x5C, 0x33, 0x09, 0xFD, 0x00, 0x0F, 0x04, 0x2C, 0x54, 0x7B, 0xA0,
+    0x94, 0x73, 0x5C, 0x56, 0x5F, 0x79, 0x9B, 0x9D, 0x77, 0x50, 0x28, 0xFB, 0x00, 0x0E, 0x1C, 0x41, 0x66, 0x88, 0xA6, 0x95,
+    0x85, 0x80, 0x87, 0x99, 0xA4, 0x86, 0x64, 0x3F, 0x19, 0xFB, 0x00, 0x0E, 0x08, 0x2B, 0x4C, 0x6A, 0x83, 0x96, 0xA0, 0xA3,
+    0x9F, 0x95, 0x82, 0x68, 0x4A, 0x29, 0x05, 0xFA, 0x00, 0x0C, 0x11, 0x2E, 0x49, 0x5F, 0x6E, 0x76, 0x79, 0x75, 0x6C, 0x5D,
+    0x47, 0x2C, 0x0E, 0xF8, 0x00, 0x0A, 0x0E, 0x25, 0x37, 0x44, 0x4C, 0x4E, 0x4B, 0x44, 0x36, 0x23, 0x0C, 0xF5, 0x00, 0x06,
+    0x10, 0x1B, 0x21, 0x24, 0x21, 0x1A, 0x0E, 0x81, 0x00, 0xFC, 0x00, 0x81, 0x00, 0x01, 0x03, 0x1E, 0xF5, 0x2A, 0x01, 0x23,
+    0x0B, 0xFC, 0x00, 0x02, 0x1B, 0x3F, 0x54, 0xF6, 0x55, 0x01, 0x47, 0x26, 0xFC, 0x00, 0x02, 0x25, 0x50, 0x7A, 0xF6, 0x7F,
+    0x02, 0x5B, 0x31, 0x06, 0xFD, 0x00, 0x03, 0x25, 0x50, 0x7A, 0xA5, 0xF8, 0xAA, 0x03, 0x85, 0x5B, 0x31, 0x06, 0xFD, 0x00,
+    0x02, 0x25, 0x50, 0x7A, 0xF9, 0x7F, 0x04, 0x94, 0x9E, 0x76, 0x4F, 0x27, 0xFC, 0x00, 0x02, 0x1B, 0x3F, 0x54, 0xFA, 0x55,
+    0x05, 0x7B, 0xA3, 0x8F, 0x67, 0x40, 0x18, 0xFC, 0x00, 0x01, 0x03, 0x1E, 0xFB, 0x2A, 0x07, 0x3B, 0x63, 0x8B, 0xA8, 0x80,
+    0x58, 0x30, 0x09, 0xF5, 0x00, 0x07, 0x23, 0x4B, 0x73, 0x9A, 0x99, 0x71, 0x49, 0x21, 0xF5, 0x00, 0x08, 0x0B, 0x33, 0x5B,
+    0x82, 0xAA, 0x89, 0x62, 0x3A, 0x12, 0xF5, 0x00, 0x08, 0x1B, 0x43, 0x6A, 0x92, 0xA2, 0x7A, 0x53, 0x2B, 0x03, 0xF6, 0x00,
+    0x08, 0x03, 0x2B, 0x52, 0x7A, 0xA1, 0x93, 0x6B, 0x44, 0x1C, 0xF5, 0x00, 0x08, 0x13, 0x3A, 0x62, 0x89, 0xAC, 0x84, 0x5C,
+    0x35, 0x0D, 0xF5, 0x00, 0x07, 0x22, 0x4A, 0x71, 0x99, 0x9D, 0x75, 0x4D, 0x25, 0xF5, 0x00, 0x08, 0x0A, 0x32, 0x59, 0x81,
+    0xA8, 0x8E, 0x66, 0x3E, 0x16, 0xF5, 0x00, 0x08, 0x1A, 0x41, 0x69, 0x90, 0xA6, 0x7E, 0x57, 0x2F, 0x07, 0xF6, 0x00, 0x08,
+    0x02, 0x29, 0x51, 0x78, 0xA0, 0x97, 0x6F, 0x48, 0x20, 0xF5, 0x00, 0x08, 0x11, 0x39, 0x60, 0x88, 0xAF, 0x88, 0x60, 0x39,
+    0x11, 0xF5, 0x00, 0x08, 0x21, 0x48, 0x70, 0x97, 0xA1, 0x79, 0x51, 0x29, 0x02, 0xF6, 0x00, 0x08, 0x09, 0x30, 0x58, 0x7F,
+    0xA7, 0x92, 0x6A, 0x42, 0x1A, 0xF5, 0x00, 0x08, 0x17, 0x40, 0x67, 0x8F, 0x95, 0x83, 0x5B, 0x33, 0x0B, 0xF5, 0x00, 0x02,
+    0x17, 0x40, 0x64, 0xFE, 0x6A, 0x01, 0x4C, 0x24, 0xF4, 0x00, 0x02, 0x07, 0x28, 0x3D, 0xFE, 0x40, 0x01, 0x30, 0x11, 0xF3,
+    0x00, 0x01, 0x05, 0x14, 0xFE, 0x15, 0x00, 0x0B, 0x81, 0x00, 0xF9, 0x00, 0x90, 0x00, 0x04, 0x07, 0x0C, 0x0D, 0x0A, 0x03,
+    0xF4, 0x00, 0x09, 0x05, 0x19, 0x28, 0x32, 0x37, 0x37, 0x34, 0x2C, 0x20, 0x0E, 0xF7, 0x00, 0x0B, 0x0E, 0x28, 0x3F, 0x50,
+    0x5B, 0x61, 0x62, 0x5E, 0x56, 0x47, 0x33, 0x1A, 0xF9, 0x00, 0x0D, 0x0A, 0x2C, 0x4A, 0x64, 0x78, 0x85, 0x8B, 0x8C, 0x88,
+    0x7E, 0x6D, 0x56, 0x3A, 0x1A, 0xFA, 0x00, 0x0E, 0x21, 0x46, 0x68, 0x86, 0x9E, 0xA3, 0x98, 0x96, 0x9C, 0xA6, 0x91, 0x76,
+    0x55, 0x32, 0x0C, 0xFC, 0x00, 0x0F, 0x0A, 0x32, 0x5A, 0x80, 0xA4, 0x99, 0x7D, 0x6E, 0x6B, 0x74, 0x8B, 0xAB, 0x91, 0x6B,
+    0x44, 0x1C, 0xFC, 0x00, 0x0F, 0x13, 0x3D, 0x67, 0x90, 0xAA, 0x82, 0x5D, 0x44, 0x41, 0x4F, 0x70, 0x98, 0xA3, 0x7A, 0x50,
+    0x26, 0xFC, 0x00, 0x0F, 0x17, 0x42, 0x6C, 0x96, 0xA2, 0x78, 0x4E, 0x24, 0x17, 0x3B, 0x65, 0x8F, 0xAA, 0x7F, 0x55, 0x2A,
+    0xFC, 0x00, 0x0F, 0x16, 0x40, 0x6A, 0x94, 0xA3, 0x79, 0x4F, 0x25, 0x1D, 0x3C, 0x66, 0x90, 0xA7, 0x7D, 0x53, 0x29, 0xFC,
+    0x00, 0x0F, 0x0E, 0x37, 0x5F, 0x86, 0xAB, 0x84, 0x61, 0x4B, 0x48, 0x54, 0x74, 0x9A, 0x97, 0x71, 0x49, 0x20, 0xFC, 0x00,
+    0x0F, 0x01, 0x27, 0x4D, 0x6F, 0x8E, 0x9D, 0x82, 0x74, 0x72, 0x7A, 0x90, 0x9A, 0x7E, 0x5C, 0x38, 0x12, 0xFB, 0x00, 0x0D,
+    0x12, 0x33, 0x52, 0x6C, 0x7F, 0x91, 0x9E, 0x9D, 0xA2, 0x85, 0x75, 0x5F, 0x42, 0x21, 0xFB, 0x00, 0x0F, 0x03, 0x28, 0x4B,
+    0x6A, 0x84, 0x98, 0x95, 0x8A, 0x88, 0x8F, 0x9E, 0x8E, 0x77, 0x59, 0x38, 0x14, 0xFC, 0x00, 0x0F, 0x15, 0x3C, 0x62, 0x86,
+    0xA6, 0x8B, 0x6F, 0x60, 0x5E, 0x67, 0x7E, 0x9D, 0x95, 0x73, 0x4E, 0x27, 0xFC, 0x00, 0x10, 0x21, 0x4A, 0x73, 0x9B, 0x9B,
+    0x73, 0x4F, 0x37, 0x33, 0x42, 0x63, 0x89, 0xAD, 0x85, 0x5D, 0x33, 0x0A, 0xFD, 0x00, 0x10, 0x27, 0x52, 0x7C, 0xA6, 0x92,
+    0x68, 0x3E, 0x15, 0x09, 0x2B, 0x55, 0x7F, 0xAA, 0x8F, 0x65, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x29, 0x53, 0x7E, 0xA8, 0x92,
+    0x67, 0x3D, 0x13, 0x02, 0x2A, 0x54, 0x7F, 0xA9, 0x91, 0x66, 0x3C, 0x11, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x79, 0xA3, 0x99,
+    0x71, 0x4B, 0x30, 0x2C, 0x3B, 0x5F, 0x87, 0xB0, 0x8C, 0x62, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x1D, 0x45, 0x6E, 0x94, 0xAA,
+    0x86, 0x69, 0x59, 0x56, 0x5F, 0x77, 0x99, 0xA5, 0x7F, 0x57, 0x2F, 0x06, 0xFD, 0x00, 0x0F, 0x0F, 0x35, 0x5B, 0x7E, 0x9D,
+    0xA5, 0x8E, 0x83, 0x81, 0x88, 0x99, 0xA8, 0x8B, 0x6A, 0x46, 0x20, 0xFB, 0x00, 0x0E, 0x20, 0x42, 0x60, 0x7B, 0x8E, 0x9B,
+    0xA2, 0xA3, 0x9F, 0x95, 0x84, 0x6C, 0x4F, 0x2F, 0x0C, 0xFB, 0x00, 0x0D, 0x06, 0x24, 0x3F, 0x56, 0x67, 0x72, 0x77, 0x78,
+    0x75, 0x6C, 0x5E, 0x4A, 0x31, 0x13, 0xF9, 0x00, 0x0B, 0x04, 0x1C, 0x30, 0x3E, 0x48, 0x4D, 0x4E, 0x4B, 0x43, 0x36, 0x25,
+    0x0F, 0xF6, 0x00, 0x07, 0x08, 0x15, 0x1E, 0x22, 0x23, 0x21, 0x1A, 0x0F, 0x81, 0x00, 0xFC, 0x00, 0x91, 0x00, 0x04, 0x01,
+    0x09, 0x0C, 0x0C, 0x08, 0xF3, 0x00, 0x09, 0x08, 0x1B, 0x2A, 0x33, 0x37, 0x36, 0x32, 0x28, 0x19, 0x04, 0xF7, 0x00, 0x0B,
+    0x11, 0x2B, 0x42, 0x52, 0x5D, 0x61, 0x61, 0x5B, 0x50, 0x3E, 0x28, 0x0C, 0xF9, 0x00, 0x0D, 0x0E, 0x30, 0x4D, 0x66, 0x7A,
+    0x87, 0x8C, 0x8B, 0x85, 0x77, 0x63, 0x48, 0x2A, 0x08, 0xFB, 0x00, 0x0E, 0x01, 0x26, 0x4A, 0x6B, 0x89, 0xA1, 0xA1, 0x98,
+    0x98, 0xA2, 0x9D, 0x84, 0x65, 0x44, 0x1F, 0xFB, 0x00, 0x0F, 0x11, 0x39, 0x60, 0x85, 0xA7, 0x94, 0x7A, 0x6D, 0x6E, 0x7C,
+    0x96, 0xA1, 0x7E, 0x59, 0x33, 0x0B, 0xFC, 0x00, 0x0F, 0x1E, 0x47, 0x70, 0x98, 0xA0, 0x7A, 0x58, 0x44, 0x44, 0x5A, 0x7C,
+    0xA1, 0x92, 0x6A, 0x42, 0x1A, 0xFC, 0x00, 0x0F, 0x26, 0x50, 0x7A, 0xA4, 0x94, 0x6A, 0x42, 0x1C, 0x1E, 0x42, 0x6A, 0x93,
+    0xA0, 0x77, 0x4E, 0x24, 0xFC, 0x00, 0x10, 0x2A, 0x54, 0x7F, 0xA9, 0x8E, 0x64, 0x39, 0x0F, 0x0E, 0x38, 0x62, 0x8D, 0xAA,
+    0x80, 0x56, 0x2C, 0x02, 0xFD, 0x00, 0x10, 0x2A, 0x55, 0x7F, 0xAA, 0x8E, 0x63, 0x39, 0x0E, 0x0D, 0x37, 0x62, 0x8C, 0xB1,
+    0x87, 0x5C, 0x32, 0x08, 0xFD, 0x00, 0x10, 0x27, 0x52, 0x7C, 0xA6, 0x91, 0x68, 0x3E, 0x15, 0x17, 0x3E, 0x67, 0x91, 0xB5,
+    0x8A, 0x60, 0x36, 0x0B, 0xFD, 0x00, 0x10, 0x21, 0x4A, 0x73, 0x9C, 0x9C, 0x74, 0x4F, 0x38, 0x39, 0x52, 0x76, 0x9C, 0xB7,
+    0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x10, 0x16, 0x3E, 0x65, 0x8B, 0xAE, 0x8B, 0x6F, 0x62, 0x62, 0x72, 0x8E, 0x88, 0xA5,
+    0x8D, 0x62, 0x38, 0x0D, 0xFD, 0x00, 0x10, 0x06, 0x2C, 0x51, 0x74, 0x93, 0xAA, 0x96, 0x8C, 0x8C, 0x97, 0x94, 0x7B, 0xA6,
+    0x8B, 0x61, 0x36, 0x0C, 0xFC, 0x00, 0x0F, 0x16, 0x38, 0x57, 0x72, 0x86, 0x93, 0x98, 0x96, 0x8A, 0x74, 0x7F, 0xA9, 0x87,
+    0x5D, 0x33, 0x09, 0xFB, 0x00, 0x0E, 0x1B, 0x36, 0x4E, 0x5F, 0x69, 0x6E, 0x6C, 0x62, 0x5C, 0x86, 0xAA, 0x81, 0x57, 0x2D,
+    0x04, 0xFB, 0x00, 0x0D, 0x1C, 0x2C, 0x27, 0x36, 0x3F, 0x43, 0x42, 0x43, 0x6A, 0x91, 0xA0, 0x77, 0x4E, 0x25, 0xFB, 0x00,
+    0x0E, 0x17, 0x3C, 0x55, 0x4D, 0x3C, 0x32, 0x32, 0x40, 0x5B, 0x7D, 0xA2, 0x91, 0x6A, 0x42, 0x19, 0xFB, 0x00, 0x0E, 0x1F,
+    0x4A, 0x74, 0x73, 0x64, 0x5D, 0x5D, 0x66, 0x7A, 0x97, 0xA1, 0x7D, 0x58, 0x32, 0x0B, 0xFB, 0x00, 0x0D, 0x1F, 0x4A, 0x74,
+    0x9A, 0x8E, 0x87, 0x87, 0x8E, 0x9E, 0xA2, 0x86, 0x66, 0x43, 0x1F, 0xFA, 0x00, 0x0D, 0x1F, 0x4A, 0x74, 0x90, 0x9B, 0xA2,
+    0xA2, 0x9D, 0x92, 0x7F, 0x66, 0x4A, 0x2A, 0x08, 0xFA, 0x00, 0x0C, 0x18, 0x3E, 0x59, 0x67, 0x72, 0x78, 0x78, 0x74, 0x6A,
+    0x5A, 0x45, 0x2A, 0x0E, 0xF9, 0x00, 0x0B, 0x03, 0x20, 0x32, 0x3F, 0x48, 0x4D, 0x4D, 0x4A, 0x41, 0x33, 0x20, 0x0A, 0xF6,
+    0x00, 0x07, 0x0A, 0x16, 0x1E, 0x23, 0x23, 0x20, 0x18, 0x0B, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00, 0x93, 0x00, 0x01, 0x1A,
+    0x28, 0xFE, 0x29, 0x01, 0x22, 0x0B, 0xF4, 0x00, 0x02, 0x17, 0x3B, 0x52, 0xFE, 0x53, 0x01, 0x47, 0x26, 0xF4, 0x00, 0x02,
+    0x21, 0x4B, 0x76, 0xFE, 0x7E, 0x02, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0, 0xA8, 0x87, 0x5D, 0x32,
+    0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0, 0xB2, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0x99,
+    0x99, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x02, 0x1F, 0x48, 0x6C, 0xFE, 0x6E, 0x02, 0x59, 0x30, 0x07, 0xF5, 0x00, 0x02,
+    0x0F, 0x30, 0x43, 0xFE, 0x44, 0x01, 0x3A, 0x1E, 0xF3, 0x00, 0x00, 0x0D, 0xFD, 0x19, 0x00, 0x14, 0xF3, 0x00, 0x02, 0x02,
+    0x1E, 0x2D, 0xFE, 0x2E, 0x01, 0x27, 0x0F, 0xF4, 0x00, 0x02, 0x19, 0x3E, 0x57, 0xFE, 0x58, 0x02, 0x4B, 0x29, 0x02, 0xF5,
+    0x00, 0x02, 0x21, 0x4B, 0x76, 0xFE, 0x83, 0x02, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0, 0xAD, 0x87,
+    0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0, 0xB2, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B,
+    0x76, 0x95, 0x95, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x02, 0x1E, 0x47, 0x68, 0xFE, 0x6A, 0x02, 0x57, 0x2F, 0x06, 0xF5,
+    0x00, 0x02, 0x0D, 0x2D, 0x3F, 0xFE, 0x40, 0x01, 0x37, 0x1B, 0xF3, 0x00, 0x00, 0x09, 0xFD, 0x15, 0x00, 0x10, 0x81, 0x00,
+    0xFB, 0x00, 0x81, 0x00, 0x93, 0x00, 0x01, 0x1A, 0x28, 0xFE, 0x29, 0x01, 0x22, 0x0B, 0xF4, 0x00, 0x02, 0x17, 0x3B, 0x52,
+    0xFE, 0x53, 0x01, 0x47, 0x26, 0xF4, 0x00, 0x02, 0x21, 0x4B, 0x76, 0xFE, 0x7E, 0x02, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08,
+    0x21, 0x4B, 0x76, 0xA0, 0xA8, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0, 0xB2, 0x87, 0x5D, 0x32,
+    0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0x99, 0x99, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x02, 0x1F, 0x48, 0x6C, 0xFE,
+    0x6E, 0x02, 0x59, 0x30, 0x07, 0xF5, 0x00, 0x02, 0x0F, 0x30, 0x43, 0xFE, 0x44, 0x01, 0x3A, 0x1E, 0xF3, 0x00, 0x00, 0x0D,
+    0xFD, 0x19, 0x00, 0x14, 0xF2, 0x00, 0x01, 0x1A, 0x2B, 0xFE, 0x2D, 0x01, 0x28, 0x13, 0xF4, 0x00, 0x02, 0x12, 0x38, 0x54,
+    0xFE, 0x57, 0x02, 0x4E, 0x2E, 0x07, 0xF5, 0x00, 0x02, 0x1A, 0x45, 0x6F, 0xFE, 0x82, 0x02, 0x63, 0x39, 0x0E, 0xF5, 0x00,
+    0x08, 0x1A, 0x45, 0x6F, 0x9A, 0xAC, 0x8E, 0x63, 0x39, 0x0E, 0xF5, 0x00, 0x08, 0x1A, 0x45, 0x6F, 0x9A, 0xB8, 0x8E, 0x63,
+    0x39, 0x0E, 0xF5, 0x00, 0x08, 0x24, 0x4D, 0x76, 0xA0, 0xA6, 0x80, 0x5A, 0x34, 0x0B, 0xF6, 0x00, 0x08, 0x06, 0x2F, 0x58,
+    0x81, 0xAA, 0x92, 0x6D, 0x47, 0x21, 0xF5, 0x00, 0x08, 0x10, 0x39, 0x63, 0x8C, 0xA5, 0x7F, 0x59, 0x33, 0x0E, 0xF5, 0x00,
+    0x07, 0x1B, 0x44, 0x6D, 0x96, 0x91, 0x6C, 0x46, 0x20, 0xF4, 0x00, 0x07, 0x21, 0x4B, 0x74, 0x7A, 0x7A, 0x58, 0x32, 0x0C,
+    0xF4, 0x00, 0x06, 0x15, 0x39, 0x4E, 0x4F, 0x4F, 0x40, 0x1F, 0xF2, 0x00, 0x05, 0x17, 0x24, 0x25, 0x25, 0x1C, 0x04, 0xB9,
+    0x00, 0x81, 0x00, 0xA1, 0x00, 0x04, 0x0E, 0x1E, 0x26, 0x1B, 0x02, 0xF4, 0x00, 0x07, 0x07, 0x17, 0x26, 0x36, 0x45, 0x50,
+    0x3E, 0x1B, 0xF6, 0x00, 0x09, 0x0F, 0x1F, 0x2E, 0x3E, 0x4E, 0x5D, 0x6D, 0x7A, 0x51, 0x27, 0xF9, 0x00, 0x0C, 0x08, 0x17,
+    0x27, 0x37, 0x46, 0x56, 0x66, 0x75, 0x85, 0x95, 0x7C, 0x52, 0x27, 0xFB, 0x00, 0x0E, 0x10, 0x20, 0x2F, 0x3F, 0x4F, 0x5E,
+    0x6E, 0x7E, 0x8D, 0x9D, 0xA6, 0x97, 0x7C, 0x52, 0x27, 0xFD, 0x00, 0x10, 0x14, 0x28, 0x38, 0x47, 0x57, 0x67, 0x76, 0x86,
+    0x95, 0xA5, 0x9C, 0x8D, 0x7E, 0x6F, 0x60, 0x47, 0x21, 0xFE, 0x00, 0x11, 0x0C, 0x32, 0x4F, 0x5F, 0x6F, 0x7E, 0x8E, 0x9E,
+    0xA1, 0x92, 0x83, 0x74, 0x65, 0x56, 0x47, 0x38, 0x28, 0x0C, 0xFE, 0x00, 0x10, 0x14, 0x3E, 0x69, 0x87, 0x96, 0xA6, 0x97,
+    0x88, 0x79, 0x6A, 0x5B, 0x4C, 0x3D, 0x2E, 0x1F, 0x10, 0x01, 0xFD, 0x00, 0x0D, 0x14, 0x3E, 0x69, 0x93, 0xA8, 0x7F, 0x70,
+    0x62, 0x53, 0x44, 0x35, 0x26, 0x17, 0x09, 0xFA, 0x00, 0x10, 0x14, 0x3E, 0x69, 0x85, 0x94, 0xA4, 0x98, 0x89, 0x7B, 0x6C,
+    0x5D, 0x4E, 0x3F, 0x30, 0x21, 0x13, 0x04, 0xFD, 0x00, 0x11, 0x0B, 0x31, 0x4D, 0x5D, 0x6D, 0x7D, 0x8C, 0x9C, 0xA2, 0x94,
+    0x85, 0x76, 0x67, 0x58, 0x49, 0x3A, 0x2A, 0x0D, 0xFD, 0x00, 0x10, 0x13, 0x26, 0x36, 0x45, 0x55, 0x65, 0x74, 0x84, 0x94,
+    0xA3, 0x9E, 0x8F, 0x80, 0x71, 0x62, 0x49, 0x22, 0xFB, 0x00, 0x0E, 0x0E, 0x1E, 0x2E, 0x3D, 0x4D, 0x5C, 0x6C, 0x7C, 0x8B,
+    0x9B, 0xA8, 0x99, 0x7C, 0x52, 0x27, 0xF9, 0x00, 0x0C, 0x06, 0x16, 0x25, 0x35, 0x45, 0x54, 0x64, 0x73, 0x83, 0x93, 0x7C,
+    0x52, 0x27, 0xF6, 0x00, 0x09, 0x0D, 0x1D, 0x2D, 0x3C, 0x4C, 0x5C, 0x6B, 0x78, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x05, 0x15,
+    0x24, 0x34, 0x44, 0x4E, 0x3C, 0x1A, 0xF1, 0x00, 0x03, 0x0C, 0x1C, 0x24, 0x19, 0x81, 0x00, 0xD6, 0x00, 0x81, 0x00, 0x82,
+    0x00, 0x00, 0x0F, 0xF4, 0x11, 0x00, 0x08, 0xFC, 0x00, 0x01, 0x21, 0x38, 0xF4, 0x3B, 0x01, 0x2D, 0x10, 0xFE, 0x00, 0x02,
+    0x11, 0x3A, 0x5D, 0xF4, 0x66, 0x01, 0x4B, 0x23, 0xFE, 0x00, 0x02, 0x14, 0x3E, 0x69, 0xF5, 0x90, 0x02, 0x7C, 0x52, 0x27,
+    0xFE, 0x00, 0x03, 0x14, 0x3E, 0x69, 0x93, 0xF6, 0x99, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02, 0x13, 0x3C, 0x63, 0xF4,
+    0x6E, 0x01, 0x4E, 0x25, 0xFE, 0x00, 0x02, 0x05, 0x28, 0x41, 0xF4, 0x46, 0x01, 0x36, 0x16, 0xFE, 0x00, 0x02, 0x13, 0x3D,
+    0x64, 0xF4, 0x70, 0x01, 0x4F, 0x26, 0xFE, 0x00, 0x03, 0x14, 0x3E, 0x69, 0x93, 0xF6, 0x9B, 0x02, 0x7C, 0x52, 0x27, 0xFE,
+    0x00, 0x02, 0x14, 0x3E, 0x69, 0xF5, 0x8F, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02, 0x11, 0x39, 0x5D, 0xF4, 0x65, 0x01,
+    0x4A, 0x23, 0xFD, 0x00, 0x01, 0x21, 0x37, 0xF4, 0x3A, 0x01, 0x2D, 0x0F, 0xFC, 0x00, 0x00, 0x0E, 0xF4, 0x10, 0x00, 0x07,
+    0x81, 0x00, 0xAC, 0x00, 0x81, 0x00, 0xAD, 0x00, 0x04, 0x11, 0x23, 0x24, 0x15, 0x06, 0xF2, 0x00, 0x07, 0x0A, 0x2F, 0x4B,
+    0x4C, 0x3D, 0x2D, 0x1E, 0x0E, 0xF4, 0x00, 0x0A, 0x14, 0x3E, 0x68, 0x74, 0x64, 0x55, 0x45, 0x35, 0x26, 0x16, 0x07, 0xF7,
+    0x00, 0x0C, 0x14, 0x3E, 0x69, 0x93, 0x8C, 0x7C, 0x6D, 0x5D, 0x4D, 0x3E, 0x2E, 0x1E, 0x0F, 0xF9, 0x00, 0x0F, 0x14, 0x3E,
+    0x69, 0x90, 0x9F, 0xA4, 0x94, 0x85, 0x75, 0x65, 0x56, 0x46, 0x36, 0x27, 0x17, 0x07, 0xFC, 0x00, 0x11, 0x0F, 0x37, 0x58,
+    0x68, 0x77, 0x86, 0x95, 0xA4, 0x9C, 0x8D, 0x7D, 0x6E, 0x5E, 0x4E, 0x3F, 0x2F, 0x1F, 0x05, 0xFD, 0x00, 0x10, 0x1C, 0x31,
+    0x40, 0x4F, 0x5E, 0x6D, 0x7C, 0x8B, 0x9A, 0xA5, 0x95, 0x85, 0x76, 0x66, 0x57, 0x41, 0x1D, 0xFC, 0x00, 0x0F, 0x0A, 0x19,
+    0x28, 0x37, 0x46, 0x55, 0x64, 0x73, 0x81, 0x90, 0x9F, 0x9D, 0x8E, 0x7C, 0x52, 0x27, 0xFA, 0x00, 0x0D, 0x02, 0x11, 0x20,
+    0x2E, 0x3D, 0x4C, 0x5B, 0x6A, 0x79, 0x95, 0xA7, 0x7C, 0x52, 0x27, 0xFC, 0x00, 0x0F, 0x0C, 0x1B, 0x2A, 0x39, 0x47, 0x56,
+    0x65, 0x74, 0x83, 0x92, 0xA0, 0x9B, 0x8C, 0x7B, 0x51, 0x27, 0xFD, 0x00, 0x10, 0x1E, 0x34, 0x43, 0x51, 0x60, 0x6F, 0x7E,
+    0x8D, 0x9C, 0xA3, 0x93, 0x84, 0x74, 0x64, 0x55, 0x3F, 0x1C, 0xFE, 0x00, 0x11, 0x10, 0x38, 0x5A, 0x6A, 0x79, 0x88, 0x97,
+    0xA6, 0x9B, 0x8B, 0x7B, 0x6C, 0x5C, 0x4C, 0x3D, 0x2D, 0x1D, 0x03, 0xFE, 0x00, 0x0F, 0x14, 0x3E, 0x69, 0x92, 0xA1, 0xA2,
+    0x92, 0x83, 0x73, 0x63, 0x54, 0x44, 0x35, 0x25, 0x15, 0x06, 0xFC, 0x00, 0x0C, 0x14, 0x3E, 0x69, 0x93, 0x8A, 0x7A, 0x6B,
+    0x5B, 0x4C, 0x3C, 0x2C, 0x1D, 0x0D, 0xF9, 0x00, 0x0A, 0x14, 0x3E, 0x68, 0x72, 0x63, 0x53, 0x43, 0x34, 0x24, 0x14, 0x05,
+    0xF7, 0x00, 0x07, 0x09, 0x2E, 0x4A, 0x4B, 0x3B, 0x2B, 0x1C, 0x0C, 0xF3, 0x00, 0x04, 0x0F, 0x21, 0x22, 0x13, 0x04, 0x81,
+    0x00, 0xCB, 0x00, 0x90, 0x00, 0x04, 0x06, 0x0C, 0x0D, 0x0B, 0x04, 0xF4, 0x00, 0x09, 0x08, 0x19, 0x26, 0x30, 0x36, 0x38,
+    0x35, 0x2D, 0x20, 0x0E, 0xF7, 0x00, 0x0B, 0x18, 0x2D, 0x40, 0x4F, 0x5A, 0x60, 0x62, 0x5F, 0x56, 0x48, 0x32, 0x19, 0xF9,
+    0x00, 0x0D, 0x12, 0x37, 0x53, 0x67, 0x77, 0x83, 0x8B, 0x8D, 0x89, 0x7F, 0x6D, 0x54, 0x37, 0x15, 0xFA, 0x00, 0x0E, 0x1B,
+    0x46, 0x70, 0x8C, 0x9F, 0xA2, 0x9B, 0x9A, 0xA3, 0xA6, 0x90, 0x73, 0x51, 0x2C, 0x06, 0xFB, 0x00, 0x0E, 0x1B, 0x46, 0x70,
+    0x9B, 0x89, 0x7A, 0x70, 0x70, 0x7C, 0x94, 0xAE, 0x8B, 0x64, 0x3C, 0x13, 0xFB, 0x00, 0x0E, 0x1B, 0x46, 0x70, 0x78, 0x63,
+    0x52, 0x46, 0x46, 0x58, 0x7B, 0xA2, 0x99, 0x6F, 0x45, 0x1B, 0xFB, 0x00, 0x0E, 0x16, 0x3D, 0x5B, 0x55, 0x3E, 0x2A, 0x1D,
+    0x1E, 0x48, 0x72, 0x9C, 0x9C, 0x72, 0x47, 0x1D, 0xFB, 0x00, 0x0E, 0x02, 0x20, 0x32, 0x2F, 0x1A, 0x04, 0x1D, 0x3B, 0x5A,
+    0x7D, 0xA4, 0x93, 0x6B, 0x42, 0x18, 0xF9, 0x00, 0x0C, 0x08, 0x06, 0x00, 0x1D, 0x3B, 0x59, 0x77, 0x96, 0xA0, 0x7F, 0x5B,
+    0x34, 0x0D, 0xF7, 0x00, 0x09, 0x17, 0x39, 0x59, 0x77, 0x95, 0xA1, 0x83, 0x64, 0x43, 0x20, 0xF7, 0x00, 0x0A, 0x07, 0x2D,
+    0x52, 0x75, 0x95, 0xA1, 0x83, 0x65, 0x47, 0x28, 0x08, 0xF7, 0x00, 0x09, 0x14, 0x3D, 0x65, 0x8C, 0xA7, 0x84, 0x65, 0x47,
+    0x29, 0x0B, 0xF6, 0x00, 0x08, 0x1C, 0x46, 0x70, 0x9A, 0x99, 0x6F, 0x49, 0x28, 0x0B, 0xF5, 0x00, 0x07, 0x1E, 0x49, 0x73,
+    0x9E, 0x95, 0x6B, 0x40, 0x16, 0xF4, 0x00, 0x07, 0x1E, 0x49, 0x73, 0x9E, 0x95, 0x6B, 0x40, 0x16, 0xF4, 0x00, 0x07, 0x1E,
+    0x48, 0x71, 0x77, 0x77, 0x69, 0x40, 0x16, 0xF4, 0x00, 0x07, 0x1F, 0x48, 0x68, 0x69, 0x69, 0x63, 0x3F, 0x17, 0xF4, 0x00,
+    0x07, 0x22, 0x4C, 0x77, 0x94, 0x94, 0x6E, 0x43, 0x19, 0xF4, 0x00, 0x07, 0x22, 0x4C, 0x77, 0xA1, 0x98, 0x6E, 0x43, 0x19,
+    0xF4, 0x00, 0x07, 0x22, 0x4C, 0x77, 0x95, 0x95, 0x6E, 0x43, 0x19, 0xF4, 0x00, 0x07, 0x1F, 0x48, 0x69, 0x6A, 0x6A, 0x64,
+    0x40, 0x17, 0xF4, 0x00, 0x07, 0x0E, 0x2E, 0x3F, 0x40, 0x40, 0x3D, 0x28, 0x07, 0xF3, 0x00, 0x00, 0x0A, 0xFE, 0x15, 0x01,
+    0x14, 0x05, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00, 0xE7, 0x00, 0x07, 0x06, 0x14, 0x1D, 0x22, 0x24, 0x21, 0x1A, 0x0D, 0xF6,
+    0x00, 0x0B, 0x05, 0x1B, 0x2E, 0x3C, 0x46, 0x4C, 0x4E, 0x4B, 0x43, 0x34, 0x21, 0x09, 0xF9, 0x00, 0x0D, 0x0C, 0x27, 0x40,
+    0x54, 0x64, 0x70, 0x77, 0x79, 0x75, 0x6B, 0x5B, 0x44, 0x29, 0x0A, 0xFB, 0x00, 0x0F, 0x0B, 0x2A, 0x48, 0x62, 0x79, 0x8C,
+    0x99, 0xA1, 0xA2, 0x9F, 0x93, 0x7F, 0x65, 0x46, 0x25, 0x01, 0xFD, 0x00, 0x10, 0x02, 0x24, 0x47, 0x66, 0x84, 0x9E, 0x93,
+    0x83, 0x7A, 0x78, 0x7E, 0x8F, 0xA1, 0x82, 0x60, 0x3B, 0x15, 0xFD, 0x00, 0x10, 0x17, 0x3D, 0x60, 0x82, 0xA2, 0x88, 0x6F,
+    0x5C, 0x50, 0x4E, 0x56, 0x6C, 0x8B, 0x9A, 0x74, 0x4D, 0x25, 0xFE, 0x00, 0x7F, 0x03, 0x2B, 0x50, 0x76, 0x9B, 0x8A, 0x6A,
+    0x4C, 0x37, 0x47, 0x50, 0x51, 0x50, 0x75, 0x9C, 0x82, 0x59, 0x30, 0x06, 0x00, 0x00, 0x12, 0x3A, 0x62, 0x8A, 0x99, 0x73,
+    0x50, 0x42, 0x5C, 0x6F, 0x7A, 0x7C, 0x73, 0x69, 0x93, 0x8A, 0x60, 0x36, 0x0B, 0x00, 0x00, 0x1D, 0x47, 0x70, 0x98, 0x89,
+    0x61, 0x3E, 0x60, 0x7E, 0x96, 0xA4, 0xA1, 0x9B, 0x83, 0x90, 0x8C, 0x62, 0x37, 0x0D, 0x00, 0x00, 0x27, 0x51, 0x7A, 0xA3,
+    0x7C, 0x53, 0x54, 0x79, 0x9B, 0x92, 0x7D, 0x77, 0x7F, 0x97, 0x97, 0x8C, 0x62, 0x37, 0x0D, 0x00, 0x03, 0x2D, 0x57, 0x81,
+    0x9E, 0x74, 0x4A, 0x64, 0x8C, 0x99, 0x74, 0x56, 0x4C, 0x5B, 0x7B, 0xA0, 0x8C, 0x62, 0x37, 0x0D, 0x00, 0x06, 0x30, 0x5B,
+    0x85, 0x99, 0x6F, 0x44, 0x6E, 0x98, 0x8B, 0x61, 0x3A, 0x22, 0x41, 0x69, 0x93, 0x8C, 0x62, 0x37, 0x0D, 0x00, 0x08, 0x32,
+    0x5D, 0x7F, 0x87, 0x98, 0x6D, 0x47, 0x71, 0x9C, 0x86, 0x5B, 0x31, 0x0F, 0x39, 0x64, 0x8E, 0x8C, 0x62, 0x37, 0x0D, 0x00,
+    0x06, 0x31, 0x5B, 0x86, 0x99, 0x6F, 0x45, 0x6F, 0x99, 0x89, 0x5F, 0x36, 0x18, 0x3E, 0x67, 0x91, 0x8C, 0x62, 0x37, 0x0D,
+    0x00, 0x04, 0x2E, 0x58, 0x82, 0x9D, 0x73, 0x49, 0x67, 0x90, 0x95, 0x6F, 0x4E, 0x42, 0x53, 0x76, 0x9C, 0x8C, 0x62, 0x37,
+    0x0D, 0x00, 0x00, 0x28, 0x52, 0x7C, 0xA4, 0x7B, 0x52, 0x58, 0x7E, 0xA1, 0x8A, 0x73, 0x6D, 0x76, 0x8F, 0x9E, 0x8C, 0x62,
+    0x37, 0x0D, 0x00, 0x00, 0x1F, 0x48, 0x71, 0x9A, 0x87, 0x60, 0x44, 0x66, 0x85, 0x9E, 0x9C, 0x97, 0x9E, 0x8B, 0x90, 0x8C,
+    0x62, 0x37, 0x0D, 0x00, 0x00, 0x14, 0x3C, 0x63, 0x8B, 0x98, 0x72, 0x4E, 0x49, 0x63, 0x78, 0x84, 0x85, 0x7D, 0x6A, 0x7C,
+    0x7C, 0x62, 0x37, 0x0D, 0x00, 0x00, 0x05, 0x2C, 0x53, 0x78, 0x0E, 0x9D, 0x8A, 0x68, 0x49, 0x3F, 0x50, 0x5A, 0x5B, 0x54,
+    0x4B, 0x52, 0x52, 0x49, 0x2A, 0x04, 0xFE, 0x00, 0x10, 0x19, 0x3E, 0x62, 0x84, 0xA4, 0x86, 0x6B, 0x55, 0x46, 0x3F, 0x3E,
+    0x44, 0x51, 0x46, 0x27, 0x22, 0x0D, 0xFD, 0x00, 0x0F, 0x04, 0x26, 0x48, 0x68, 0x86, 0xA1, 0x8F, 0x7C, 0x70, 0x69, 0x68,
+    0x6E, 0x79, 0x5F, 0x37, 0x0E, 0xFB, 0x00, 0x0E, 0x0C, 0x2C, 0x4A, 0x65, 0x7E, 0x92, 0xA1, 0x99, 0x94, 0x93, 0x97, 0x95,
+    0x6D, 0x45, 0x1D, 0xFA, 0x00, 0x0D, 0x0E, 0x2A, 0x43, 0x59, 0x6B, 0x79, 0x82, 0x87, 0x8A, 0x86, 0x7D, 0x6E, 0x49, 0x20,
+    0xF9, 0x00, 0x0C, 0x07, 0x1F, 0x33, 0x43, 0x50, 0x58, 0x5D, 0x5F, 0x5C, 0x54, 0x47, 0x32, 0x11, 0xF7, 0x00, 0x09, 0x0D,
+    0x1B, 0x27, 0x2E, 0x33, 0x35, 0x32, 0x2A, 0x1F, 0x0F, 0xF3, 0x00, 0x04, 0x05, 0x08, 0x0A, 0x07, 0x01, 0xD1, 0x00, 0x81,
+    0x00, 0xFC, 0x00, 0x01, 0x1A, 0x29, 0xFE, 0x2A, 0x01, 0x23, 0x0C, 0xF4, 0x00, 0x02, 0x15, 0x3A, 0x53, 0xFE, 0x55, 0x01,
+    0x48, 0x26, 0xF4, 0x00, 0x02, 0x22, 0x4B, 0x74, 0xFE, 0x7F, 0x02, 0x5D, 0x35, 0x0C, 0xF6, 0x00, 0x09, 0x06, 0x2F, 0x58,
+    0x80, 0xA9, 0xAA, 0x92, 0x6A, 0x41, 0x18, 0xF6, 0x00, 0x09, 0x13, 0x3B, 0x64, 0x8D, 0x9E, 0x8C, 0x9F, 0x76, 0x4E, 0x25,
+    0xF6, 0x00, 0x0A, 0x1F, 0x48, 0x70, 0x99, 0x93, 0x81, 0xAA, 0x83, 0x5A, 0x31, 0x09, 0xF8, 0x00, 0x0B, 0x03, 0x2C, 0x54,
+    0x7D, 0xA5, 0x87, 0x75, 0x9E, 0x8F, 0x66, 0x3E, 0x15, 0xF8, 0x00, 0x0B, 0x0F, 0x38, 0x61, 0x89, 0xA5, 0x7C, 0x6A, 0x93,
+    0x9C, 0x73, 0x4A, 0x22, 0xF8, 0x00, 0x0C, 0x1C, 0x44, 0x6D, 0x96, 0x99, 0x70, 0x5E, 0x87, 0xA8, 0x7F, 0x57, 0x2E, 0x05,
+    0xF9, 0x00, 0x0C, 0x28, 0x51, 0x7A, 0xA2, 0x8E, 0x65, 0x53, 0x7C, 0xA5, 0x8C, 0x63, 0x3A, 0x12, 0xFA, 0x00, 0x0D, 0x0C,
+    0x35, 0x5D, 0x86, 0xAB, 0x82, 0x59, 0x48, 0x70, 0x99, 0x98, 0x70, 0x47, 0x1E, 0xFA, 0x00, 0x0E, 0x18, 0x41, 0x6A, 0x92,
+    0xA0, 0x77, 0x4E, 0x3C, 0x65, 0x8E, 0xA5, 0x7C, 0x53, 0x2B, 0x02, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x76, 0x9F, 0x95, 0x6C,
+    0x53, 0x53, 0x5A, 0x83, 0xAC, 0x88, 0x60, 0x37, 0x0F, 0xFC, 0x00, 0x05, 0x09, 0x31, 0x5A, 0x83, 0xAB, 0x89, 0xFC, 0x7E,
+    0x04, 0xA1, 0x95, 0x6C, 0x44, 0x1B, 0xFC, 0x00, 0x04, 0x15, 0x3E, 0x66, 0x8F, 0xB0, 0xFB, 0xA8, 0x04, 0xA9, 0xA1, 0x79,
+    0x50, 0x27, 0xFC, 0x00, 0x04, 0x22, 0x4A, 0x73, 0x9B, 0x99, 0xFB, 0x7D, 0x05, 0x88, 0xAE, 0x85, 0x5C, 0x34, 0x0B, 0xFE,
+    0x00, 0x06, 0x05, 0x2E, 0x57, 0x7F, 0xA8, 0x8E, 0x65, 0xFC, 0x53, 0x05, 0x7C, 0xA5, 0x92, 0x69, 0x40, 0x18, 0xFE, 0x00,
+    0x07, 0x12, 0x3A, 0x63, 0x8C, 0xAC, 0x83, 0x5A, 0x31, 0xFE, 0x28, 0x06, 0x48, 0x71, 0x9A, 0x9E, 0x75, 0x4D, 0x24, 0xFE,
+    0x00, 0x2B, 0x1E, 0x47, 0x70, 0x98, 0xA0, 0x77, 0x4E, 0x25, 0x00, 0x00, 0x13, 0x3C, 0x65, 0x8E, 0xAA, 0x82, 0x59, 0x31,
+    0x08, 0x00, 0x01, 0x2B, 0x53, 0x7C, 0x95, 0x95, 0x6C, 0x43, 0x1A, 0x00, 0x00, 0x08, 0x31, 0x5A, 0x83, 0x95, 0x8E, 0x66,
+    0x3D, 0x14, 0x00, 0x01, 0x2B, 0x52, 0xFE, 0x6A, 0x02, 0x5E, 0x38, 0x0F, 0xFE, 0x00, 0x01, 0x25, 0x4D, 0xFE, 0x6A, 0x06,
+    0x62, 0x3D, 0x14, 0x00, 0x00, 0x17, 0x34, 0xFE, 0x40, 0x01, 0x3B, 0x22, 0xFD, 0x00, 0x01, 0x13, 0x31, 0xFE, 0x40, 0x02,
+    0x3D, 0x26, 0x04, 0xFE, 0x00, 0x00, 0x0E, 0xFE, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0xFE, 0x15, 0x01, 0x13,
+    0x04, 0x81, 0x00, 0x81, 0x00, 0x02, 0x00, 0x16, 0x28, 0xFB, 0x2A, 0x03, 0x27, 0x20, 0x15, 0x06, 0xF9, 0x00, 0x02, 0x0F,
+    0x35, 0x51, 0xFC, 0x55, 0x05, 0x54, 0x51, 0x4A, 0x3E, 0x2C, 0x16, 0xFA, 0x00, 0x02, 0x18, 0x42, 0x6D, 0xFB, 0x7F, 0x05,
+    0x7B, 0x73, 0x65, 0x51, 0x37, 0x1A, 0xFB, 0x00, 0x04, 0x18, 0x42, 0x6D, 0x97, 0xAA, 0xFD, 0xA8, 0x06, 0xA6, 0x9C, 0x8B,
+    0x73, 0x56, 0x34, 0x10, 0xFC, 0x00, 0x04, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0xFE, 0x7D, 0x07, 0x7E, 0x83, 0x91, 0xAB, 0x91,
+    0x6F, 0x49, 0x21, 0xFC, 0x00, 0x05, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0xFE, 0x53, 0x07, 0x5A, 0x6F, 0x93, 0xA8, 0x80,
+    0x57, 0x2D, 0x03, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x4E, 0x28, 0x29, 0x34, 0x5E, 0x88, 0xB2, 0x87,
+    0x5D, 0x33, 0x08, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x4E, 0x23, 0x22, 0x35, 0x5E, 0x88, 0xB2, 0x87,
+    0x5D, 0x33, 0x08, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x4E, 0x4C, 0x4C, 0x54, 0x6E, 0x93, 0xA6, 0x7F,
+    0x56, 0x2D, 0x03, 0xFD, 0x00, 0x0F, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x76, 0x76, 0x77, 0x7D, 0x8D, 0xA4, 0x8D, 0x6C,
+    0x47, 0x20, 0xFC, 0x00, 0x04, 0x18, 0x42, 0x6D, 0x97, 0xB0, 0xFD, 0xA1, 0x06, 0xA6, 0x88, 0x7D, 0x6B, 0x50, 0x31, 0x0D,
+    0xFC, 0x00, 0x04, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0xFD, 0x86, 0x06, 0x8B, 0x97, 0x9A, 0x85, 0x69, 0x49, 0x25, 0xFC, 0x00,
+    0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x5B, 0x5B, 0x5C, 0x61, 0x71, 0x8D, 0xA5, 0x84, 0x5F, 0x38, 0x10, 0xFD, 0x00,
+    0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x4E, 0x31, 0x31, 0x38, 0x51, 0x77, 0x9F, 0x97, 0x6E, 0x45, 0x1C, 0xFD, 0x00,
+    0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x4E, 0x23, 0x07, 0x19, 0x43, 0x6E, 0x98, 0xA0, 0x76, 0x4C, 0x22, 0xFD, 0x00,
+    0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x4E, 0x23, 0x13, 0x1A, 0x44, 0x6E, 0x98, 0xA2, 0x77, 0x4D, 0x22, 0xFD, 0x00,
+    0x10, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0x4E, 0x3D, 0x3E, 0x43, 0x55, 0x79, 0xA1, 0x9C, 0x72, 0x48, 0x1F, 0xFD, 0x00,
+    0x05, 0x18, 0x42, 0x6D, 0x97, 0xA3, 0x78, 0xFE, 0x68, 0x07, 0x6D, 0x79, 0x91, 0xAF, 0x8B, 0x66, 0x3E, 0x15, 0xFD, 0x00,
+    0x04, 0x18, 0x42, 0x6D, 0x97, 0xA7, 0xFE, 0x92, 0x08, 0x93, 0x96, 0xA0, 0xA6, 0x90, 0x73, 0x51, 0x2C, 0x07, 0xFD, 0x00,
+    0x02, 0x18, 0x42, 0x6D, 0xFC, 0x95, 0x07, 0x94, 0x91, 0x8A, 0x7F, 0x6C, 0x54, 0x37, 0x16, 0xFC, 0x00, 0x02, 0x15, 0x3F,
+    0x63, 0xFB, 0x6A, 0x05, 0x67, 0x61, 0x56, 0x47, 0x32, 0x18, 0xFB, 0x00, 0x02, 0x06, 0x27, 0x3D, 0xFC, 0x40, 0x05, 0x3F,
+    0x3D, 0x37, 0x2E, 0x20, 0x0E, 0xF9, 0x00, 0x01, 0x05, 0x14, 0xFB, 0x15, 0x02, 0x13, 0x0E, 0x05, 0x81, 0x00, 0xFC, 0x00,
+    0x8F, 0x00, 0x04, 0x03, 0x0A, 0x0D, 0x0C, 0x07, 0xF3, 0x00, 0x09, 0x11, 0x21, 0x2D, 0x35, 0x37, 0x37, 0x31, 0x28, 0x1A,
+    0x09, 0xF8, 0x00, 0x0C, 0x05, 0x20, 0x36, 0x49, 0x57, 0x5F, 0x62, 0x61, 0x5B, 0x50, 0x42, 0x2F, 0x14, 0xFA, 0x00, 0x0D,
+    0x05, 0x25, 0x41, 0x5B, 0x70, 0x7F, 0x89, 0x8C, 0x8B, 0x85, 0x79, 0x68, 0x4F, 0x29, 0xFA, 0x00, 0x0E, 0x1F, 0x41, 0x61,
+    0x7D, 0x95, 0xA7, 0x9F, 0x9A, 0x9C, 0xA4, 0xA0, 0x83, 0x58, 0x2E, 0x03, 0xFC, 0x00, 0x0F, 0x11, 0x37, 0x5A, 0x7D, 0x9D,
+    0x9F, 0x86, 0x76, 0x70, 0x72, 0x7C, 0x8C, 0x83, 0x58, 0x2E, 0x03, 0xFC, 0x00, 0x0F, 0x24, 0x4A, 0x70, 0x95, 0xA3, 0x81,
+    0x63, 0x4D, 0x45, 0x48, 0x54, 0x68, 0x80, 0x58, 0x2E, 0x03, 0xFD, 0x00, 0x0F, 0x0A, 0x32, 0x5A, 0x83, 0xA9, 0x90, 0x6A,
+    0x46, 0x27, 0x1B, 0x1E, 0x2E, 0x44, 0x58, 0x48, 0x25, 0xFC, 0x00, 0x0F, 0x14, 0x3E, 0x67, 0x90, 0xAB, 0x82, 0x59, 0x31,
+    0x0B, 0x00, 0x00, 0x09, 0x22, 0x2E, 0x25, 0x0C, 0xFC, 0x00, 0x07, 0x1C, 0x46, 0x70, 0x9A, 0xA2, 0x78, 0x4E, 0x25, 0xFC,
+    0x00, 0x00, 0x03, 0xFA, 0x00, 0x07, 0x21, 0x4C, 0x76, 0xA0, 0x9D, 0x72, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x24, 0x4E, 0x79,
+    0xA3, 0x9A, 0x6F, 0x45, 0x1B, 0xF4, 0x00, 0x07, 0x25, 0x4F, 0x7A, 0xA4, 0x99, 0x6F, 0x44, 0x1A, 0xF4, 0x00, 0x07, 0x23,
+    0x4E, 0x78, 0xA3, 0x9B, 0x70, 0x46, 0x1C, 0xF4, 0x00, 0x07, 0x1F, 0x49, 0x74, 0x9E, 0x9F, 0x74, 0x4B, 0x21, 0xF4, 0x00,
+    0x08, 0x19, 0x43, 0x6C, 0x96, 0xA5, 0x7C, 0x53, 0x2A, 0x02, 0xFE, 0x00, 0x02, 0x0E, 0x17, 0x10, 0xFB, 0x00, 0x0F, 0x10,
+    0x3A, 0x62, 0x8A, 0xB0, 0x88, 0x60, 0x3A, 0x16, 0x04, 0x08, 0x1A, 0x33, 0x42, 0x36, 0x19, 0xFC, 0x00, 0x10, 0x04, 0x2C,
+    0x54, 0x7B, 0xA1, 0x99, 0x74, 0x52, 0x39, 0x2F, 0x32, 0x3F, 0x55, 0x6C, 0x54, 0x2B, 0x02, 0xFC, 0x00, 0x0F, 0x1C, 0x42,
+    0x68, 0x8B, 0xAD, 0x8E, 0x73, 0x60, 0x59, 0x5B, 0x67, 0x79, 0x83, 0x58, 0x2E, 0x03, 0xFC, 0x00, 0x0F, 0x09, 0x2D, 0x50,
+    0x71, 0x8F, 0xA9, 0x97, 0x89, 0x84, 0x85, 0x8F, 0x9E, 0x83, 0x58, 0x2E, 0x03, 0xFB, 0x00, 0x0E, 0x15, 0x34, 0x53, 0x6E,
+    0x84, 0x95, 0x9F, 0xA3, 0xA1, 0x9A, 0x8E, 0x7C, 0x58, 0x2D, 0x03, 0xFA, 0x00, 0x0C, 0x17, 0x32, 0x4A, 0x5E, 0x6D, 0x75,
+    0x78, 0x77, 0x71, 0x66, 0x56, 0x42, 0x21, 0xF8, 0x00, 0x0B, 0x10, 0x25, 0x36, 0x43, 0x4B, 0x4E, 0x4D, 0x47, 0x3D, 0x2F,
+    0x1D, 0x06, 0xF6, 0x00, 0x07, 0x0E, 0x19, 0x21, 0x23, 0x22, 0x1D, 0x14, 0x07, 0x81, 0x00, 0xFE, 0x00, 0x81, 0x00, 0x01,
+    0x04, 0x1E, 0xFC, 0x2A, 0x03, 0x28, 0x22, 0x19, 0x0E, 0xF7, 0x00, 0x01, 0x1C, 0x40, 0xFD, 0x55, 0x06, 0x54, 0x52, 0x4C,
+    0x42, 0x35, 0x23, 0x0D, 0xF9, 0x00, 0x02, 0x26, 0x51, 0x7B, 0xFD, 0x7F, 0x06, 0x7C, 0x76, 0x6B, 0x5C, 0x48, 0x30, 0x14,
+    0xFA, 0x00, 0x0E, 0x26, 0x51, 0x7B, 0xA6, 0xAA, 0xA8, 0xA9, 0xA6, 0xA0, 0x94, 0x82, 0x6B, 0x50, 0x32, 0x10, 0xFB, 0x00,
+    0x0F, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x7D, 0x7E, 0x82, 0x8B, 0x9A, 0xA6, 0x8C, 0x6D, 0x4B, 0x28, 0x02, 0xFC, 0x00, 0x0F,
+    0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x54, 0x58, 0x62, 0x76, 0x92, 0xA9, 0x87, 0x61, 0x3B, 0x14, 0xFC, 0x00, 0x0F, 0x26,
+    0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x2E, 0x3B, 0x56, 0x7A, 0xA0, 0x9A, 0x73, 0x4B, 0x23, 0xFC, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x1B, 0x42, 0x6A, 0x93, 0xA9, 0x80, 0x57, 0x2D, 0x04, 0xFD, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x0C, 0x36, 0x60, 0x8A, 0xB3, 0x8A, 0x60, 0x36, 0x0B, 0xFD, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x05, 0x30, 0x5A, 0x84, 0xAF, 0x8F, 0x65, 0x3B, 0x10, 0xFD, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2D, 0x57, 0x82, 0xAC, 0x92, 0x67, 0x3D, 0x12, 0xFD, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2C, 0x57, 0x81, 0xAC, 0x93, 0x68, 0x3E, 0x13, 0xFD, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x03, 0x2E, 0x58, 0x82, 0xAD, 0x91, 0x67, 0x3C, 0x12, 0xFD, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x08, 0x32, 0x5C, 0x86, 0xB1, 0x8D, 0x62, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x12, 0x3B, 0x64, 0x8D, 0xAF, 0x85, 0x5C, 0x32, 0x09, 0xFD, 0x00, 0x0F, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x19, 0x2A, 0x4B, 0x71, 0x98, 0xA2, 0x7A, 0x52, 0x29, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B,
+    0xA6, 0x94, 0x6A, 0x3F, 0x43, 0x4F, 0x65, 0x85, 0xA9, 0x91, 0x6B, 0x44, 0x1C, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA6,
+    0x94, 0x6A, 0x69, 0x6D, 0x76, 0x88, 0xA1, 0x9B, 0x7A, 0x57, 0x32, 0x0C, 0xFC, 0x00, 0x0E, 0x26, 0x51, 0x7B, 0xA6, 0x9B,
+    0x92, 0x93, 0x97, 0x9F, 0xA7, 0x95, 0x7C, 0x5F, 0x3F, 0x1D, 0xFB, 0x00, 0x02, 0x26, 0x51, 0x7B, 0xFE, 0x95, 0x08, 0x94,
+    0x92, 0x8B, 0x80, 0x6F, 0x5A, 0x40, 0x23, 0x03, 0xFB, 0x00, 0x01, 0x24, 0x4C, 0xFC, 0x6A, 0x06, 0x68, 0x61, 0x57, 0x48,
+    0x36, 0x1F, 0x04, 0xFA, 0x00, 0x01, 0x12, 0x30, 0xFD, 0x40, 0x05, 0x3F, 0x3D, 0x37, 0x2E, 0x22, 0x10, 0xF7, 0x00, 0x00,
+    0x0B, 0xFC, 0x15, 0x02, 0x13, 0x0D, 0x05, 0x81, 0x00, 0xFA, 0x00, 0x81, 0x00, 0x02, 0x00, 0x0D, 0x24, 0xF6, 0x2A, 0x01,
+    0x24, 0x0D, 0xFC, 0x00, 0x02, 0x01, 0x28, 0x49, 0xF6, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x02, 0x08, 0x33, 0x5D,
+    0xF6, 0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0xAA, 0x03, 0x88, 0x5D, 0x33, 0x08,
+    0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x06, 0x08, 0x33,
+    0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87,
+    0x5C, 0x32, 0xFB, 0x2A, 0x01, 0x24, 0x0D, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x23,
+    0x00, 0x17, 0xFB, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x4E, 0x02, 0x4D, 0x39, 0x17, 0xFC, 0x00,
+    0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x78, 0x02, 0x75, 0x4E, 0x23, 0xFC, 0x00, 0x04, 0x08, 0x33, 0x5D, 0x88,
+    0xB2, 0xF9, 0xA3, 0x02, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x8A, 0xFA, 0x87, 0x02, 0x79,
+    0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x5C, 0x02, 0x5B, 0x43, 0x1D, 0xFC, 0x00, 0x06,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x32, 0x02, 0x31, 0x23, 0x07, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88,
+    0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x07, 0xFA, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x15, 0x01,
+    0x12, 0x01, 0xFC, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x3F, 0x01, 0x3B, 0x22, 0xFC, 0x00, 0x05,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x6A, 0x02, 0x5F, 0x39, 0x0F, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2,
+    0x96, 0xFA, 0x94, 0x03, 0x91, 0x67, 0x3C, 0x12, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0x95, 0x03, 0x91, 0x67,
+    0x3C, 0x12, 0xFD, 0x00, 0x02, 0x06, 0x30, 0x57, 0xF6, 0x6A, 0x02, 0x5F, 0x39, 0x10, 0xFC, 0x00, 0x01, 0x1C, 0x37, 0xF6,
+    0x40, 0x01, 0x3B, 0x23, 0xFA, 0x00, 0x00, 0x10, 0xF6, 0x15, 0x01, 0x12, 0x02, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x02,
+    0x00, 0x00, 0x1C, 0xF6, 0x2A, 0x01, 0x28, 0x16, 0xFB, 0x00, 0x02, 0x18, 0x3C, 0x54, 0xF7, 0x55, 0x02, 0x50, 0x34, 0x0E,
+    0xFC, 0x00, 0x02, 0x21, 0x4B, 0x76, 0xF7, 0x7F, 0x02, 0x6C, 0x41, 0x17, 0xFC, 0x00, 0x03, 0x21, 0x4B, 0x76, 0xA0, 0xF9,
+    0xAA, 0x03, 0x96, 0x6C, 0x41, 0x17, 0xFC, 0x00, 0x04, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0xF9, 0x7F, 0x02, 0x6C, 0x41, 0x17,
+    0xFC, 0x00, 0x05, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0xFA, 0x55, 0x02, 0x50, 0x34, 0x0E, 0xFC, 0x00, 0x06, 0x21, 0x4B,
+    0x76, 0xA0, 0x99, 0x6F, 0x44, 0xFB, 0x2A, 0x01, 0x28, 0x16, 0xFB, 0x00, 0x06, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44,
+    0xFB, 0x24, 0x00, 0x17, 0xFA, 0x00, 0x05, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0xFB, 0x4F, 0x02, 0x4E, 0x39, 0x16, 0xFB,
+    0x00, 0x04, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0xFA, 0x79, 0x02, 0x75, 0x4C, 0x21, 0xFB, 0x00, 0x04, 0x21, 0x4B, 0x76, 0xA0,
+    0xAC, 0xFB, 0xA4, 0x03, 0xA1, 0x77, 0x4C, 0x22, 0xFB, 0x00, 0x04, 0x21, 0x4B, 0x76, 0xA0, 0x9A, 0xFA, 0x86, 0x02, 0x77,
+    0x4C, 0x22, 0xFB, 0x00, 0x05, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0xFB, 0x5B, 0x02, 0x5A, 0x41, 0x1B, 0xFB, 0x00, 0x06,
+    0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0xFC, 0x31, 0x02, 0x30, 0x21, 0x05, 0xFB, 0x00, 0x07, 0x21, 0x4B, 0x76, 0xA0,
+    0x99, 0x6F, 0x44, 0x1A, 0xFC, 0x06, 0xF9, 0x00, 0x07, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0xF4, 0x00, 0x07,
+    0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0xF4, 0x00, 0x07, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0xF4,
+    0x00, 0x07, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0xF4, 0x00, 0x07, 0x21, 0x4B, 0x76, 0x95, 0x95, 0x6F, 0x44,
+    0x1A, 0xF4, 0x00, 0x07, 0x1E, 0x47, 0x68, 0x6A, 0x6A, 0x65, 0x41, 0x18, 0xF4, 0x00, 0x07, 0x0D, 0x2D, 0x3F, 0x40, 0x40,
+    0x3E, 0x29, 0x08, 0xF3, 0x00, 0x00, 0x09, 0xFE, 0x15, 0x01, 0x14, 0x06, 0x81, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x04, 0x07,
+    0x0B, 0x0D, 0x0A, 0x03, 0xF4, 0x00, 0x09, 0x05, 0x18, 0x27, 0x30, 0x36, 0x38, 0x34, 0x2C, 0x20, 0x0F, 0xF7, 0x00, 0x0C,
+    0x11, 0x2A, 0x3F, 0x4F, 0x5A, 0x60, 0x62, 0x5E, 0x55, 0x48, 0x35, 0x1F, 0x04, 0xFA, 0x00, 0x0D, 0x13, 0x32, 0x4C, 0x64,
+    0x77, 0x84, 0x8B, 0x8D, 0x88, 0x7E, 0x6E, 0x5A, 0x40, 0x1B, 0xFB, 0x00, 0x0E, 0x0B, 0x2E, 0x4F, 0x6E, 0x88, 0x9E, 0xA5,
+    0x9C, 0x9A, 0x9E, 0xA6, 0x94, 0x79, 0x4E, 0x24, 0xFB, 0x00, 0x0E, 0x22, 0x46, 0x69, 0x8B, 0xA9, 0x93, 0x7E, 0x72, 0x6F,
+    0x75, 0x83, 0x97, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x0F, 0x0E, 0x34, 0x5B, 0x81, 0xA4, 0x95, 0x73, 0x58, 0x48, 0x45, 0x4C,
+    0x5D, 0x74, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x0F, 0x1B, 0x44, 0x6C, 0x94, 0xA7, 0x7F, 0x5A, 0x37, 0x1F, 0x1A, 0x24, 0x39,
+    0x54, 0x64, 0x47, 0x20, 0xFC, 0x00, 0x07, 0x26, 0x50, 0x79, 0xA2, 0x99, 0x70, 0x48, 0x20, 0xFE, 0x00, 0x04, 0x18, 0x31,
+    0x3A, 0x2A, 0x0C, 0xFD, 0x00, 0x09, 0x04, 0x2F, 0x59, 0x82, 0xAC, 0x90, 0x66, 0x3C, 0x13, 0x11, 0xFC, 0x14, 0x01, 0x12,
+    0x01, 0xFD, 0x00, 0x09, 0x0A, 0x34, 0x5E, 0x88, 0xB2, 0x8A, 0x60, 0x36, 0x21, 0x39, 0xFC, 0x3F, 0x02, 0x3A, 0x23, 0x01,
+    0xFE, 0x00, 0x09, 0x0C, 0x36, 0x61, 0x8B, 0xB2, 0x88, 0x5D, 0x33, 0x37, 0x5D, 0xFC, 0x69, 0x02, 0x5F, 0x39, 0x10, 0xFE,
+    0x00, 0x0A, 0x0D, 0x37, 0x62, 0x8C, 0xB1, 0x87, 0x5C, 0x32, 0x3A, 0x65, 0x8F, 0xFE, 0x94, 0x03, 0x92, 0x68, 0x3D, 0x13,
+    0xFE, 0x00, 0x11, 0x0B, 0x36, 0x60, 0x8A, 0xB3, 0x88, 0x5E, 0x34, 0x3A, 0x65, 0x8F, 0x93, 0x93, 0xA8, 0x92, 0x68, 0x3D,
+    0x13, 0xFE, 0x00, 0x11, 0x07, 0x31, 0x5C, 0x86, 0xB0, 0x8C, 0x62, 0x38, 0x37, 0x5C, 0x69, 0x69, 0x78, 0xA3, 0x92, 0x68,
+    0x3D, 0x13, 0xFE, 0x00, 0x11, 0x02, 0x2B, 0x55, 0x7E, 0xA8, 0x93, 0x69, 0x40, 0x20, 0x39, 0x3E, 0x4E, 0x78, 0xA3, 0x92,
+    0x68, 0x3D, 0x13, 0xFD, 0x00, 0x10, 0x22, 0x4B, 0x74, 0x9C, 0x9D, 0x75, 0x4E, 0x28, 0x11, 0x23, 0x4E, 0x78, 0xA3, 0x92,
+    0x68, 0x3D, 0x13, 0xFD, 0x00, 0x10, 0x15, 0x3E, 0x65, 0x8B, 0xAC, 0x87, 0x63, 0x44, 0x32, 0x2E, 0x4E, 0x78, 0xA3, 0x92,
+    0x68, 0x3D, 0x13, 0xFD, 0x00, 0x10, 0x06, 0x2C, 0x53, 0x77, 0x9A, 0x9F, 0x80, 0x68, 0x5B, 0x59, 0x60, 0x78, 0xA3, 0x92,
+    0x68, 0x3D, 0x13, 0xFC, 0x00, 0x0F, 0x19, 0x3C, 0x5F, 0x7E, 0x9B, 0xA2, 0x8F, 0x85, 0x83, 0x89, 0x99, 0xA7, 0x8E, 0x68,
+    0x3D, 0x13, 0xFC, 0x00, 0x0F, 0x01, 0x23, 0x42, 0x5F, 0x78, 0x8D, 0x9A, 0xA1, 0xA3, 0x9E, 0x93, 0x82, 0x6C, 0x52, 0x32,
+    0x0B, 0xFB, 0x00, 0x0D, 0x06, 0x23, 0x3E, 0x53, 0x65, 0x71, 0x77, 0x78, 0x74, 0x6B, 0x5C, 0x48, 0x31, 0x16, 0xF9, 0x00,
+    0x0B, 0x02, 0x1A, 0x2E, 0x3D, 0x47, 0x4C, 0x4E, 0x4A, 0x42, 0x35, 0x23, 0x0E, 0xF6, 0x00, 0x07, 0x06, 0x15, 0x1D, 0x22,
+    0x23, 0x20, 0x19, 0x0D, 0x81, 0x00, 0xFD, 0x00, 0x81, 0x00, 0x01, 0x04, 0x1E, 0xFE, 0x2A, 0x05, 0x28, 0x15, 0x00, 0x00,
+    0x08, 0x21, 0xFE, 0x2A, 0x01, 0x26, 0x11, 0xFC, 0x00, 0x01, 0x1C, 0x40, 0xFE, 0x55, 0x05, 0x50, 0x32, 0x0C, 0x00, 0x22,
+    0x44, 0xFE, 0x55, 0x02, 0x4D, 0x2D, 0x07, 0xFD, 0x00, 0x0A, 0x26, 0x51, 0x7B, 0x7F, 0x7F, 0x6A, 0x3F, 0x15, 0x01, 0x2C,
+    0x56, 0xFE, 0x7F, 0x02, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C,
+    0x56, 0x81, 0xAA, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C,
+    0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C,
+    0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C,
+    0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x23, 0x23, 0x2C,
+    0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x05, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0xFD, 0x4E, 0x06, 0x56,
+    0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x04, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0xFB, 0x78, 0x05, 0x81, 0xAB, 0x8E,
+    0x64, 0x39, 0x0F, 0xFD, 0x00, 0x04, 0x26, 0x51, 0x7B, 0xA6, 0xA8, 0xFA, 0xA3, 0x04, 0xB8, 0x8E, 0x64, 0x39, 0x0F, 0xFD,
+    0x00, 0x04, 0x26, 0x51, 0x7B, 0xA6, 0x95, 0xFA, 0x87, 0x04, 0xAC, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x05, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0xFC, 0x5C, 0x05, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x06, 0x26, 0x51, 0x7B, 0xA6,
+    0x94, 0x6A, 0x3F, 0xFE, 0x32, 0x06, 0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6,
+    0x94, 0x6A, 0x3F, 0x15, 0x07, 0x2C, 0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6,
+    0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C, 0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6,
+    0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C, 0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6,
+    0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C, 0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6,
+    0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C, 0x56, 0x81, 0xAB, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0x95,
+    0x94, 0x6A, 0x3F, 0x15, 0x01, 0x2C, 0x56, 0x81, 0x95, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x01, 0x24, 0x4C, 0xFE, 0x6A,
+    0x05, 0x61, 0x3C, 0x12, 0x00, 0x29, 0x51, 0xFE, 0x6A, 0x02, 0x5C, 0x36, 0x0D, 0xFD, 0x00, 0x01, 0x12, 0x30, 0xFE, 0x40,
+    0x05, 0x3C, 0x25, 0x03, 0x00, 0x16, 0x34, 0xFE, 0x40, 0x01, 0x3A, 0x21, 0xFB, 0x00, 0x00, 0x0B, 0xFE, 0x15, 0x01, 0x13,
+    0x03, 0xFE, 0x00, 0x00, 0x0E, 0xFE, 0x15, 0x00, 0x12, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x02, 0x00, 0x0B, 0x23,
+    0xF7, 0x2A, 0x01, 0x28, 0x17, 0xFA, 0x00, 0x01, 0x26, 0x47, 0xF7, 0x55, 0x02, 0x51, 0x35, 0x10, 0xFC, 0x00, 0x02, 0x06,
+    0x31, 0x5B, 0xF7, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF9, 0xAA, 0x03, 0x98, 0x6D,
+    0x43, 0x18, 0xFC, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xFD, 0x7F, 0x01, 0x94, 0xA6, 0xFD, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFB,
+    0x00, 0x01, 0x26, 0x47, 0xFE, 0x55, 0x03, 0x69, 0x94, 0xA6, 0x7B, 0xFE, 0x55, 0x02, 0x51, 0x35, 0x10, 0xFB, 0x00, 0x0D,
+    0x0B, 0x23, 0x2A, 0x2A, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x2A, 0x2A, 0x28, 0x17, 0xF7, 0x00, 0x07, 0x14, 0x3F, 0x69,
+    0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14,
+    0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00,
+    0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26,
+    0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B,
+    0x51, 0x26, 0xF6, 0x00, 0x0C, 0x0F, 0x15, 0x15, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0x15, 0x13, 0x05, 0xFA, 0x00,
+    0x01, 0x1A, 0x36, 0xFE, 0x3F, 0x09, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x3F, 0x3F, 0x3D, 0x27, 0x06, 0xFC, 0x00, 0x02, 0x04,
+    0x2E, 0x55, 0xFD, 0x6A, 0x02, 0x94, 0xA6, 0x7B, 0xFE, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B,
+    0x86, 0xFE, 0x94, 0x01, 0x9D, 0xAB, 0xFD, 0x94, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF8,
+    0x95, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xF7, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFB, 0x00, 0x01,
+    0x1A, 0x36, 0xF7, 0x40, 0x02, 0x3D, 0x27, 0x06, 0xFA, 0x00, 0x00, 0x0F, 0xF7, 0x15, 0x01, 0x14, 0x05, 0x81, 0x00, 0x01,
+    0x00, 0x00, 0x81, 0x00, 0xFE, 0x00, 0x01, 0x0B, 0x23, 0xFA, 0x2A, 0x01, 0x29, 0x1A, 0xF7, 0x00, 0x01, 0x25, 0x47, 0xFA,
+    0x55, 0x02, 0x53, 0x3A, 0x15, 0xF9, 0x00, 0x02, 0x05, 0x30, 0x5A, 0xFA, 0x7F, 0x02, 0x73, 0x48, 0x1E, 0xF9, 0x00, 0x03,
+    0x05, 0x30, 0x5A, 0x85, 0xFC, 0xAA, 0x03, 0x9D, 0x73, 0x48, 0x1E, 0xF9, 0x00, 0x02, 0x05, 0x30, 0x5A, 0xFC, 0x7F, 0x04,
+    0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF8, 0x00, 0x01, 0x25, 0x47, 0xFD, 0x55, 0x05, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF8,
+    0x00, 0x01, 0x0B, 0x23, 0xFE, 0x2A, 0x06, 0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x1C, 0x47, 0x71,
+    0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x1C, 0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x1C,
+    0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x1C, 0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00,
+    0x07, 0x1C, 0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x1C, 0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E,
+    0xF4, 0x00, 0x07, 0x1C, 0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xFB, 0x00, 0x0E, 0x0D, 0x24, 0x29, 0x1B, 0x01, 0x00,
+    0x00, 0x1C, 0x47, 0x71, 0x9C, 0x9D, 0x73, 0x48, 0x1E, 0xFC, 0x00, 0x0F, 0x02, 0x28, 0x49, 0x53, 0x3D, 0x23, 0x0F, 0x04,
+    0x1F, 0x49, 0x74, 0x9E, 0x9B, 0x71, 0x47, 0x1C, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x79, 0x5E, 0x48, 0x37, 0x2F, 0x31,
+    0x52, 0x7B, 0xA4, 0x95, 0x6C, 0x42, 0x18, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x82, 0x6E, 0x60, 0x59, 0x5B, 0x6A,
+    0x8A, 0xB0, 0x8A, 0x62, 0x39, 0x10, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA7, 0x95, 0x89, 0x83, 0x85, 0x8F, 0xA6,
+    0x9B, 0x79, 0x53, 0x2C, 0x04, 0xFC, 0x00, 0x0E, 0x09, 0x33, 0x5D, 0x7B, 0x8A, 0x96, 0x9F, 0xA3, 0xA2, 0x9D, 0x90, 0x7C,
+    0x60, 0x3E, 0x1A, 0xFA, 0x00, 0x0D, 0x24, 0x42, 0x54, 0x62, 0x6D, 0x75, 0x78, 0x78, 0x73, 0x69, 0x58, 0x40, 0x23, 0x02,
+    0xFA, 0x00, 0x0C, 0x07, 0x1C, 0x2C, 0x39, 0x44, 0x4B, 0x4E, 0x4D, 0x49, 0x40, 0x31, 0x1D, 0x04, 0xF7, 0x00, 0x08, 0x04,
+    0x10, 0x1A, 0x21, 0x23, 0x23, 0x1F, 0x17, 0x0A, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00, 0x01, 0x04, 0x1E, 0xFE, 0x2A, 0x01,
+    0x28, 0x15, 0xFE, 0x00, 0x01, 0x0B, 0x23, 0xFE, 0x2A, 0x01, 0x29, 0x19, 0xFD, 0x00, 0x01, 0x1C, 0x40, 0xFE, 0x55, 0x06,
+    0x50, 0x32, 0x0C, 0x00, 0x09, 0x28, 0x47, 0xFE, 0x55, 0x02, 0x52, 0x38, 0x13, 0xFE, 0x00, 0x0B, 0x26, 0x51, 0x7B, 0x7F,
+    0x7F, 0x6A, 0x3F, 0x15, 0x08, 0x27, 0x46, 0x64, 0xFE, 0x7F, 0x02, 0x71, 0x46, 0x1C, 0xFE, 0x00, 0x11, 0x26, 0x51, 0x7B,
+    0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x25, 0x44, 0x63, 0x82, 0xA0, 0x95, 0x76, 0x58, 0x38, 0x13, 0xFE, 0x00, 0x10, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x24, 0x42, 0x61, 0x80, 0x9F, 0x97, 0x78, 0x59, 0x3A, 0x1C, 0xFD, 0x00, 0x0F, 0x26, 0x51,
+    0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x41, 0x60, 0x7F, 0x9D, 0x98, 0x79, 0x5B, 0x3C, 0x1D, 0xFC, 0x00, 0x0E, 0x26, 0x51, 0x7B,
+    0xA6, 0x94, 0x6A, 0x3F, 0x5E, 0x7D, 0x9C, 0x9A, 0x7B, 0x5C, 0x3D, 0x1F, 0xFB, 0x00, 0x0E, 0x26, 0x51, 0x7B, 0xA6, 0x94,
+    0x6A, 0x5D, 0x7B, 0x9A, 0x9B, 0x7C, 0x5E, 0x3F, 0x20, 0x01, 0xFB, 0x00, 0x0D, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x7A,
+    0x99, 0x9D, 0x7E, 0x5F, 0x40, 0x21, 0x03, 0xFA, 0x00, 0x0C, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x78, 0x97, 0xA4, 0x7F, 0x61,
+    0x42, 0x23, 0x04, 0xF9, 0x00, 0x0C, 0x26, 0x51, 0x7B, 0xA6, 0x96, 0x96, 0xA1, 0xAB, 0x8E, 0x6B, 0x48, 0x25, 0x02, 0xF9,
+    0x00, 0x0C, 0x26, 0x51, 0x7B, 0xA6, 0xB7, 0xA0, 0x81, 0x93, 0xA6, 0x83, 0x60, 0x3D, 0x19, 0xF9, 0x00, 0x0D, 0x26, 0x51,
+    0x7B, 0xA6, 0xA2, 0x83, 0x64, 0x7B, 0x9F, 0x9B, 0x78, 0x54, 0x31, 0x0E, 0xFA, 0x00, 0x0E, 0x26, 0x51, 0x7B, 0xA6, 0x94,
+    0x6A, 0x47, 0x64, 0x88, 0xAC, 0x8F, 0x6C, 0x49, 0x26, 0x03, 0xFB, 0x00, 0x0E, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F,
+    0x4D, 0x71, 0x94, 0xA7, 0x84, 0x61, 0x3E, 0x1B, 0xFB, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x36, 0x5A,
+    0x7D, 0xA1, 0x9C, 0x79, 0x56, 0x32, 0x0F, 0xFC, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x1F, 0x42, 0x66,
+    0x8A, 0xAD, 0x91, 0x6D, 0x4A, 0x27, 0x04, 0xFD, 0x00, 0x10, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x2B, 0x4F,
+    0x72, 0x96, 0xA8, 0x85, 0x62, 0x3F, 0x1C, 0xFD, 0x00, 0x11, 0x26, 0x51, 0x7B, 0xA6, 0x94, 0x6A, 0x3F, 0x15, 0x14, 0x38,
+    0x5B, 0x7F, 0xA2, 0x9D, 0x7A, 0x57, 0x33, 0x10, 0xFE, 0x00, 0x11, 0x26, 0x51, 0x7B, 0x95, 0x94, 0x6A, 0x3F, 0x15, 0x00,
+    0x20, 0x44, 0x68, 0x8B, 0x95, 0x92, 0x6E, 0x4A, 0x22, 0xFE, 0x00, 0x01, 0x24, 0x4C, 0xFE, 0x6A, 0x06, 0x61, 0x3C, 0x12,
+    0x00, 0x09, 0x2D, 0x50, 0xFE, 0x6A, 0x02, 0x69, 0x4A, 0x22, 0xFE, 0x00, 0x01, 0x12, 0x30, 0xFE, 0x40, 0x06, 0x3C, 0x25,
+    0x03, 0x00, 0x00, 0x15, 0x33, 0xFE, 0x40, 0x02, 0x3F, 0x2F, 0x10, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x15, 0x01, 0x13, 0x03,
+    0xFD, 0x00, 0x00, 0x0D, 0xFD, 0x15, 0x00, 0x0B, 0x81, 0x00, 0x81, 0x00, 0x02, 0x00, 0x07, 0x20, 0xFE, 0x2A, 0x01, 0x27,
+    0x12, 0xF3, 0x00, 0x01, 0x20, 0x43, 0xFE, 0x55, 0x02, 0x4E, 0x2F, 0x09, 0xF4, 0x00, 0x01, 0x2A, 0x54, 0xFE, 0x7F, 0x02,
+    0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F,
+    0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A,
+    0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00,
+    0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11,
+    0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66,
+    0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9,
+    0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x07, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0x3B, 0x11, 0xF4, 0x00, 0x06, 0x2A, 0x54,
+    0x7F, 0xA9, 0x90, 0x66, 0x3B, 0xFA, 0x15, 0x00, 0x0A, 0xFB, 0x00, 0x05, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0x66, 0xF9, 0x3F,
+    0x01, 0x2F, 0x10, 0xFC, 0x00, 0x04, 0x2A, 0x54, 0x7F, 0xA9, 0x90, 0xF9, 0x6A, 0x02, 0x69, 0x4A, 0x22, 0xFC, 0x00, 0x04,
+    0x2A, 0x54, 0x7F, 0xA9, 0x9A, 0xF9, 0x94, 0x02, 0x79, 0x4F, 0x24, 0xFC, 0x00, 0x02, 0x2A, 0x54, 0x7F, 0xF7, 0x95, 0x02,
+    0x79, 0x4F, 0x24, 0xFC, 0x00, 0x01, 0x27, 0x4F, 0xF6, 0x6A, 0x02, 0x69, 0x4A, 0x22, 0xFC, 0x00, 0x01, 0x15, 0x32, 0xF6,
+    0x40, 0x02, 0x3F, 0x2F, 0x10, 0xFB, 0x00, 0x00, 0x0D, 0xF5, 0x15, 0x00, 0x0B, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x01,
+    0x15, 0x28, 0xFE, 0x2A, 0x05, 0x29, 0x19, 0x00, 0x00, 0x0F, 0x25, 0xFD, 0x2A, 0x01, 0x1F, 0x05, 0xFE, 0x00, 0x02, 0x0D,
+    0x33, 0x50, 0xFE, 0x55, 0x05, 0x53, 0x39, 0x14, 0x03, 0x2A, 0x4A, 0xFD, 0x55, 0x01, 0x41, 0x1D, 0xFE, 0x00, 0x02, 0x15,
+    0x3F, 0x6A, 0xFE, 0x7F, 0x05, 0x72, 0x4A, 0x22, 0x11, 0x39, 0x62, 0xFE, 0x7F, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11,
+    0x15, 0x3F, 0x6A, 0x94, 0xAA, 0xA8, 0x80, 0x58, 0x2F, 0x1F, 0x47, 0x6F, 0x98, 0xAA, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00,
+    0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x8D, 0x8E, 0x65, 0x3D, 0x2D, 0x55, 0x7D, 0x9D, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE,
+    0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x7F, 0x9B, 0x73, 0x4B, 0x3A, 0x63, 0x8B, 0x90, 0x8B, 0xA7, 0x7C, 0x52, 0x27,
+    0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x9A, 0x81, 0x58, 0x48, 0x70, 0x99, 0x82, 0x8B, 0xA7, 0x7C, 0x52,
+    0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x8C, 0x8E, 0x66, 0x56, 0x7E, 0x9D, 0x75, 0x8B, 0xA7, 0x7C,
+    0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x7E, 0x9C, 0x74, 0x64, 0x8C, 0x8F, 0x67, 0x8B, 0xA7,
+    0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x71, 0x99, 0x81, 0x71, 0x9A, 0x82, 0x61, 0x8B,
+    0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x63, 0x8B, 0x8F, 0x7F, 0x9C, 0x74, 0x61,
+    0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x55, 0x7E, 0x9D, 0x8D, 0x8F, 0x66,
+    0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x48, 0x70, 0x98, 0xA9, 0x81,
+    0x59, 0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x48, 0x62, 0x8B, 0x8B,
+    0x73, 0x4B, 0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x48, 0x51, 0x60,
+    0x60, 0x5C, 0x3D, 0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x48, 0x2E,
+    0x36, 0x36, 0x34, 0x36, 0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72, 0x48,
+    0x1D, 0x0B, 0x0B, 0x0C, 0x36, 0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D, 0x72,
+    0x48, 0x1D, 0x00, 0x00, 0x0C, 0x36, 0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94, 0x9D,
+    0x72, 0x48, 0x1D, 0x00, 0x00, 0x0C, 0x36, 0x61, 0x8B, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x15, 0x3F, 0x6A, 0x94,
+    0x95, 0x72, 0x48, 0x1D, 0x00, 0x00, 0x0C, 0x36, 0x61, 0x8B, 0x95, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x0C, 0x13, 0x3C, 0x61,
+    0x6A, 0x6A, 0x66, 0x44, 0x1B, 0x00, 0x00, 0x0A, 0x33, 0x5A, 0xFE, 0x6A, 0x01, 0x4D, 0x24, 0xFE, 0x00, 0x07, 0x03, 0x25,
+    0x3C, 0x40, 0x40, 0x3E, 0x2B, 0x0A, 0xFE, 0x00, 0x01, 0x1E, 0x39, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xFD, 0x00, 0x05, 0x03,
+    0x13, 0x15, 0x15, 0x14, 0x07, 0xFC, 0x00, 0x00, 0x11, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x01,
+    0x03, 0x1E, 0xFD, 0x2A, 0x04, 0x23, 0x0B, 0x00, 0x06, 0x20, 0xFE, 0x2A, 0x01, 0x26, 0x10, 0xFC, 0x00, 0x02, 0x1B, 0x3F,
+    0x54, 0xFE, 0x55, 0x04, 0x47, 0x25, 0x00, 0x1F, 0x42, 0xFE, 0x55, 0x02, 0x4C, 0x2C, 0x06, 0xFD, 0x00, 0x02, 0x25, 0x50,
+    0x7A, 0xFE, 0x7F, 0x0A, 0x5D, 0x36, 0x0F, 0x29, 0x54, 0x7E, 0x7F, 0x7F, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0xAA, 0x95, 0x6D, 0x46, 0x1F, 0x29, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0xB1, 0xA5, 0x7D, 0x56, 0x2F, 0x29, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x92, 0x98, 0x8E, 0x66, 0x3F, 0x29, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x88, 0x9E, 0x76, 0x4F, 0x29, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x78, 0x9F, 0x86, 0x5F, 0x38, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x68, 0x8F, 0x97, 0x6F, 0x48, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x7F, 0xA6, 0x7F, 0x58, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x6F, 0x96, 0x90, 0x68, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x5F, 0x86, 0xA0, 0x78, 0x54, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x4F, 0x76, 0x9D, 0x88, 0x61, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x3E, 0x66, 0x8D, 0x99, 0x71, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x56, 0x7D, 0xA4, 0x81, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x46, 0x6D, 0x94, 0x92, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x35, 0x5D, 0x84, 0xA2, 0x7E, 0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x25, 0x4D, 0x74, 0x9B, 0x99, 0xB0, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x15, 0x3C, 0x64, 0x8B, 0xB2, 0xB8, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50,
+    0x7A, 0x95, 0x91, 0x67, 0x3C, 0x12, 0x2C, 0x54, 0x7B, 0x95, 0x95, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x01, 0x23, 0x4B,
+    0xFE, 0x6A, 0x05, 0x5F, 0x39, 0x10, 0x1C, 0x44, 0x66, 0xFE, 0x6A, 0x02, 0x5C, 0x35, 0x0C, 0xFD, 0x00, 0x01, 0x11, 0x30,
+    0xFE, 0x40, 0x05, 0x3B, 0x23, 0x00, 0x0A, 0x2B, 0x3E, 0xFE, 0x40, 0x01, 0x3A, 0x20, 0xFB, 0x00, 0x00, 0x0B, 0xFE, 0x15,
+    0x05, 0x12, 0x02, 0x00, 0x00, 0x07, 0x14, 0xFE, 0x15, 0x00, 0x11, 0x81, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x04, 0x06,
+    0x0C, 0x0D, 0x0A, 0x01, 0xF3, 0x00, 0x08, 0x14, 0x25, 0x30, 0x36, 0x37, 0x34, 0x2B, 0x1C, 0x08, 0xF7, 0x00, 0x0B, 0x04,
+    0x21, 0x39, 0x4C, 0x59, 0x60, 0x62, 0x5D, 0x53, 0x43, 0x2C, 0x11, 0xF8, 0x00, 0x0C, 0x21, 0x40, 0x5D, 0x73, 0x83, 0x8B,
+    0x8C, 0x87, 0x7A, 0x67, 0x4D, 0x30, 0x0E, 0xFA, 0x00, 0x0E, 0x16, 0x3B, 0x5D, 0x7C, 0x97, 0xAA, 0x9C, 0x9A, 0xA2, 0xA1,
+    0x89, 0x6C, 0x4A, 0x27, 0x01, 0xFC, 0x00, 0x0F, 0x02, 0x2A, 0x50, 0x75, 0x98, 0xA2, 0x85, 0x73, 0x70, 0x7B, 0x94, 0xA7,
+    0x86, 0x60, 0x3B, 0x14, 0xFC, 0x00, 0x0F, 0x11, 0x39, 0x60, 0x88, 0xAF, 0x8A, 0x66, 0x4B, 0x46, 0x58, 0x79, 0x9F, 0x9A,
+    0x72, 0x4B, 0x23, 0xFC, 0x00, 0x10, 0x1B, 0x45, 0x6E, 0x97, 0xA3, 0x7A, 0x52, 0x2B, 0x1C, 0x40, 0x68, 0x90, 0xA9, 0x80,
+    0x57, 0x2E, 0x05, 0xFD, 0x00, 0x10, 0x24, 0x4D, 0x77, 0xA1, 0x9A, 0x70, 0x46, 0x1D, 0x0A, 0x33, 0x5D, 0x87, 0xB1, 0x8A,
+    0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x2A, 0x54, 0x7E, 0xA8, 0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2C, 0x57, 0x81, 0xAB, 0x91,
+    0x67, 0x3D, 0x12, 0xFE, 0x00, 0x11, 0x03, 0x2D, 0x58, 0x82, 0xAC, 0x90, 0x66, 0x3C, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8,
+    0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x11, 0x05, 0x2F, 0x5A, 0x84, 0xAF, 0x8F, 0x64, 0x3A, 0x0F, 0x00, 0x27, 0x51, 0x7C,
+    0xA6, 0x97, 0x6D, 0x42, 0x18, 0xFE, 0x00, 0x11, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8E, 0x64, 0x39, 0x0F, 0x00, 0x26, 0x51,
+    0x7B, 0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x04, 0x2F, 0x59, 0x84, 0xAE, 0x8F, 0x65, 0x3A, 0x10, 0x00, 0x27,
+    0x52, 0x7C, 0xA6, 0x97, 0x6C, 0x42, 0x17, 0xFE, 0x00, 0x11, 0x01, 0x2C, 0x56, 0x80, 0xAB, 0x92, 0x67, 0x3D, 0x13, 0x00,
+    0x2A, 0x54, 0x7F, 0xA9, 0x93, 0x69, 0x3F, 0x14, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7B, 0xA5, 0x96, 0x6C, 0x42, 0x18, 0x05,
+    0x2F, 0x59, 0x83, 0xAD, 0x8E, 0x64, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9D, 0x9D, 0x74, 0x4B, 0x22, 0x10,
+    0x38, 0x61, 0x8A, 0xAF, 0x86, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x0F, 0x17, 0x40, 0x69, 0x91, 0xA8, 0x81, 0x5A, 0x38, 0x2F,
+    0x49, 0x6F, 0x96, 0xA2, 0x7A, 0x52, 0x29, 0xFC, 0x00, 0x0F, 0x0A, 0x32, 0x5A, 0x80, 0xA5, 0x94, 0x73, 0x5D, 0x5A, 0x68,
+    0x85, 0xA8, 0x90, 0x6B, 0x43, 0x1C, 0xFB, 0x00, 0x0E, 0x21, 0x46, 0x6B, 0x8C, 0xAA, 0x96, 0x86, 0x84, 0x8D, 0xA3, 0x9A,
+    0x79, 0x57, 0x31, 0x0C, 0xFB, 0x00, 0x0D, 0x0D, 0x2F, 0x51, 0x6E, 0x87, 0x98, 0xA1, 0xA2, 0x9D, 0x8F, 0x7A, 0x5E, 0x3E,
+    0x1C, 0xF9, 0x00, 0x0C, 0x15, 0x32, 0x4C, 0x61, 0x6F, 0x77, 0x78, 0x73, 0x68, 0x56, 0x3E, 0x22, 0x02, 0xF8, 0x00, 0x0A,
+    0x11, 0x28, 0x3A, 0x46, 0x4C, 0x4E, 0x4A, 0x40, 0x31, 0x1B, 0x02, 0xF6, 0x00, 0x07, 0x02, 0x12, 0x1C, 0x22, 0x23, 0x20,
+    0x17, 0x09, 0x81, 0x00, 0xFC, 0x00, 0x81, 0x00, 0x02, 0x00, 0x0D, 0x24, 0xFB, 0x2A, 0x03, 0x29, 0x23, 0x1A, 0x0C, 0xF9,
+    0x00, 0x02, 0x01, 0x28, 0x49, 0xFB, 0x55, 0x05, 0x53, 0x4D, 0x43, 0x34, 0x1F, 0x06, 0xFB, 0x00, 0x02, 0x08, 0x33, 0x5D,
+    0xFB, 0x7F, 0x06, 0x7D, 0x76, 0x6B, 0x59, 0x42, 0x26, 0x07, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xAA, 0xA9, 0xFE,
+    0xA8, 0x06, 0xA7, 0xA0, 0x93, 0x7D, 0x62, 0x43, 0x20, 0xFC, 0x00, 0x10, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x7D, 0x7D,
+    0x7E, 0x82, 0x90, 0xA8, 0x9E, 0x7E, 0x5A, 0x34, 0x0D, 0xFD, 0x00, 0x10, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x53,
+    0x53, 0x59, 0x6C, 0x8B, 0xAF, 0x93, 0x6B, 0x43, 0x1A, 0xFD, 0x00, 0x10, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32,
+    0x29, 0x31, 0x50, 0x77, 0x9F, 0x9F, 0x75, 0x4C, 0x22, 0xFD, 0x00, 0x10, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32,
+    0x07, 0x1A, 0x45, 0x6F, 0x9A, 0xA4, 0x7A, 0x4F, 0x25, 0xFD, 0x00, 0x10, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32,
+    0x15, 0x22, 0x48, 0x72, 0x9C, 0xA3, 0x78, 0x4E, 0x23, 0xFD, 0x00, 0x10, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x3F,
+    0x3F, 0x46, 0x5E, 0x80, 0xA6, 0x9A, 0x71, 0x48, 0x1E, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFE, 0x69,
+    0x07, 0x6F, 0x7F, 0x9A, 0xAC, 0x89, 0x63, 0x3C, 0x13, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x95, 0xFE, 0x94,
+    0x07, 0x98, 0xA5, 0xA5, 0x8E, 0x70, 0x4E, 0x2A, 0x04, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x95, 0xFE, 0x93,
+    0x06, 0x91, 0x8A, 0x7E, 0x6B, 0x52, 0x34, 0x13, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFE, 0x69, 0x05,
+    0x67, 0x61, 0x56, 0x46, 0x30, 0x16, 0xFB, 0x00, 0x0D, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x3E, 0x3E, 0x3D, 0x37,
+    0x2E, 0x1F, 0x0C, 0xFA, 0x00, 0x0B, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0x14, 0x12, 0x0D, 0x04, 0xF8, 0x00,
+    0x08, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0x07, 0xF5, 0x00, 0x08, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C,
+    0x32, 0x07, 0xF5, 0x00, 0x08, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0x07, 0xF5, 0x00, 0x08, 0x08, 0x33, 0x5D,
+    0x88, 0x95, 0x87, 0x5C, 0x32, 0x07, 0xF5, 0x00, 0x02, 0x06, 0x30, 0x57, 0xFE, 0x6A, 0x02, 0x57, 0x2F, 0x06, 0xF4, 0x00,
+    0x01, 0x1C, 0x37, 0xFE, 0x40, 0x01, 0x37, 0x1B, 0xF2, 0x00, 0x00, 0x10, 0xFE, 0x15, 0x00, 0x10, 0x81, 0x00, 0xF7, 0x00,
+    0x90, 0x00, 0x04, 0x06, 0x0C, 0x0D, 0x0A, 0x01, 0xF3, 0x00, 0x08, 0x14, 0x25, 0x30, 0x36, 0x37, 0x34, 0x2B, 0x1C, 0x08,
+    0xF7, 0x00, 0x0B, 0x04, 0x21, 0x39, 0x4C, 0x59, 0x60, 0x62, 0x5D, 0x53, 0x43, 0x2C, 0x11, 0xF8, 0x00, 0x0C, 0x21, 0x40,
+    0x5D, 0x73, 0x83, 0x8B, 0x8C, 0x87, 0x7A, 0x67, 0x4D, 0x30, 0x0E, 0xFA, 0x00, 0x0E, 0x16, 0x3B, 0x5D, 0x7C, 0x97, 0xAA,
+    0x9C, 0x9A, 0xA2, 0xA1, 0x89, 0x6C, 0x4A, 0x27, 0x01, 0xFC, 0x00, 0x0F, 0x02, 0x2A, 0x50, 0x75, 0x98, 0xA2, 0x85, 0x73,
+    0x70, 0x7B, 0x94, 0xA7, 0x86, 0x60, 0x3B, 0x14, 0xFC, 0x00, 0x0F, 0x11, 0x39, 0x60, 0x88, 0xAF, 0x8A, 0x66, 0x4B, 0x46,
+    0x58, 0x79, 0x9F, 0x9A, 0x72, 0x4B, 0x23, 0xFC, 0x00, 0x10, 0x1B, 0x45, 0x6E, 0x97, 0xA3, 0x7A, 0x52, 0x2B, 0x1C, 0x40,
+    0x68, 0x90, 0xA9, 0x80, 0x57, 0x2E, 0x05, 0xFD, 0x00, 0x10, 0x24, 0x4D, 0x77, 0xA1, 0x9A, 0x70, 0x46, 0x1D, 0x0A, 0x33,
+    0x5D, 0x87, 0xB1, 0x8A, 0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x2A, 0x54, 0x7E, 0xA8, 0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2C,
+    0x57, 0x81, 0xAB, 0x91, 0x67, 0x3D, 0x12, 0xFE, 0x00, 0x11, 0x03, 0x2D, 0x58, 0x82, 0xAC, 0x90, 0x66, 0x3C, 0x11, 0x00,
+    0x28, 0x53, 0x7D, 0xA8, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x11, 0x05, 0x2F, 0x5A, 0x84, 0xAF, 0x8F, 0x64, 0x3A, 0x0F,
+    0x00, 0x27, 0x51, 0x7C, 0xA6, 0x97, 0x6D, 0x42, 0x18, 0xFE, 0x00, 0x11, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8E, 0x64, 0x39,
+    0x0F, 0x00, 0x26, 0x51, 0x7B, 0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x04, 0x2F, 0x59, 0x84, 0xAE, 0x8F, 0x65,
+    0x3A, 0x10, 0x00, 0x27, 0x52, 0x7C, 0xA6, 0x97, 0x6C, 0x42, 0x17, 0xFE, 0x00, 0x11, 0x01, 0x2C, 0x56, 0x80, 0xAB, 0x92,
+    0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F, 0xA9, 0x94, 0x6A, 0x3F, 0x15, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7B, 0xA5, 0x96,
+    0x6C, 0x42, 0x18, 0x05, 0x2F, 0x59, 0x83, 0xAD, 0x8E, 0x65, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x73, 0x9C, 0x9D,
+    0x74, 0x4B, 0x22, 0x10, 0x38, 0x61, 0x8A, 0xB0, 0x86, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x0F, 0x16, 0x3F, 0x69, 0x90, 0xA8,
+    0x81, 0x5A, 0x38, 0x2F, 0x49, 0x6F, 0x96, 0xA3, 0x7B, 0x52, 0x2A, 0xFC, 0x00, 0x0F, 0x0A, 0x32, 0x59, 0x80, 0xA5, 0x94,
+    0x73, 0x5D, 0x5A, 0x68, 0x85, 0xA8, 0x91, 0x6B, 0x44, 0x1D, 0xFB, 0x00, 0x0E, 0x21, 0x46, 0x6A, 0x8C, 0xAA, 0x96, 0x86,
+    0x84, 0x8D, 0xA3, 0x9A, 0x7A, 0x57, 0x32, 0x0C, 0xFB, 0x00, 0x0D, 0x0C, 0x2F, 0x50, 0x6E, 0x86, 0x98, 0xA1, 0xA2, 0xB1,
+    0x92, 0x7A, 0x5E, 0x3F, 0x1C, 0xF9, 0x00, 0x0D, 0x14, 0x31, 0x4C, 0x61, 0x6F, 0x77, 0x78, 0x93, 0xA0, 0x83, 0x66, 0x48,
+    0x2B, 0x0B, 0xF9, 0x00, 0x0C, 0x11, 0x28, 0x39, 0x46, 0x4C, 0x57, 0x76, 0x94, 0xA2, 0x84, 0x67, 0x44, 0x1B, 0xF8, 0x00,
+    0x0B, 0x02, 0x12, 0x1C, 0x22, 0x3A, 0x58, 0x77, 0x95, 0x7E, 0x66, 0x44, 0x1B, 0xF4, 0x00, 0x07, 0x1C, 0x3B, 0x59, 0x71,
+    0x5A, 0x43, 0x2B, 0x0A, 0xF3, 0x00, 0x05, 0x1D, 0x3B, 0x47, 0x37, 0x1F, 0x08, 0xF1, 0x00, 0x02, 0x15, 0x1C, 0x12, 0xBC,
+    0x00, 0x81, 0x00, 0x01, 0x02, 0x1D, 0xFB, 0x2A, 0x03, 0x29, 0x24, 0x1B, 0x0E, 0xF8, 0x00, 0x02, 0x1A, 0x3E, 0x54, 0xFC,
+    0x55, 0x05, 0x53, 0x4E, 0x44, 0x36, 0x22, 0x0A, 0xFA, 0x00, 0x02, 0x23, 0x4E, 0x78, 0xFC, 0x7F, 0x06, 0x7E, 0x78, 0x6D,
+    0x5C, 0x45, 0x2A, 0x0C, 0xFB, 0x00, 0x04, 0x23, 0x4E, 0x78, 0xA3, 0xAA, 0xFD, 0xA8, 0x06, 0xA1, 0x94, 0x81, 0x66, 0x48,
+    0x25, 0x01, 0xFC, 0x00, 0x04, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0xFE, 0x7D, 0x07, 0x81, 0x8C, 0xA3, 0xA3, 0x83, 0x60, 0x3A,
+    0x13, 0xFC, 0x00, 0x0F, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x53, 0x53, 0x57, 0x67, 0x84, 0xA8, 0x99, 0x72, 0x49, 0x20,
+    0xFC, 0x00, 0x0F, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42, 0x28, 0x2E, 0x49, 0x71, 0x99, 0xA6, 0x7C, 0x52, 0x28, 0xFC,
+    0x00, 0x0F, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42, 0x18, 0x15, 0x40, 0x6A, 0x95, 0xAA, 0x80, 0x55, 0x2B, 0xFC, 0x00,
+    0x0F, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42, 0x24, 0x28, 0x46, 0x6E, 0x98, 0xA6, 0x7C, 0x52, 0x28, 0xFC, 0x00, 0x0F,
+    0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x4E, 0x4E, 0x51, 0x61, 0x7F, 0xA4, 0x97, 0x71, 0x49, 0x20, 0xFC, 0x00, 0x04, 0x23,
+    0x4E, 0x78, 0xA3, 0x97, 0xFE, 0x79, 0x07, 0x7B, 0x86, 0x9C, 0x9A, 0x7E, 0x5D, 0x38, 0x12, 0xFC, 0x00, 0x04, 0x23, 0x4E,
+    0x78, 0xA3, 0xAA, 0xFE, 0xA3, 0x06, 0xA5, 0x94, 0x84, 0x76, 0x5F, 0x42, 0x21, 0xFB, 0x00, 0x04, 0x23, 0x4E, 0x78, 0xA3,
+    0x97, 0xFE, 0x84, 0x06, 0x8B, 0x9E, 0x94, 0x7B, 0x5A, 0x37, 0x13, 0xFB, 0x00, 0x0F, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D,
+    0x59, 0x5A, 0x63, 0x7E, 0x9F, 0x96, 0x72, 0x4D, 0x28, 0x02, 0xFC, 0x00, 0x0F, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42,
+    0x2F, 0x42, 0x64, 0x89, 0xAC, 0x87, 0x61, 0x3B, 0x15, 0xFC, 0x00, 0x10, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42, 0x18,
+    0x2A, 0x4F, 0x75, 0x9B, 0x9B, 0x74, 0x4E, 0x28, 0x02, 0xFD, 0x00, 0x10, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42, 0x18,
+    0x16, 0x3C, 0x63, 0x89, 0xAD, 0x87, 0x61, 0x3B, 0x15, 0xFD, 0x00, 0x11, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42, 0x18,
+    0x04, 0x2A, 0x50, 0x77, 0x9D, 0x9A, 0x74, 0x4E, 0x28, 0x02, 0xFE, 0x00, 0x11, 0x23, 0x4E, 0x78, 0xA3, 0x97, 0x6D, 0x42,
+    0x18, 0x00, 0x18, 0x3E, 0x65, 0x8B, 0xAD, 0x87, 0x61, 0x3B, 0x15, 0xFE, 0x00, 0x11, 0x23, 0x4E, 0x78, 0x95, 0x95, 0x6D,
+    0x42, 0x18, 0x00, 0x06, 0x2C, 0x53, 0x79, 0x95, 0x95, 0x74, 0x4E, 0x26, 0xFE, 0x00, 0x0C, 0x21, 0x49, 0x69, 0x6A, 0x6A,
+    0x63, 0x3F, 0x15, 0x00, 0x00, 0x1A, 0x40, 0x64, 0xFE, 0x6A, 0x01, 0x4E, 0x26, 0xFE, 0x00, 0x0C, 0x0F, 0x2E, 0x3F, 0x40,
+    0x40, 0x3D, 0x27, 0x06, 0x00, 0x00, 0x07, 0x28, 0x3D, 0xFE, 0x40, 0x01, 0x32, 0x14, 0xFD, 0x00, 0x00, 0x0A, 0xFE, 0x15,
+    0x01, 0x14, 0x05, 0xFD, 0x00, 0x01, 0x06, 0x14, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x90, 0x00, 0x04, 0x06, 0x0C, 0x0D,
+    0x0B, 0x06, 0xF4, 0x00, 0x0A, 0x03, 0x16, 0x26, 0x30, 0x36, 0x38, 0x35, 0x30, 0x27, 0x1C, 0x0E, 0xF8, 0x00, 0x0C, 0x0D,
+    0x27, 0x3D, 0x4E, 0x5A, 0x61, 0x62, 0x60, 0x59, 0x50, 0x44, 0x36, 0x1E, 0xFA, 0x00, 0x0E, 0x0B, 0x2B, 0x48, 0x61, 0x75,
+    0x83, 0x8B, 0x8D, 0x8A, 0x83, 0x79, 0x6C, 0x5A, 0x35, 0x0C, 0xFB, 0x00, 0x0E, 0x24, 0x46, 0x67, 0x84, 0x9B, 0xA7, 0x9D,
+    0x99, 0x9C, 0xA4, 0xA2, 0x8F, 0x64, 0x3A, 0x0F, 0xFC, 0x00, 0x0F, 0x10, 0x37, 0x5D, 0x82, 0xA3, 0x96, 0x80, 0x73, 0x6F,
+    0x72, 0x7C, 0x8A, 0x8F, 0x64, 0x3A, 0x0F, 0xFC, 0x00, 0x0F, 0x1C, 0x46, 0x6E, 0x96, 0x9D, 0x79, 0x5B, 0x49, 0x44, 0x48,
+    0x53, 0x63, 0x78, 0x64, 0x3A, 0x0F, 0xFC, 0x00, 0x0F, 0x23, 0x4D, 0x78, 0xA1, 0x91, 0x68, 0x3F, 0x21, 0x1A, 0x1E, 0x2B,
+    0x3E, 0x52, 0x4D, 0x2E, 0x08, 0xFC, 0x00, 0x0E, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x68, 0x3E, 0x27, 0x1B, 0x12, 0x08, 0x19,
+    0x29, 0x26, 0x12, 0xFB, 0x00, 0x0C, 0x21, 0x4B, 0x75, 0x9E, 0x9D, 0x79, 0x5F, 0x50, 0x45, 0x3C, 0x31, 0x22, 0x11, 0xF9,
+    0x00, 0x0E, 0x18, 0x41, 0x68, 0x8E, 0xB0, 0x99, 0x86, 0x78, 0x6E, 0x65, 0x59, 0x49, 0x36, 0x1E, 0x03, 0xFB, 0x00, 0x0E,
+    0x09, 0x2F, 0x53, 0x74, 0x8F, 0xA5, 0xAD, 0xA1, 0x98, 0x8E, 0x81, 0x70, 0x5A, 0x3F, 0x21, 0xFA, 0x00, 0x0E, 0x18, 0x38,
+    0x54, 0x6B, 0x7E, 0x8C, 0x97, 0xA0, 0xAB, 0xA8, 0x95, 0x7B, 0x5D, 0x3A, 0x16, 0xFA, 0x00, 0x0D, 0x18, 0x31, 0x46, 0x56,
+    0x63, 0x6D, 0x77, 0x82, 0x93, 0xAC, 0x98, 0x75, 0x4E, 0x27, 0xF9, 0x00, 0x0D, 0x0C, 0x1F, 0x2E, 0x3A, 0x44, 0x4E, 0x5B,
+    0x70, 0x8F, 0xAD, 0x85, 0x5C, 0x33, 0x09, 0xFC, 0x00, 0x0F, 0x0F, 0x1E, 0x1B, 0x09, 0x06, 0x11, 0x1B, 0x24, 0x34, 0x56,
+    0x7F, 0xA9, 0x8D, 0x63, 0x39, 0x0E, 0xFD, 0x00, 0x10, 0x0E, 0x31, 0x48, 0x43, 0x2D, 0x1A, 0x0B, 0x04, 0x06, 0x27, 0x51,
+    0x7B, 0xA6, 0x8E, 0x64, 0x3A, 0x0F, 0xFD, 0x00, 0x10, 0x1B, 0x45, 0x6D, 0x67, 0x53, 0x41, 0x35, 0x2E, 0x30, 0x3E, 0x5C,
+    0x83, 0xAB, 0x8A, 0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x1C, 0x46, 0x71, 0x8C, 0x79, 0x69, 0x5E, 0x59, 0x5A, 0x64, 0x79,
+    0x98, 0xA3, 0x7D, 0x55, 0x2D, 0x04, 0xFD, 0x00, 0x0F, 0x1C, 0x46, 0x71, 0x9B, 0xA0, 0x92, 0x88, 0x83, 0x84, 0x8C, 0x9C,
+    0xA6, 0x8A, 0x69, 0x44, 0x1E, 0xFC, 0x00, 0x0F, 0x1B, 0x45, 0x6E, 0x81, 0x8E, 0x99, 0xA0, 0xA3, 0xA2, 0x9D, 0x93, 0x82,
+    0x6B, 0x4E, 0x2D, 0x0B, 0xFC, 0x00, 0x0E, 0x0F, 0x32, 0x4A, 0x59, 0x65, 0x6F, 0x76, 0x78, 0x78, 0x73, 0x6B, 0x5C, 0x48,
+    0x2F, 0x12, 0xFA, 0x00, 0x0C, 0x11, 0x23, 0x31, 0x3C, 0x45, 0x4B, 0x4E, 0x4D, 0x49, 0x41, 0x34, 0x23, 0x0D, 0xF7, 0x00,
+    0x08, 0x08, 0x13, 0x1B, 0x21, 0x23, 0x23, 0x1F, 0x18, 0x0C, 0x81, 0x00, 0xFC, 0x00, 0x82, 0x00, 0x01, 0x06, 0x1F, 0xF3,
+    0x2A, 0x01, 0x27, 0x12, 0xFE, 0x00, 0x01, 0x1E, 0x42, 0xF3, 0x55, 0x07, 0x4E, 0x2F, 0x09, 0x00, 0x00, 0x28, 0x53, 0x7D,
+    0xF4, 0x7F, 0x08, 0x66, 0x3B, 0x11, 0x00, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0xF6, 0xAA, 0x08, 0x90, 0x66, 0x3B, 0x11, 0x00,
+    0x00, 0x28, 0x53, 0x7D, 0xFC, 0x7F, 0x01, 0x93, 0xA7, 0xFB, 0x7F, 0x06, 0x66, 0x3B, 0x11, 0x00, 0x00, 0x1E, 0x42, 0xFC,
+    0x55, 0x03, 0x68, 0x93, 0xA7, 0x7C, 0xFC, 0x55, 0x06, 0x4E, 0x2F, 0x09, 0x00, 0x00, 0x06, 0x1F, 0xFD, 0x2A, 0x05, 0x3E,
+    0x68, 0x93, 0xA7, 0x7C, 0x52, 0xFD, 0x2A, 0x01, 0x27, 0x12, 0xF9, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52,
+    0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7,
+    0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68,
+    0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13,
+    0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00,
+    0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27,
+    0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C,
+    0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x95, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x02, 0x11, 0x3A, 0x60, 0xFE,
+    0x6A, 0x01, 0x4D, 0x25, 0xF4, 0x00, 0x02, 0x02, 0x24, 0x3C, 0xFE, 0x40, 0x01, 0x31, 0x13, 0xF3, 0x00, 0x01, 0x03, 0x13,
+    0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00, 0x01, 0x00, 0x1C, 0xFE, 0x2A, 0x05, 0x29, 0x18, 0x00, 0x00,
+    0x0C, 0x23, 0xFE, 0x2A, 0x01, 0x24, 0x0D, 0xFC, 0x00, 0x0A, 0x18, 0x3C, 0x54, 0x55, 0x55, 0x52, 0x36, 0x11, 0x00, 0x26,
+    0x48, 0xFE, 0x55, 0x02, 0x49, 0x28, 0x02, 0xFD, 0x00, 0x0A, 0x21, 0x4C, 0x76, 0x7F, 0x7F, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0xFE, 0x7F, 0x02, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xAA, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31,
+    0x5B, 0x86, 0xB0, 0x88, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x10, 0x1E, 0x48, 0x73, 0x9D, 0x9A, 0x6F, 0x45, 0x1B, 0x07, 0x32,
+    0x5C, 0x87, 0xB0, 0x85, 0x5B, 0x31, 0x06, 0xFD, 0x00, 0x10, 0x1A, 0x43, 0x6D, 0x97, 0x9E, 0x74, 0x4D, 0x32, 0x2F, 0x3E,
+    0x62, 0x8B, 0xAA, 0x80, 0x56, 0x2C, 0x02, 0xFD, 0x00, 0x0F, 0x12, 0x3B, 0x63, 0x8B, 0xAB, 0x88, 0x6B, 0x5B, 0x59, 0x62,
+    0x7A, 0x9B, 0x9C, 0x75, 0x4D, 0x24, 0xFC, 0x00, 0x0F, 0x05, 0x2C, 0x52, 0x76, 0x96, 0xA6, 0x90, 0x85, 0x83, 0x8A, 0x9B,
+    0xA3, 0x85, 0x63, 0x3D, 0x17, 0xFB, 0x00, 0x0E, 0x18, 0x3B, 0x5A, 0x75, 0x8B, 0x9A, 0xA2, 0xA3, 0x9E, 0x93, 0x80, 0x67,
+    0x49, 0x27, 0x04, 0xFA, 0x00, 0x0C, 0x1E, 0x3A, 0x52, 0x64, 0x71, 0x77, 0x78, 0x74, 0x6B, 0x5B, 0x45, 0x2B, 0x0D, 0xF8,
+    0x00, 0x0A, 0x17, 0x2C, 0x3C, 0x47, 0x4D, 0x4E, 0x4A, 0x42, 0x34, 0x21, 0x0A, 0xF6, 0x00, 0x07, 0x06, 0x14, 0x1D, 0x23,
+    0x23, 0x20, 0x19, 0x0C, 0x81, 0x00, 0xFC, 0x00, 0x82, 0x00, 0x01, 0x02, 0x1D, 0xFE, 0x2A, 0x01, 0x29, 0x18, 0xFD, 0x00,
+    0x01, 0x0C, 0x23, 0xFE, 0x2A, 0x01, 0x25, 0x0F, 0xFE, 0x00, 0x07, 0x1A, 0x3E, 0x54, 0x55, 0x55, 0x52, 0x37, 0x12, 0xFE,
+    0x00, 0x01, 0x27, 0x48, 0xFE, 0x55, 0x11, 0x4B, 0x2B, 0x04, 0x00, 0x00, 0x23, 0x4E, 0x78, 0x7F, 0x7F, 0x70, 0x47, 0x1E,
+    0x00, 0x00, 0x0B, 0x34, 0x5D, 0xFE, 0x7F, 0x2B, 0x61, 0x36, 0x0C, 0x00, 0x00, 0x1B, 0x44, 0x6D, 0x96, 0xA4, 0x7B, 0x52,
+    0x28, 0x00, 0x00, 0x16, 0x3F, 0x68, 0x91, 0xA8, 0x7F, 0x56, 0x2E, 0x05, 0x00, 0x00, 0x0F, 0x38, 0x61, 0x8A, 0xAF, 0x85,
+    0x5C, 0x33, 0x0A, 0x00, 0x21, 0x4A, 0x73, 0x9C, 0x9C, 0x73, 0x4A, 0x22, 0xFE, 0x00, 0x11, 0x03, 0x2C, 0x55, 0x7E, 0xA6,
+    0x90, 0x67, 0x3E, 0x15, 0x03, 0x2C, 0x55, 0x7E, 0xA7, 0x90, 0x67, 0x3E, 0x16, 0xFD, 0x00, 0x10, 0x20, 0x49, 0x72, 0x9B,
+    0x9B, 0x72, 0x49, 0x20, 0x0E, 0x37, 0x60, 0x89, 0xAD, 0x84, 0x5B, 0x32, 0x0A, 0xFD, 0x00, 0x0F, 0x14, 0x3D, 0x66, 0x8F,
+    0xA6, 0x7D, 0x54, 0x2B, 0x19, 0x42, 0x6B, 0x94, 0xA1, 0x78, 0x4F, 0x27, 0xFC, 0x00, 0x0F, 0x08, 0x31, 0x5A, 0x83, 0xAB,
+    0x88, 0x5F, 0x36, 0x23, 0x4D, 0x76, 0x9F, 0x95, 0x6C, 0x43, 0x1B, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x77, 0x9F, 0x93, 0x6A,
+    0x41, 0x2E, 0x57, 0x80, 0xAA, 0x89, 0x60, 0x37, 0x0F, 0xFB, 0x00, 0x0E, 0x19, 0x42, 0x6B, 0x94, 0x9E, 0x75, 0x4B, 0x39,
+    0x62, 0x8B, 0xA6, 0x7D, 0x54, 0x2C, 0x03, 0xFB, 0x00, 0x0D, 0x0D, 0x36, 0x5F, 0x88, 0xA8, 0x7F, 0x56, 0x44, 0x6D, 0x96,
+    0x9A, 0x71, 0x48, 0x20, 0xFA, 0x00, 0x0D, 0x01, 0x2A, 0x53, 0x7C, 0xA4, 0x8A, 0x61, 0x4F, 0x78, 0xA1, 0x8E, 0x65, 0x3C,
+    0x14, 0xF9, 0x00, 0x0C, 0x1E, 0x47, 0x70, 0x99, 0x95, 0x6C, 0x5A, 0x83, 0xAB, 0x82, 0x59, 0x30, 0x08, 0xF9, 0x00, 0x0B,
+    0x12, 0x3B, 0x64, 0x8D, 0xA0, 0x77, 0x65, 0x8E, 0x9F, 0x76, 0x4D, 0x25, 0xF8, 0x00, 0x0B, 0x06, 0x2F, 0x58, 0x81, 0xA9,
+    0x82, 0x70, 0x99, 0x93, 0x6A, 0x41, 0x19, 0xF7, 0x00, 0x0A, 0x23, 0x4C, 0x75, 0x9D, 0x8D, 0x7B, 0xA4, 0x87, 0x5E, 0x35,
+    0x0D, 0xF7, 0x00, 0x0A, 0x17, 0x40, 0x69, 0x92, 0x98, 0x86, 0xA4, 0x7B, 0x52, 0x2A, 0x01, 0xF7, 0x00, 0x09, 0x0B, 0x34,
+    0x5D, 0x86, 0xA5, 0x98, 0x98, 0x6F, 0x46, 0x1E, 0xF5, 0x00, 0x08, 0x28, 0x51, 0x7A, 0x95, 0x95, 0x8C, 0x63, 0x3A, 0x12,
+    0xF5, 0x00, 0x02, 0x1C, 0x45, 0x67, 0xFE, 0x6A, 0x02, 0x56, 0x2E, 0x06, 0xF5, 0x00, 0x02, 0x0B, 0x2B, 0x3F, 0xFE, 0x40,
+    0x01, 0x36, 0x1B, 0xF3, 0x00, 0x00, 0x08, 0xFD, 0x15, 0x00, 0x0F, 0x81, 0x00, 0xFB, 0x00, 0x82, 0x00, 0x01, 0x15, 0x28,
+    0xFE, 0x2A, 0x01, 0x1C, 0x01, 0xFC, 0x00, 0x01, 0x11, 0x26, 0xFE, 0x2A, 0x0A, 0x1F, 0x06, 0x00, 0x0D, 0x33, 0x50, 0x55,
+    0x55, 0x54, 0x3D, 0x19, 0xFD, 0x00, 0x02, 0x07, 0x2E, 0x4D, 0xFE, 0x55, 0x0A, 0x42, 0x1E, 0x00, 0x15, 0x40, 0x6A, 0x7F,
+    0x7F, 0x77, 0x4D, 0x23, 0xFD, 0x00, 0x10, 0x10, 0x3A, 0x64, 0x7F, 0x7F, 0x7D, 0x53, 0x28, 0x00, 0x10, 0x3A, 0x64, 0x8E,
+    0xA7, 0x7C, 0x52, 0x28, 0xFD, 0x00, 0x11, 0x15, 0x3F, 0x69, 0x94, 0xA1, 0x77, 0x4D, 0x23, 0x00, 0x0A, 0x34, 0x5E, 0x88,
+    0xAC, 0x81, 0x57, 0x2D, 0x06, 0xFE, 0x08, 0x11, 0x1A, 0x44, 0x6E, 0x99, 0x9B, 0x71, 0x47, 0x1D, 0x00, 0x04, 0x2E, 0x58,
+    0x82, 0xAC, 0x86, 0x5C, 0x32, 0x30, 0xFE, 0x33, 0x11, 0x27, 0x49, 0x73, 0x9E, 0x95, 0x6B, 0x41, 0x16, 0x00, 0x00, 0x27,
+    0x51, 0x7B, 0xA5, 0x8B, 0x61, 0x38, 0x58, 0xFE, 0x5D, 0x45, 0x47, 0x4E, 0x78, 0xA3, 0x8E, 0x64, 0x3A, 0x10, 0x00, 0x00,
+    0x21, 0x4B, 0x75, 0x9F, 0x90, 0x66, 0x44, 0x6D, 0x88, 0x88, 0x7F, 0x56, 0x53, 0x7D, 0xA8, 0x88, 0x5E, 0x34, 0x0A, 0x00,
+    0x00, 0x1B, 0x45, 0x6F, 0x99, 0x95, 0x6B, 0x4D, 0x76, 0xA0, 0xB0, 0x88, 0x5E, 0x58, 0x82, 0xAC, 0x82, 0x58, 0x2E, 0x04,
+    0x00, 0x00, 0x15, 0x3F, 0x69, 0x93, 0x9A, 0x70, 0x55, 0x7F, 0x9E, 0x8C, 0x91, 0x67, 0x5D, 0x87, 0xA6, 0x7B, 0x51, 0x27,
+    0xFE, 0x00, 0x11, 0x0E, 0x38, 0x62, 0x8C, 0x9F, 0x75, 0x5E, 0x88, 0x95, 0x83, 0x9A, 0x70, 0x62, 0x8C, 0x9F, 0x75, 0x4B,
+    0x21, 0xFE, 0x00, 0x11, 0x08, 0x32, 0x5C, 0x86, 0xA4, 0x7A, 0x67, 0x91, 0x8B, 0x79, 0xA3, 0x79, 0x67, 0x91, 0x99, 0x6F,
+    0x45, 0x1B, 0xFE, 0x00, 0x11, 0x02, 0x2C, 0x56, 0x80, 0xA9, 0x7F, 0x70, 0x99, 0x82, 0x70, 0x99, 0x82, 0x6C, 0x96, 0x93,
+    0x69, 0x3F, 0x15, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x84, 0x79, 0xA2, 0x79, 0x66, 0x90, 0x8B, 0x71, 0x9B, 0x8C,
+    0x62, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x1F, 0x49, 0x73, 0x9D, 0x89, 0x81, 0x99, 0x6F, 0x5D, 0x86, 0x94, 0x76, 0xA0, 0x86,
+    0x5C, 0x32, 0x08, 0xFD, 0x00, 0x10, 0x19, 0x43, 0x6D, 0x97, 0x8E, 0x8A, 0x8F, 0x66, 0x53, 0x7D, 0x9D, 0x7B, 0xA5, 0x80,
+    0x56, 0x2C, 0x02, 0xFD, 0x00, 0x0F, 0x13, 0x3D, 0x67, 0x91, 0x93, 0x93, 0x86, 0x5C, 0x4A, 0x73, 0x9D, 0x80, 0xA4, 0x7A,
+    0x50, 0x25, 0xFC, 0x00, 0x0F, 0x0C, 0x36, 0x60, 0x8A, 0xA7, 0xA6, 0x7C, 0x53, 0x40, 0x6A, 0x93, 0xA0, 0x9D, 0x73, 0x49,
+    0x1F, 0xFC, 0x00, 0x0F, 0x06, 0x30, 0x5A, 0x84, 0xAE, 0x9C, 0x73, 0x49, 0x37, 0x60, 0x8A, 0xB3, 0x97, 0x6D, 0x43, 0x19,
+    0xFB, 0x00, 0x0E, 0x2A, 0x54, 0x7E, 0x95, 0x93, 0x69, 0x40, 0x2D, 0x57, 0x80, 0x95, 0x91, 0x67, 0x3D, 0x13, 0xFB, 0x00,
+    0x01, 0x23, 0x4C, 0xFE, 0x6A, 0x03, 0x5D, 0x36, 0x24, 0x4C, 0xFE, 0x6A, 0x02, 0x5C, 0x36, 0x0C, 0xFB, 0x00, 0x01, 0x11,
+    0x30, 0xFE, 0x40, 0x03, 0x3A, 0x21, 0x12, 0x31, 0xFE, 0x40, 0x01, 0x3A, 0x20, 0xF9, 0x00, 0x00, 0x0B, 0xFE, 0x15, 0x03,
+    0x12, 0x00, 0x00, 0x0B, 0xFE, 0x15, 0x00, 0x12, 0x81, 0x00, 0xFE, 0x00, 0x81, 0x00, 0x01, 0x15, 0x28, 0xFE, 0x2A, 0x01,
+    0x21, 0x09, 0xFE, 0x00, 0x01, 0x0D, 0x24, 0xFE, 0x2A, 0x01, 0x26, 0x11, 0xFE, 0x00, 0x02, 0x0D, 0x33, 0x50, 0xFE, 0x55,
+    0x06, 0x45, 0x22, 0x00, 0x00, 0x03, 0x28, 0x49, 0xFE, 0x55, 0x07, 0x4D, 0x2D, 0x07, 0x00, 0x00, 0x15, 0x3F, 0x6A, 0xFE,
+    0x7F, 0x06, 0x5D, 0x38, 0x13, 0x00, 0x19, 0x3D, 0x62, 0xFE, 0x7F, 0x17, 0x64, 0x39, 0x0F, 0x00, 0x00, 0x0D, 0x33, 0x57,
+    0x7B, 0x9F, 0x97, 0x72, 0x4D, 0x29, 0x0A, 0x2E, 0x53, 0x78, 0x9C, 0x99, 0x75, 0x52, 0x2E, 0x07, 0xFE, 0x00, 0x10, 0x1C,
+    0x41, 0x65, 0x89, 0xAC, 0x87, 0x63, 0x3E, 0x20, 0x44, 0x69, 0x8D, 0xA6, 0x82, 0x5F, 0x3B, 0x17, 0xFD, 0x00, 0x0F, 0x06,
+    0x2A, 0x4F, 0x73, 0x97, 0x9D, 0x78, 0x53, 0x35, 0x5A, 0x7E, 0xA3, 0x8F, 0x6C, 0x48, 0x24, 0xFB, 0x00, 0x0E, 0x14, 0x38,
+    0x5D, 0x81, 0xA5, 0x8D, 0x69, 0x4B, 0x6F, 0x94, 0x9C, 0x79, 0x55, 0x31, 0x0D, 0xFA, 0x00, 0x0C, 0x22, 0x46, 0x6A, 0x8F,
+    0xA3, 0x7E, 0x61, 0x85, 0xA9, 0x86, 0x62, 0x3E, 0x1A, 0xF9, 0x00, 0x0C, 0x0C, 0x30, 0x54, 0x78, 0x9D, 0x93, 0x76, 0x9B,
+    0x93, 0x6F, 0x4B, 0x27, 0x03, 0xF8, 0x00, 0x0A, 0x1A, 0x3E, 0x62, 0x86, 0xA9, 0x91, 0xA0, 0x7C, 0x58, 0x34, 0x10, 0xF7,
+    0x00, 0x09, 0x03, 0x28, 0x4C, 0x70, 0x94, 0xB0, 0x89, 0x65, 0x41, 0x1D, 0xF6, 0x00, 0x0A, 0x11, 0x35, 0x59, 0x7C, 0xA0,
+    0xA9, 0x95, 0x70, 0x4C, 0x27, 0x03, 0xF8, 0x00, 0x0B, 0x03, 0x27, 0x4B, 0x6F, 0x93, 0x9F, 0x83, 0xA8, 0x86, 0x62, 0x3E,
+    0x19, 0xF8, 0x00, 0x0C, 0x1A, 0x3E, 0x62, 0x86, 0xAA, 0x89, 0x6E, 0x93, 0x9C, 0x78, 0x54, 0x2F, 0x0B, 0xFA, 0x00, 0x0D,
+    0x0D, 0x31, 0x55, 0x79, 0x9D, 0x97, 0x73, 0x59, 0x7E, 0xA2, 0x8E, 0x6A, 0x45, 0x21, 0xFA, 0x00, 0x0E, 0x24, 0x48, 0x6C,
+    0x8F, 0xA5, 0x81, 0x5C, 0x44, 0x69, 0x8D, 0xA4, 0x80, 0x5B, 0x37, 0x12, 0xFC, 0x00, 0x10, 0x16, 0x3A, 0x5E, 0x82, 0xA6,
+    0x8F, 0x6A, 0x46, 0x2F, 0x53, 0x78, 0x9D, 0x96, 0x71, 0x4D, 0x29, 0x04, 0xFE, 0x00, 0x11, 0x09, 0x2D, 0x51, 0x75, 0x99,
+    0x9D, 0x78, 0x54, 0x30, 0x1A, 0x3E, 0x63, 0x88, 0xAC, 0x87, 0x63, 0x3F, 0x1A, 0xFE, 0x00, 0x2B, 0x20, 0x44, 0x68, 0x8C,
+    0xAA, 0x86, 0x62, 0x3E, 0x1A, 0x05, 0x29, 0x4E, 0x73, 0x98, 0x9D, 0x79, 0x55, 0x30, 0x0C, 0x00, 0x0A, 0x34, 0x5B, 0x7F,
+    0x95, 0x94, 0x70, 0x4C, 0x28, 0x03, 0x00, 0x14, 0x39, 0x5E, 0x83, 0x95, 0x8F, 0x6B, 0x45, 0x1D, 0x00, 0x0A, 0x34, 0x5B,
+    0xFE, 0x6A, 0x02, 0x5A, 0x36, 0x11, 0xFE, 0x00, 0x0B, 0x24, 0x49, 0x69, 0x6A, 0x6A, 0x67, 0x45, 0x1D, 0x00, 0x00, 0x1F,
+    0x39, 0xFE, 0x40, 0x01, 0x39, 0x1E, 0xFD, 0x00, 0x07, 0x0F, 0x2E, 0x3F, 0x40, 0x40, 0x3F, 0x2C, 0x0C, 0xFE, 0x00, 0x00,
+    0x11, 0xFE, 0x15, 0x00, 0x11, 0xFB, 0x00, 0x00, 0x0A, 0xFD, 0x15, 0x00, 0x08, 0x81, 0x00, 0x82, 0x00, 0x01, 0x09, 0x22,
+    0xFE, 0x2A, 0x01, 0x27, 0x14, 0xFD, 0x00, 0x01, 0x08, 0x21, 0xFE, 0x2A, 0x01, 0x28, 0x16, 0xFE, 0x00, 0x01, 0x23, 0x45,
+    0xFE, 0x55, 0x02, 0x4F, 0x31, 0x0C, 0xFE, 0x00, 0x01, 0x21, 0x44, 0xFE, 0x55, 0x06, 0x50, 0x33, 0x0E, 0x00, 0x03, 0x2D,
+    0x58, 0xFE, 0x7F, 0x07, 0x6B, 0x46, 0x21, 0x00, 0x00, 0x11, 0x36, 0x5B, 0xFE, 0x7F, 0x2B, 0x6B, 0x40, 0x16, 0x00, 0x00,
+    0x23, 0x48, 0x6D, 0x91, 0xA5, 0x80, 0x5A, 0x35, 0x10, 0x00, 0x25, 0x4A, 0x70, 0x95, 0xA2, 0x7D, 0x58, 0x34, 0x0E, 0x00,
+    0x00, 0x0E, 0x33, 0x57, 0x7C, 0xA1, 0x94, 0x6F, 0x4A, 0x25, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0x8C, 0x68, 0x43, 0x1E, 0xFD,
+    0x00, 0x10, 0x1D, 0x42, 0x67, 0x8C, 0xA9, 0x84, 0x5E, 0x39, 0x29, 0x4E, 0x74, 0x99, 0x9C, 0x77, 0x52, 0x2E, 0x09, 0xFD,
+    0x00, 0x0F, 0x08, 0x2D, 0x52, 0x76, 0x9B, 0x98, 0x73, 0x4E, 0x3E, 0x63, 0x88, 0xAB, 0x86, 0x62, 0x3D, 0x18, 0xFB, 0x00,
+    0x0E, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0x87, 0x62, 0x52, 0x77, 0x9D, 0x96, 0x71, 0x4C, 0x28, 0x03, 0xFB, 0x00, 0x0D, 0x02,
+    0x27, 0x4C, 0x70, 0x95, 0x9C, 0x77, 0x67, 0x8C, 0xA5, 0x80, 0x5C, 0x37, 0x12, 0xF9, 0x00, 0x0B, 0x12, 0x36, 0x5B, 0x80,
+    0xA5, 0x8B, 0x7B, 0xA0, 0x90, 0x6B, 0x46, 0x22, 0xF7, 0x00, 0x0A, 0x21, 0x46, 0x6B, 0x8F, 0xA0, 0x90, 0x9F, 0x7A, 0x56,
+    0x31, 0x0C, 0xF7, 0x00, 0x09, 0x0C, 0x31, 0x55, 0x7A, 0x9F, 0xAF, 0x8A, 0x65, 0x40, 0x1C, 0xF5, 0x00, 0x08, 0x1B, 0x40,
+    0x69, 0x94, 0xA6, 0x7B, 0x51, 0x2B, 0x06, 0xF5, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00,
+    0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26,
+    0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B,
+    0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94,
+    0x95, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x02, 0x12, 0x3B, 0x61, 0xFE, 0x6A, 0x01, 0x4C, 0x24, 0xF4, 0x00, 0x02, 0x03, 0x25,
+    0x3C, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF3, 0x00, 0x01, 0x03, 0x13, 0xFE, 0x15, 0x00, 0x0B, 0x81, 0x00, 0xFB, 0x00, 0x81,
+    0x00, 0x02, 0x00, 0x13, 0x27, 0xF5, 0x2A, 0x01, 0x1F, 0x05, 0xFD, 0x00, 0x02, 0x0A, 0x30, 0x4E, 0xF5, 0x55, 0x01, 0x41,
+    0x1E, 0xFD, 0x00, 0x02, 0x12, 0x3C, 0x67, 0xF6, 0x7F, 0x02, 0x7D, 0x53, 0x28, 0xFD, 0x00, 0x03, 0x12, 0x3C, 0x67, 0x91,
+    0xF8, 0xAA, 0x03, 0xA8, 0x7D, 0x53, 0x28, 0xFD, 0x00, 0x02, 0x12, 0x3C, 0x67, 0xF8, 0x7F, 0x04, 0xA1, 0x9C, 0x79, 0x52,
+    0x28, 0xFD, 0x00, 0x02, 0x0A, 0x30, 0x4E, 0xFA, 0x55, 0x06, 0x6B, 0x8F, 0xA8, 0x85, 0x61, 0x3E, 0x1A, 0xFC, 0x00, 0x01,
+    0x13, 0x27, 0xFC, 0x2A, 0x08, 0x3B, 0x5F, 0x82, 0xA6, 0x90, 0x6D, 0x4A, 0x26, 0x03, 0xF7, 0x00, 0x09, 0x0B, 0x2F, 0x52,
+    0x76, 0x99, 0x9C, 0x79, 0x56, 0x32, 0x0F, 0xF6, 0x00, 0x08, 0x22, 0x46, 0x69, 0x8D, 0xA8, 0x85, 0x61, 0x3E, 0x1B, 0xF6,
+    0x00, 0x09, 0x15, 0x39, 0x5D, 0x80, 0xA4, 0x90, 0x6D, 0x4A, 0x26, 0x03, 0xF7, 0x00, 0x09, 0x09, 0x2D, 0x50, 0x74, 0x98,
+    0x9C, 0x79, 0x55, 0x32, 0x0F, 0xF6, 0x00, 0x08, 0x20, 0x44, 0x67, 0x8B, 0xA8, 0x85, 0x61, 0x3E, 0x1A, 0xF6, 0x00, 0x09,
+    0x14, 0x37, 0x5B, 0x7F, 0xA2, 0x90, 0x6D, 0x4A, 0x26, 0x03, 0xF7, 0x00, 0x09, 0x07, 0x2B, 0x4E, 0x72, 0x96, 0x9C, 0x79,
+    0x55, 0x32, 0x0F, 0xF6, 0x00, 0x08, 0x1E, 0x42, 0x66, 0x89, 0xA8, 0x84, 0x61, 0x3E, 0x1A, 0xF6, 0x00, 0x08, 0x12, 0x35,
+    0x59, 0x7D, 0xA0, 0x90, 0x6D, 0x4A, 0x26, 0xFC, 0x15, 0x00, 0x10, 0xFC, 0x00, 0x07, 0x05, 0x29, 0x4D, 0x70, 0x94, 0x9C,
+    0x79, 0x55, 0xFA, 0x3F, 0x01, 0x37, 0x1C, 0xFD, 0x00, 0x05, 0x18, 0x40, 0x64, 0x87, 0xA8, 0x84, 0xF8, 0x6A, 0x02, 0x57,
+    0x30, 0x07, 0xFE, 0x00, 0x04, 0x1D, 0x47, 0x72, 0x9C, 0xA7, 0xF8, 0x94, 0x03, 0x88, 0x5D, 0x33, 0x08, 0xFE, 0x00, 0x02,
+    0x1D, 0x47, 0x72, 0xF6, 0x95, 0x03, 0x88, 0x5D, 0x33, 0x08, 0xFE, 0x00, 0x02, 0x1A, 0x43, 0x66, 0xF5, 0x6A, 0x02, 0x57,
+    0x30, 0x07, 0xFE, 0x00, 0x02, 0x0A, 0x2A, 0x3E, 0xF5, 0x40, 0x01, 0x37, 0x1C, 0xFC, 0x00, 0x01, 0x07, 0x14, 0xF5, 0x15,
+    0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x92, 0x00, 0x01, 0x01, 0x17, 0xFB, 0x1F, 0x00, 0x14, 0xF5, 0x00, 0x01, 0x1E, 0x3D,
+    0xFB, 0x4A, 0x01, 0x38, 0x17, 0xF7, 0x00, 0x02, 0x03, 0x2D, 0x57, 0xFC, 0x74, 0x02, 0x73, 0x4F, 0x25, 0xF7, 0x00, 0x03,
+    0x03, 0x2E, 0x58, 0x83, 0xFD, 0x9F, 0x02, 0x7B, 0x51, 0x26, 0xF7, 0x00, 0x0A, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x7D,
+    0x7D, 0x7A, 0x50, 0x26, 0xF7, 0x00, 0x0A, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x53, 0x52, 0x3E, 0x1B, 0xF7, 0x00,
+    0x0A, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x28, 0x1C, 0x02, 0xF7, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD,
+    0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03,
+    0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03,
+    0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD,
+    0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03,
+    0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03,
+    0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD,
+    0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x08, 0x03,
+    0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x03, 0xF5, 0x00, 0x0A, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x2E, 0x2B,
+    0x1F, 0x04, 0xF7, 0x00, 0x0A, 0x03, 0x2E, 0x58, 0x83, 0xAD, 0x83, 0x58, 0x55, 0x55, 0x40, 0x1D, 0xF7, 0x00, 0x0A, 0x03,
+    0x2E, 0x58, 0x83, 0xAD, 0x83, 0x80, 0x80, 0x7B, 0x51, 0x26, 0xF7, 0x00, 0x03, 0x03, 0x2E, 0x58, 0x83, 0xFD, 0x9C, 0x02,
+    0x7B, 0x51, 0x26, 0xF7, 0x00, 0x02, 0x02, 0x2C, 0x56, 0xFB, 0x71, 0x01, 0x4E, 0x25, 0xF6, 0x00, 0x01, 0x1C, 0x3A, 0xFB,
+    0x47, 0x01, 0x36, 0x16, 0xF5, 0x00, 0x00, 0x15, 0xFB, 0x1C, 0x00, 0x12, 0xBC, 0x00, 0x81, 0x00, 0x01, 0x10, 0x25, 0xFE,
+    0x2A, 0x01, 0x1F, 0x05, 0xF4, 0x00, 0x02, 0x05, 0x2C, 0x4C, 0xFE, 0x55, 0x01, 0x41, 0x1E, 0xF4, 0x00, 0x08, 0x0D, 0x37,
+    0x62, 0x7F, 0x7F, 0x7D, 0x56, 0x30, 0x09, 0xF5, 0x00, 0x08, 0x05, 0x2C, 0x53, 0x79, 0xA0, 0x8F, 0x68, 0x42, 0x1B, 0xF4,
+    0x00, 0x08, 0x1A, 0x41, 0x67, 0x8E, 0xA1, 0x7A, 0x54, 0x2D, 0x07, 0xF5, 0x00, 0x08, 0x08, 0x2F, 0x55, 0x7C, 0xA2, 0x8C,
+    0x66, 0x3F, 0x19, 0xF4, 0x00, 0x08, 0x1D, 0x43, 0x6A, 0x90, 0x9E, 0x78, 0x51, 0x2B, 0x04, 0xF5, 0x00, 0x08, 0x0B, 0x31,
+    0x58, 0x7E, 0xA5, 0x8A, 0x63, 0x3D, 0x16, 0xF4, 0x00, 0x08, 0x1F, 0x46, 0x6C, 0x93, 0x9C, 0x75, 0x4F, 0x28, 0x02, 0xF5,
+    0x00, 0x08, 0x0D, 0x34, 0x5A, 0x81, 0xA7, 0x87, 0x61, 0x3A, 0x14, 0xF4, 0x00, 0x07, 0x22, 0x48, 0x6F, 0x95, 0x99, 0x73,
+    0x4C, 0x26, 0xF4, 0x00, 0x08, 0x10, 0x36, 0x5D, 0x83, 0xAA, 0x85, 0x5E, 0x38, 0x11, 0xF4, 0x00, 0x07, 0x24, 0x4B, 0x71,
+    0x98, 0x97, 0x70, 0x4A, 0x23, 0xF4, 0x00, 0x08, 0x12, 0x39, 0x5F, 0x86, 0xA9, 0x82, 0x5C, 0x35, 0x0F, 0xF4, 0x00, 0x07,
+    0x27, 0x4D, 0x74, 0x9A, 0x94, 0x6E, 0x47, 0x21, 0xF4, 0x00, 0x08, 0x15, 0x3B, 0x62, 0x88, 0xA6, 0x80, 0x59, 0x33, 0x0C,
+    0xF5, 0x00, 0x08, 0x03, 0x29, 0x50, 0x76, 0x9D, 0x92, 0x6B, 0x45, 0x1E, 0xF4, 0x00, 0x08, 0x17, 0x3E, 0x64, 0x8B, 0xA4,
+    0x7D, 0x57, 0x30, 0x0A, 0xF5, 0x00, 0x08, 0x05, 0x2C, 0x52, 0x79, 0x9F, 0x8F, 0x69, 0x42, 0x1C, 0xF4, 0x00, 0x08, 0x1A,
+    0x40, 0x67, 0x8D, 0xA1, 0x7B, 0x54, 0x2E, 0x07, 0xF5, 0x00, 0x08, 0x08, 0x2E, 0x55, 0x7B, 0xA2, 0x8D, 0x66, 0x40, 0x19,
+    0xF4, 0x00, 0x08, 0x1C, 0x43, 0x69, 0x90, 0x9E, 0x78, 0x51, 0x2B, 0x02, 0xF5, 0x00, 0x02, 0x0A, 0x31, 0x57, 0xFE, 0x74,
+    0x02, 0x59, 0x30, 0x06, 0xF4, 0x00, 0x01, 0x1E, 0x3D, 0xFE, 0x49, 0x01, 0x3E, 0x20, 0xF3, 0x00, 0x01, 0x01, 0x17, 0xFE,
+    0x1F, 0x01, 0x18, 0x03, 0xAA, 0x00, 0x93, 0x00, 0x01, 0x0B, 0x1C, 0xFC, 0x1F, 0x01, 0x1D, 0x0D, 0xF6, 0x00, 0x02, 0x06,
+    0x2A, 0x45, 0xFC, 0x4A, 0x02, 0x46, 0x2D, 0x09, 0xF7, 0x00, 0x02, 0x12, 0x3C, 0x65, 0xFC, 0x74, 0x02, 0x68, 0x40, 0x16,
+    0xF7, 0x00, 0x03, 0x13, 0x3D, 0x68, 0x92, 0xFE, 0x9F, 0x03, 0x96, 0x6B, 0x41, 0x16, 0xF7, 0x00, 0x02, 0x13, 0x3D, 0x68,
+    0xFE, 0x7D, 0x04, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF7, 0x00, 0x0A, 0x0A, 0x30, 0x4D, 0x53, 0x53, 0x70, 0x9A, 0x96, 0x6B,
+    0x41, 0x16, 0xF6, 0x00, 0x09, 0x12, 0x25, 0x28, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45,
+    0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07,
+    0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4,
+    0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41,
+    0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96,
+    0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70,
+    0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B,
+    0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF4, 0x00, 0x07, 0x1B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF6, 0x00,
+    0x09, 0x14, 0x28, 0x2B, 0x45, 0x70, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF7, 0x00, 0x0A, 0x0B, 0x31, 0x4F, 0x55, 0x55, 0x70,
+    0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF7, 0x00, 0x02, 0x13, 0x3D, 0x68, 0xFE, 0x80, 0x04, 0x9A, 0x96, 0x6B, 0x41, 0x16, 0xF7,
+    0x00, 0x03, 0x13, 0x3D, 0x68, 0x92, 0xFE, 0x9C, 0x03, 0x96, 0x6B, 0x41, 0x16, 0xF7, 0x00, 0x02, 0x12, 0x3C, 0x64, 0xFC,
+    0x71, 0x02, 0x67, 0x3F, 0x15, 0xF7, 0x00, 0x02, 0x05, 0x28, 0x42, 0xFC, 0x47, 0x02, 0x43, 0x2B, 0x08, 0xF6, 0x00, 0x01,
+    0x08, 0x19, 0xFC, 0x1C, 0x01, 0x1A, 0x0A, 0xBB, 0x00, 0x81, 0x00, 0xFC, 0x00, 0x01, 0x10, 0x25, 0xFE, 0x2A, 0x00, 0x1B,
+    0xF3, 0x00, 0x07, 0x0C, 0x2D, 0x4C, 0x55, 0x55, 0x54, 0x3C, 0x1B, 0xF5, 0x00, 0x09, 0x06, 0x27, 0x48, 0x69, 0x7F, 0x7F,
+    0x78, 0x57, 0x36, 0x15, 0xF6, 0x00, 0x0A, 0x21, 0x42, 0x63, 0x84, 0xA5, 0xA8, 0x92, 0x72, 0x51, 0x30, 0x0F, 0xF8, 0x00,
+    0x0C, 0x1B, 0x3C, 0x5D, 0x7E, 0x9F, 0x93, 0x85, 0xA5, 0x8D, 0x6C, 0x4B, 0x2A, 0x09, 0xFA, 0x00, 0x0E, 0x15, 0x36, 0x57,
+    0x78, 0x99, 0x95, 0x76, 0x69, 0x88, 0xA7, 0x87, 0x66, 0x45, 0x24, 0x03, 0xFC, 0x00, 0x0F, 0x0F, 0x30, 0x51, 0x72, 0x93,
+    0x98, 0x78, 0x59, 0x4C, 0x6B, 0x8A, 0xA1, 0x81, 0x60, 0x3F, 0x1E, 0xFD, 0x00, 0x11, 0x09, 0x2A, 0x4B, 0x6C, 0x8D, 0x9A,
+    0x7B, 0x5C, 0x3C, 0x2F, 0x4E, 0x6D, 0x8C, 0x9C, 0x7B, 0x5A, 0x39, 0x18, 0xFE, 0x00, 0x21, 0x19, 0x42, 0x66, 0x87, 0x96,
+    0x7D, 0x5E, 0x3F, 0x20, 0x12, 0x31, 0x50, 0x6F, 0x8E, 0x96, 0x75, 0x53, 0x2C, 0x02, 0x00, 0x00, 0x1A, 0x43, 0x67, 0x6C,
+    0x6C, 0x60, 0x41, 0x22, 0x03, 0x00, 0x14, 0x33, 0x52, 0xFE, 0x6C, 0x0C, 0x55, 0x2D, 0x03, 0x00, 0x00, 0x0A, 0x2B, 0x3F,
+    0x41, 0x41, 0x3D, 0x24, 0x05, 0xFE, 0x00, 0x01, 0x16, 0x34, 0xFE, 0x41, 0x01, 0x36, 0x1A, 0xFD, 0x00, 0x05, 0x08, 0x16,
+    0x17, 0x17, 0x14, 0x03, 0xFC, 0x00, 0x00, 0x0E, 0xFE, 0x17, 0x00, 0x10, 0x81, 0x00, 0x81, 0x00, 0x99, 0x00, 0x81, 0x00,
+    0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xB4, 0x00, 0x01, 0x0E, 0x1F, 0xF2, 0x21, 0x05, 0x17, 0x00, 0x00, 0x09, 0x2D, 0x47,
+    0xF3, 0x4C, 0x06, 0x4B, 0x3B, 0x1A, 0x00, 0x15, 0x3F, 0x68, 0xF2, 0x76, 0x05, 0x52, 0x28, 0x00, 0x15, 0x40, 0x6A, 0xF3,
+    0x86, 0x06, 0x7D, 0x53, 0x28, 0x00, 0x0F, 0x36, 0x56, 0xF2, 0x5C, 0x05, 0x46, 0x21, 0x00, 0x00, 0x1B, 0x2E, 0xF2, 0x31,
+    0x01, 0x25, 0x0A, 0xFE, 0x00, 0x00, 0x05, 0xF2, 0x07, 0xFE, 0x00, 0xA9, 0x00, 0x01, 0x04, 0x18, 0xFE, 0x1E, 0x00, 0x16,
+    0xF2, 0x00, 0x01, 0x22, 0x3F, 0xFE, 0x48, 0x01, 0x3C, 0x1D, 0xF4, 0x00, 0x02, 0x09, 0x33, 0x5C, 0xFE, 0x73, 0x02, 0x59,
+    0x37, 0x15, 0xF5, 0x00, 0x09, 0x06, 0x2F, 0x53, 0x74, 0x94, 0x94, 0x72, 0x50, 0x2E, 0x0C, 0xF5, 0x00, 0x09, 0x17, 0x38,
+    0x58, 0x78, 0x98, 0x8C, 0x6A, 0x48, 0x26, 0x03, 0xF5, 0x00, 0x08, 0x1C, 0x3C, 0x5C, 0x7C, 0x9C, 0x83, 0x61, 0x3F, 0x1D,
+    0xF4, 0x00, 0x08, 0x20, 0x40, 0x61, 0x81, 0x9C, 0x7A, 0x58, 0x34, 0x0C, 0xF5, 0x00, 0x08, 0x04, 0x25, 0x45, 0x65, 0x73,
+    0x73, 0x63, 0x3A, 0x10, 0xF4, 0x00, 0x07, 0x09, 0x29, 0x43, 0x49, 0x49, 0x43, 0x28, 0x04, 0xF3, 0x00, 0x05, 0x09, 0x1B,
+    0x1E, 0x1E, 0x1B, 0x08, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xC1, 0x00, 0x81, 0x00, 0xAA, 0x00, 0x08, 0x08, 0x14, 0x1E,
+    0x24, 0x28, 0x27, 0x23, 0x1C, 0x0F, 0xF7, 0x00, 0x0C, 0x08, 0x21, 0x30, 0x3D, 0x47, 0x4E, 0x52, 0x52, 0x4E, 0x45, 0x36,
+    0x23, 0x0A, 0xF9, 0x00, 0x0D, 0x20, 0x44, 0x58, 0x66, 0x71, 0x79, 0x7D, 0x7C, 0x78, 0x6D, 0x5D, 0x46, 0x2A, 0x0B, 0xFA,
+    0x00, 0x0D, 0x2A, 0x54, 0x7F, 0x8E, 0x9A, 0xA3, 0xA6, 0xA6, 0xA1, 0x95, 0x81, 0x67, 0x47, 0x25, 0xFA, 0x00, 0x0E, 0x2A,
+    0x54, 0x7F, 0x98, 0x8A, 0x80, 0x7B, 0x7C, 0x83, 0x95, 0xA3, 0x83, 0x5F, 0x39, 0x12, 0xFB, 0x00, 0x0E, 0x2A, 0x54, 0x7F,
+    0x71, 0x62, 0x57, 0x51, 0x51, 0x5B, 0x76, 0x9A, 0x98, 0x70, 0x46, 0x1D, 0xFB, 0x00, 0x0E, 0x22, 0x47, 0x5A, 0x4B, 0x3E,
+    0x46, 0x4B, 0x4C, 0x4C, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x06, 0x0C, 0x29, 0x43, 0x58, 0x67, 0x70, 0x75,
+    0xFE, 0x76, 0x04, 0x8A, 0xA5, 0x7B, 0x50, 0x26, 0xFC, 0x00, 0x07, 0x01, 0x26, 0x47, 0x65, 0x7E, 0x8F, 0x9A, 0xA0, 0xFE,
+    0xA1, 0x04, 0xA3, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x07, 0x14, 0x3B, 0x60, 0x83, 0xA1, 0x98, 0x86, 0x7E, 0xFE, 0x7B,
+    0x04, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x72, 0x9A, 0x99, 0x76, 0x5F, 0x54, 0x51, 0x51, 0x61,
+    0x8C, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA5, 0x8B, 0x61, 0x3A, 0x2A, 0x26, 0x40, 0x68, 0x92,
+    0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x27, 0x52, 0x7C, 0xA7, 0x8A, 0x60, 0x37, 0x29, 0x35, 0x53, 0x78, 0x9E, 0xA6,
+    0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x23, 0x4D, 0x76, 0x9E, 0x96, 0x72, 0x5A, 0x54, 0x5B, 0x70, 0x8E, 0x99, 0xA6, 0x7C,
+    0x51, 0x27, 0xFC, 0x00, 0x0F, 0x18, 0x40, 0x67, 0x8B, 0xAB, 0x93, 0x82, 0x7E, 0x84, 0x94, 0x8F, 0x8A, 0xA6, 0x7C, 0x51,
+    0x27, 0xFC, 0x00, 0x0F, 0x07, 0x2D, 0x50, 0x6F, 0x89, 0x9A, 0xA2, 0xA2, 0x9B, 0x8A, 0x71, 0x8A, 0x95, 0x7C, 0x51, 0x27,
+    0xFB, 0x00, 0x09, 0x14, 0x33, 0x4E, 0x63, 0x71, 0x78, 0x78, 0x71, 0x64, 0x59, 0xFE, 0x6A, 0x01, 0x4D, 0x24, 0xFA, 0x00,
+    0x08, 0x12, 0x2A, 0x3C, 0x48, 0x4D, 0x4D, 0x48, 0x3C, 0x38, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF9, 0x00, 0x07, 0x04, 0x14,
+    0x1E, 0x23, 0x23, 0x1E, 0x14, 0x11, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x00, 0x00, 0x95, 0x00, 0x01, 0x06, 0x1A,
+    0xFE, 0x1F, 0x00, 0x15, 0xF2, 0x00, 0x01, 0x23, 0x41, 0xFE, 0x4A, 0x01, 0x39, 0x18, 0xF4, 0x00, 0x02, 0x0A, 0x34, 0x5D,
+    0xFE, 0x74, 0x01, 0x50, 0x26, 0xF4, 0x00, 0x07, 0x0A, 0x35, 0x5F, 0x8A, 0x9F, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x0A,
+    0x35, 0x5F, 0x8A, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x06, 0x0A, 0x35, 0x5F, 0x8A, 0xA7, 0x7C, 0x52, 0xFE, 0x27, 0x02,
+    0x21, 0x15, 0x04, 0xF9, 0x00, 0x0D, 0x0A, 0x35, 0x5F, 0x8A, 0xA7, 0x7C, 0x52, 0x4B, 0x52, 0x51, 0x4A, 0x3D, 0x29, 0x10,
+    0xFA, 0x00, 0x0E, 0x0A, 0x35, 0x5F, 0x8A, 0xA7, 0x7C, 0x63, 0x74, 0x7C, 0x7B, 0x74, 0x63, 0x4C, 0x30, 0x10, 0xFB, 0x00,
+    0x0F, 0x0A, 0x35, 0x5F, 0x8A, 0xA7, 0x7C, 0x86, 0x9C, 0xA5, 0xA6, 0x9B, 0x88, 0x6C, 0x4C, 0x2A, 0x06, 0xFC, 0x00, 0x0F,
+    0x0A, 0x35, 0x5F, 0x8A, 0xA7, 0x81, 0x98, 0x83, 0x7B, 0x80, 0x93, 0xA8, 0x88, 0x65, 0x40, 0x19, 0xFC, 0x00, 0x0F, 0x0A,
+    0x35, 0x5F, 0x8A, 0xB4, 0x9E, 0x7A, 0x5D, 0x51, 0x59, 0x74, 0x97, 0x9F, 0x78, 0x51, 0x29, 0xFC, 0x00, 0x10, 0x0A, 0x35,
+    0x5F, 0x8A, 0xB4, 0x8D, 0x65, 0x3F, 0x26, 0x38, 0x5E, 0x86, 0xAE, 0x87, 0x5D, 0x34, 0x0A, 0xFD, 0x00, 0x10, 0x0A, 0x35,
+    0x5F, 0x8A, 0xAD, 0x83, 0x59, 0x30, 0x07, 0x28, 0x51, 0x7B, 0xA5, 0x90, 0x66, 0x3C, 0x11, 0xFD, 0x00, 0x10, 0x0A, 0x35,
+    0x5F, 0x8A, 0xA8, 0x7E, 0x53, 0x29, 0x00, 0x21, 0x4C, 0x76, 0xA0, 0x95, 0x6A, 0x40, 0x15, 0xFD, 0x00, 0x10, 0x0A, 0x35,
+    0x5F, 0x8A, 0xA7, 0x7C, 0x52, 0x27, 0x00, 0x20, 0x4A, 0x75, 0x9F, 0x96, 0x6B, 0x41, 0x16, 0xFD, 0x00, 0x10, 0x0A, 0x35,
+    0x5F, 0x8A, 0xA8, 0x7E, 0x54, 0x29, 0x00, 0x22, 0x4C, 0x76, 0xA1, 0x94, 0x6A, 0x3F, 0x15, 0xFD, 0x00, 0x10, 0x0A, 0x35,
+    0x5F, 0x8A, 0xAD, 0x84, 0x5A, 0x31, 0x08, 0x29, 0x52, 0x7C, 0xA6, 0x8E, 0x65, 0x3B, 0x10, 0xFD, 0x00, 0x10, 0x0A, 0x35,
+    0x5F, 0x8A, 0xB4, 0x8F, 0x67, 0x42, 0x2B, 0x3B, 0x60, 0x87, 0xAD, 0x85, 0x5C, 0x32, 0x09, 0xFD, 0x00, 0x0F, 0x0A, 0x35,
+    0x5F, 0x8A, 0xB4, 0xA0, 0x7D, 0x61, 0x55, 0x5D, 0x77, 0x99, 0x9C, 0x76, 0x4F, 0x26, 0xFC, 0x00, 0x0F, 0x0A, 0x35, 0x5F,
+    0x8A, 0xA7, 0x7F, 0x9C, 0x87, 0x7F, 0x84, 0x97, 0xA4, 0x85, 0x61, 0x3D, 0x17, 0xFC, 0x00, 0x0F, 0x0A, 0x35, 0x5F, 0x8A,
+    0x95, 0x7C, 0x83, 0x98, 0xA2, 0xA1, 0x97, 0x83, 0x68, 0x49, 0x27, 0x03, 0xFC, 0x00, 0x02, 0x08, 0x32, 0x59, 0xFE, 0x6A,
+    0x08, 0x5F, 0x70, 0x78, 0x77, 0x6F, 0x5F, 0x48, 0x2C, 0x0D, 0xFA, 0x00, 0x01, 0x1D, 0x38, 0xFE, 0x40, 0x07, 0x39, 0x47,
+    0x4E, 0x4D, 0x46, 0x38, 0x25, 0x0C, 0xF8, 0x00, 0x00, 0x10, 0xFE, 0x15, 0x05, 0x12, 0x1E, 0x23, 0x22, 0x1C, 0x11, 0x81,
+    0x00, 0xFC, 0x00, 0x81, 0x00, 0xA8, 0x00, 0x08, 0x03, 0x12, 0x1E, 0x25, 0x28, 0x27, 0x21, 0x17, 0x09, 0xF6, 0x00, 0x0B,
+    0x13, 0x29, 0x3B, 0x47, 0x4F, 0x52, 0x51, 0x4B, 0x3F, 0x30, 0x1D, 0x03, 0xF9, 0x00, 0x0C, 0x19, 0x36, 0x4E, 0x62, 0x70,
+    0x79, 0x7C, 0x7B, 0x74, 0x67, 0x56, 0x3F, 0x1D, 0xFA, 0x00, 0x0D, 0x15, 0x36, 0x55, 0x71, 0x88, 0x99, 0xA3, 0xA6, 0xA6,
+    0x9D, 0x8F, 0x7C, 0x52, 0x28, 0xFB, 0x00, 0x0E, 0x07, 0x2C, 0x50, 0x72, 0x91, 0xA8, 0x91, 0x81, 0x7B, 0x7D, 0x86, 0x96,
+    0x7D, 0x52, 0x28, 0xFB, 0x00, 0x0E, 0x17, 0x3E, 0x66, 0x8A, 0xAC, 0x8A, 0x6D, 0x59, 0x51, 0x52, 0x5E, 0x72, 0x7D, 0x52,
+    0x28, 0xFB, 0x00, 0x0E, 0x24, 0x4D, 0x76, 0x9D, 0x98, 0x72, 0x4E, 0x32, 0x26, 0x29, 0x38, 0x50, 0x63, 0x4A, 0x23, 0xFC,
+    0x00, 0x0F, 0x03, 0x2D, 0x57, 0x81, 0xAA, 0x8B, 0x62, 0x3A, 0x13, 0x00, 0x00, 0x14, 0x2E, 0x38, 0x2B, 0x0F, 0xFC, 0x00,
+    0x08, 0x07, 0x32, 0x5C, 0x87, 0xAE, 0x84, 0x5A, 0x30, 0x06, 0xFE, 0x00, 0x02, 0x07, 0x0E, 0x05, 0xFB, 0x00, 0x08, 0x09,
+    0x34, 0x5E, 0x89, 0xAD, 0x82, 0x58, 0x2D, 0x03, 0xF5, 0x00, 0x08, 0x07, 0x32, 0x5C, 0x86, 0xAF, 0x85, 0x5B, 0x30, 0x07,
+    0xFE, 0x00, 0x02, 0x0A, 0x11, 0x08, 0xFB, 0x00, 0x0F, 0x02, 0x2C, 0x56, 0x80, 0xA9, 0x8C, 0x63, 0x3B, 0x16, 0x00, 0x03,
+    0x16, 0x31, 0x3C, 0x2E, 0x11, 0xFB, 0x00, 0x0E, 0x23, 0x4C, 0x74, 0x9C, 0x9A, 0x74, 0x51, 0x36, 0x2B, 0x2D, 0x3A, 0x52,
+    0x66, 0x4C, 0x24, 0xFB, 0x00, 0x0E, 0x16, 0x3D, 0x64, 0x88, 0xAB, 0x8D, 0x71, 0x5D, 0x55, 0x57, 0x61, 0x74, 0x7D, 0x52,
+    0x28, 0xFB, 0x00, 0x0E, 0x05, 0x29, 0x4E, 0x6F, 0x8E, 0xA9, 0x95, 0x85, 0x80, 0x81, 0x89, 0x99, 0x7D, 0x52, 0x28, 0xFA,
+    0x00, 0x0D, 0x12, 0x33, 0x52, 0x6E, 0x84, 0x95, 0x9F, 0xA3, 0xA1, 0x99, 0x8B, 0x78, 0x52, 0x27, 0xF9, 0x00, 0x0C, 0x16,
+    0x33, 0x4A, 0x5E, 0x6C, 0x75, 0x78, 0x77, 0x70, 0x64, 0x52, 0x3C, 0x1B, 0xF8, 0x00, 0x0A, 0x0F, 0x25, 0x37, 0x43, 0x4B,
+    0x4E, 0x4D, 0x47, 0x3C, 0x2C, 0x19, 0xF5, 0x00, 0x07, 0x0E, 0x1A, 0x21, 0x23, 0x22, 0x1D, 0x13, 0x05, 0x81, 0x00, 0xFE,
+    0x00, 0x8D, 0x00, 0x05, 0x0B, 0x1C, 0x1F, 0x1F, 0x1E, 0x11, 0xF3, 0x00, 0x07, 0x06, 0x2A, 0x45, 0x4A, 0x4A, 0x48, 0x33,
+    0x10, 0xF4, 0x00, 0x07, 0x12, 0x3C, 0x65, 0x74, 0x74, 0x6F, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x13, 0x3D, 0x68, 0x92, 0x9E,
+    0x73, 0x49, 0x1E, 0xF4, 0x00, 0x07, 0x13, 0x3D, 0x68, 0x92, 0x9E, 0x73, 0x49, 0x1E, 0xF8, 0x00, 0x0B, 0x0E, 0x1C, 0x25,
+    0x28, 0x25, 0x3D, 0x68, 0x92, 0x9E, 0x73, 0x49, 0x1E, 0xFA, 0x00, 0x0D, 0x03, 0x1E, 0x34, 0x45, 0x4F, 0x52, 0x4F, 0x45,
+    0x68, 0x92, 0x9E, 0x73, 0x49, 0x1E, 0xFB, 0x00, 0x0E, 0x01, 0x21, 0x3F, 0x58, 0x6C, 0x78, 0x7D, 0x79, 0x6D, 0x68, 0x92,
+    0x9E, 0x73, 0x49, 0x1E, 0xFB, 0x00, 0x0E, 0x19, 0x3C, 0x5D, 0x7B, 0x93, 0xA2, 0xA6, 0xA3, 0x92, 0x78, 0x92, 0x9E, 0x73,
+    0x49, 0x1E, 0xFC, 0x00, 0x0F, 0x07, 0x2D, 0x53, 0x77, 0x99, 0xA0, 0x88, 0x7C, 0x7E, 0x8D, 0x93, 0x92, 0x9E, 0x73, 0x49,
+    0x1E, 0xFC, 0x00, 0x0F, 0x15, 0x3E, 0x66, 0x8C, 0xA9, 0x84, 0x64, 0x52, 0x54, 0x6B, 0x8D, 0xAC, 0x9E, 0x73, 0x49, 0x1E,
+    0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x73, 0x9C, 0x99, 0x71, 0x4A, 0x29, 0x2F, 0x53, 0x7A, 0xA2, 0x9E, 0x73, 0x49, 0x1E, 0xFC,
+    0x00, 0x0F, 0x28, 0x52, 0x7C, 0xA6, 0x8F, 0x65, 0x3C, 0x12, 0x1C, 0x45, 0x6F, 0x99, 0x9E, 0x73, 0x49, 0x1E, 0xFD, 0x00,
+    0x10, 0x01, 0x2C, 0x56, 0x81, 0xAB, 0x8A, 0x60, 0x35, 0x0B, 0x15, 0x3F, 0x6A, 0x94, 0x9E, 0x73, 0x49, 0x1E, 0xFD, 0x00,
+    0x10, 0x02, 0x2D, 0x57, 0x82, 0xAC, 0x89, 0x5E, 0x34, 0x09, 0x13, 0x3E, 0x68, 0x92, 0x9E, 0x73, 0x49, 0x1E, 0xFD, 0x00,
+    0x10, 0x01, 0x2B, 0x56, 0x80, 0xAA, 0x8A, 0x60, 0x36, 0x0C, 0x15, 0x40, 0x6A, 0x94, 0x9E, 0x73, 0x49, 0x1E, 0xFC, 0x00,
+    0x0F, 0x27, 0x51, 0x7B, 0xA4, 0x90, 0x66, 0x3D, 0x14, 0x1D, 0x47, 0x70, 0x9A, 0x9E, 0x73, 0x49, 0x1E, 0xFC, 0x00, 0x0F,
+    0x1F, 0x48, 0x71, 0x9A, 0x9A, 0x72, 0x4C, 0x2D, 0x33, 0x55, 0x7C, 0xA4, 0x9E, 0x73, 0x49, 0x1E, 0xFC, 0x00, 0x0F, 0x13,
+    0x3C, 0x63, 0x8A, 0xAB, 0x87, 0x67, 0x56, 0x58, 0x6F, 0x8F, 0xA8, 0x9E, 0x73, 0x49, 0x1E, 0xFC, 0x00, 0x0F, 0x04, 0x2B,
+    0x51, 0x74, 0x96, 0xA3, 0x8B, 0x80, 0x82, 0x91, 0x90, 0x92, 0x9E, 0x73, 0x49, 0x1E, 0xFB, 0x00, 0x0E, 0x16, 0x39, 0x5A,
+    0x77, 0x8F, 0x9E, 0xA3, 0x9E, 0x8E, 0x74, 0x92, 0x95, 0x73, 0x49, 0x1E, 0xFA, 0x00, 0x0D, 0x1E, 0x3B, 0x55, 0x68, 0x74,
+    0x79, 0x75, 0x68, 0x60, 0x6A, 0x6A, 0x67, 0x45, 0x1C, 0xF9, 0x00, 0x0C, 0x1A, 0x30, 0x41, 0x4B, 0x4E, 0x4B, 0x41, 0x3C,
+    0x40, 0x40, 0x3F, 0x2B, 0x0B, 0xF8, 0x00, 0x06, 0x09, 0x18, 0x21, 0x24, 0x21, 0x18, 0x13, 0xFE, 0x15, 0x00, 0x08, 0x81,
+    0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0xA9, 0x00, 0x08, 0x01, 0x12, 0x1E, 0x25, 0x28, 0x26, 0x1F, 0x13, 0x02, 0xF6, 0x00,
+    0x0A, 0x10, 0x27, 0x3A, 0x47, 0x4F, 0x52, 0x50, 0x49, 0x3B, 0x28, 0x0F, 0xF8, 0x00, 0x0C, 0x14, 0x32, 0x4B, 0x60, 0x70,
+    0x79, 0x7D, 0x7B, 0x71, 0x61, 0x4A, 0x2F, 0x11, 0xFA, 0x00, 0x0E, 0x0F, 0x31, 0x50, 0x6E, 0x86, 0x98, 0xA3, 0xA5, 0xA4,
+    0x99, 0x86, 0x6B, 0x4D, 0x2B, 0x08, 0xFB, 0x00, 0x0E, 0x25, 0x4A, 0x6C, 0x8C, 0xA9, 0x90, 0x80, 0x7B, 0x7F, 0x8F, 0xA8,
+    0x88, 0x66, 0x41, 0x1C, 0xFC, 0x00, 0x10, 0x10, 0x38, 0x5F, 0x84, 0xA8, 0x8C, 0x6E, 0x58, 0x50, 0x57, 0x6D, 0x8E, 0xA0,
+    0x7B, 0x53, 0x2B, 0x03, 0xFD, 0x00, 0x06, 0x1D, 0x46, 0x6F, 0x97, 0x9C, 0x76, 0x51, 0xFE, 0x34, 0x06, 0x54, 0x7C, 0xA4,
+    0x89, 0x60, 0x36, 0x0D, 0xFD, 0x00, 0x05, 0x26, 0x50, 0x7A, 0xA3, 0x90, 0x67, 0xFC, 0x5F, 0x05, 0x72, 0x9C, 0x92, 0x67,
+    0x3D, 0x13, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x56, 0x80, 0xAA, 0x8E, 0xFA, 0x89, 0x04, 0x9C, 0x95, 0x6B, 0x40, 0x16, 0xFE,
+    0x00, 0x05, 0x02, 0x2D, 0x57, 0x82, 0xAC, 0x94, 0xF8, 0x93, 0x02, 0x6C, 0x41, 0x17, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x55,
+    0x80, 0xAA, 0x89, 0xF8, 0x68, 0x02, 0x61, 0x3D, 0x14, 0xFD, 0x00, 0x05, 0x25, 0x50, 0x79, 0xA2, 0x8E, 0x65, 0xF9, 0x3E,
+    0x02, 0x3B, 0x25, 0x04, 0xFD, 0x00, 0x0F, 0x1C, 0x45, 0x6E, 0x95, 0x9B, 0x75, 0x52, 0x37, 0x2B, 0x2B, 0x34, 0x41, 0x52,
+    0x62, 0x4D, 0x27, 0xFC, 0x00, 0x10, 0x0F, 0x36, 0x5E, 0x82, 0xA6, 0x8E, 0x72, 0x5E, 0x56, 0x56, 0x5D, 0x69, 0x79, 0x81,
+    0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x23, 0x48, 0x6A, 0x89, 0xA5, 0x96, 0x87, 0x80, 0x80, 0x86, 0x91, 0xA0, 0x81, 0x56,
+    0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x0D, 0x2E, 0x4D, 0x6A, 0x81, 0x92, 0x9D, 0xA2, 0xA2, 0x9D, 0x94, 0x88, 0x79, 0x56, 0x2B,
+    0x01, 0xFB, 0x00, 0x0D, 0x11, 0x2E, 0x46, 0x5B, 0x6A, 0x73, 0x78, 0x78, 0x73, 0x6B, 0x60, 0x52, 0x3F, 0x1E, 0xF9, 0x00,
+    0x0C, 0x0B, 0x22, 0x34, 0x41, 0x49, 0x4D, 0x4D, 0x49, 0x42, 0x37, 0x2A, 0x1B, 0x03, 0xF7, 0x00, 0x08, 0x0C, 0x18, 0x20,
+    0x23, 0x23, 0x1F, 0x18, 0x0E, 0x02, 0x81, 0x00, 0xFE, 0x00, 0x8F, 0x00, 0x02, 0x03, 0x12, 0x1B, 0xFD, 0x1F, 0x00, 0x15,
+    0xF5, 0x00, 0x04, 0x12, 0x2A, 0x3B, 0x45, 0x49, 0xFE, 0x4A, 0x01, 0x3A, 0x19, 0xF7, 0x00, 0x04, 0x12, 0x32, 0x4E, 0x62,
+    0x6F, 0xFD, 0x74, 0x01, 0x52, 0x28, 0xF8, 0x00, 0x0B, 0x03, 0x29, 0x4D, 0x6F, 0x88, 0x98, 0x9E, 0x9F, 0x9F, 0x7E, 0x53,
+    0x29, 0xF8, 0x00, 0x0B, 0x11, 0x3A, 0x61, 0x88, 0xAA, 0x8F, 0x83, 0x82, 0x82, 0x7E, 0x53, 0x29, 0xFB, 0x00, 0x09, 0x01,
+    0x15, 0x1B, 0x1B, 0x44, 0x6E, 0x97, 0x99, 0x71, 0x59, 0xFE, 0x57, 0x01, 0x44, 0x20, 0xFB, 0x00, 0x08, 0x20, 0x3C, 0x45,
+    0x45, 0x48, 0x72, 0x9D, 0x93, 0x68, 0xFD, 0x45, 0x01, 0x36, 0x17, 0xFC, 0x00, 0x02, 0x08, 0x32, 0x5B, 0xFE, 0x70, 0x02,
+    0x73, 0x9E, 0x92, 0xFD, 0x70, 0x02, 0x6F, 0x50, 0x27, 0xFC, 0x00, 0x03, 0x09, 0x34, 0x5E, 0x89, 0xFE, 0x9A, 0x01, 0xA8,
+    0xA0, 0xFD, 0x9A, 0x02, 0x7E, 0x53, 0x29, 0xFC, 0x00, 0x02, 0x09, 0x34, 0x5E, 0xFD, 0x82, 0x01, 0x9E, 0x93, 0xFD, 0x82,
+    0x02, 0x7E, 0x53, 0x29, 0xFC, 0x00, 0x02, 0x02, 0x2A, 0x4B, 0xFE, 0x57, 0x03, 0x73, 0x9E, 0x92, 0x68, 0xFD, 0x57, 0x01,
+    0x44, 0x20, 0xFB, 0x00, 0x09, 0x0F, 0x26, 0x2D, 0x2D, 0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0xFE, 0x2D, 0x01, 0x22, 0x07,
+    0xF9, 0x00, 0x0A, 0x02, 0x1E, 0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0x13, 0x02, 0x02, 0xF6, 0x00, 0x07, 0x1E, 0x49, 0x73,
+    0x9E, 0x92, 0x68, 0x3D, 0x13, 0xF4, 0x00, 0x07, 0x1E, 0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0x13, 0xF4, 0x00, 0x07, 0x1E,
+    0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0x13, 0xF4, 0x00, 0x07, 0x1E, 0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0x13, 0xF4, 0x00,
+    0x07, 0x1E, 0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0x13, 0xF4, 0x00, 0x07, 0x1E, 0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0x13,
+    0xF4, 0x00, 0x07, 0x1E, 0x49, 0x73, 0x9E, 0x92, 0x68, 0x3D, 0x13, 0xF4, 0x00, 0x07, 0x1E, 0x49, 0x73, 0x95, 0x92, 0x68,
+    0x3D, 0x13, 0xF4, 0x00, 0x07, 0x1C, 0x45, 0x67, 0x6A, 0x6A, 0x60, 0x3A, 0x11, 0xF4, 0x00, 0x07, 0x0B, 0x2B, 0x3F, 0x40,
+    0x40, 0x3C, 0x24, 0x02, 0xF3, 0x00, 0x00, 0x08, 0xFE, 0x15, 0x01, 0x13, 0x02, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00, 0xA9,
+    0x00, 0x0A, 0x0E, 0x1D, 0x25, 0x28, 0x25, 0x1C, 0x16, 0x19, 0x19, 0x18, 0x0B, 0xF9, 0x00, 0x0D, 0x02, 0x1E, 0x34, 0x45,
+    0x4F, 0x53, 0x4F, 0x45, 0x3F, 0x43, 0x43, 0x42, 0x2E, 0x0D, 0xFA, 0x00, 0x0D, 0x21, 0x3E, 0x58, 0x6C, 0x79, 0x7D, 0x79,
+    0x6D, 0x62, 0x6E, 0x6E, 0x6A, 0x46, 0x1D, 0xFB, 0x00, 0x0E, 0x18, 0x3C, 0x5D, 0x7A, 0x93, 0xA2, 0xA6, 0xA3, 0x92, 0x77,
+    0x92, 0x98, 0x73, 0x49, 0x1E, 0xFC, 0x00, 0x0F, 0x07, 0x2D, 0x53, 0x77, 0x98, 0xA1, 0x88, 0x7C, 0x7D, 0x8C, 0x91, 0x92,
+    0x9E, 0x73, 0x49, 0x1E, 0xFC, 0x00, 0x0F, 0x15, 0x3D, 0x66, 0x8C, 0xA9, 0x85, 0x65, 0x52, 0x53, 0x6A, 0x8B, 0xA9, 0x9E,
+    0x73, 0x49, 0x1E, 0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x73, 0x9C, 0x99, 0x71, 0x4A, 0x2A, 0x2E, 0x52, 0x79, 0xA2, 0x9E, 0x73,
+    0x49, 0x1E, 0xFC, 0x00, 0x0F, 0x28, 0x52, 0x7C, 0xA6, 0x8F, 0x65, 0x3B, 0x13, 0x1B, 0x44, 0x6E, 0x98, 0x9E, 0x73, 0x49,
+    0x1E, 0xFD, 0x00, 0x10, 0x01, 0x2C, 0x56, 0x81, 0xAB, 0x8A, 0x5F, 0x35, 0x0B, 0x15, 0x3F, 0x69, 0x93, 0x9E, 0x73, 0x49,
+    0x1E, 0xFD, 0x00, 0x10, 0x02, 0x2D, 0x57, 0x82, 0xAC, 0x89, 0x5E, 0x34, 0x09, 0x13, 0x3E, 0x68, 0x93, 0x9E, 0x73, 0x49,
+    0x1E, 0xFD, 0x00, 0x10, 0x01, 0x2B, 0x55, 0x7F, 0xAA, 0x8B, 0x61, 0x37, 0x0C, 0x16, 0x40, 0x6B, 0x95, 0x9E, 0x73, 0x49,
+    0x1E, 0xFC, 0x00, 0x0F, 0x26, 0x50, 0x79, 0xA3, 0x91, 0x68, 0x3F, 0x18, 0x20, 0x48, 0x71, 0x9B, 0x9E, 0x73, 0x49, 0x1E,
+    0xFC, 0x00, 0x0F, 0x1D, 0x46, 0x6F, 0x97, 0x9E, 0x76, 0x52, 0x36, 0x38, 0x58, 0x7E, 0xA6, 0x9E, 0x73, 0x49, 0x1E, 0xFC,
+    0x00, 0x0F, 0x11, 0x39, 0x5F, 0x86, 0xA9, 0x8E, 0x70, 0x60, 0x60, 0x74, 0x94, 0x99, 0x9E, 0x73, 0x49, 0x1E, 0xFB, 0x00,
+    0x0E, 0x27, 0x4B, 0x6F, 0x8F, 0xAB, 0x95, 0x89, 0x8A, 0x97, 0x87, 0x92, 0x9E, 0x73, 0x49, 0x1E, 0xFB, 0x00, 0x0E, 0x10,
+    0x33, 0x53, 0x6F, 0x86, 0x94, 0x99, 0x94, 0x85, 0x6B, 0x92, 0x9D, 0x73, 0x48, 0x1E, 0xFA, 0x00, 0x0D, 0x1C, 0x33, 0x4C,
+    0x5F, 0x6A, 0x6E, 0x6A, 0x5E, 0x6B, 0x95, 0x9A, 0x6F, 0x45, 0x1B, 0xFB, 0x00, 0x0E, 0x13, 0x39, 0x56, 0x53, 0x42, 0x41,
+    0x44, 0x41, 0x4D, 0x74, 0x9D, 0x91, 0x68, 0x3E, 0x15, 0xFB, 0x00, 0x0E, 0x19, 0x44, 0x6E, 0x7A, 0x6A, 0x5E, 0x58, 0x5B,
+    0x6B, 0x88, 0xA7, 0x82, 0x5B, 0x33, 0x0B, 0xFB, 0x00, 0x0D, 0x19, 0x44, 0x6E, 0x99, 0x93, 0x88, 0x83, 0x85, 0x90, 0xA6,
+    0x8D, 0x6C, 0x48, 0x23, 0xFA, 0x00, 0x0D, 0x19, 0x44, 0x6E, 0x87, 0x91, 0x98, 0x9B, 0x9A, 0x92, 0x83, 0x6D, 0x51, 0x30,
+    0x0E, 0xFA, 0x00, 0x0C, 0x11, 0x36, 0x52, 0x5E, 0x68, 0x6E, 0x71, 0x6F, 0x69, 0x5C, 0x4A, 0x31, 0x15, 0xF8, 0x00, 0x0A,
+    0x18, 0x2A, 0x35, 0x3E, 0x44, 0x46, 0x45, 0x3F, 0x34, 0x24, 0x0F, 0xF6, 0x00, 0x07, 0x01, 0x0C, 0x14, 0x19, 0x1C, 0x1A,
+    0x15, 0x0C, 0xE4, 0x00, 0x95, 0x00, 0x01, 0x05, 0x1A, 0xFE, 0x1F, 0x00, 0x15, 0xF2, 0x00, 0x01, 0x22, 0x40, 0xFE, 0x4A,
+    0x01, 0x39, 0x19, 0xF4, 0x00, 0x02, 0x09, 0x33, 0x5C, 0xFE, 0x74, 0x01, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x09, 0x34, 0x5E,
+    0x89, 0x9F, 0x7D, 0x53, 0x28, 0xF4, 0x00, 0x07, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0xF4, 0x00, 0x0C, 0x09,
+    0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x26, 0x28, 0x24, 0x1A, 0x0A, 0xF9, 0x00, 0x0D, 0x09, 0x34, 0x5E, 0x89, 0xA8,
+    0x7D, 0x53, 0x47, 0x50, 0x52, 0x4E, 0x42, 0x2F, 0x15, 0xFA, 0x00, 0x0E, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x5D, 0x70,
+    0x7A, 0x7D, 0x77, 0x69, 0x51, 0x33, 0x12, 0xFB, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x80, 0x97, 0xA4, 0xA7,
+    0xA0, 0x8D, 0x6F, 0x4D, 0x28, 0x01, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x97, 0x84, 0x7D, 0x82, 0x96,
+    0xAB, 0x87, 0x60, 0x38, 0x10, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xB0, 0x9B, 0x78, 0x5D, 0x52, 0x5B, 0x79, 0x9F,
+    0x96, 0x6D, 0x44, 0x1A, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xB2, 0x89, 0x62, 0x3C, 0x28, 0x41, 0x6A, 0x93, 0x9F,
+    0x74, 0x4A, 0x20, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xAA, 0x80, 0x56, 0x2C, 0x0F, 0x3A, 0x64, 0x8F, 0xA2, 0x77,
+    0x4D, 0x22, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D,
+    0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23,
+    0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC,
+    0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00,
+    0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F,
+    0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09,
+    0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34,
+    0x5E, 0x89, 0x95, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0x95, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x02, 0x07, 0x31, 0x58,
+    0xFE, 0x6A, 0x09, 0x4E, 0x25, 0x0D, 0x36, 0x5D, 0x6A, 0x6A, 0x69, 0x49, 0x20, 0xFB, 0x00, 0x01, 0x1C, 0x38, 0xFE, 0x40,
+    0x09, 0x31, 0x13, 0x00, 0x21, 0x3A, 0x40, 0x40, 0x3F, 0x2E, 0x0F, 0xFA, 0x00, 0x00, 0x10, 0xFE, 0x15, 0x00, 0x0C, 0xFE,
+    0x00, 0x00, 0x12, 0xFE, 0x15, 0x00, 0x0A, 0x81, 0x00, 0x01, 0x00, 0x00, 0x91, 0x00, 0x01, 0x03, 0x18, 0xFE, 0x1F, 0x00,
+    0x17, 0xF2, 0x00, 0x01, 0x20, 0x3E, 0xFE, 0x4A, 0x01, 0x3B, 0x1C, 0xF4, 0x00, 0x02, 0x05, 0x30, 0x59, 0xFE, 0x74, 0x01,
+    0x54, 0x2B, 0xF4, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0x9F, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B,
+    0x85, 0xAA, 0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x04, 0x08, 0x18, 0x1B, 0x30, 0x5B, 0xFE, 0x7F, 0x02, 0x56, 0x2B, 0x01,
+    0xF8, 0x00, 0x05, 0x06, 0x29, 0x41, 0x45, 0x45, 0x47, 0xFE, 0x55, 0x01, 0x44, 0x21, 0xF7, 0x00, 0x02, 0x14, 0x3E, 0x65,
+    0xFB, 0x70, 0x01, 0x53, 0x2A, 0xF7, 0x00, 0x03, 0x15, 0x40, 0x6A, 0x95, 0xFD, 0x9A, 0x03, 0x80, 0x56, 0x2B, 0x01, 0xF8,
+    0x00, 0x02, 0x15, 0x40, 0x6A, 0xFE, 0x82, 0x05, 0x86, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF8, 0x00, 0x0B, 0x0E, 0x34, 0x52,
+    0x57, 0x57, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0A, 0x17, 0x2A, 0x2D, 0x30, 0x5B, 0x85, 0xAB, 0x80,
+    0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30,
+    0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5,
+    0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0C, 0x05, 0x07, 0x07, 0x30, 0x5B, 0x85,
+    0xAB, 0x80, 0x56, 0x2B, 0x07, 0x07, 0x04, 0xFA, 0x00, 0x01, 0x19, 0x2E, 0xFE, 0x32, 0x04, 0x5B, 0x85, 0xAB, 0x80, 0x56,
+    0xFE, 0x32, 0x01, 0x2C, 0x15, 0xFC, 0x00, 0x02, 0x0C, 0x34, 0x55, 0xFD, 0x5C, 0x02, 0x85, 0xAB, 0x80, 0xFD, 0x5C, 0x02,
+    0x51, 0x2F, 0x07, 0xFD, 0x00, 0x02, 0x12, 0x3C, 0x67, 0xFD, 0x87, 0x01, 0x89, 0xAB, 0xFC, 0x87, 0x02, 0x62, 0x37, 0x0D,
+    0xFD, 0x00, 0x03, 0x12, 0x3C, 0x67, 0x91, 0xF8, 0x95, 0x03, 0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x02, 0x10, 0x39, 0x5F,
+    0xF6, 0x6A, 0x02, 0x5B, 0x34, 0x0B, 0xFC, 0x00, 0x01, 0x23, 0x3B, 0xF6, 0x40, 0x01, 0x39, 0x1F, 0xFB, 0x00, 0x01, 0x02,
+    0x12, 0xF6, 0x15, 0x00, 0x11, 0x81, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x05, 0x0B, 0x1D, 0x1F, 0x1F, 0x1E, 0x10, 0xF3,
+    0x00, 0x07, 0x07, 0x2B, 0x45, 0x4A, 0x4A, 0x48, 0x32, 0x0F, 0xF4, 0x00, 0x07, 0x13, 0x3D, 0x66, 0x74, 0x74, 0x6E, 0x47,
+    0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D,
+    0x72, 0x48, 0x1D, 0xF6, 0x00, 0x09, 0x15, 0x1B, 0x1B, 0x3E, 0x69, 0x7F, 0x7F, 0x72, 0x48, 0x1D, 0xF7, 0x00, 0x01, 0x1F,
+    0x3C, 0xFE, 0x45, 0x05, 0x4F, 0x55, 0x55, 0x53, 0x39, 0x14, 0xF8, 0x00, 0x02, 0x07, 0x31, 0x59, 0xFB, 0x70, 0x02, 0x6B,
+    0x45, 0x1C, 0xF8, 0x00, 0x03, 0x08, 0x32, 0x5D, 0x87, 0xFC, 0x9A, 0x02, 0x72, 0x48, 0x1D, 0xF8, 0x00, 0x02, 0x08, 0x32,
+    0x5D, 0xFD, 0x82, 0x04, 0x94, 0x9D, 0x72, 0x48, 0x1D, 0xF8, 0x00, 0x02, 0x01, 0x28, 0x4A, 0xFE, 0x57, 0x05, 0x69, 0x93,
+    0x9D, 0x72, 0x48, 0x1D, 0xF7, 0x00, 0x0A, 0x0E, 0x26, 0x2D, 0x2D, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF5, 0x00,
+    0x08, 0x02, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48,
+    0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D,
+    0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69,
+    0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14,
+    0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x72, 0x48, 0x1D, 0xF7, 0x00,
+    0x0A, 0x0B, 0x0E, 0x0E, 0x14, 0x3F, 0x69, 0x94, 0x9C, 0x72, 0x47, 0x1D, 0xF8, 0x00, 0x01, 0x1B, 0x33, 0xFE, 0x39, 0x06,
+    0x47, 0x6F, 0x98, 0x98, 0x6E, 0x44, 0x1A, 0xF9, 0x00, 0x02, 0x0A, 0x33, 0x57, 0xFE, 0x63, 0x06, 0x67, 0x81, 0xA6, 0x8D,
+    0x65, 0x3C, 0x13, 0xF9, 0x00, 0x0C, 0x0E, 0x38, 0x63, 0x8D, 0x8E, 0x8E, 0x90, 0xA0, 0x9A, 0x79, 0x55, 0x2E, 0x07, 0xF9,
+    0x00, 0x03, 0x0E, 0x38, 0x63, 0x8D, 0xFE, 0x94, 0x04, 0x8C, 0x7A, 0x5E, 0x3E, 0x1B, 0xF8, 0x00, 0x02, 0x0C, 0x35, 0x5B,
+    0xFE, 0x6A, 0x05, 0x69, 0x63, 0x54, 0x3E, 0x22, 0x03, 0xF7, 0x00, 0x01, 0x20, 0x39, 0xFD, 0x3F, 0x03, 0x3A, 0x2E, 0x1B,
+    0x03, 0xF5, 0x00, 0x00, 0x11, 0xFE, 0x15, 0x02, 0x14, 0x10, 0x05, 0xE2, 0x00, 0x94, 0x00, 0x00, 0x11, 0xFE, 0x1F, 0x01,
+    0x1D, 0x0C, 0xF3, 0x00, 0x07, 0x11, 0x33, 0x49, 0x4A, 0x4A, 0x46, 0x2C, 0x08, 0xF4, 0x00, 0x07, 0x1F, 0x49, 0x70, 0x74,
+    0x74, 0x67, 0x3E, 0x14, 0xF4, 0x00, 0x07, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x15, 0xF4, 0x00, 0x07, 0x1F, 0x4A,
+    0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x15, 0xF4, 0x00, 0x0E, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x15, 0x00, 0x0F, 0x1A,
+    0x1B, 0x1B, 0x1A, 0x0E, 0xFB, 0x00, 0x09, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x15, 0x16, 0x33, 0xFE, 0x45, 0x02,
+    0x44, 0x31, 0x10, 0xFC, 0x00, 0x0F, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x17, 0x35, 0x52, 0x6E, 0x70, 0x70, 0x6D,
+    0x49, 0x20, 0xFC, 0x00, 0x0F, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x36, 0x53, 0x71, 0x8E, 0x9A, 0x83, 0x66, 0x45,
+    0x1D, 0xFC, 0x00, 0x0F, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x54, 0x72, 0x8F, 0x9F, 0x82, 0x64, 0x47, 0x2A, 0x0A,
+    0xFC, 0x00, 0x0E, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x55, 0x73, 0x90, 0x9E, 0x81, 0x63, 0x46, 0x28, 0x0B, 0xFB, 0x00,
+    0x0D, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x74, 0x92, 0x9D, 0x7F, 0x62, 0x44, 0x27, 0x0A, 0xFA, 0x00, 0x0C, 0x1F, 0x4A,
+    0x74, 0x9F, 0x94, 0x75, 0x93, 0x9D, 0x7E, 0x60, 0x43, 0x26, 0x08, 0xF9, 0x00, 0x0B, 0x1F, 0x4A, 0x74, 0x9F, 0x96, 0x94,
+    0x9F, 0xA5, 0x83, 0x61, 0x3F, 0x1C, 0xF8, 0x00, 0x0C, 0x1F, 0x4A, 0x74, 0x9F, 0xB4, 0x97, 0x7A, 0x98, 0x9C, 0x7A, 0x58,
+    0x35, 0x13, 0xF9, 0x00, 0x0D, 0x1F, 0x4A, 0x74, 0x9F, 0x97, 0x78, 0x5D, 0x7F, 0xA2, 0x93, 0x71, 0x4E, 0x2C, 0x0A, 0xFA,
+    0x00, 0x0D, 0x1F, 0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x44, 0x66, 0x89, 0xAC, 0x8A, 0x67, 0x45, 0x23, 0xFA, 0x00, 0x0E, 0x1F,
+    0x4A, 0x74, 0x9F, 0x94, 0x6A, 0x3F, 0x4E, 0x70, 0x93, 0xA3, 0x80, 0x5E, 0x3C, 0x1A, 0xFB, 0x00, 0x0F, 0x1F, 0x4A, 0x74,
+    0x9F, 0x94, 0x6A, 0x3F, 0x35, 0x57, 0x7A, 0x9D, 0x9A, 0x77, 0x55, 0x33, 0x10, 0xFC, 0x00, 0x10, 0x1F, 0x4A, 0x74, 0x9F,
+    0x94, 0x6A, 0x3F, 0x1C, 0x3F, 0x61, 0x84, 0xA6, 0x90, 0x6E, 0x4C, 0x29, 0x07, 0xFD, 0x00, 0x10, 0x1F, 0x4A, 0x74, 0x95,
+    0x94, 0x6A, 0x3F, 0x15, 0x26, 0x49, 0x6B, 0x8E, 0x95, 0x87, 0x65, 0x40, 0x17, 0xFD, 0x00, 0x0A, 0x1D, 0x46, 0x67, 0x6A,
+    0x6A, 0x61, 0x3C, 0x13, 0x0D, 0x30, 0x52, 0xFE, 0x6A, 0x02, 0x64, 0x40, 0x17, 0xFD, 0x00, 0x0A, 0x0C, 0x2C, 0x3F, 0x40,
+    0x40, 0x3C, 0x25, 0x03, 0x00, 0x17, 0x34, 0xFE, 0x40, 0x02, 0x3D, 0x28, 0x07, 0xFC, 0x00, 0x00, 0x08, 0xFE, 0x15, 0x01,
+    0x13, 0x03, 0xFE, 0x00, 0x00, 0x0E, 0xFE, 0x15, 0x01, 0x14, 0x05, 0x81, 0x00, 0x95, 0x00, 0x01, 0x14, 0x23, 0xFB, 0x25,
+    0x01, 0x1B, 0x03, 0xF7, 0x00, 0x02, 0x10, 0x34, 0x4D, 0xFB, 0x4F, 0x01, 0x3F, 0x1D, 0xF7, 0x00, 0x02, 0x1A, 0x45, 0x6F,
+    0xFB, 0x7A, 0x01, 0x54, 0x2A, 0xF7, 0x00, 0x03, 0x1B, 0x45, 0x70, 0x9A, 0xFE, 0xA3, 0x03, 0xA4, 0x7F, 0x55, 0x2A, 0xF7,
+    0x00, 0x02, 0x1A, 0x45, 0x6E, 0xFE, 0x78, 0x04, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF7, 0x00, 0x0A, 0x0F, 0x33, 0x4B, 0x4E,
+    0x4E, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF6, 0x00, 0x09, 0x12, 0x22, 0x23, 0x32, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A,
+    0xF4, 0x00, 0x07, 0x07, 0x32, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF4, 0x00, 0x07, 0x07, 0x32, 0x5C, 0x87, 0xAA, 0x7F,
+    0x55, 0x2A, 0xF4, 0x00, 0x07, 0x07, 0x32, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF4, 0x00, 0x07, 0x07, 0x32, 0x5C, 0x87,
+    0xAA, 0x7F, 0x55, 0x2A, 0xF4, 0x00, 0x07, 0x07, 0x32, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF4, 0x00, 0x07, 0x07, 0x32,
+    0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF4, 0x00, 0x07, 0x07, 0x32, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF4, 0x00, 0x07,
+    0x07, 0x32, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF4, 0x00, 0x07, 0x07, 0x32, 0x5C, 0x87, 0xAA, 0x7F, 0x55, 0x2A, 0xF4,
+    0x00, 0x0A, 0x07, 0x31, 0x5C, 0x86, 0xAA, 0x7F, 0x55, 0x2A, 0x0E, 0x0E, 0x0D, 0xF7, 0x00, 0x0C, 0x04, 0x2E, 0x58, 0x82,
+    0xAC, 0x84, 0x5C, 0x39, 0x38, 0x38, 0x37, 0x23, 0x04, 0xF8, 0x00, 0x05, 0x26, 0x50, 0x78, 0xA0, 0x94, 0x72, 0xFE, 0x63,
+    0x02, 0x5F, 0x3E, 0x16, 0xF8, 0x00, 0x0B, 0x1A, 0x41, 0x66, 0x8A, 0xA8, 0x97, 0x8E, 0x8D, 0x8D, 0x6F, 0x45, 0x1A, 0xF8,
+    0x00, 0x05, 0x07, 0x2C, 0x4E, 0x6C, 0x83, 0x91, 0xFE, 0x95, 0x02, 0x6F, 0x45, 0x1A, 0xF7, 0x00, 0x04, 0x12, 0x30, 0x4A,
+    0x5D, 0x67, 0xFE, 0x6A, 0x02, 0x65, 0x41, 0x18, 0xF6, 0x00, 0x03, 0x0F, 0x24, 0x34, 0x3D, 0xFE, 0x40, 0x02, 0x3E, 0x29,
+    0x08, 0xF4, 0x00, 0x01, 0x0C, 0x13, 0xFE, 0x15, 0x01, 0x14, 0x06, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0xAD, 0x00,
+    0x0E, 0x01, 0x15, 0x1B, 0x1B, 0x1A, 0x23, 0x28, 0x24, 0x18, 0x19, 0x25, 0x28, 0x23, 0x17, 0x03, 0xFB, 0x00, 0x0F, 0x20,
+    0x3C, 0x45, 0x45, 0x44, 0x4D, 0x53, 0x4E, 0x3F, 0x40, 0x4E, 0x52, 0x4D, 0x3E, 0x25, 0x07, 0xFD, 0x00, 0x10, 0x08, 0x32,
+    0x5B, 0x70, 0x70, 0x6C, 0x75, 0x7D, 0x77, 0x63, 0x65, 0x78, 0x7D, 0x76, 0x61, 0x43, 0x20, 0xFD, 0x00, 0x11, 0x09, 0x34,
+    0x5E, 0x89, 0x9A, 0x7D, 0x9B, 0xA7, 0x9E, 0x81, 0x84, 0x9F, 0xA7, 0x9C, 0x7E, 0x5A, 0x32, 0x0A, 0xFE, 0x00, 0x11, 0x09,
+    0x34, 0x5E, 0x89, 0xA5, 0x90, 0x7B, 0x81, 0x9F, 0x95, 0x91, 0x7C, 0x7F, 0x9C, 0x91, 0x68, 0x3F, 0x15, 0xFE, 0x00, 0x11,
+    0x09, 0x34, 0x5E, 0x89, 0xA7, 0x7D, 0x54, 0x66, 0x90, 0xA8, 0x7E, 0x56, 0x64, 0x8E, 0x9A, 0x70, 0x46, 0x1B, 0xFE, 0x00,
+    0x11, 0x09, 0x34, 0x5E, 0x89, 0xA2, 0x77, 0x4D, 0x61, 0x8B, 0xA3, 0x78, 0x4E, 0x5F, 0x89, 0x9F, 0x74, 0x4A, 0x1F, 0xFE,
+    0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x75, 0x4A, 0x5E, 0x89, 0xA1, 0x76, 0x4C, 0x5D, 0x87, 0xA1, 0x76, 0x4C, 0x21,
+    0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x74, 0x4A, 0x5E, 0x88, 0xA0, 0x75, 0x4B, 0x5C, 0x87, 0xA2, 0x77, 0x4D,
+    0x22, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x74, 0x4A, 0x5E, 0x88, 0xA0, 0x75, 0x4B, 0x5C, 0x87, 0xA2, 0x77,
+    0x4D, 0x22, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x74, 0x4A, 0x5E, 0x88, 0xA0, 0x75, 0x4B, 0x5C, 0x87, 0xA2,
+    0x77, 0x4D, 0x22, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x74, 0x4A, 0x5E, 0x88, 0xA0, 0x75, 0x4B, 0x5C, 0x87,
+    0xA2, 0x77, 0x4D, 0x22, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x74, 0x4A, 0x5E, 0x88, 0xA0, 0x75, 0x4B, 0x5C,
+    0x87, 0xA2, 0x77, 0x4D, 0x22, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x74, 0x4A, 0x5E, 0x88, 0xA0, 0x75, 0x4B,
+    0x5C, 0x87, 0xA2, 0x77, 0x4D, 0x22, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x74, 0x4A, 0x5E, 0x88, 0xA0, 0x75,
+    0x4B, 0x5C, 0x87, 0xA2, 0x77, 0x4D, 0x22, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x95, 0x74, 0x4A, 0x5E, 0x88, 0x95,
+    0x75, 0x4B, 0x5C, 0x87, 0x95, 0x77, 0x4D, 0x22, 0xFE, 0x00, 0x11, 0x08, 0x31, 0x58, 0x6A, 0x6A, 0x67, 0x46, 0x58, 0x6A,
+    0x6A, 0x68, 0x47, 0x56, 0x6A, 0x6A, 0x69, 0x48, 0x20, 0xFD, 0x00, 0x10, 0x1D, 0x38, 0x40, 0x40, 0x3F, 0x2C, 0x37, 0x40,
+    0x40, 0x3F, 0x2D, 0x37, 0x40, 0x40, 0x3F, 0x2E, 0x0E, 0xFC, 0x00, 0x00, 0x10, 0xFE, 0x15, 0x01, 0x08, 0x10, 0xFE, 0x15,
+    0x01, 0x09, 0x10, 0xFE, 0x15, 0x00, 0x0A, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0xAC, 0x00, 0x01, 0x01, 0x15, 0xFE, 0x1B,
+    0x06, 0x11, 0x1F, 0x26, 0x28, 0x24, 0x1A, 0x0A, 0xF8, 0x00, 0x01, 0x20, 0x3C, 0xFE, 0x45, 0x07, 0x38, 0x47, 0x50, 0x52,
+    0x4E, 0x42, 0x2F, 0x15, 0xFA, 0x00, 0x0E, 0x08, 0x32, 0x5B, 0x70, 0x70, 0x6F, 0x5D, 0x70, 0x7A, 0x7D, 0x77, 0x69, 0x51,
+    0x33, 0x12, 0xFB, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x9A, 0x7D, 0x80, 0x97, 0xA4, 0xA7, 0xA0, 0x8D, 0x6F, 0x4D, 0x28,
+    0x01, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x97, 0x84, 0x7D, 0x82, 0x96, 0xAB, 0x87, 0x60, 0x38, 0x10,
+    0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xB0, 0x9B, 0x78, 0x5D, 0x52, 0x5B, 0x79, 0x9F, 0x96, 0x6D, 0x44, 0x1A, 0xFC,
+    0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xB2, 0x89, 0x62, 0x3C, 0x28, 0x41, 0x6A, 0x93, 0x9F, 0x74, 0x4A, 0x20, 0xFC, 0x00,
+    0x0F, 0x09, 0x34, 0x5E, 0x89, 0xAA, 0x80, 0x56, 0x2C, 0x0F, 0x3A, 0x64, 0x8F, 0xA2, 0x77, 0x4D, 0x22, 0xFC, 0x00, 0x0F,
+    0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09,
+    0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34,
+    0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E,
+    0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89,
+    0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8,
+    0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D,
+    0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x95, 0x7D, 0x53,
+    0x28, 0x0F, 0x39, 0x64, 0x8E, 0x95, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x02, 0x07, 0x31, 0x58, 0xFE, 0x6A, 0x09, 0x4E, 0x25,
+    0x0D, 0x36, 0x5D, 0x6A, 0x6A, 0x69, 0x49, 0x20, 0xFB, 0x00, 0x01, 0x1C, 0x38, 0xFE, 0x40, 0x09, 0x31, 0x13, 0x00, 0x21,
+    0x3A, 0x40, 0x40, 0x3F, 0x2E, 0x0F, 0xFA, 0x00, 0x00, 0x10, 0xFE, 0x15, 0x00, 0x0C, 0xFE, 0x00, 0x00, 0x12, 0xFE, 0x15,
+    0x00, 0x0A, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0xA9, 0x00, 0x07, 0x07, 0x17, 0x21, 0x26, 0x27, 0x24, 0x1C, 0x0F,
+    0xF5, 0x00, 0x0A, 0x17, 0x2D, 0x3F, 0x4B, 0x51, 0x52, 0x4E, 0x45, 0x36, 0x22, 0x08, 0xF8, 0x00, 0x0C, 0x1A, 0x39, 0x52,
+    0x67, 0x75, 0x7B, 0x7C, 0x78, 0x6D, 0x5C, 0x44, 0x28, 0x09, 0xFA, 0x00, 0x0D, 0x13, 0x35, 0x56, 0x74, 0x8C, 0x9D, 0xA6,
+    0xA6, 0xA2, 0x95, 0x7F, 0x64, 0x45, 0x22, 0xFA, 0x00, 0x0E, 0x27, 0x4D, 0x71, 0x92, 0xA7, 0x8D, 0x7E, 0x7B, 0x85, 0x9A,
+    0xA0, 0x80, 0x5D, 0x38, 0x12, 0xFC, 0x00, 0x0F, 0x0F, 0x37, 0x5F, 0x86, 0xAC, 0x8C, 0x6B, 0x55, 0x51, 0x5F, 0x7D, 0xA0,
+    0x97, 0x71, 0x49, 0x21, 0xFC, 0x00, 0x10, 0x19, 0x43, 0x6C, 0x95, 0xA1, 0x79, 0x52, 0x2F, 0x27, 0x41, 0x67, 0x8E, 0xA7,
+    0x7F, 0x55, 0x2C, 0x02, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0x9F, 0x97, 0x6D, 0x43, 0x1A, 0x08, 0x31, 0x5A, 0x84, 0xAE,
+    0x88, 0x5E, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F, 0xA9,
+    0x8D, 0x62, 0x38, 0x0D, 0xFD, 0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5, 0x90, 0x66, 0x3B, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8,
+    0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x24, 0x4F, 0x79, 0xA4, 0x92, 0x68, 0x3D, 0x13, 0x00, 0x2A, 0x55, 0x7F, 0xA9,
+    0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x98, 0x6E, 0x45, 0x1C, 0x0A, 0x32, 0x5B, 0x85, 0xAF,
+    0x87, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6B, 0x94, 0xA2, 0x7A, 0x54, 0x32, 0x2B, 0x44, 0x69, 0x90, 0xA6,
+    0x7E, 0x55, 0x2B, 0x02, 0xFD, 0x00, 0x0F, 0x0D, 0x36, 0x5E, 0x84, 0xA9, 0x8E, 0x6E, 0x59, 0x55, 0x63, 0x7F, 0xA2, 0x95,
+    0x6F, 0x48, 0x1F, 0xFB, 0x00, 0x0E, 0x25, 0x4B, 0x6E, 0x90, 0xAA, 0x91, 0x82, 0x80, 0x89, 0x9E, 0x9D, 0x7E, 0x5B, 0x36,
+    0x10, 0xFB, 0x00, 0x0D, 0x10, 0x33, 0x54, 0x71, 0x88, 0x99, 0xA1, 0xA2, 0x9D, 0x91, 0x7C, 0x61, 0x43, 0x20, 0xF9, 0x00,
+    0x0C, 0x17, 0x35, 0x4F, 0x63, 0x70, 0x77, 0x78, 0x74, 0x69, 0x58, 0x41, 0x25, 0x07, 0xF8, 0x00, 0x0A, 0x13, 0x29, 0x3B,
+    0x46, 0x4D, 0x4E, 0x4A, 0x41, 0x32, 0x1E, 0x05, 0xF6, 0x00, 0x07, 0x04, 0x12, 0x1D, 0x22, 0x23, 0x20, 0x18, 0x0B, 0x81,
+    0x00, 0xFC, 0x00, 0x81, 0x00, 0xAC, 0x00, 0x0B, 0x03, 0x16, 0x1B, 0x1B, 0x1A, 0x16, 0x22, 0x27, 0x26, 0x20, 0x14, 0x03,
+    0xF8, 0x00, 0x01, 0x22, 0x3D, 0xFE, 0x45, 0x07, 0x3E, 0x4C, 0x52, 0x51, 0x4A, 0x3C, 0x28, 0x0F, 0xFA, 0x00, 0x0E, 0x0B,
+    0x34, 0x5D, 0x70, 0x70, 0x6F, 0x64, 0x74, 0x7C, 0x7B, 0x73, 0x62, 0x4B, 0x2F, 0x0F, 0xFB, 0x00, 0x0F, 0x0C, 0x36, 0x61,
+    0x8B, 0x9A, 0x7B, 0x87, 0x9C, 0xA5, 0xA6, 0x9B, 0x87, 0x6B, 0x4B, 0x28, 0x04, 0xFC, 0x00, 0x0F, 0x0C, 0x36, 0x61, 0x8B,
+    0xA6, 0x82, 0x97, 0x83, 0x7B, 0x80, 0x94, 0xA7, 0x87, 0x63, 0x3E, 0x17, 0xFC, 0x00, 0x0F, 0x0C, 0x36, 0x61, 0x8B, 0xB6,
+    0x9D, 0x7A, 0x5C, 0x51, 0x59, 0x75, 0x98, 0x9D, 0x76, 0x4F, 0x26, 0xFC, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B, 0xB5, 0x8C,
+    0x64, 0x3E, 0x26, 0x39, 0x5F, 0x87, 0xAD, 0x84, 0x5B, 0x32, 0x08, 0xFD, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B, 0xAC, 0x82,
+    0x58, 0x2F, 0x06, 0x2A, 0x53, 0x7D, 0xA7, 0x8E, 0x63, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B, 0xA7, 0x7D,
+    0x52, 0x28, 0x00, 0x23, 0x4D, 0x78, 0xA2, 0x93, 0x68, 0x3E, 0x13, 0xFD, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B,
+    0x51, 0x26, 0x00, 0x21, 0x4C, 0x76, 0xA1, 0x94, 0x6A, 0x3F, 0x15, 0xFD, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B, 0xA7, 0x7D,
+    0x53, 0x28, 0x00, 0x23, 0x4E, 0x78, 0xA2, 0x92, 0x68, 0x3E, 0x13, 0xFD, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B, 0xAC, 0x83,
+    0x59, 0x30, 0x07, 0x2B, 0x54, 0x7D, 0xA7, 0x8D, 0x63, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x0C, 0x36, 0x61, 0x8B, 0xB6, 0x8E,
+    0x66, 0x41, 0x2A, 0x3C, 0x61, 0x88, 0xAC, 0x83, 0x5B, 0x31, 0x08, 0xFD, 0x00, 0x0F, 0x0C, 0x36, 0x61, 0x8B, 0xB4, 0x9F,
+    0x7C, 0x60, 0x55, 0x5D, 0x77, 0x9A, 0x9B, 0x75, 0x4E, 0x25, 0xFC, 0x00, 0x0F, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x80, 0x9B,
+    0x87, 0x7F, 0x85, 0x97, 0xA4, 0x84, 0x61, 0x3C, 0x16, 0xFC, 0x00, 0x0F, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x84, 0x99,
+    0xA2, 0xA1, 0x97, 0x83, 0x68, 0x48, 0x26, 0x02, 0xFC, 0x00, 0x0E, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x60, 0x70, 0x78,
+    0x77, 0x6F, 0x5E, 0x48, 0x2C, 0x0C, 0xFB, 0x00, 0x0D, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x48, 0x4E, 0x4D, 0x46,
+    0x38, 0x24, 0x0C, 0xFA, 0x00, 0x0B, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x26, 0x23, 0x22, 0x1C, 0x10, 0xF8, 0x00,
+    0x07, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x0C, 0x36, 0x61, 0x8B, 0x94, 0x7B, 0x51, 0x26,
+    0xF4, 0x00, 0x07, 0x0A, 0x33, 0x5A, 0x6A, 0x6A, 0x69, 0x4C, 0x23, 0xF3, 0x00, 0x01, 0x1E, 0x38, 0xFE, 0x3F, 0x01, 0x30,
+    0x11, 0xF2, 0x00, 0x00, 0x11, 0xFE, 0x15, 0x00, 0x0B, 0xE0, 0x00, 0x81, 0x00, 0xA9, 0x00, 0x0A, 0x09, 0x19, 0x22, 0x26,
+    0x24, 0x1C, 0x14, 0x19, 0x19, 0x18, 0x0E, 0xF8, 0x00, 0x07, 0x18, 0x2F, 0x40, 0x4C, 0x50, 0x4E, 0x45, 0x3C, 0xFE, 0x43,
+    0x01, 0x32, 0x12, 0xFA, 0x00, 0x0D, 0x1A, 0x39, 0x53, 0x68, 0x75, 0x7A, 0x78, 0x6D, 0x5D, 0x6E, 0x6E, 0x6D, 0x4C, 0x23,
+    0xFB, 0x00, 0x0E, 0x12, 0x35, 0x56, 0x75, 0x8E, 0x9F, 0xA5, 0xA2, 0x93, 0x7A, 0x8C, 0x98, 0x7A, 0x4F, 0x25, 0xFB, 0x00,
+    0x0E, 0x26, 0x4C, 0x70, 0x92, 0xA6, 0x8C, 0x7F, 0x7E, 0x8B, 0x96, 0x8C, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x0E,
+    0x36, 0x5E, 0x85, 0xAB, 0x8B, 0x6A, 0x55, 0x55, 0x68, 0x89, 0xA8, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x19, 0x42,
+    0x6C, 0x94, 0xA0, 0x78, 0x51, 0x2E, 0x2D, 0x4E, 0x75, 0x9D, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x75,
+    0x9E, 0x97, 0x6D, 0x43, 0x1A, 0x17, 0x40, 0x69, 0x93, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x24, 0x4F, 0x79, 0xA4,
+    0x92, 0x67, 0x3D, 0x13, 0x0F, 0x39, 0x64, 0x8E, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x26, 0x50, 0x7B, 0xA5, 0x90,
+    0x66, 0x3B, 0x11, 0x0D, 0x37, 0x62, 0x8C, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x67,
+    0x3D, 0x13, 0x0F, 0x39, 0x64, 0x8E, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x20, 0x4B, 0x75, 0x9F, 0x97, 0x6D, 0x43,
+    0x1A, 0x17, 0x40, 0x69, 0x93, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x19, 0x42, 0x6C, 0x94, 0xA0, 0x78, 0x51, 0x2E,
+    0x2D, 0x4F, 0x75, 0x9D, 0xA4, 0x7A, 0x4F, 0x25, 0xFC, 0x00, 0x0F, 0x0E, 0x36, 0x5F, 0x85, 0xAB, 0x8B, 0x6A, 0x55, 0x55,
+    0x69, 0x89, 0xA7, 0xA4, 0x7A, 0x4F, 0x25, 0xFB, 0x00, 0x0E, 0x26, 0x4C, 0x70, 0x92, 0xA7, 0x8D, 0x7F, 0x7E, 0x8B, 0x96,
+    0x8C, 0xA4, 0x7A, 0x4F, 0x25, 0xFB, 0x00, 0x0E, 0x12, 0x35, 0x56, 0x75, 0x8D, 0x9E, 0xA5, 0xA2, 0x93, 0x79, 0x8C, 0xA4,
+    0x7A, 0x4F, 0x25, 0xFA, 0x00, 0x0D, 0x1A, 0x39, 0x53, 0x68, 0x75, 0x7A, 0x78, 0x6C, 0x62, 0x8C, 0xA4, 0x7A, 0x4F, 0x25,
+    0xF9, 0x00, 0x0C, 0x18, 0x2F, 0x40, 0x4B, 0x50, 0x4E, 0x44, 0x62, 0x8C, 0xA4, 0x7A, 0x4F, 0x25, 0xF8, 0x00, 0x0B, 0x09,
+    0x18, 0x22, 0x25, 0x24, 0x37, 0x62, 0x8C, 0xA4, 0x7A, 0x4F, 0x25, 0xF4, 0x00, 0x07, 0x0D, 0x37, 0x62, 0x8C, 0xA4, 0x7A,
+    0x4F, 0x25, 0xF4, 0x00, 0x07, 0x0D, 0x37, 0x62, 0x8C, 0x96, 0x7A, 0x4F, 0x25, 0xF4, 0x00, 0x07, 0x0B, 0x35, 0x5C, 0x6C,
+    0x6C, 0x6B, 0x4B, 0x23, 0xF3, 0x00, 0x01, 0x20, 0x3B, 0xFE, 0x41, 0x01, 0x31, 0x11, 0xF2, 0x00, 0x00, 0x13, 0xFE, 0x17,
+    0x00, 0x0C, 0xE8, 0x00, 0x81, 0x00, 0xAA, 0x00, 0x0C, 0x02, 0x16, 0x1B, 0x1B, 0x1A, 0x10, 0x1A, 0x24, 0x28, 0x26, 0x20,
+    0x13, 0x01, 0xF9, 0x00, 0x01, 0x21, 0x3D, 0xFE, 0x45, 0x08, 0x35, 0x43, 0x4E, 0x52, 0x51, 0x49, 0x3A, 0x26, 0x0C, 0xFB,
+    0x00, 0x0E, 0x0A, 0x34, 0x5C, 0x70, 0x70, 0x6F, 0x56, 0x6A, 0x77, 0x7D, 0x7B, 0x71, 0x60, 0x48, 0x24, 0xFB, 0x00, 0x0F,
+    0x0B, 0x35, 0x60, 0x8A, 0x9A, 0x7C, 0x77, 0x90, 0xA1, 0xA7, 0xA5, 0x99, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x0B,
+    0x35, 0x60, 0x8A, 0xA6, 0x7C, 0x95, 0x93, 0x86, 0x82, 0x85, 0x91, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x0B, 0x35,
+    0x60, 0x8A, 0xA6, 0x84, 0x88, 0x6D, 0x5C, 0x57, 0x5B, 0x6A, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0E, 0x0B, 0x35, 0x60,
+    0x8A, 0xB5, 0x94, 0x6E, 0x4C, 0x34, 0x2D, 0x32, 0x46, 0x58, 0x47, 0x23, 0xFB, 0x00, 0x0E, 0x0B, 0x35, 0x60, 0x8A, 0xAF,
+    0x86, 0x5D, 0x35, 0x10, 0x02, 0x0B, 0x23, 0x2E, 0x24, 0x0B, 0xFB, 0x00, 0x07, 0x0B, 0x35, 0x60, 0x8A, 0xA8, 0x7E, 0x54,
+    0x2A, 0xFD, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x07, 0x0B, 0x35, 0x60, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x0B,
+    0x35, 0x60, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x0B, 0x35, 0x60, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xF4, 0x00,
+    0x07, 0x0B, 0x35, 0x60, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x0B, 0x35, 0x60, 0x8A, 0xA6, 0x7C, 0x51, 0x27,
+    0xF4, 0x00, 0x07, 0x0B, 0x35, 0x60, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x0B, 0x35, 0x60, 0x8A, 0x95, 0x7C,
+    0x51, 0x27, 0xF4, 0x00, 0x02, 0x09, 0x32, 0x59, 0xFE, 0x6A, 0x01, 0x4D, 0x24, 0xF3, 0x00, 0x01, 0x1E, 0x38, 0xFE, 0x40,
+    0x01, 0x31, 0x12, 0xF2, 0x00, 0x00, 0x11, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0xF9, 0x00, 0x81, 0x00, 0xA9, 0x00, 0x08,
+    0x07, 0x16, 0x21, 0x26, 0x28, 0x26, 0x21, 0x19, 0x0D, 0xF6, 0x00, 0x0B, 0x17, 0x2D, 0x3F, 0x4A, 0x51, 0x52, 0x51, 0x4B,
+    0x42, 0x35, 0x25, 0x09, 0xF9, 0x00, 0x0C, 0x19, 0x38, 0x52, 0x66, 0x74, 0x7B, 0x7D, 0x7B, 0x75, 0x6B, 0x5D, 0x45, 0x20,
+    0xFA, 0x00, 0x0D, 0x0C, 0x32, 0x55, 0x74, 0x8C, 0x9D, 0xA5, 0xA4, 0xA5, 0x9F, 0x93, 0x7B, 0x51, 0x26, 0xFA, 0x00, 0x0D,
+    0x1C, 0x44, 0x6B, 0x90, 0xA5, 0x8B, 0x7E, 0x7A, 0x7C, 0x85, 0x92, 0x7B, 0x51, 0x26, 0xFA, 0x00, 0x0D, 0x26, 0x4F, 0x79,
+    0xA3, 0x8E, 0x69, 0x54, 0x4F, 0x52, 0x5C, 0x6B, 0x7B, 0x51, 0x26, 0xFA, 0x00, 0x0D, 0x29, 0x53, 0x7E, 0xA8, 0x89, 0x5F,
+    0x3E, 0x33, 0x2A, 0x34, 0x46, 0x52, 0x3F, 0x1C, 0xFA, 0x00, 0x0D, 0x25, 0x4F, 0x79, 0xA2, 0x96, 0x77, 0x67, 0x5C, 0x54,
+    0x4B, 0x3E, 0x2B, 0x1C, 0x03, 0xFA, 0x00, 0x0D, 0x1B, 0x43, 0x6A, 0x8C, 0xA8, 0x9D, 0x8F, 0x86, 0x7E, 0x74, 0x65, 0x4E,
+    0x32, 0x11, 0xFA, 0x00, 0x0E, 0x0B, 0x2F, 0x50, 0x6D, 0x83, 0x91, 0x9A, 0xA4, 0xA7, 0x9D, 0x8A, 0x6E, 0x4D, 0x28, 0x02,
+    0xFA, 0x00, 0x0D, 0x14, 0x31, 0x49, 0x5B, 0x68, 0x71, 0x7A, 0x87, 0x9B, 0xAA, 0x87, 0x60, 0x38, 0x0F, 0xFB, 0x00, 0x0E,
+    0x0D, 0x28, 0x33, 0x28, 0x33, 0x3E, 0x47, 0x51, 0x61, 0x7B, 0xA0, 0x95, 0x6B, 0x41, 0x17, 0xFB, 0x00, 0x0E, 0x24, 0x49,
+    0x5E, 0x4E, 0x3E, 0x31, 0x2A, 0x2B, 0x45, 0x6F, 0x9A, 0x97, 0x6C, 0x42, 0x18, 0xFB, 0x00, 0x0E, 0x2B, 0x55, 0x80, 0x75,
+    0x66, 0x5A, 0x54, 0x55, 0x61, 0x7E, 0xA3, 0x8F, 0x66, 0x3D, 0x13, 0xFB, 0x00, 0x0E, 0x2B, 0x55, 0x80, 0x9D, 0x8E, 0x84,
+    0x7F, 0x7F, 0x88, 0x9C, 0x9C, 0x7C, 0x57, 0x30, 0x08, 0xFB, 0x00, 0x0D, 0x2B, 0x55, 0x80, 0x8D, 0x97, 0x9F, 0xA3, 0xA2,
+    0x9C, 0x90, 0x7B, 0x60, 0x40, 0x1D, 0xFA, 0x00, 0x0D, 0x21, 0x44, 0x58, 0x64, 0x6E, 0x75, 0x78, 0x78, 0x73, 0x68, 0x57,
+    0x40, 0x24, 0x04, 0xFA, 0x00, 0x0C, 0x08, 0x21, 0x2F, 0x3B, 0x44, 0x4B, 0x4E, 0x4D, 0x49, 0x3F, 0x31, 0x1D, 0x05, 0xF7,
+    0x00, 0x08, 0x07, 0x11, 0x1A, 0x20, 0x23, 0x23, 0x1F, 0x16, 0x09, 0x81, 0x00, 0xFC, 0x00, 0x81, 0x00, 0xFC, 0x00, 0x04,
+    0x0D, 0x0F, 0x0F, 0x0E, 0x02, 0xF2, 0x00, 0x06, 0x20, 0x36, 0x39, 0x39, 0x38, 0x26, 0x07, 0xF4, 0x00, 0x07, 0x10, 0x39,
+    0x5C, 0x64, 0x64, 0x61, 0x42, 0x1A, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x8E, 0x8E, 0x73, 0x48, 0x1E, 0xF6, 0x00, 0x0D,
+    0x11, 0x1B, 0x1B, 0x3E, 0x69, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0x1B, 0x1B, 0x19, 0x0A, 0xFB, 0x00, 0x01, 0x17, 0x36, 0xFE,
+    0x45, 0x04, 0x69, 0x93, 0x9D, 0x73, 0x48, 0xFE, 0x45, 0x02, 0x43, 0x2C, 0x0A, 0xFC, 0x00, 0x02, 0x28, 0x51, 0x6F, 0xFE,
+    0x70, 0x02, 0x93, 0x9D, 0x73, 0xFD, 0x70, 0x02, 0x68, 0x42, 0x18, 0xFC, 0x00, 0x02, 0x29, 0x54, 0x7E, 0xFE, 0x9A, 0x01,
+    0xA1, 0xA7, 0xFD, 0x9A, 0x03, 0x99, 0x6E, 0x44, 0x19, 0xFC, 0x00, 0x02, 0x29, 0x54, 0x7E, 0xFE, 0x82, 0x01, 0x93, 0x9D,
+    0xFC, 0x82, 0x02, 0x6E, 0x44, 0x19, 0xFC, 0x00, 0x01, 0x20, 0x44, 0xFE, 0x57, 0x03, 0x69, 0x93, 0x9D, 0x73, 0xFD, 0x57,
+    0x02, 0x54, 0x37, 0x12, 0xFC, 0x00, 0x09, 0x08, 0x22, 0x2D, 0x2D, 0x3E, 0x69, 0x93, 0x9D, 0x73, 0x48, 0xFE, 0x2D, 0x01,
+    0x2B, 0x19, 0xF9, 0x00, 0x0B, 0x02, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0x02, 0x02, 0x01, 0xF7, 0x00, 0x07,
+    0x14, 0x3E, 0x69, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0xF4,
+    0x00, 0x07, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x0A, 0x14, 0x3E, 0x69, 0x93, 0x9D, 0x73, 0x48,
+    0x1E, 0x09, 0x09, 0x08, 0xF7, 0x00, 0x06, 0x12, 0x3D, 0x67, 0x91, 0x9F, 0x75, 0x4B, 0xFE, 0x34, 0x01, 0x32, 0x1F, 0xF8,
+    0x00, 0x0C, 0x0E, 0x37, 0x61, 0x8A, 0xA9, 0x83, 0x66, 0x5F, 0x5E, 0x5E, 0x5A, 0x3B, 0x14, 0xF9, 0x00, 0x06, 0x04, 0x2C,
+    0x54, 0x7A, 0x9D, 0xA0, 0x8F, 0xFE, 0x89, 0x02, 0x6E, 0x44, 0x19, 0xF8, 0x00, 0x05, 0x1B, 0x40, 0x61, 0x7B, 0x8B, 0x93,
+    0xFE, 0x95, 0x02, 0x6E, 0x44, 0x19, 0xF8, 0x00, 0x05, 0x05, 0x25, 0x40, 0x55, 0x62, 0x68, 0xFE, 0x6A, 0x02, 0x64, 0x40,
+    0x17, 0xF7, 0x00, 0x04, 0x05, 0x1C, 0x2D, 0x38, 0x3E, 0xFE, 0x40, 0x02, 0x3D, 0x28, 0x07, 0xF5, 0x00, 0x02, 0x05, 0x0F,
+    0x14, 0xFE, 0x15, 0x01, 0x14, 0x06, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0xAB, 0x00, 0x00, 0x14, 0xFE, 0x1A, 0x08,
+    0x10, 0x00, 0x00, 0x04, 0x16, 0x1A, 0x1A, 0x19, 0x0E, 0xFA, 0x00, 0x01, 0x1F, 0x3B, 0xFE, 0x44, 0x04, 0x35, 0x16, 0x00,
+    0x24, 0x3E, 0xFE, 0x44, 0x01, 0x32, 0x11, 0xFC, 0x00, 0x0F, 0x08, 0x32, 0x5A, 0x6F, 0x6F, 0x6E, 0x4F, 0x26, 0x0E, 0x37,
+    0x5F, 0x6F, 0x6F, 0x6D, 0x4A, 0x21, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x99, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64,
+    0x8E, 0x99, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E,
+    0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2,
+    0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78,
+    0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D,
+    0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23,
+    0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC,
+    0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x3A, 0x64, 0x8F, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00,
+    0x0F, 0x09, 0x33, 0x5E, 0x88, 0xA8, 0x7E, 0x53, 0x29, 0x15, 0x3E, 0x68, 0x92, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F,
+    0x06, 0x30, 0x5A, 0x85, 0xAD, 0x83, 0x5A, 0x32, 0x2F, 0x4D, 0x73, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x2A,
+    0x53, 0x7D, 0xA5, 0x91, 0x6E, 0x59, 0x59, 0x69, 0x88, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x1F, 0x47, 0x6E,
+    0x94, 0xAA, 0x90, 0x83, 0x82, 0x8E, 0x8D, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x0F, 0x35, 0x59, 0x79, 0x92,
+    0xA0, 0xA3, 0x9C, 0x8A, 0x70, 0x8E, 0x95, 0x78, 0x4D, 0x23, 0xFA, 0x00, 0x0D, 0x1D, 0x3D, 0x58, 0x6C, 0x76, 0x78, 0x73,
+    0x65, 0x5D, 0x6A, 0x6A, 0x69, 0x49, 0x20, 0xFA, 0x00, 0x0D, 0x01, 0x1D, 0x33, 0x44, 0x4C, 0x4E, 0x49, 0x3E, 0x3A, 0x40,
+    0x40, 0x3F, 0x2E, 0x0F, 0xF8, 0x00, 0x06, 0x0D, 0x1B, 0x22, 0x23, 0x20, 0x15, 0x12, 0xFE, 0x15, 0x00, 0x0A, 0x81, 0x00,
+    0x01, 0x00, 0x00, 0x81, 0x00, 0xAD, 0x00, 0x05, 0x04, 0x17, 0x1B, 0x1B, 0x1A, 0x10, 0xFD, 0x00, 0x05, 0x07, 0x18, 0x1B,
+    0x1B, 0x1A, 0x0E, 0xFC, 0x00, 0x01, 0x24, 0x3E, 0xFE, 0x45, 0x0B, 0x35, 0x15, 0x00, 0x00, 0x05, 0x28, 0x41, 0x45, 0x45,
+    0x44, 0x31, 0x10, 0xFE, 0x00, 0x11, 0x0D, 0x37, 0x5F, 0x70, 0x70, 0x6F, 0x4F, 0x26, 0x00, 0x00, 0x14, 0x3C, 0x64, 0x70,
+    0x70, 0x6D, 0x49, 0x20, 0xFE, 0x00, 0x11, 0x0B, 0x34, 0x5C, 0x84, 0x9A, 0x85, 0x5C, 0x34, 0x0C, 0x00, 0x22, 0x4A, 0x73,
+    0x9A, 0x96, 0x6E, 0x46, 0x1D, 0xFD, 0x00, 0x10, 0x25, 0x4D, 0x76, 0x9E, 0x92, 0x6A, 0x42, 0x1A, 0x08, 0x30, 0x58, 0x80,
+    0xA9, 0x88, 0x5F, 0x37, 0x0F, 0xFD, 0x00, 0x10, 0x17, 0x3F, 0x67, 0x8F, 0xA0, 0x78, 0x50, 0x28, 0x16, 0x3E, 0x66, 0x8E,
+    0xA1, 0x79, 0x51, 0x29, 0x01, 0xFD, 0x00, 0x0F, 0x09, 0x31, 0x59, 0x81, 0xA9, 0x86, 0x5E, 0x36, 0x24, 0x4C, 0x74, 0x9C,
+    0x93, 0x6B, 0x43, 0x1B, 0xFB, 0x00, 0x0E, 0x23, 0x4B, 0x73, 0x9B, 0x94, 0x6C, 0x44, 0x32, 0x5A, 0x82, 0xAA, 0x85, 0x5D,
+    0x35, 0x0D, 0xFB, 0x00, 0x0D, 0x15, 0x3D, 0x65, 0x8D, 0xA2, 0x7A, 0x52, 0x40, 0x68, 0x90, 0x9F, 0x77, 0x4F, 0x27, 0xFA,
+    0x00, 0x0D, 0x06, 0x2E, 0x56, 0x7E, 0xA7, 0x88, 0x5F, 0x4E, 0x76, 0x9E, 0x90, 0x68, 0x40, 0x18, 0xF9, 0x00, 0x0C, 0x20,
+    0x48, 0x70, 0x98, 0x95, 0x6D, 0x5C, 0x84, 0xAA, 0x82, 0x5A, 0x32, 0x0A, 0xF9, 0x00, 0x0B, 0x12, 0x3A, 0x62, 0x8A, 0xA3,
+    0x7B, 0x6A, 0x92, 0x9C, 0x74, 0x4C, 0x24, 0xF8, 0x00, 0x0B, 0x04, 0x2C, 0x54, 0x7C, 0xA4, 0x89, 0x77, 0xA0, 0x8E, 0x66,
+    0x3E, 0x16, 0xF7, 0x00, 0x0A, 0x1D, 0x46, 0x6E, 0x96, 0x97, 0x85, 0xA8, 0x80, 0x58, 0x2F, 0x07, 0xF7, 0x00, 0x09, 0x0F,
+    0x37, 0x5F, 0x87, 0xA8, 0x9C, 0x99, 0x71, 0x49, 0x21, 0xF6, 0x00, 0x09, 0x01, 0x29, 0x51, 0x79, 0x95, 0x95, 0x8B, 0x63,
+    0x3B, 0x13, 0xF5, 0x00, 0x02, 0x1B, 0x43, 0x66, 0xFE, 0x6A, 0x02, 0x54, 0x2D, 0x05, 0xF5, 0x00, 0x02, 0x0A, 0x2A, 0x3E,
+    0xFE, 0x40, 0x01, 0x35, 0x19, 0xF3, 0x00, 0x01, 0x07, 0x14, 0xFE, 0x15, 0x00, 0x0F, 0x81, 0x00, 0xFB, 0x00, 0x81, 0x00,
+    0xAE, 0x00, 0x05, 0x08, 0x18, 0x1B, 0x1B, 0x19, 0x0B, 0xFA, 0x00, 0x00, 0x15, 0xFE, 0x1B, 0x0A, 0x11, 0x00, 0x00, 0x06,
+    0x29, 0x41, 0x45, 0x45, 0x43, 0x2D, 0x0B, 0xFC, 0x00, 0x01, 0x1F, 0x3C, 0xFE, 0x45, 0x0A, 0x36, 0x17, 0x00, 0x14, 0x3E,
+    0x65, 0x70, 0x70, 0x69, 0x43, 0x1A, 0xFD, 0x00, 0x10, 0x07, 0x31, 0x59, 0x70, 0x70, 0x6F, 0x50, 0x27, 0x00, 0x12, 0x3B,
+    0x65, 0x8E, 0x9A, 0x76, 0x4C, 0x23, 0xFD, 0x00, 0x5A, 0x10, 0x3A, 0x63, 0x8D, 0x9A, 0x77, 0x4E, 0x25, 0x00, 0x08, 0x32,
+    0x5B, 0x84, 0xA8, 0x7F, 0x55, 0x2C, 0x1C, 0x22, 0x22, 0x20, 0x19, 0x43, 0x6C, 0x96, 0x97, 0x6E, 0x44, 0x1B, 0x00, 0x00,
+    0x28, 0x51, 0x7B, 0xA4, 0x88, 0x5E, 0x35, 0x42, 0x4C, 0x4C, 0x4A, 0x32, 0x4C, 0x75, 0x9F, 0x8D, 0x64, 0x3B, 0x11, 0x00,
+    0x00, 0x1E, 0x48, 0x71, 0x9A, 0x91, 0x67, 0x3E, 0x5D, 0x77, 0x77, 0x6E, 0x45, 0x54, 0x7E, 0xA8, 0x84, 0x5A, 0x31, 0x08,
+    0x00, 0x00, 0x15, 0x3E, 0x67, 0x91, 0x9A, 0x70, 0x47, 0x68, 0x91, 0xA1, 0x7A, 0x51, 0x5D, 0x87, 0xA3, 0x7A, 0x51, 0x27,
+    0xFE, 0x00, 0x11, 0x0B, 0x34, 0x5E, 0x87, 0xA3, 0x79, 0x50, 0x73, 0x9C, 0x91, 0x85, 0x5C, 0x66, 0x90, 0x9A, 0x70, 0x47,
+    0x1E, 0xFE, 0x00, 0x11, 0x01, 0x2B, 0x54, 0x7D, 0xA7, 0x82, 0x58, 0x7F, 0x95, 0x83, 0x91, 0x68, 0x6F, 0x99, 0x90, 0x67,
+    0x3D, 0x14, 0xFD, 0x00, 0x10, 0x21, 0x4A, 0x74, 0x9D, 0x8B, 0x61, 0x8A, 0x89, 0x77, 0x9C, 0x73, 0x78, 0xA2, 0x86, 0x5D,
+    0x34, 0x0A, 0xFD, 0x00, 0x10, 0x17, 0x41, 0x6A, 0x93, 0x94, 0x6C, 0x95, 0x7D, 0x6B, 0x94, 0x7F, 0x81, 0xA6, 0x7D, 0x53,
+    0x2A, 0x01, 0xFD, 0x00, 0x0F, 0x0E, 0x37, 0x60, 0x8A, 0x9D, 0x78, 0x9A, 0x71, 0x5F, 0x88, 0x8A, 0x8A, 0x9C, 0x73, 0x4A,
+    0x20, 0xFC, 0x00, 0x0F, 0x04, 0x2D, 0x57, 0x80, 0xA6, 0x83, 0x8E, 0x65, 0x53, 0x7C, 0x95, 0x93, 0x93, 0x69, 0x40, 0x17,
+    0xFB, 0x00, 0x0E, 0x24, 0x4D, 0x76, 0xA0, 0xAB, 0x82, 0x59, 0x47, 0x70, 0x99, 0xAF, 0x89, 0x60, 0x36, 0x0D, 0xFB, 0x00,
+    0x0E, 0x1A, 0x43, 0x6D, 0x95, 0x95, 0x76, 0x4E, 0x3B, 0x64, 0x8D, 0x95, 0x7F, 0x56, 0x2D, 0x03, 0xFB, 0x00, 0x08, 0x10,
+    0x39, 0x5F, 0x6A, 0x6A, 0x65, 0x42, 0x2F, 0x57, 0xFE, 0x6A, 0x01, 0x4B, 0x23, 0xFA, 0x00, 0x08, 0x01, 0x23, 0x3B, 0x40,
+    0x40, 0x3E, 0x29, 0x1B, 0x37, 0xFE, 0x40, 0x01, 0x30, 0x11, 0xF9, 0x00, 0x07, 0x02, 0x13, 0x15, 0x15, 0x14, 0x06, 0x00,
+    0x10, 0xFE, 0x15, 0x00, 0x0B, 0x81, 0x00, 0xFE, 0x00, 0x81, 0x00, 0xAC, 0x00, 0x00, 0x14, 0xFE, 0x1B, 0x01, 0x15, 0x02,
+    0xFE, 0x00, 0x05, 0x0F, 0x1A, 0x1B, 0x1B, 0x19, 0x0A, 0xFC, 0x00, 0x01, 0x1E, 0x3B, 0xFE, 0x45, 0x05, 0x3D, 0x21, 0x00,
+    0x00, 0x12, 0x33, 0xFE, 0x45, 0x02, 0x43, 0x2C, 0x0A, 0xFE, 0x00, 0x02, 0x05, 0x2F, 0x58, 0xFE, 0x70, 0x0B, 0x5C, 0x3A,
+    0x17, 0x09, 0x2B, 0x4E, 0x6E, 0x70, 0x70, 0x68, 0x42, 0x18, 0xFE, 0x00, 0x11, 0x04, 0x2D, 0x53, 0x75, 0x97, 0x97, 0x75,
+    0x53, 0x31, 0x22, 0x44, 0x67, 0x89, 0x9A, 0x84, 0x62, 0x3E, 0x16, 0xFD, 0x00, 0x10, 0x17, 0x39, 0x5B, 0x7D, 0x9F, 0x8E,
+    0x6C, 0x4A, 0x3B, 0x5D, 0x80, 0xA2, 0x8D, 0x6B, 0x49, 0x27, 0x04, 0xFC, 0x00, 0x0E, 0x20, 0x42, 0x64, 0x86, 0xA7, 0x85,
+    0x63, 0x54, 0x76, 0x99, 0x95, 0x73, 0x51, 0x2F, 0x0D, 0xFB, 0x00, 0x0D, 0x06, 0x28, 0x4A, 0x6C, 0x8E, 0x9E, 0x7C, 0x6D,
+    0x8F, 0x9E, 0x7C, 0x5A, 0x38, 0x16, 0xF9, 0x00, 0x0B, 0x0F, 0x31, 0x53, 0x75, 0x97, 0x95, 0x86, 0xA6, 0x84, 0x62, 0x40,
+    0x1E, 0xF7, 0x00, 0x0A, 0x18, 0x3A, 0x5C, 0x7E, 0xA0, 0xA7, 0x8D, 0x6B, 0x49, 0x27, 0x05, 0xF7, 0x00, 0x09, 0x10, 0x32,
+    0x54, 0x76, 0x98, 0xA9, 0x85, 0x63, 0x41, 0x1F, 0xF7, 0x00, 0x0B, 0x08, 0x29, 0x4B, 0x6D, 0x8F, 0x9E, 0x8F, 0x9F, 0x7D,
+    0x5B, 0x39, 0x17, 0xF8, 0x00, 0x0C, 0x21, 0x43, 0x65, 0x87, 0xA7, 0x85, 0x76, 0x98, 0x96, 0x74, 0x52, 0x30, 0x0E, 0xFA,
+    0x00, 0x0E, 0x19, 0x3B, 0x5D, 0x7F, 0xA1, 0x8E, 0x6C, 0x5D, 0x7F, 0xA2, 0x8E, 0x6C, 0x4A, 0x28, 0x06, 0xFC, 0x00, 0x0F,
+    0x10, 0x32, 0x54, 0x76, 0x98, 0x98, 0x75, 0x53, 0x44, 0x66, 0x89, 0xA7, 0x85, 0x63, 0x42, 0x20, 0xFD, 0x00, 0x11, 0x08,
+    0x2A, 0x4C, 0x6E, 0x90, 0xA1, 0x7F, 0x5C, 0x3A, 0x2B, 0x4D, 0x6F, 0x92, 0x9F, 0x7D, 0x5B, 0x39, 0x17, 0xFE, 0x00, 0x17,
+    0x18, 0x41, 0x65, 0x87, 0x95, 0x88, 0x66, 0x43, 0x21, 0x12, 0x34, 0x56, 0x79, 0x95, 0x95, 0x75, 0x52, 0x2A, 0x01, 0x00,
+    0x00, 0x18, 0x41, 0x65, 0xFE, 0x6A, 0x06, 0x4D, 0x2A, 0x08, 0x00, 0x1B, 0x3D, 0x60, 0xFE, 0x6A, 0x07, 0x52, 0x2A, 0x01,
+    0x00, 0x00, 0x08, 0x29, 0x3E, 0xFE, 0x40, 0x06, 0x30, 0x11, 0x00, 0x00, 0x02, 0x23, 0x3B, 0xFE, 0x40, 0x01, 0x34, 0x17,
+    0xFD, 0x00, 0x01, 0x06, 0x14, 0xFE, 0x15, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0x02, 0x13, 0xFE, 0x15, 0x00, 0x0E, 0x81, 0x00,
+    0x00, 0x00, 0x81, 0x00, 0xAD, 0x00, 0x01, 0x03, 0x16, 0xFE, 0x1B, 0x00, 0x12, 0xFD, 0x00, 0x01, 0x03, 0x16, 0xFE, 0x1B,
+    0x00, 0x12, 0xFC, 0x00, 0x01, 0x22, 0x3E, 0xFE, 0x45, 0x01, 0x37, 0x18, 0xFE, 0x00, 0x01, 0x22, 0x3D, 0xFE, 0x45, 0x01,
+    0x38, 0x19, 0xFE, 0x00, 0x02, 0x0B, 0x35, 0x5D, 0xFE, 0x70, 0x06, 0x52, 0x2B, 0x03, 0x00, 0x0D, 0x35, 0x5D, 0xFE, 0x70,
+    0x01, 0x53, 0x2A, 0xFE, 0x00, 0x11, 0x09, 0x32, 0x59, 0x81, 0x9A, 0x89, 0x61, 0x3A, 0x12, 0x00, 0x1C, 0x44, 0x6C, 0x94,
+    0x9A, 0x76, 0x4F, 0x27, 0xFD, 0x00, 0x10, 0x22, 0x4A, 0x71, 0x99, 0x98, 0x70, 0x49, 0x21, 0x03, 0x2B, 0x53, 0x7B, 0xA3,
+    0x8F, 0x67, 0x3F, 0x18, 0xFD, 0x00, 0x10, 0x13, 0x3A, 0x62, 0x89, 0xA7, 0x7F, 0x58, 0x30, 0x12, 0x3A, 0x62, 0x8A, 0xA7,
+    0x7F, 0x58, 0x30, 0x08, 0xFD, 0x00, 0x0F, 0x03, 0x2B, 0x52, 0x7A, 0xA1, 0x8F, 0x67, 0x3F, 0x21, 0x49, 0x71, 0x98, 0x97,
+    0x70, 0x48, 0x21, 0xFB, 0x00, 0x0E, 0x1B, 0x43, 0x6A, 0x92, 0x9E, 0x76, 0x4E, 0x30, 0x58, 0x7F, 0xA7, 0x88, 0x60, 0x39,
+    0x11, 0xFB, 0x00, 0x0E, 0x0C, 0x33, 0x5B, 0x82, 0xAA, 0x85, 0x5D, 0x3F, 0x67, 0x8E, 0xA0, 0x79, 0x51, 0x29, 0x02, 0xFA,
+    0x00, 0x0C, 0x24, 0x4B, 0x73, 0x9A, 0x94, 0x6C, 0x4E, 0x75, 0x9D, 0x91, 0x69, 0x42, 0x1A, 0xF9, 0x00, 0x0C, 0x14, 0x3C,
+    0x63, 0x8B, 0xA3, 0x7B, 0x5C, 0x84, 0xA9, 0x82, 0x5A, 0x32, 0x0B, 0xF9, 0x00, 0x0B, 0x05, 0x2C, 0x54, 0x7B, 0xA3, 0x8A,
+    0x6B, 0x93, 0x9A, 0x72, 0x4B, 0x23, 0xF7, 0x00, 0x0A, 0x1D, 0x44, 0x6C, 0x93, 0x99, 0x7A, 0xA2, 0x8A, 0x63, 0x3B, 0x14,
+    0xF7, 0x00, 0x0A, 0x0D, 0x35, 0x5C, 0x84, 0xA8, 0x8F, 0xA3, 0x7B, 0x54, 0x2C, 0x04, 0xF6, 0x00, 0x08, 0x25, 0x4D, 0x74,
+    0x9C, 0xB9, 0x94, 0x6C, 0x44, 0x1D, 0xF5, 0x00, 0x08, 0x16, 0x3D, 0x65, 0x8C, 0xAD, 0x85, 0x5D, 0x36, 0x0E, 0xF7, 0x00,
+    0x09, 0x0A, 0x0D, 0x1D, 0x43, 0x6B, 0x92, 0x9E, 0x76, 0x4E, 0x27, 0xF7, 0x00, 0x0A, 0x1B, 0x33, 0x38, 0x38, 0x56, 0x7C,
+    0xA2, 0x8E, 0x67, 0x3F, 0x17, 0xF8, 0x00, 0x0B, 0x0B, 0x33, 0x57, 0x62, 0x62, 0x6F, 0x90, 0xA4, 0x7E, 0x56, 0x2F, 0x08,
+    0xF8, 0x00, 0x0A, 0x0F, 0x39, 0x64, 0x8D, 0x8D, 0x95, 0xAB, 0x8D, 0x6A, 0x45, 0x1F, 0xF7, 0x00, 0x0A, 0x0F, 0x39, 0x64,
+    0x8E, 0x94, 0x93, 0x86, 0x6F, 0x51, 0x30, 0x0C, 0xF7, 0x00, 0x09, 0x0D, 0x36, 0x5C, 0x6A, 0x6A, 0x68, 0x5F, 0x4C, 0x33,
+    0x15, 0xF5, 0x00, 0x07, 0x20, 0x3A, 0x3F, 0x3F, 0x3E, 0x36, 0x27, 0x12, 0xF3, 0x00, 0x04, 0x11, 0x15, 0x15, 0x14, 0x0D,
+    0xE0, 0x00, 0x81, 0x00, 0xAB, 0x00, 0x01, 0x10, 0x1B, 0xF8, 0x1C, 0x01, 0x1B, 0x0D, 0xFA, 0x00, 0x01, 0x13, 0x34, 0xF7,
+    0x46, 0x02, 0x45, 0x2F, 0x0E, 0xFB, 0x00, 0x02, 0x22, 0x4C, 0x6F, 0xF8, 0x71, 0x02, 0x6C, 0x46, 0x1C, 0xFB, 0x00, 0x02,
+    0x24, 0x4E, 0x79, 0xF8, 0x9B, 0x02, 0x72, 0x48, 0x1D, 0xFB, 0x00, 0x02, 0x24, 0x4E, 0x79, 0xFA, 0x83, 0x04, 0x99, 0x9D,
+    0x72, 0x48, 0x1D, 0xFB, 0x00, 0x01, 0x1C, 0x40, 0xFB, 0x58, 0x06, 0x69, 0x8A, 0xA5, 0x84, 0x63, 0x41, 0x19, 0xFB, 0x00,
+    0x02, 0x05, 0x20, 0x2D, 0xFE, 0x2E, 0x08, 0x41, 0x62, 0x84, 0xA5, 0x8B, 0x6A, 0x49, 0x27, 0x06, 0xF9, 0x00, 0x0B, 0x03,
+    0x03, 0x19, 0x3B, 0x5C, 0x7D, 0x9E, 0x92, 0x70, 0x4F, 0x2E, 0x0D, 0xF7, 0x00, 0x09, 0x13, 0x34, 0x55, 0x76, 0x97, 0x98,
+    0x77, 0x56, 0x35, 0x13, 0xF7, 0x00, 0x09, 0x0C, 0x2D, 0x4E, 0x70, 0x91, 0x9F, 0x7E, 0x5C, 0x3B, 0x1A, 0xF7, 0x00, 0x09,
+    0x05, 0x26, 0x48, 0x69, 0x8A, 0xA6, 0x84, 0x63, 0x42, 0x21, 0xF6, 0x00, 0x0B, 0x20, 0x41, 0x62, 0x83, 0xA5, 0x8B, 0x6A,
+    0x49, 0x27, 0x0B, 0x0B, 0x0A, 0xF9, 0x00, 0x07, 0x19, 0x3A, 0x5C, 0x7D, 0x9E, 0x92, 0x70, 0x4F, 0xFD, 0x35, 0x02, 0x34,
+    0x23, 0x04, 0xFC, 0x00, 0x06, 0x03, 0x2D, 0x54, 0x76, 0x97, 0x98, 0x77, 0xFB, 0x60, 0x02, 0x5D, 0x3F, 0x18, 0xFC, 0x00,
+    0x05, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8C, 0xFA, 0x8A, 0x02, 0x72, 0x48, 0x1D, 0xFC, 0x00, 0x03, 0x05, 0x30, 0x5A, 0x85,
+    0xF8, 0x95, 0x02, 0x72, 0x48, 0x1D, 0xFC, 0x00, 0x02, 0x03, 0x2D, 0x55, 0xF7, 0x6A, 0x02, 0x66, 0x44, 0x1B, 0xFB, 0x00,
+    0x01, 0x19, 0x36, 0xF7, 0x40, 0x02, 0x3E, 0x2B, 0x0A, 0xFA, 0x00, 0x00, 0x0F, 0xF7, 0x15, 0x01, 0x14, 0x07, 0x81, 0x00,
+    0x01, 0x00, 0x00, 0x8E, 0x00, 0x06, 0x0D, 0x16, 0x1C, 0x1F, 0x1F, 0x1B, 0x09, 0xF5, 0x00, 0x09, 0x0C, 0x24, 0x35, 0x40,
+    0x46, 0x49, 0x4A, 0x43, 0x27, 0x03, 0xF7, 0x00, 0x0A, 0x08, 0x2A, 0x47, 0x5C, 0x6A, 0x71, 0x74, 0x74, 0x62, 0x39, 0x0F,
+    0xF7, 0x00, 0x0A, 0x1D, 0x42, 0x66, 0x82, 0x93, 0x9B, 0x9E, 0x8F, 0x64, 0x3A, 0x0F, 0xF8, 0x00, 0x0B, 0x01, 0x2A, 0x53,
+    0x7B, 0xA1, 0x99, 0x85, 0x7E, 0x7D, 0x64, 0x3A, 0x0F, 0xF8, 0x00, 0x0B, 0x08, 0x32, 0x5D, 0x87, 0xAC, 0x84, 0x5D, 0x53,
+    0x53, 0x4B, 0x2D, 0x07, 0xF8, 0x00, 0x0A, 0x0C, 0x36, 0x60, 0x8B, 0xA7, 0x7C, 0x52, 0x29, 0x28, 0x24, 0x10, 0xF7, 0x00,
+    0x07, 0x0C, 0x37, 0x61, 0x8C, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0xA6, 0x7B, 0x51, 0x26,
+    0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0xA6, 0x7B, 0x51, 0x26, 0xF6, 0x00, 0x09, 0x0C, 0x16, 0x16, 0x38, 0x62, 0x8D,
+    0xA5, 0x7B, 0x50, 0x26, 0xF7, 0x00, 0x0A, 0x13, 0x31, 0x40, 0x41, 0x48, 0x6B, 0x93, 0xA0, 0x77, 0x4D, 0x23, 0xF7, 0x00,
+    0x0A, 0x24, 0x4D, 0x6B, 0x6B, 0x70, 0x83, 0xA3, 0x91, 0x6B, 0x43, 0x1A, 0xF7, 0x00, 0x0A, 0x27, 0x51, 0x7C, 0x96, 0x9A,
+    0x9B, 0x87, 0x73, 0x56, 0x32, 0x0D, 0xF7, 0x00, 0x0A, 0x27, 0x51, 0x7C, 0x87, 0x8B, 0x9A, 0x95, 0x7E, 0x5E, 0x39, 0x12,
+    0xF7, 0x00, 0x0A, 0x20, 0x45, 0x5C, 0x5C, 0x62, 0x79, 0x9D, 0x98, 0x70, 0x47, 0x1E, 0xF7, 0x00, 0x0A, 0x09, 0x25, 0x31,
+    0x32, 0x3E, 0x67, 0x90, 0xA3, 0x79, 0x4E, 0x24, 0xF5, 0x00, 0x08, 0x07, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x51, 0x26,
+    0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0xA6, 0x7B,
+    0x51, 0x26, 0xF4, 0x00, 0x09, 0x0C, 0x37, 0x61, 0x8C, 0xA6, 0x7B, 0x51, 0x26, 0x0C, 0x08, 0xF6, 0x00, 0x0A, 0x0B, 0x36,
+    0x60, 0x8A, 0xA8, 0x7E, 0x54, 0x37, 0x36, 0x31, 0x1A, 0xF7, 0x00, 0x0B, 0x07, 0x30, 0x5A, 0x84, 0xAD, 0x89, 0x6A, 0x61,
+    0x61, 0x56, 0x33, 0x0B, 0xF7, 0x00, 0x0A, 0x26, 0x4E, 0x75, 0x98, 0xA4, 0x92, 0x8C, 0x8B, 0x64, 0x3A, 0x0F, 0xF7, 0x00,
+    0x0A, 0x16, 0x3B, 0x5C, 0x77, 0x86, 0x8D, 0x90, 0x8F, 0x64, 0x3A, 0x0F, 0xF6, 0x00, 0x09, 0x20, 0x3C, 0x50, 0x5D, 0x63,
+    0x66, 0x67, 0x5B, 0x35, 0x0D, 0xF6, 0x00, 0x08, 0x01, 0x18, 0x28, 0x33, 0x39, 0x3B, 0x3C, 0x37, 0x1F, 0xF2, 0x00, 0x04,
+    0x09, 0x0E, 0x11, 0x12, 0x0E, 0xD2, 0x00, 0x91, 0x00, 0x05, 0x0A, 0x1F, 0x24, 0x24, 0x23, 0x15, 0xF3, 0x00, 0x07, 0x02,
+    0x28, 0x46, 0x4E, 0x4E, 0x4D, 0x36, 0x13, 0xF4, 0x00, 0x07, 0x0C, 0x36, 0x61, 0x79, 0x79, 0x72, 0x49, 0x1F, 0xF4, 0x00,
+    0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F,
+    0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74,
+    0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C,
+    0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37,
+    0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07,
+    0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4,
+    0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49,
+    0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E,
+    0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61,
+    0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C,
+    0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00,
+    0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F,
+    0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x86, 0x86, 0x74,
+    0x49, 0x1F, 0xF4, 0x00, 0x07, 0x07, 0x2E, 0x51, 0x5C, 0x5C, 0x5A, 0x3F, 0x18, 0xF3, 0x00, 0x06, 0x15, 0x2C, 0x31, 0x31,
+    0x30, 0x20, 0x03, 0xF2, 0x00, 0x03, 0x03, 0x07, 0x07, 0x06, 0xF8, 0x00, 0x94, 0x00, 0x06, 0x15, 0x1F, 0x1F, 0x1E, 0x19,
+    0x11, 0x05, 0xF4, 0x00, 0x08, 0x18, 0x39, 0x4A, 0x4A, 0x48, 0x43, 0x3A, 0x2C, 0x16, 0xF5, 0x00, 0x09, 0x26, 0x50, 0x74,
+    0x74, 0x72, 0x6D, 0x63, 0x51, 0x37, 0x17, 0xF6, 0x00, 0x0A, 0x27, 0x51, 0x7C, 0x9E, 0x9D, 0x97, 0x8B, 0x73, 0x52, 0x2D,
+    0x05, 0xF7, 0x00, 0x0A, 0x27, 0x51, 0x7B, 0x7D, 0x81, 0x8E, 0xAC, 0x8C, 0x64, 0x3C, 0x12, 0xF7, 0x00, 0x0A, 0x1C, 0x3F,
+    0x52, 0x53, 0x57, 0x72, 0x9A, 0x98, 0x6E, 0x44, 0x1A, 0xF7, 0x00, 0x0A, 0x03, 0x1D, 0x28, 0x28, 0x3F, 0x69, 0x94, 0x9D,
+    0x72, 0x48, 0x1D, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68,
+    0x93, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0xF4, 0x00, 0x0A, 0x13,
+    0x3D, 0x68, 0x92, 0x9E, 0x74, 0x4A, 0x1F, 0x16, 0x12, 0x01, 0xF7, 0x00, 0x0A, 0x10, 0x3A, 0x64, 0x8E, 0xA4, 0x7B, 0x54,
+    0x42, 0x40, 0x3B, 0x21, 0xF7, 0x00, 0x0B, 0x08, 0x31, 0x59, 0x81, 0xA3, 0x8F, 0x76, 0x6C, 0x6B, 0x5D, 0x37, 0x0D, 0xF7,
+    0x00, 0x0A, 0x22, 0x46, 0x67, 0x80, 0x8E, 0x9E, 0x96, 0x8F, 0x64, 0x3A, 0x0F, 0xF7, 0x00, 0x0A, 0x28, 0x4E, 0x71, 0x8C,
+    0x9C, 0x90, 0x88, 0x86, 0x64, 0x3A, 0x0F, 0xF8, 0x00, 0x0B, 0x0B, 0x35, 0x5E, 0x86, 0xAC, 0x87, 0x69, 0x5D, 0x5C, 0x53,
+    0x31, 0x0A, 0xF8, 0x00, 0x0A, 0x11, 0x3B, 0x66, 0x90, 0xA2, 0x78, 0x4F, 0x33, 0x31, 0x2D, 0x17, 0xF7, 0x00, 0x09, 0x13,
+    0x3E, 0x68, 0x93, 0x9E, 0x73, 0x49, 0x1E, 0x07, 0x04, 0xF6, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x9D, 0x73, 0x48, 0x1E,
+    0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x9D, 0x73, 0x48, 0x1E, 0xF6, 0x00, 0x09, 0x03, 0x0C, 0x13, 0x3E, 0x68, 0x93,
+    0x9D, 0x73, 0x48, 0x1E, 0xF7, 0x00, 0x0A, 0x0C, 0x29, 0x36, 0x36, 0x41, 0x6B, 0x95, 0x9C, 0x71, 0x47, 0x1D, 0xF7, 0x00,
+    0x0A, 0x21, 0x48, 0x60, 0x61, 0x65, 0x79, 0x9E, 0x95, 0x6B, 0x42, 0x18, 0xF7, 0x00, 0x0A, 0x27, 0x51, 0x7C, 0x8B, 0x8E,
+    0x9B, 0xA4, 0x85, 0x5F, 0x37, 0x0F, 0xF7, 0x00, 0x09, 0x27, 0x51, 0x7C, 0x91, 0x8F, 0x8A, 0x7E, 0x69, 0x4A, 0x26, 0xF6,
+    0x00, 0x09, 0x23, 0x4B, 0x66, 0x66, 0x65, 0x60, 0x56, 0x46, 0x2D, 0x0E, 0xF6, 0x00, 0x08, 0x10, 0x2E, 0x3C, 0x3C, 0x3A,
+    0x36, 0x2D, 0x1F, 0x0B, 0xF4, 0x00, 0x05, 0x08, 0x12, 0x11, 0x10, 0x0C, 0x04, 0xCC, 0x00, 0x81, 0x00, 0x81, 0x00, 0xD7,
+    0x00, 0x06, 0x01, 0x0F, 0x18, 0x1B, 0x19, 0x12, 0x06, 0xFD, 0x00, 0x02, 0x14, 0x1B, 0x11, 0xFB, 0x00, 0x0F, 0x14, 0x28,
+    0x38, 0x42, 0x46, 0x43, 0x3B, 0x2E, 0x1E, 0x0E, 0x0B, 0x20, 0x3A, 0x46, 0x36, 0x16, 0xFD, 0x00, 0x10, 0x1E, 0x38, 0x4E,
+    0x60, 0x6C, 0x70, 0x6E, 0x64, 0x56, 0x44, 0x37, 0x35, 0x44, 0x5B, 0x70, 0x4F, 0x26, 0xFE, 0x00, 0x11, 0x10, 0x38, 0x5A,
+    0x73, 0x87, 0x95, 0x9B, 0x98, 0x8C, 0x7D, 0x6C, 0x60, 0x5F, 0x6A, 0x7E, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x14, 0x3E,
+    0x69, 0x93, 0x9D, 0x90, 0x8C, 0x91, 0x9C, 0xA3, 0x94, 0x8A, 0x89, 0x92, 0xA3, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x11, 0x14,
+    0x3E, 0x69, 0x8C, 0x76, 0x67, 0x62, 0x67, 0x74, 0x84, 0x94, 0x9D, 0x9D, 0x93, 0x80, 0x69, 0x4B, 0x23, 0xFE, 0x00, 0x11,
+    0x13, 0x3D, 0x66, 0x6A, 0x51, 0x3E, 0x37, 0x3E, 0x4C, 0x5D, 0x6B, 0x73, 0x73, 0x6B, 0x5B, 0x46, 0x2D, 0x10, 0xFE, 0x00,
+    0x10, 0x07, 0x2B, 0x45, 0x46, 0x2E, 0x17, 0x0D, 0x15, 0x25, 0x35, 0x42, 0x49, 0x49, 0x42, 0x34, 0x21, 0x0B, 0xFC, 0x00,
+    0x03, 0x0B, 0x1D, 0x1D, 0x0D, 0xFD, 0x00, 0x05, 0x0D, 0x18, 0x1E, 0x1E, 0x18, 0x0C, 0x81, 0x00, 0x81, 0x00, 0x00, 0x00,
+    0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xA2, 0x00, 0x81, 0x00, 0xA8, 0x00, 0x01, 0x07, 0x18, 0xFE,
+    0x1B, 0x00, 0x11, 0xF3, 0x00, 0x02, 0x04, 0x28, 0x41, 0xFE, 0x45, 0x01, 0x35, 0x16, 0xF4, 0x00, 0x07, 0x12, 0x3C, 0x63,
+    0x70, 0x70, 0x6F, 0x4F, 0x26, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0x9A, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13,
+    0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x8E, 0x8E, 0x7C, 0x52, 0x27, 0xF4, 0x00,
+    0x02, 0x10, 0x38, 0x5B, 0xFE, 0x64, 0x01, 0x4A, 0x23, 0xF4, 0x00, 0x07, 0x01, 0x28, 0x49, 0x55, 0x55, 0x52, 0x39, 0x14,
+    0xF4, 0x00, 0x07, 0x09, 0x33, 0x5E, 0x7F, 0x7F, 0x72, 0x47, 0x1D, 0xF4, 0x00, 0x07, 0x0B, 0x36, 0x60, 0x8B, 0x9F, 0x74,
+    0x4A, 0x20, 0xF4, 0x00, 0x07, 0x0E, 0x38, 0x63, 0x8D, 0xA1, 0x77, 0x4C, 0x22, 0xF4, 0x00, 0x07, 0x10, 0x3B, 0x65, 0x90,
+    0xA4, 0x79, 0x4F, 0x25, 0xF4, 0x00, 0x07, 0x13, 0x3D, 0x68, 0x92, 0xA6, 0x7C, 0x51, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E,
+    0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07,
+    0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4,
+    0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA7, 0x7C, 0x52,
+    0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x93, 0xA5, 0x7C, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x13, 0x3E, 0x68, 0x7A, 0x7A,
+    0x79, 0x52, 0x27, 0xF4, 0x00, 0x07, 0x09, 0x2E, 0x4A, 0x50, 0x50, 0x4F, 0x3D, 0x1B, 0xF3, 0x00, 0x01, 0x10, 0x22, 0xFE,
+    0x25, 0x01, 0x1A, 0x01, 0xD0, 0x00, 0x81, 0x00, 0xF9, 0x00, 0x03, 0x08, 0x0C, 0x0C, 0x03, 0xF1, 0x00, 0x05, 0x19, 0x31,
+    0x36, 0x36, 0x28, 0x0C, 0xF3, 0x00, 0x06, 0x0A, 0x32, 0x55, 0x61, 0x61, 0x47, 0x21, 0xF3, 0x00, 0x06, 0x0E, 0x38, 0x63,
+    0x8B, 0x7B, 0x50, 0x26, 0xF3, 0x00, 0x07, 0x0F, 0x38, 0x63, 0x8D, 0x7B, 0x50, 0x26, 0x0C, 0xF6, 0x00, 0x0B, 0x0D, 0x24,
+    0x37, 0x45, 0x63, 0x8D, 0x7B, 0x50, 0x42, 0x34, 0x24, 0x09, 0xF9, 0x00, 0x0C, 0x11, 0x2E, 0x48, 0x5E, 0x6E, 0x78, 0x8D,
+    0x7C, 0x76, 0x6A, 0x5C, 0x45, 0x20, 0xFA, 0x00, 0x0D, 0x0B, 0x2E, 0x4D, 0x6A, 0x83, 0x96, 0xA2, 0xA8, 0xA4, 0x9F, 0x93,
+    0x7D, 0x52, 0x28, 0xFA, 0x00, 0x0D, 0x22, 0x47, 0x69, 0x89, 0xA6, 0x92, 0x81, 0x8D, 0x7B, 0x82, 0x8F, 0x7D, 0x52, 0x28,
+    0xFB, 0x00, 0x0E, 0x0D, 0x35, 0x5C, 0x81, 0xA4, 0x91, 0x71, 0x63, 0x8D, 0x7B, 0x59, 0x69, 0x7A, 0x52, 0x28, 0xFB, 0x00,
+    0x0E, 0x1A, 0x44, 0x6C, 0x94, 0xA1, 0x7A, 0x55, 0x63, 0x8D, 0x7B, 0x50, 0x43, 0x50, 0x3E, 0x1C, 0xFB, 0x00, 0x0E, 0x24,
+    0x4E, 0x77, 0xA1, 0x94, 0x6B, 0x42, 0x63, 0x8D, 0x7B, 0x50, 0x26, 0x26, 0x1B, 0x02, 0xFB, 0x00, 0x0B, 0x29, 0x53, 0x7E,
+    0xA8, 0x8D, 0x63, 0x38, 0x63, 0x8D, 0x7B, 0x50, 0x26, 0xF8, 0x00, 0x0B, 0x2B, 0x55, 0x80, 0xAA, 0x8B, 0x60, 0x38, 0x63,
+    0x8D, 0x7B, 0x50, 0x26, 0xF8, 0x00, 0x0B, 0x29, 0x53, 0x7D, 0xA7, 0x8D, 0x63, 0x39, 0x63, 0x8D, 0x7B, 0x50, 0x26, 0xF8,
+    0x00, 0x0E, 0x23, 0x4D, 0x76, 0xA0, 0x95, 0x6C, 0x44, 0x63, 0x8D, 0x7B, 0x50, 0x26, 0x2A, 0x1F, 0x05, 0xFB, 0x00, 0x0E,
+    0x1A, 0x43, 0x6B, 0x92, 0xA3, 0x7C, 0x58, 0x63, 0x8D, 0x7B, 0x50, 0x47, 0x55, 0x41, 0x1E, 0xFB, 0x00, 0x0E, 0x0C, 0x34,
+    0x5A, 0x7F, 0xA2, 0x94, 0x74, 0x63, 0x8D, 0x7B, 0x5D, 0x6C, 0x7D, 0x52, 0x28, 0xFA, 0x00, 0x0D, 0x20, 0x44, 0x67, 0x86,
+    0xA2, 0x96, 0x85, 0x8D, 0x7E, 0x85, 0x93, 0x7D, 0x52, 0x28, 0xFA, 0x00, 0x0D, 0x09, 0x2B, 0x4A, 0x66, 0x7F, 0x91, 0x9D,
+    0xA5, 0xA2, 0x9B, 0x8F, 0x7D, 0x52, 0x28, 0xF9, 0x00, 0x0C, 0x0E, 0x2B, 0x44, 0x59, 0x69, 0x73, 0x8D, 0x7B, 0x71, 0x66,
+    0x58, 0x42, 0x1E, 0xF8, 0x00, 0x0B, 0x09, 0x20, 0x32, 0x40, 0x63, 0x8D, 0x7B, 0x50, 0x3E, 0x30, 0x20, 0x06, 0xF6, 0x00,
+    0x07, 0x0E, 0x38, 0x63, 0x8D, 0x7B, 0x50, 0x26, 0x08, 0xF4, 0x00, 0x06, 0x0E, 0x38, 0x63, 0x87, 0x7B, 0x50, 0x26, 0xF3,
+    0x00, 0x06, 0x08, 0x30, 0x52, 0x5C, 0x5C, 0x44, 0x1F, 0xF2, 0x00, 0x05, 0x16, 0x2C, 0x32, 0x31, 0x24, 0x09, 0xF1, 0x00,
+    0x02, 0x04, 0x07, 0x07, 0xCF, 0x00, 0x8E, 0x00, 0x04, 0x05, 0x0B, 0x0D, 0x0B, 0x05, 0xF3, 0x00, 0x09, 0x10, 0x22, 0x2E,
+    0x35, 0x38, 0x36, 0x2F, 0x25, 0x17, 0x04, 0xF7, 0x00, 0x0A, 0x1B, 0x34, 0x49, 0x57, 0x5F, 0x62, 0x60, 0x59, 0x4D, 0x3E,
+    0x23, 0xF8, 0x00, 0x0C, 0x18, 0x39, 0x57, 0x6F, 0x80, 0x89, 0x8D, 0x8A, 0x82, 0x75, 0x5E, 0x35, 0x0C, 0xFA, 0x00, 0x0D,
+    0x09, 0x2F, 0x53, 0x76, 0x92, 0xA8, 0x9D, 0x95, 0x97, 0xA0, 0x8C, 0x62, 0x37, 0x0D, 0xFA, 0x00, 0x0D, 0x19, 0x41, 0x68,
+    0x8E, 0xAF, 0x8E, 0x75, 0x6B, 0x6C, 0x78, 0x8B, 0x62, 0x37, 0x0D, 0xFA, 0x00, 0x0D, 0x24, 0x4D, 0x77, 0x9F, 0x9C, 0x75,
+    0x52, 0x40, 0x43, 0x51, 0x68, 0x5B, 0x34, 0x0B, 0xFB, 0x00, 0x0D, 0x01, 0x2B, 0x55, 0x7F, 0xA9, 0x90, 0x67, 0x3E, 0x16,
+    0x1A, 0x2D, 0x3F, 0x3A, 0x20, 0xFA, 0x00, 0x0C, 0x04, 0x2E, 0x59, 0x83, 0xAE, 0x8B, 0x61, 0x36, 0x0C, 0x00, 0x09, 0x15,
+    0x12, 0xFA, 0x00, 0x0C, 0x06, 0x17, 0x2F, 0x59, 0x84, 0xAE, 0x8A, 0x5F, 0x35, 0x1A, 0x1A, 0x19, 0x0A, 0xFA, 0x00, 0x08,
+    0x04, 0x27, 0x40, 0x45, 0x59, 0x84, 0xAE, 0x8A, 0x5F, 0xFE, 0x45, 0x02, 0x42, 0x2B, 0x09, 0xFB, 0x00, 0x07, 0x11, 0x3B,
+    0x63, 0x6F, 0x6F, 0x84, 0xAE, 0x8A, 0xFD, 0x6F, 0x02, 0x68, 0x41, 0x18, 0xFB, 0x00, 0x07, 0x13, 0x3D, 0x68, 0x92, 0x9A,
+    0x9A, 0xB5, 0x9C, 0xFE, 0x9A, 0x03, 0x98, 0x6E, 0x43, 0x19, 0xFB, 0x00, 0x07, 0x13, 0x3D, 0x68, 0x82, 0x82, 0x85, 0xAF,
+    0x8A, 0xFD, 0x82, 0x02, 0x6E, 0x43, 0x19, 0xFB, 0x00, 0x08, 0x0B, 0x32, 0x51, 0x57, 0x59, 0x84, 0xAE, 0x8A, 0x5F, 0xFE,
+    0x57, 0x02, 0x54, 0x37, 0x11, 0xFA, 0x00, 0x0C, 0x16, 0x2A, 0x2F, 0x59, 0x84, 0xAE, 0x8A, 0x5F, 0x35, 0x2D, 0x2D, 0x2B,
+    0x19, 0xF9, 0x00, 0x08, 0x0B, 0x15, 0x2F, 0x59, 0x84, 0xAE, 0x8A, 0x5F, 0x35, 0xFD, 0x15, 0x01, 0x13, 0x04, 0xFC, 0x00,
+    0x08, 0x11, 0x2F, 0x3F, 0x3F, 0x59, 0x84, 0xAE, 0x8A, 0x5F, 0xFC, 0x3F, 0x02, 0x3C, 0x26, 0x05, 0xFD, 0x00, 0x07, 0x22,
+    0x4B, 0x69, 0x6A, 0x6A, 0x84, 0xAE, 0x8A, 0xFB, 0x6A, 0x02, 0x62, 0x3D, 0x14, 0xFD, 0x00, 0x07, 0x25, 0x50, 0x7A, 0x94,
+    0x94, 0x95, 0xB3, 0x97, 0xFB, 0x94, 0x02, 0x6C, 0x41, 0x17, 0xFD, 0x00, 0x02, 0x25, 0x50, 0x7A, 0xF6, 0x95, 0x02, 0x6C,
+    0x41, 0x17, 0xFD, 0x00, 0x01, 0x23, 0x4B, 0xF5, 0x6A, 0x02, 0x62, 0x3E, 0x14, 0xFD, 0x00, 0x01, 0x11, 0x30, 0xF5, 0x40,
+    0x02, 0x3D, 0x26, 0x05, 0xFC, 0x00, 0x00, 0x0B, 0xF5, 0x15, 0x01, 0x13, 0x04, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0xAA,
+    0x00, 0x02, 0x04, 0x0C, 0x04, 0xFB, 0x00, 0x01, 0x0B, 0x08, 0xF8, 0x00, 0x0C, 0x0F, 0x2B, 0x36, 0x2B, 0x10, 0x00, 0x01,
+    0x00, 0x05, 0x23, 0x35, 0x31, 0x1A, 0xFA, 0x00, 0x0E, 0x0F, 0x2D, 0x4B, 0x61, 0x4C, 0x2D, 0x26, 0x2B, 0x29, 0x23, 0x42,
+    0x5D, 0x56, 0x37, 0x19, 0xFB, 0x00, 0x0F, 0x27, 0x4B, 0x69, 0x88, 0x6A, 0x4B, 0x50, 0x56, 0x52, 0x47, 0x60, 0x7E, 0x73,
+    0x55, 0x33, 0x0B, 0xFD, 0x00, 0x10, 0x04, 0x2E, 0x59, 0x7E, 0x9B, 0x87, 0x69, 0x79, 0x80, 0x7C, 0x6E, 0x7E, 0x9C, 0x86,
+    0x64, 0x3B, 0x10, 0xFC, 0x00, 0x0F, 0x21, 0x41, 0x5F, 0x7D, 0x9B, 0x8D, 0x9C, 0x94, 0x98, 0x94, 0x9C, 0x86, 0x68, 0x4A,
+    0x2B, 0x06, 0xFC, 0x00, 0x0E, 0x05, 0x23, 0x41, 0x64, 0x89, 0x90, 0x75, 0x69, 0x70, 0x87, 0x95, 0x70, 0x4A, 0x2C, 0x0E,
+    0xFA, 0x00, 0x0D, 0x21, 0x4B, 0x74, 0x9C, 0x78, 0x54, 0x3F, 0x4B, 0x6D, 0x94, 0x80, 0x56, 0x2D, 0x03, 0xFA, 0x00, 0x0D,
+    0x24, 0x4F, 0x79, 0x9A, 0x70, 0x46, 0x1B, 0x39, 0x63, 0x8E, 0x85, 0x5B, 0x30, 0x06, 0xFA, 0x00, 0x0D, 0x20, 0x4A, 0x73,
+    0x9C, 0x79, 0x55, 0x40, 0x4C, 0x6E, 0x95, 0x7F, 0x56, 0x2C, 0x03, 0xFB, 0x00, 0x0E, 0x05, 0x23, 0x42, 0x64, 0x8A, 0x91,
+    0x76, 0x6A, 0x71, 0x88, 0x93, 0x6E, 0x4B, 0x2D, 0x10, 0xFB, 0x00, 0x0F, 0x21, 0x42, 0x60, 0x7E, 0x9C, 0x8D, 0x9D, 0x95,
+    0x99, 0x91, 0x9B, 0x87, 0x6A, 0x4C, 0x2C, 0x07, 0xFD, 0x00, 0x10, 0x04, 0x2E, 0x59, 0x7E, 0x9C, 0x86, 0x68, 0x77, 0x7E,
+    0x7A, 0x6C, 0x7D, 0x9B, 0x88, 0x65, 0x3B, 0x10, 0xFC, 0x00, 0x0F, 0x27, 0x4B, 0x69, 0x85, 0x67, 0x49, 0x4E, 0x54, 0x51,
+    0x45, 0x5F, 0x7D, 0x71, 0x53, 0x31, 0x0A, 0xFC, 0x00, 0x0E, 0x0F, 0x2D, 0x4B, 0x5E, 0x49, 0x2B, 0x25, 0x29, 0x27, 0x23,
+    0x41, 0x5C, 0x52, 0x34, 0x16, 0xFA, 0x00, 0x04, 0x0E, 0x29, 0x34, 0x28, 0x0D, 0xFE, 0x00, 0x04, 0x05, 0x22, 0x33, 0x2E,
+    0x16, 0xF8, 0x00, 0x02, 0x02, 0x09, 0x01, 0xFB, 0x00, 0x01, 0x08, 0x05, 0x81, 0x00, 0xD4, 0x00, 0x82, 0x00, 0x01, 0x09,
+    0x22, 0xFE, 0x2A, 0x01, 0x27, 0x14, 0xFD, 0x00, 0x01, 0x08, 0x21, 0xFE, 0x2A, 0x01, 0x28, 0x16, 0xFE, 0x00, 0x01, 0x23,
+    0x45, 0xFE, 0x55, 0x02, 0x4F, 0x31, 0x0C, 0xFE, 0x00, 0x01, 0x21, 0x44, 0xFE, 0x55, 0x06, 0x50, 0x33, 0x0E, 0x00, 0x03,
+    0x2D, 0x58, 0xFE, 0x7F, 0x07, 0x6B, 0x46, 0x21, 0x00, 0x00, 0x11, 0x36, 0x5B, 0xFE, 0x7F, 0x2B, 0x6B, 0x40, 0x16, 0x00,
+    0x00, 0x23, 0x48, 0x6D, 0x92, 0xA5, 0x80, 0x5A, 0x35, 0x10, 0x00, 0x25, 0x4A, 0x70, 0x95, 0xA2, 0x7D, 0x58, 0x34, 0x0E,
+    0x00, 0x00, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0x94, 0x6F, 0x4A, 0x25, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0x8C, 0x67, 0x43, 0x1E,
+    0xFD, 0x00, 0x10, 0x1E, 0x43, 0x68, 0x8C, 0xA9, 0x84, 0x5E, 0x39, 0x29, 0x4E, 0x74, 0x99, 0x9B, 0x76, 0x52, 0x2D, 0x09,
+    0xFD, 0x00, 0x0F, 0x09, 0x2E, 0x52, 0x77, 0x9C, 0x98, 0x73, 0x4E, 0x3E, 0x63, 0x88, 0xAA, 0x86, 0x61, 0x3C, 0x18, 0xFC,
+    0x00, 0x10, 0x18, 0x33, 0x3D, 0x62, 0x87, 0xAC, 0x87, 0x62, 0x52, 0x77, 0x9D, 0x95, 0x70, 0x4B, 0x3A, 0x26, 0x05, 0xFE,
+    0x00, 0x11, 0x04, 0x2D, 0x54, 0x67, 0x67, 0x72, 0x97, 0x9C, 0x77, 0x67, 0x8C, 0xA4, 0x7F, 0x67, 0x67, 0x62, 0x3F, 0x17,
+    0xFE, 0x00, 0x0B, 0x06, 0x31, 0x5B, 0x86, 0x91, 0x91, 0x96, 0xAB, 0x8B, 0x7B, 0xA0, 0xA0, 0xFE, 0x91, 0x02, 0x6F, 0x44,
+    0x1A, 0xFE, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xFD, 0x7A, 0x03, 0x90, 0xA0, 0x90, 0x9F, 0xFD, 0x7A, 0x02, 0x6E, 0x44, 0x19,
+    0xFD, 0x00, 0x01, 0x25, 0x46, 0xFE, 0x53, 0x05, 0x56, 0x7B, 0x9F, 0xAE, 0x8A, 0x65, 0xFE, 0x53, 0x02, 0x4F, 0x35, 0x10,
+    0xFE, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xFC, 0x7D, 0x01, 0x94, 0xA6, 0xFC, 0x7D, 0x02, 0x6E, 0x44, 0x1A, 0xFE, 0x00, 0x03,
+    0x06, 0x31, 0x5B, 0x86, 0xFD, 0x8F, 0x01, 0x99, 0xA9, 0xFC, 0x8F, 0x02, 0x6F, 0x44, 0x1A, 0xFE, 0x00, 0x02, 0x03, 0x2C,
+    0x52, 0xFD, 0x64, 0x03, 0x69, 0x94, 0xA6, 0x7B, 0xFD, 0x64, 0x02, 0x5F, 0x3E, 0x16, 0xFD, 0x00, 0x01, 0x16, 0x31, 0xFE,
+    0x3A, 0x05, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0xFE, 0x3A, 0x02, 0x38, 0x24, 0x04, 0xFC, 0x00, 0x0E, 0x0A, 0x0F, 0x0F,
+    0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0x0F, 0x0F, 0x0E, 0x01, 0xF8, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6,
+    0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69,
+    0x94, 0x95, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x02, 0x12, 0x3B, 0x61, 0xFE, 0x6A, 0x01, 0x4C, 0x24, 0xF4, 0x00, 0x02, 0x03,
+    0x25, 0x3C, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF3, 0x00, 0x01, 0x03, 0x13, 0xFE, 0x15, 0x00, 0x0B, 0x81, 0x00, 0xFB, 0x00,
+    0x81, 0x00, 0xFB, 0x00, 0x03, 0x08, 0x0C, 0x0C, 0x0B, 0xF1, 0x00, 0x01, 0x18, 0x30, 0xFE, 0x36, 0x01, 0x25, 0x06, 0xF4,
+    0x00, 0x07, 0x08, 0x31, 0x55, 0x61, 0x61, 0x5F, 0x41, 0x1A, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8B, 0x8B, 0x74, 0x49,
+    0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E,
+    0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61,
+    0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C,
+    0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00,
+    0x07, 0x0C, 0x37, 0x61, 0x8C, 0x99, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0B, 0x35, 0x5D, 0x6F, 0x6F, 0x6B, 0x47, 0x1D,
+    0xF3, 0x00, 0x06, 0x22, 0x3D, 0x44, 0x44, 0x43, 0x2F, 0x0E, 0xF4, 0x00, 0x07, 0x08, 0x31, 0x55, 0x61, 0x61, 0x5F, 0x41,
+    0x1A, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8B, 0x8B, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E,
+    0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61,
+    0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C,
+    0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00,
+    0x07, 0x0C, 0x37, 0x61, 0x8C, 0x9E, 0x74, 0x49, 0x1F, 0xF4, 0x00, 0x07, 0x0C, 0x37, 0x61, 0x8C, 0x99, 0x74, 0x49, 0x1F,
+    0xF4, 0x00, 0x07, 0x0B, 0x35, 0x5D, 0x6F, 0x6F, 0x6B, 0x47, 0x1D, 0xF3, 0x00, 0x06, 0x22, 0x3D, 0x44, 0x44, 0x43, 0x2F,
+    0x0E, 0xF3, 0x00, 0x05, 0x02, 0x15, 0x1A, 0x1A, 0x19, 0x0C, 0xCF, 0x00, 0x90, 0x00, 0x04, 0x05, 0x0C, 0x0D, 0x0B, 0x05,
+    0xF3, 0x00, 0x09, 0x10, 0x22, 0x2F, 0x36, 0x38, 0x35, 0x2F, 0x25, 0x19, 0x08, 0xF7, 0x00, 0x0B, 0x1A, 0x34, 0x4A, 0x58,
+    0x60, 0x62, 0x5F, 0x59, 0x4E, 0x41, 0x28, 0x05, 0xF9, 0x00, 0x0C, 0x16, 0x38, 0x56, 0x6F, 0x81, 0x8A, 0x8D, 0x8A, 0x82,
+    0x77, 0x64, 0x3D, 0x13, 0xFA, 0x00, 0x0D, 0x02, 0x2A, 0x50, 0x74, 0x92, 0xA7, 0x95, 0x90, 0x93, 0x9C, 0x93, 0x69, 0x3E,
+    0x14, 0xFA, 0x00, 0x0D, 0x0D, 0x37, 0x60, 0x89, 0xAA, 0x86, 0x6D, 0x65, 0x69, 0x74, 0x83, 0x69, 0x3E, 0x14, 0xFA, 0x00,
+    0x0D, 0x11, 0x3C, 0x66, 0x91, 0xA0, 0x76, 0x4C, 0x3B, 0x3F, 0x4B, 0x5C, 0x5A, 0x38, 0x10, 0xFA, 0x00, 0x0C, 0x0E, 0x38,
+    0x62, 0x8B, 0xA8, 0x84, 0x65, 0x4B, 0x35, 0x24, 0x34, 0x33, 0x1E, 0xF9, 0x00, 0x0B, 0x04, 0x2C, 0x53, 0x77, 0x97, 0xA1,
+    0x86, 0x6F, 0x5A, 0x44, 0x2E, 0x17, 0xF8, 0x00, 0x0C, 0x10, 0x34, 0x55, 0x72, 0x8A, 0x97, 0xA4, 0x94, 0x7E, 0x69, 0x52,
+    0x39, 0x1E, 0xF9, 0x00, 0x0D, 0x22, 0x49, 0x6F, 0x91, 0x92, 0x75, 0x7F, 0x94, 0xA3, 0x8D, 0x75, 0x5A, 0x3C, 0x1B, 0xFB,
+    0x00, 0x0F, 0x04, 0x2E, 0x57, 0x81, 0xA3, 0x7B, 0x56, 0x5A, 0x70, 0x86, 0x9F, 0x96, 0x78, 0x56, 0x31, 0x0A, 0xFC, 0x00,
+    0x0F, 0x07, 0x32, 0x5C, 0x87, 0xA0, 0x76, 0x4E, 0x35, 0x4C, 0x64, 0x7F, 0xA0, 0x90, 0x68, 0x3F, 0x16, 0xFC, 0x00, 0x0F,
+    0x04, 0x2E, 0x58, 0x80, 0xA8, 0x88, 0x68, 0x4E, 0x37, 0x43, 0x67, 0x8F, 0x9A, 0x70, 0x45, 0x1B, 0xFB, 0x00, 0x0E, 0x22,
+    0x49, 0x6F, 0x90, 0xA4, 0x8A, 0x72, 0x5C, 0x46, 0x65, 0x8D, 0x96, 0x6D, 0x43, 0x19, 0xFB, 0x00, 0x0E, 0x10, 0x33, 0x54,
+    0x71, 0x8A, 0xA1, 0x96, 0x80, 0x6C, 0x7D, 0x9E, 0x85, 0x60, 0x38, 0x10, 0xFA, 0x00, 0x0D, 0x18, 0x35, 0x4F, 0x67, 0x7D,
+    0x92, 0xA5, 0x91, 0x9C, 0x86, 0x6A, 0x4A, 0x26, 0x01, 0xF9, 0x00, 0x0B, 0x13, 0x2C, 0x43, 0x58, 0x6E, 0x84, 0x9C, 0x9D,
+    0x7F, 0x5E, 0x39, 0x13, 0xF9, 0x00, 0x0C, 0x08, 0x1D, 0x22, 0x1E, 0x34, 0x49, 0x61, 0x7D, 0x9D, 0x98, 0x72, 0x49, 0x20,
+    0xF9, 0x00, 0x0C, 0x25, 0x44, 0x4C, 0x3D, 0x2F, 0x27, 0x41, 0x64, 0x8D, 0xA5, 0x7A, 0x50, 0x25, 0xFA, 0x00, 0x0D, 0x0A,
+    0x34, 0x5E, 0x74, 0x65, 0x58, 0x51, 0x55, 0x6C, 0x91, 0xA0, 0x76, 0x4D, 0x23, 0xFA, 0x00, 0x0D, 0x0A, 0x34, 0x5F, 0x89,
+    0x8D, 0x82, 0x7C, 0x7E, 0x8D, 0xA7, 0x8D, 0x69, 0x42, 0x1A, 0xFA, 0x00, 0x0D, 0x0A, 0x34, 0x5F, 0x87, 0x93, 0x9B, 0xA0,
+    0xA0, 0x99, 0x89, 0x70, 0x51, 0x2F, 0x0A, 0xFA, 0x00, 0x0C, 0x04, 0x2B, 0x4D, 0x5E, 0x69, 0x72, 0x76, 0x75, 0x6F, 0x62,
+    0x4E, 0x34, 0x16, 0xF8, 0x00, 0x0A, 0x11, 0x29, 0x35, 0x40, 0x47, 0x4B, 0x4B, 0x46, 0x3B, 0x29, 0x13, 0xF5, 0x00, 0x07,
+    0x0C, 0x16, 0x1D, 0x21, 0x20, 0x1C, 0x13, 0x04, 0xA6, 0x00, 0x93, 0x00, 0x00, 0x10, 0xFE, 0x1D, 0x01, 0x1C, 0x17, 0xFE,
+    0x1D, 0x01, 0x17, 0x03, 0xF8, 0x00, 0x06, 0x11, 0x33, 0x47, 0x48, 0x48, 0x45, 0x3D, 0xFE, 0x48, 0x01, 0x3E, 0x21, 0xF8,
+    0x00, 0x06, 0x1F, 0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02, 0x5B, 0x32, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B,
+    0x75, 0x9D, 0x9A, 0x6F, 0x5C, 0x87, 0x9D, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x9C, 0x9A, 0x6F,
+    0x5C, 0x87, 0x9C, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x06, 0x1F, 0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02,
+    0x5B, 0x32, 0x08, 0xF9, 0x00, 0x06, 0x11, 0x33, 0x46, 0x47, 0x47, 0x45, 0x3D, 0xFE, 0x47, 0x01, 0x3E, 0x21, 0xF7, 0x00,
+    0x05, 0x10, 0x1C, 0x1D, 0x1D, 0x1C, 0x17, 0xFE, 0x1D, 0x01, 0x17, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xAE, 0x00,
+    0x81, 0x00, 0xE7, 0x00, 0x05, 0x02, 0x0B, 0x11, 0x11, 0x0E, 0x07, 0xF4, 0x00, 0x09, 0x0A, 0x1D, 0x2B, 0x35, 0x3B, 0x3C,
+    0x38, 0x30, 0x24, 0x13, 0xF7, 0x00, 0x0C, 0x17, 0x2F, 0x43, 0x54, 0x5F, 0x65, 0x66, 0x62, 0x59, 0x4B, 0x39, 0x22, 0x09,
+    0xFA, 0x00, 0x0E, 0x1B, 0x38, 0x52, 0x69, 0x7C, 0x88, 0x8F, 0x91, 0x8C, 0x82, 0x72, 0x5D, 0x44, 0x29, 0x0A, 0xFC, 0x00,
+    0x10, 0x17, 0x38, 0x58, 0x74, 0x8E, 0x90, 0x81, 0x78, 0x77, 0x7C, 0x88, 0x98, 0x80, 0x65, 0x47, 0x26, 0x04, 0xFE, 0x00,
+    0x11, 0x0B, 0x30, 0x53, 0x74, 0x94, 0x82, 0x6A, 0x61, 0x6A, 0x6E, 0x6B, 0x62, 0x76, 0x91, 0x83, 0x62, 0x40, 0x1C, 0xFE,
+    0x00, 0x7F, 0x1E, 0x45, 0x6A, 0x8E, 0x81, 0x62, 0x75, 0x89, 0x94, 0x98, 0x95, 0x8B, 0x70, 0x73, 0x94, 0x7A, 0x56, 0x2F,
+    0x09, 0x00, 0x05, 0x2D, 0x55, 0x7D, 0x8E, 0x69, 0x75, 0x96, 0x88, 0x74, 0x6D, 0x72, 0x7D, 0x70, 0x59, 0x7D, 0x8E, 0x67,
+    0x40, 0x17, 0x00, 0x0E, 0x38, 0x62, 0x8B, 0x7E, 0x62, 0x8A, 0x8F, 0x6A, 0x4C, 0x43, 0x48, 0x56, 0x5B, 0x44, 0x6C, 0x95,
+    0x74, 0x4B, 0x21, 0x00, 0x14, 0x3E, 0x68, 0x93, 0x75, 0x6B, 0x95, 0x83, 0x59, 0x31, 0x18, 0x1F, 0x2F, 0x32, 0x38, 0x62,
+    0x8D, 0x7B, 0x51, 0x27, 0x00, 0x15, 0x40, 0x6A, 0x95, 0x73, 0x6D, 0x97, 0x80, 0x56, 0x2B, 0x01, 0x05, 0x15, 0x17, 0x36,
+    0x60, 0x8B, 0x7D, 0x53, 0x28, 0x00, 0x12, 0x3D, 0x66, 0x90, 0x78, 0x68, 0x92, 0x86, 0x5E, 0x39, 0x2A, 0x2D, 0x3D, 0x41,
+    0x3C, 0x65, 0x8F, 0x79, 0x4F, 0x25, 0x00, 0x0B, 0x35, 0x5E, 0x4E, 0x86, 0x84, 0x5D, 0x83, 0x97, 0x75, 0x5D, 0x54, 0x57,
+    0x64, 0x67, 0x4C, 0x72, 0x98, 0x70, 0x47, 0x1E, 0x00, 0x00, 0x28, 0x50, 0x76, 0x96, 0x72, 0x6B, 0x89, 0x96, 0x85, 0x7F,
+    0x81, 0x8B, 0x70, 0x63, 0x86, 0x87, 0x61, 0x3A, 0x12, 0x00, 0x00, 0x17, 0x3D, 0x61, 0x84, 0x8D, 0x6E, 0x67, 0x7A, 0x84,
+    0x87, 0x84, 0x7B, 0x6A, 0x7F, 0x93, 0x71, 0x4E, 0x28, 0x02, 0x00, 0x00, 0x03, 0x27, 0x49, 0x69, 0x87, 0x8F, 0x78, 0x67,
+    0x5E, 0x5C, 0x62, 0x70, 0x84, 0x94, 0x77, 0x57, 0x36, 0x13, 0xFD, 0x00, 0x0F, 0x0D, 0x2D, 0x4B, 0x67, 0x7F, 0x93, 0x90,
+    0x88, 0x87, 0x8C, 0x97, 0x89, 0x72, 0x58, 0x3B, 0x1C, 0xFB, 0x00, 0x0D, 0x0F, 0x2B, 0x45, 0x5A, 0x6C, 0x79, 0x7F, 0x81,
+    0x7C, 0x72, 0x63, 0x4F, 0x37, 0x1C, 0xF9, 0x00, 0x0B, 0x09, 0x21, 0x34, 0x44, 0x4F, 0x55, 0x56, 0x52, 0x4A, 0x3C, 0x2A,
+    0x14, 0xF6, 0x00, 0x08, 0x0E, 0x1B, 0x25, 0x2B, 0x2C, 0x28, 0x20, 0x14, 0x04, 0xF1, 0x00, 0x00, 0x01, 0x81, 0x00, 0xE4,
+    0x00, 0x90, 0x00, 0x03, 0x08, 0x0D, 0x0D, 0x09, 0xF3, 0x00, 0x09, 0x0C, 0x1D, 0x29, 0x32, 0x37, 0x37, 0x33, 0x29, 0x19,
+    0x03, 0xF7, 0x00, 0x0B, 0x0B, 0x2D, 0x44, 0x52, 0x5C, 0x62, 0x61, 0x5D, 0x51, 0x3E, 0x24, 0x05, 0xF8, 0x00, 0x0B, 0x19,
+    0x43, 0x69, 0x7B, 0x86, 0x8C, 0x8C, 0x86, 0x78, 0x60, 0x41, 0x1F, 0xF8, 0x00, 0x0C, 0x1A, 0x44, 0x6F, 0x95, 0x88, 0x81,
+    0x83, 0x8E, 0x9C, 0x7D, 0x59, 0x32, 0x0A, 0xF9, 0x00, 0x0C, 0x1A, 0x44, 0x6D, 0x6E, 0x5F, 0x57, 0x59, 0x69, 0x8B, 0x91,
+    0x68, 0x3F, 0x16, 0xF9, 0x00, 0x0C, 0x0E, 0x32, 0x4B, 0x5F, 0x6D, 0x74, 0x76, 0x76, 0x80, 0x9A, 0x70, 0x46, 0x1B, 0xF9,
+    0x00, 0x0C, 0x22, 0x47, 0x69, 0x84, 0x96, 0x9C, 0x98, 0x97, 0x97, 0x9C, 0x72, 0x47, 0x1D, 0xFA, 0x00, 0x0D, 0x08, 0x31,
+    0x5A, 0x81, 0x9F, 0x81, 0x72, 0x6D, 0x6D, 0x80, 0x9C, 0x72, 0x47, 0x1D, 0xFA, 0x00, 0x0D, 0x0E, 0x38, 0x62, 0x8D, 0x90,
+    0x66, 0x48, 0x43, 0x5E, 0x86, 0x9C, 0x72, 0x47, 0x1D, 0xFA, 0x00, 0x0D, 0x0D, 0x37, 0x61, 0x8B, 0x94, 0x6E, 0x59, 0x5E,
+    0x76, 0x97, 0x9C, 0x72, 0x47, 0x1D, 0xFA, 0x00, 0x0D, 0x05, 0x2E, 0x56, 0x7C, 0x9D, 0x8F, 0x83, 0x86, 0x97, 0x7F, 0x9C,
+    0x72, 0x47, 0x1D, 0xF9, 0x00, 0x0C, 0x1D, 0x41, 0x61, 0x7A, 0x89, 0x8D, 0x87, 0x76, 0x7F, 0x84, 0x72, 0x47, 0x1D, 0xFA,
+    0x00, 0x02, 0x01, 0x2A, 0x51, 0xF9, 0x68, 0x02, 0x66, 0x46, 0x1D, 0xFA, 0x00, 0x03, 0x03, 0x2D, 0x58, 0x82, 0xFA, 0x92,
+    0x02, 0x75, 0x4B, 0x20, 0xFA, 0x00, 0x02, 0x03, 0x2D, 0x58, 0xF9, 0x80, 0x02, 0x75, 0x4B, 0x20, 0xF9, 0x00, 0x01, 0x23,
+    0x45, 0xF9, 0x55, 0x02, 0x54, 0x3C, 0x17, 0xF9, 0x00, 0x01, 0x09, 0x22, 0xF9, 0x2B, 0x01, 0x2A, 0x1C, 0x81, 0x00, 0x81,
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x92, 0x00, 0x08, 0x15, 0x25, 0x23, 0x0F, 0x00, 0x0D, 0x22, 0x26, 0x17, 0xF6, 0x00, 0x0A,
+    0x19, 0x36, 0x4E, 0x4A, 0x2D, 0x10, 0x2D, 0x48, 0x50, 0x38, 0x14, 0xF8, 0x00, 0x0B, 0x1D, 0x39, 0x55, 0x72, 0x65, 0x3B,
+    0x30, 0x4C, 0x69, 0x73, 0x49, 0x1E, 0xFA, 0x00, 0x0D, 0x04, 0x20, 0x3C, 0x59, 0x75, 0x90, 0x66, 0x3B, 0x50, 0x6C, 0x88,
+    0x73, 0x49, 0x1E, 0xFB, 0x00, 0x0E, 0x07, 0x24, 0x40, 0x5C, 0x79, 0x95, 0x90, 0x66, 0x53, 0x6F, 0x8C, 0x9E, 0x73, 0x49,
+    0x1E, 0xFC, 0x00, 0x0F, 0x0B, 0x27, 0x43, 0x60, 0x7C, 0x98, 0x91, 0x75, 0x59, 0x73, 0x8F, 0x9B, 0x7E, 0x62, 0x42, 0x1A,
+    0xFC, 0x00, 0x0F, 0x25, 0x47, 0x63, 0x7F, 0x9C, 0x8E, 0x72, 0x5A, 0x76, 0x93, 0x97, 0x7B, 0x5F, 0x42, 0x26, 0x07, 0xFD,
+    0x00, 0x0F, 0x04, 0x2F, 0x59, 0x83, 0x9F, 0x8B, 0x6E, 0x52, 0x76, 0x96, 0x94, 0x77, 0x5B, 0x3F, 0x23, 0x06, 0xFC, 0x00,
+    0x0F, 0x04, 0x2F, 0x59, 0x81, 0x9D, 0x8C, 0x70, 0x54, 0x76, 0x94, 0x96, 0x79, 0x5D, 0x41, 0x25, 0x08, 0xFB, 0x00, 0x0F,
+    0x23, 0x45, 0x61, 0x7D, 0x9A, 0x90, 0x74, 0x58, 0x74, 0x91, 0x99, 0x7D, 0x61, 0x44, 0x28, 0x09, 0xFC, 0x00, 0x0F, 0x09,
+    0x25, 0x41, 0x5E, 0x7A, 0x96, 0x93, 0x77, 0x5B, 0x71, 0x8D, 0x9D, 0x80, 0x64, 0x43, 0x1B, 0xFB, 0x00, 0x0E, 0x05, 0x22,
+    0x3E, 0x5A, 0x77, 0x93, 0x90, 0x66, 0x51, 0x6D, 0x8A, 0x9E, 0x73, 0x49, 0x1E, 0xFA, 0x00, 0x0D, 0x02, 0x1E, 0x3B, 0x57,
+    0x73, 0x8F, 0x66, 0x3B, 0x4E, 0x6A, 0x86, 0x73, 0x49, 0x1E, 0xF8, 0x00, 0x0B, 0x1B, 0x37, 0x53, 0x70, 0x65, 0x3B, 0x2E,
+    0x4A, 0x67, 0x72, 0x48, 0x1E, 0xF7, 0x00, 0x0A, 0x17, 0x34, 0x4C, 0x48, 0x2B, 0x0E, 0x2B, 0x46, 0x4D, 0x36, 0x13, 0xF6,
+    0x00, 0x08, 0x13, 0x23, 0x20, 0x0D, 0x00, 0x0B, 0x1F, 0x23, 0x15, 0x81, 0x00, 0xD5, 0x00, 0x81, 0x00, 0x81, 0x00, 0xEE,
+    0x00, 0x01, 0x07, 0x17, 0xF4, 0x1A, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x05, 0x27, 0x40, 0xF4, 0x44, 0x01, 0x34, 0x15, 0xFE,
+    0x00, 0x02, 0x13, 0x3C, 0x63, 0xF5, 0x6F, 0x02, 0x6E, 0x4E, 0x25, 0xFE, 0x00, 0x03, 0x14, 0x3E, 0x69, 0x93, 0xF6, 0x99,
+    0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02, 0x14, 0x3E, 0x69, 0xF6, 0x91, 0x03, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02,
+    0x11, 0x3A, 0x5E, 0xF7, 0x67, 0x04, 0x82, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02, 0x01, 0x22, 0x38, 0xF8, 0x3C, 0x05,
+    0x57, 0x82, 0xA7, 0x7C, 0x52, 0x27, 0xFC, 0x00, 0x00, 0x0F, 0xF9, 0x12, 0x06, 0x2D, 0x57, 0x82, 0xA7, 0x7C, 0x52, 0x27,
+    0xF4, 0x00, 0x07, 0x02, 0x2D, 0x57, 0x82, 0x86, 0x7C, 0x52, 0x27, 0xF3, 0x00, 0x01, 0x25, 0x49, 0xFE, 0x5B, 0x01, 0x45,
+    0x20, 0xF3, 0x00, 0x01, 0x0D, 0x27, 0xFE, 0x31, 0x01, 0x25, 0x09, 0xF1, 0x00, 0xFE, 0x06, 0x81, 0x00, 0xAB, 0x00, 0x81,
+    0x00, 0x81, 0x00, 0xBF, 0x00, 0xFA, 0x01, 0xF5, 0x00, 0x01, 0x12, 0x27, 0xFB, 0x2C, 0x02, 0x2B, 0x1D, 0x01, 0xF8, 0x00,
+    0x02, 0x07, 0x2D, 0x4E, 0xFB, 0x56, 0x02, 0x55, 0x3D, 0x19, 0xF8, 0x00, 0x02, 0x0E, 0x38, 0x63, 0xFB, 0x81, 0x02, 0x76,
+    0x4C, 0x21, 0xF8, 0x00, 0x03, 0x0E, 0x38, 0x63, 0x8D, 0xFD, 0xA5, 0x03, 0xA1, 0x76, 0x4C, 0x21, 0xF8, 0x00, 0x02, 0x0E,
+    0x38, 0x63, 0xFB, 0x7B, 0x02, 0x75, 0x4B, 0x21, 0xF8, 0x00, 0x02, 0x04, 0x2A, 0x48, 0xFB, 0x50, 0x02, 0x4F, 0x39, 0x16,
+    0xF7, 0x00, 0x01, 0x0D, 0x21, 0xFB, 0x26, 0x01, 0x25, 0x18, 0x81, 0x00, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0xE7,
+    0x00, 0x05, 0x02, 0x0B, 0x11, 0x11, 0x0E, 0x07, 0xF4, 0x00, 0x09, 0x0A, 0x1D, 0x2B, 0x35, 0x3B, 0x3C, 0x38, 0x30, 0x24,
+    0x13, 0xF7, 0x00, 0x0C, 0x17, 0x2F, 0x43, 0x54, 0x5F, 0x65, 0x66, 0x62, 0x59, 0x4B, 0x39, 0x22, 0x09, 0xFA, 0x00, 0x0E,
+    0x1B, 0x38, 0x52, 0x69, 0x7C, 0x88, 0x8F, 0x91, 0x8C, 0x82, 0x72, 0x5D, 0x44, 0x29, 0x0A, 0xFC, 0x00, 0x10, 0x17, 0x38,
+    0x58, 0x74, 0x8E, 0x90, 0x81, 0x78, 0x77, 0x7C, 0x88, 0x98, 0x80, 0x65, 0x47, 0x26, 0x04, 0xFE, 0x00, 0x11, 0x0B, 0x30,
+    0x53, 0x74, 0x94, 0x82, 0x6A, 0x66, 0x66, 0x65, 0x60, 0x61, 0x76, 0x91, 0x83, 0x62, 0x40, 0x1C, 0xFE, 0x00, 0x06, 0x1E,
+    0x45, 0x6A, 0x8E, 0x81, 0x62, 0x8A, 0xFE, 0x90, 0x7F, 0x8A, 0x7B, 0x60, 0x73, 0x94, 0x7A, 0x56, 0x2F, 0x09, 0x00, 0x05,
+    0x2D, 0x55, 0x7D, 0x8E, 0x69, 0x60, 0x8A, 0x8B, 0x6E, 0x6F, 0x7E, 0x9C, 0x76, 0x59, 0x7D, 0x8E, 0x67, 0x40, 0x17, 0x00,
+    0x0E, 0x38, 0x62, 0x8B, 0x7E, 0x56, 0x60, 0x8A, 0x8B, 0x60, 0x49, 0x6F, 0x9A, 0x7D, 0x52, 0x6C, 0x95, 0x74, 0x4B, 0x21,
+    0x00, 0x14, 0x3E, 0x68, 0x93, 0x75, 0x4B, 0x60, 0x8A, 0x8B, 0x72, 0x73, 0x81, 0x96, 0x73, 0x4C, 0x62, 0x8D, 0x7B, 0x51,
+    0x27, 0x00, 0x15, 0x40, 0x6A, 0x95, 0x73, 0x48, 0x60, 0x8A, 0x90, 0x8B, 0x97, 0x80, 0x73, 0x5A, 0x39, 0x60, 0x8B, 0x7D,
+    0x53, 0x28, 0x00, 0x12, 0x3D, 0x66, 0x90, 0x78, 0x4E, 0x60, 0x8A, 0x8B, 0x61, 0x77, 0x99, 0x7D, 0x5A, 0x3C, 0x65, 0x8F,
+    0x79, 0x4F, 0x25, 0x00, 0x0B, 0x35, 0x5E, 0x86, 0x84, 0x5D, 0x60, 0x8A, 0x8B, 0x60, 0x5F, 0x83, 0x95, 0x44, 0x71, 0x4C,
+    0x72, 0x98, 0x70, 0x47, 0x1E, 0x00, 0x00, 0x28, 0x50, 0x76, 0x96, 0x72, 0x60, 0x8A, 0x8B, 0x60, 0x48, 0x6D, 0x91, 0x87,
+    0x63, 0x86, 0x87, 0x61, 0x3A, 0x12, 0x00, 0x00, 0x17, 0x3D, 0x61, 0x84, 0x8D, 0x6E, 0x75, 0x75, 0x5E, 0x35, 0x56, 0x75,
+    0x75, 0x7F, 0x93, 0x71, 0x4E, 0x28, 0x02, 0x00, 0x00, 0x03, 0x27, 0x49, 0x69, 0x87, 0x8F, 0x78, 0x67, 0x5E, 0x5C, 0x62,
+    0x70, 0x84, 0x94, 0x77, 0x57, 0x36, 0x13, 0xFD, 0x00, 0x0F, 0x0D, 0x2D, 0x4B, 0x67, 0x7F, 0x93, 0x90, 0x88, 0x87, 0x8C,
+    0x97, 0x89, 0x72, 0x58, 0x3B, 0x1C, 0xFB, 0x00, 0x0D, 0x0F, 0x2B, 0x45, 0x5A, 0x6C, 0x79, 0x7F, 0x81, 0x7C, 0x72, 0x63,
+    0x4F, 0x37, 0x1C, 0xF9, 0x00, 0x0B, 0x09, 0x21, 0x34, 0x44, 0x4F, 0x55, 0x56, 0x52, 0x4A, 0x3C, 0x2A, 0x14, 0xF6, 0x00,
+    0x08, 0x0E, 0x1B, 0x25, 0x2B, 0x2C, 0x28, 0x20, 0x14, 0x04, 0xF1, 0x00, 0x00, 0x01, 0x81, 0x00, 0xE4, 0x00, 0x93, 0x00,
+    0x00, 0x05, 0xF9, 0x10, 0x00, 0x0B, 0xF7, 0x00, 0x02, 0x0B, 0x2A, 0x3A, 0xFA, 0x3B, 0x01, 0x33, 0x19, 0xF8, 0x00, 0x02,
+    0x1E, 0x46, 0x64, 0xFA, 0x65, 0x02, 0x55, 0x30, 0x07, 0xF9, 0x00, 0x02, 0x21, 0x4C, 0x76, 0xFB, 0x90, 0x03, 0x89, 0x5E,
+    0x34, 0x09, 0xF9, 0x00, 0x02, 0x21, 0x4C, 0x76, 0xFB, 0x8E, 0x03, 0x89, 0x5E, 0x34, 0x09, 0xF9, 0x00, 0x02, 0x1D, 0x45,
+    0x62, 0xFA, 0x64, 0x02, 0x54, 0x2F, 0x06, 0xF9, 0x00, 0x01, 0x0A, 0x28, 0xF9, 0x39, 0x01, 0x32, 0x18, 0xF7, 0x00, 0x00,
+    0x04, 0xF9, 0x0F, 0x00, 0x0A, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xAD, 0x00, 0x90, 0x00, 0x03, 0x04, 0x0C, 0x0D, 0x08,
+    0xF2, 0x00, 0x07, 0x07, 0x1D, 0x2D, 0x36, 0x37, 0x31, 0x24, 0x11, 0xF5, 0x00, 0x09, 0x0B, 0x29, 0x42, 0x55, 0x60, 0x62,
+    0x5B, 0x4B, 0x34, 0x18, 0xF7, 0x00, 0x0B, 0x03, 0x26, 0x47, 0x65, 0x7C, 0x8A, 0x8C, 0x83, 0x70, 0x54, 0x35, 0x13, 0xF8,
+    0x00, 0x0B, 0x16, 0x3C, 0x61, 0x83, 0x9F, 0x8C, 0x89, 0x95, 0x90, 0x71, 0x4D, 0x27, 0xF8, 0x00, 0x0C, 0x23, 0x4C, 0x75,
+    0x9B, 0x80, 0x65, 0x5F, 0x72, 0x93, 0x86, 0x5E, 0x36, 0x0C, 0xF9, 0x00, 0x0C, 0x29, 0x54, 0x7E, 0x96, 0x6C, 0x44, 0x37,
+    0x5A, 0x83, 0x91, 0x67, 0x3D, 0x12, 0xF9, 0x00, 0x0C, 0x29, 0x54, 0x7E, 0x97, 0x6D, 0x47, 0x3C, 0x5C, 0x84, 0x90, 0x67,
+    0x3C, 0x12, 0xF9, 0x00, 0x0C, 0x22, 0x4B, 0x73, 0x99, 0x83, 0x6A, 0x65, 0x77, 0x97, 0x84, 0x5C, 0x34, 0x0B, 0xF9, 0x00,
+    0x0B, 0x14, 0x3A, 0x5F, 0x80, 0x9B, 0x92, 0x90, 0x9B, 0x8B, 0x6D, 0x4A, 0x24, 0xF7, 0x00, 0x0A, 0x24, 0x44, 0x60, 0x76,
+    0x82, 0x84, 0x7C, 0x69, 0x4F, 0x31, 0x0F, 0xF7, 0x00, 0x09, 0x08, 0x24, 0x3D, 0x4E, 0x58, 0x5A, 0x53, 0x44, 0x2E, 0x13,
+    0xF5, 0x00, 0x07, 0x02, 0x17, 0x26, 0x2E, 0x2F, 0x2A, 0x1E, 0x0B, 0xF1, 0x00, 0x01, 0x04, 0x05, 0x81, 0x00, 0x81, 0x00,
+    0xA7, 0x00, 0x81, 0x00, 0xBC, 0x00, 0x00, 0x05, 0xFE, 0x09, 0xF1, 0x00, 0x06, 0x16, 0x2E, 0x34, 0x34, 0x33, 0x22, 0x04,
+    0xF4, 0x00, 0x07, 0x07, 0x2F, 0x52, 0x5E, 0x5E, 0x5C, 0x3F, 0x18, 0xF4, 0x00, 0x07, 0x0B, 0x36, 0x60, 0x89, 0x89, 0x73,
+    0x48, 0x1E, 0xF7, 0x00, 0x00, 0x0D, 0xFE, 0x10, 0x06, 0x36, 0x60, 0x8B, 0x9D, 0x73, 0x48, 0x1E, 0xFE, 0x10, 0x00, 0x07,
+    0xFC, 0x00, 0x01, 0x20, 0x37, 0xFD, 0x3A, 0x04, 0x60, 0x8B, 0x9D, 0x73, 0x48, 0xFD, 0x3A, 0x01, 0x2C, 0x0F, 0xFE, 0x00,
+    0x02, 0x11, 0x39, 0x5C, 0xFC, 0x65, 0x02, 0x8B, 0x9D, 0x73, 0xFD, 0x65, 0x02, 0x64, 0x4A, 0x23, 0xFE, 0x00, 0x02, 0x14,
+    0x3E, 0x69, 0xFC, 0x8F, 0x01, 0x93, 0xA1, 0xFC, 0x8F, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x03, 0x14, 0x3E, 0x69, 0x93,
+    0xFD, 0x9A, 0x01, 0x9C, 0xA7, 0xFC, 0x9A, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02, 0x13, 0x3C, 0x64, 0xFC, 0x70, 0x02,
+    0x8B, 0x9D, 0x73, 0xFD, 0x70, 0x02, 0x6F, 0x4F, 0x26, 0xFE, 0x00, 0x02, 0x05, 0x28, 0x41, 0xFD, 0x45, 0x04, 0x60, 0x8B,
+    0x9D, 0x73, 0x48, 0xFD, 0x45, 0x01, 0x35, 0x15, 0xFD, 0x00, 0x01, 0x07, 0x18, 0xFE, 0x1B, 0x06, 0x36, 0x60, 0x8B, 0x9D,
+    0x73, 0x48, 0x1E, 0xFE, 0x1B, 0x00, 0x11, 0xFC, 0x00, 0x01, 0x03, 0x13, 0xFE, 0x15, 0x06, 0x36, 0x60, 0x8B, 0x95, 0x73,
+    0x48, 0x1E, 0xFE, 0x15, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0x02, 0x24, 0x3C, 0xFD, 0x3F, 0x04, 0x5A, 0x6B, 0x6B, 0x67, 0x45,
+    0xFD, 0x3F, 0x01, 0x31, 0x12, 0xFE, 0x00, 0x02, 0x12, 0x3B, 0x60, 0xF4, 0x6A, 0x01, 0x4D, 0x24, 0xFE, 0x00, 0x03, 0x14,
+    0x3E, 0x69, 0x93, 0xF6, 0x94, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x03, 0x14, 0x3E, 0x69, 0x93, 0xF6, 0x95, 0x02, 0x7C,
+    0x52, 0x27, 0xFE, 0x00, 0x02, 0x12, 0x3B, 0x60, 0xF4, 0x6A, 0x01, 0x4D, 0x24, 0xFE, 0x00, 0x02, 0x02, 0x24, 0x3C, 0xF4,
+    0x40, 0x01, 0x31, 0x12, 0xFD, 0x00, 0x01, 0x03, 0x13, 0xF4, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x91, 0x00, 0x04,
+    0x02, 0x0A, 0x0D, 0x0C, 0x05, 0xF3, 0x00, 0x08, 0x0D, 0x1E, 0x2B, 0x34, 0x38, 0x36, 0x2F, 0x22, 0x0E, 0xF6, 0x00, 0x0A,
+    0x0D, 0x2F, 0x45, 0x54, 0x5E, 0x62, 0x60, 0x58, 0x48, 0x31, 0x15, 0xF7, 0x00, 0x0B, 0x1B, 0x45, 0x6B, 0x7C, 0x87, 0x8D,
+    0x8A, 0x80, 0x6C, 0x51, 0x30, 0x0C, 0xF8, 0x00, 0x0B, 0x1C, 0x46, 0x71, 0x92, 0x84, 0x7E, 0x85, 0x9A, 0x8D, 0x6A, 0x44,
+    0x1C, 0xF8, 0x00, 0x0B, 0x1C, 0x46, 0x6F, 0x6B, 0x5B, 0x54, 0x5E, 0x80, 0xA3, 0x79, 0x4F, 0x25, 0xF8, 0x00, 0x0B, 0x10,
+    0x33, 0x4B, 0x46, 0x33, 0x31, 0x55, 0x7D, 0xA1, 0x79, 0x4F, 0x25, 0xF7, 0x00, 0x0A, 0x12, 0x21, 0x1E, 0x2E, 0x4C, 0x6D,
+    0x8F, 0x8C, 0x69, 0x43, 0x1B, 0xF6, 0x00, 0x09, 0x11, 0x2E, 0x4C, 0x6A, 0x88, 0x90, 0x71, 0x51, 0x2E, 0x0A, 0xF7, 0x00,
+    0x09, 0x11, 0x2F, 0x4D, 0x6A, 0x88, 0x90, 0x72, 0x54, 0x35, 0x15, 0xF7, 0x00, 0x0B, 0x0E, 0x30, 0x4D, 0x6B, 0x89, 0x8F,
+    0x72, 0x54, 0x47, 0x47, 0x38, 0x18, 0xF8, 0x00, 0x04, 0x1E, 0x47, 0x6C, 0x89, 0x8E, 0xFC, 0x71, 0x01, 0x51, 0x28, 0xF8,
+    0x00, 0x02, 0x1F, 0x49, 0x74, 0xFB, 0x9C, 0x02, 0x7E, 0x54, 0x29, 0xF8, 0x00, 0x02, 0x1E, 0x48, 0x6D, 0xFB, 0x72, 0x02,
+    0x71, 0x51, 0x28, 0xF8, 0x00, 0x02, 0x10, 0x31, 0x46, 0xFA, 0x47, 0x01, 0x38, 0x18, 0xF7, 0x00, 0x01, 0x0F, 0x1C, 0xFA,
+    0x1D, 0x00, 0x13, 0x81, 0x00, 0x81, 0x00, 0xD5, 0x00, 0x91, 0x00, 0x04, 0x02, 0x09, 0x0D, 0x0C, 0x08, 0xF3, 0x00, 0x08,
+    0x0E, 0x22, 0x2C, 0x33, 0x37, 0x37, 0x31, 0x26, 0x15, 0xF6, 0x00, 0x0A, 0x06, 0x2B, 0x49, 0x55, 0x5D, 0x62, 0x61, 0x5B,
+    0x4E, 0x39, 0x1F, 0xF7, 0x00, 0x0B, 0x0F, 0x39, 0x64, 0x7F, 0x87, 0x8C, 0x8C, 0x84, 0x74, 0x5B, 0x3B, 0x17, 0xF8, 0x00,
+    0x0B, 0x0F, 0x39, 0x64, 0x8E, 0x84, 0x7E, 0x81, 0x91, 0x97, 0x75, 0x4F, 0x27, 0xF8, 0x00, 0x0C, 0x0D, 0x36, 0x5D, 0x67,
+    0x5A, 0x54, 0x58, 0x75, 0x9E, 0x82, 0x58, 0x2D, 0x03, 0xF8, 0x00, 0x0B, 0x21, 0x3B, 0x42, 0x5C, 0x5D, 0x62, 0x7A, 0xA1,
+    0x7D, 0x55, 0x2B, 0x01, 0xF8, 0x00, 0x0A, 0x01, 0x22, 0x4C, 0x77, 0x88, 0x8B, 0x90, 0x81, 0x67, 0x44, 0x1F, 0xF6, 0x00,
+    0x0A, 0x22, 0x4C, 0x77, 0x82, 0x86, 0x94, 0x8B, 0x70, 0x4E, 0x28, 0x01, 0xF8, 0x00, 0x0B, 0x1B, 0x2C, 0x3F, 0x57, 0x58,
+    0x5D, 0x73, 0x99, 0x87, 0x5F, 0x35, 0x0B, 0xF9, 0x00, 0x0C, 0x15, 0x3A, 0x55, 0x50, 0x43, 0x3D, 0x45, 0x69, 0x93, 0x8D,
+    0x63, 0x38, 0x0E, 0xF9, 0x00, 0x0C, 0x1D, 0x47, 0x72, 0x78, 0x6C, 0x67, 0x6D, 0x80, 0xA0, 0x83, 0x5C, 0x32, 0x09, 0xF9,
+    0x00, 0x0B, 0x1D, 0x47, 0x72, 0x97, 0x96, 0x92, 0x96, 0x98, 0x86, 0x6B, 0x49, 0x24, 0xF8, 0x00, 0x0B, 0x19, 0x41, 0x61,
+    0x6E, 0x76, 0x79, 0x77, 0x70, 0x61, 0x4C, 0x2F, 0x0F, 0xF8, 0x00, 0x0A, 0x07, 0x26, 0x39, 0x45, 0x4C, 0x4F, 0x4C, 0x46,
+    0x3A, 0x28, 0x10, 0xF6, 0x00, 0x08, 0x02, 0x11, 0x1B, 0x22, 0x24, 0x22, 0x1C, 0x12, 0x02, 0x81, 0x00, 0x81, 0x00, 0xD4,
+    0x00, 0xA3, 0x00, 0x05, 0x0E, 0x1C, 0x1E, 0x1E, 0x1D, 0x0F, 0xF3, 0x00, 0x07, 0x0E, 0x2F, 0x46, 0x48, 0x48, 0x46, 0x31,
+    0x0E, 0xF5, 0x00, 0x08, 0x05, 0x27, 0x49, 0x6B, 0x73, 0x73, 0x6D, 0x46, 0x1C, 0xF5, 0x00, 0x08, 0x1F, 0x41, 0x63, 0x85,
+    0x9D, 0x82, 0x62, 0x40, 0x19, 0xF6, 0x00, 0x09, 0x16, 0x38, 0x5A, 0x7C, 0x9E, 0x86, 0x66, 0x46, 0x26, 0x05, 0xF7, 0x00,
+    0x09, 0x0E, 0x30, 0x52, 0x74, 0x96, 0x8B, 0x6B, 0x4A, 0x2A, 0x0A, 0xF6, 0x00, 0x08, 0x23, 0x49, 0x6B, 0x8D, 0x8F, 0x6F,
+    0x4F, 0x2F, 0x0E, 0xF5, 0x00, 0x07, 0x27, 0x51, 0x73, 0x73, 0x72, 0x53, 0x33, 0x13, 0xF4, 0x00, 0x06, 0x18, 0x38, 0x49,
+    0x49, 0x48, 0x37, 0x17, 0xF2, 0x00, 0x00, 0x14, 0xFE, 0x1E, 0x00, 0x13, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xBF, 0x00,
+    0x81, 0x00, 0xAC, 0x00, 0x01, 0x01, 0x15, 0xFE, 0x1B, 0x08, 0x11, 0x00, 0x00, 0x05, 0x17, 0x1B, 0x1B, 0x1A, 0x0F, 0xFA,
+    0x00, 0x01, 0x20, 0x3C, 0xFE, 0x45, 0x04, 0x36, 0x16, 0x01, 0x24, 0x3F, 0xFE, 0x45, 0x01, 0x32, 0x12, 0xFC, 0x00, 0x0F,
+    0x08, 0x32, 0x5B, 0x70, 0x70, 0x6F, 0x50, 0x27, 0x0E, 0x38, 0x60, 0x70, 0x70, 0x6E, 0x4B, 0x21, 0xFC, 0x00, 0x0F, 0x09,
+    0x34, 0x5E, 0x89, 0x9A, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0x9A, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34,
+    0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E,
+    0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89,
+    0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8,
+    0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D,
+    0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53,
+    0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28,
+    0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7E, 0x53, 0x29, 0x13,
+    0x3C, 0x67, 0x91, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x10, 0x09, 0x34, 0x5E, 0x89, 0xAE, 0x84, 0x5C, 0x36, 0x2E, 0x49,
+    0x70, 0x99, 0xA2, 0x78, 0x4D, 0x37, 0x1F, 0xFD, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0xB3, 0x94, 0x72, 0x5B, 0x57, 0x66,
+    0x84, 0xA8, 0xA3, 0x79, 0x63, 0x5B, 0x35, 0x0C, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x89, 0x93, 0x84, 0x82,
+    0x8C, 0xA1, 0x81, 0xAB, 0x8E, 0x8A, 0x64, 0x39, 0x0F, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x75, 0x8D, 0x9F,
+    0xA3, 0x9A, 0x84, 0x75, 0x98, 0xA2, 0x8E, 0x64, 0x39, 0x0F, 0xFE, 0x00, 0x11, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x75, 0x69,
+    0x76, 0x78, 0x72, 0x61, 0x5C, 0x74, 0x78, 0x6D, 0x57, 0x34, 0x0B, 0xFE, 0x00, 0x10, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x75,
+    0x4A, 0x4C, 0x4E, 0x49, 0x3B, 0x3B, 0x4B, 0x4E, 0x45, 0x34, 0x1B, 0xFD, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x75,
+    0x4A, 0x21, 0x23, 0x1F, 0x14, 0x15, 0x21, 0x23, 0x1C, 0x0E, 0xFC, 0x00, 0x07, 0x09, 0x34, 0x5E, 0x89, 0x9F, 0x75, 0x4A,
+    0x20, 0xF4, 0x00, 0x07, 0x09, 0x34, 0x5E, 0x89, 0x95, 0x75, 0x4A, 0x20, 0xF4, 0x00, 0x07, 0x07, 0x31, 0x58, 0x6B, 0x6B,
+    0x68, 0x46, 0x1D, 0xF3, 0x00, 0x06, 0x1D, 0x38, 0x40, 0x40, 0x3F, 0x2D, 0x0D, 0xF2, 0x00, 0x04, 0x11, 0x16, 0x16, 0x15,
+    0x09, 0xE0, 0x00, 0x81, 0x00, 0xFE, 0x00, 0x03, 0x02, 0x12, 0x1F, 0x26, 0xFB, 0x2A, 0x01, 0x28, 0x17, 0xF9, 0x00, 0x05,
+    0x0F, 0x27, 0x3A, 0x48, 0x51, 0x54, 0xFC, 0x55, 0x02, 0x51, 0x35, 0x10, 0xFB, 0x00, 0x05, 0x12, 0x30, 0x4B, 0x61, 0x71,
+    0x7B, 0xFB, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x0F, 0x09, 0x2C, 0x4E, 0x6C, 0x85, 0x99, 0xA5, 0xA9, 0xA2, 0x92,
+    0x92, 0x93, 0x98, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x0F, 0x1D, 0x43, 0x68, 0x8A, 0xA8, 0xBF, 0xCE, 0xC7, 0x9C, 0x72, 0x68,
+    0x83, 0x98, 0x6D, 0x43, 0x18, 0xFD, 0x00, 0x10, 0x01, 0x2B, 0x53, 0x7B, 0xA2, 0xC6, 0xE3, 0xF1, 0xC7, 0x9C, 0x72, 0x58,
+    0x83, 0x98, 0x6D, 0x43, 0x18, 0xFD, 0x00, 0x10, 0x09, 0x33, 0x5D, 0x87, 0xB0, 0xD9, 0xFF, 0xF1, 0xC7, 0x9C, 0x72, 0x58,
+    0x83, 0x98, 0x6D, 0x43, 0x18, 0xFD, 0x00, 0x10, 0x0B, 0x35, 0x60, 0x8A, 0xB5, 0xDF, 0xFF, 0xF1, 0xC7, 0x9C, 0x72, 0x58,
+    0x83, 0x98, 0x6D, 0x43, 0x18, 0xFD, 0x00, 0x10, 0x08, 0x32, 0x5C, 0x86, 0xB0, 0xD8, 0xFF, 0xF1, 0xC7, 0x9C, 0x72, 0x58,
+    0x83, 0x98, 0x6D, 0x43, 0x18, 0xFD, 0x00, 0x10, 0x01, 0x2A, 0x52, 0x7A, 0xA0, 0xC3, 0xDF, 0xF1, 0xC7, 0x9C, 0x72, 0x58,
+    0x83, 0x98, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x0F, 0x1B, 0x41, 0x66, 0x87, 0xA4, 0xBA, 0xC8, 0xC7, 0x9C, 0x72, 0x58, 0x83,
+    0x98, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x0F, 0x07, 0x2A, 0x4B, 0x68, 0x81, 0x93, 0x9F, 0xA5, 0x9C, 0x72, 0x58, 0x83, 0x98,
+    0x6D, 0x43, 0x18, 0xFB, 0x00, 0x0E, 0x0F, 0x2D, 0x46, 0x5B, 0x6B, 0x75, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43,
+    0x18, 0xFA, 0x00, 0x0D, 0x0C, 0x22, 0x35, 0x42, 0x54, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43, 0x18, 0xF8, 0x00,
+    0x0B, 0x0D, 0x29, 0x54, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43, 0x18, 0xF7, 0x00, 0x0A, 0x29, 0x54, 0x7E, 0x9C,
+    0x72, 0x58, 0x83, 0x98, 0x6D, 0x43, 0x18, 0xF7, 0x00, 0x0A, 0x29, 0x54, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43,
+    0x18, 0xF7, 0x00, 0x0A, 0x29, 0x54, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43, 0x18, 0xF7, 0x00, 0x0A, 0x29, 0x54,
+    0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43, 0x18, 0xF7, 0x00, 0x0A, 0x29, 0x54, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98,
+    0x6D, 0x43, 0x18, 0xF7, 0x00, 0x0A, 0x29, 0x54, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43, 0x18, 0xF7, 0x00, 0x0A,
+    0x29, 0x54, 0x7E, 0x9C, 0x72, 0x58, 0x83, 0x98, 0x6D, 0x43, 0x18, 0xF7, 0x00, 0x0A, 0x29, 0x53, 0x77, 0x77, 0x70, 0x58,
+    0x77, 0x77, 0x6C, 0x42, 0x18, 0xF7, 0x00, 0x0A, 0x1C, 0x3D, 0x4D, 0x4D, 0x4B, 0x40, 0x4D, 0x4D, 0x4A, 0x30, 0x0C, 0xF7,
+    0x00, 0x09, 0x01, 0x19, 0x22, 0x22, 0x21, 0x1B, 0x22, 0x22, 0x21, 0x10, 0xA9, 0x00, 0x81, 0x00, 0x81, 0x00, 0xE9, 0x00,
+    0x01, 0x0E, 0x1A, 0xFE, 0x1B, 0x00, 0x15, 0xF3, 0x00, 0x02, 0x10, 0x31, 0x44, 0xFE, 0x45, 0x01, 0x3C, 0x1F, 0xF4, 0x00,
+    0x02, 0x1F, 0x49, 0x6D, 0xFE, 0x70, 0x02, 0x59, 0x31, 0x07, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0x9A, 0x9A, 0x87, 0x5D,
+    0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76, 0xA0, 0xB2, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x08, 0x21, 0x4B, 0x76,
+    0xA0, 0xA8, 0x87, 0x5D, 0x32, 0x08, 0xF5, 0x00, 0x02, 0x21, 0x4B, 0x75, 0xFE, 0x7D, 0x02, 0x5D, 0x32, 0x08, 0xF5, 0x00,
+    0x02, 0x17, 0x3B, 0x52, 0xFE, 0x53, 0x01, 0x47, 0x26, 0xF3, 0x00, 0x00, 0x1A, 0xFD, 0x28, 0x01, 0x22, 0x0B, 0x81, 0x00,
+    0x81, 0x00, 0xE9, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x96, 0x00, 0x04, 0x07, 0x14, 0x15, 0x15, 0x08, 0xF2, 0x00,
+    0x06, 0x0A, 0x2B, 0x3E, 0x40, 0x3F, 0x2B, 0x0C, 0xF3, 0x00, 0x07, 0x1B, 0x43, 0x66, 0x6A, 0x67, 0x48, 0x26, 0x03, 0xF5,
+    0x00, 0x08, 0x12, 0x1D, 0x43, 0x68, 0x8B, 0x84, 0x61, 0x3D, 0x17, 0xF6, 0x00, 0x09, 0x15, 0x36, 0x47, 0x3E, 0x51, 0x77,
+    0x9C, 0x75, 0x4D, 0x24, 0xF6, 0x00, 0x09, 0x24, 0x4E, 0x71, 0x66, 0x62, 0x74, 0x9D, 0x7F, 0x54, 0x2A, 0xF6, 0x00, 0x09,
+    0x25, 0x50, 0x7A, 0x90, 0x8D, 0x95, 0x9A, 0x77, 0x4F, 0x25, 0xF6, 0x00, 0x09, 0x25, 0x4F, 0x77, 0x81, 0x85, 0x83, 0x77,
+    0x5E, 0x3D, 0x18, 0xF6, 0x00, 0x09, 0x19, 0x3B, 0x4F, 0x57, 0x5A, 0x58, 0x4F, 0x3D, 0x22, 0x02, 0xF5, 0x00, 0x07, 0x18,
+    0x25, 0x2D, 0x30, 0x2E, 0x27, 0x18, 0x02, 0xF2, 0x00, 0x02, 0x03, 0x05, 0x04, 0xE2, 0x00, 0x8F, 0x00, 0x02, 0x04, 0x05,
+    0x05, 0xF3, 0x00, 0x03, 0x09, 0x19, 0x21, 0x28, 0xFE, 0x2F, 0x01, 0x21, 0x05, 0xF6, 0x00, 0x09, 0x06, 0x29, 0x42, 0x4B,
+    0x52, 0x59, 0x5A, 0x59, 0x41, 0x1C, 0xF6, 0x00, 0x09, 0x13, 0x3D, 0x65, 0x74, 0x7C, 0x83, 0x84, 0x78, 0x4E, 0x23, 0xF6,
+    0x00, 0x09, 0x14, 0x3E, 0x69, 0x93, 0x92, 0x8A, 0xA3, 0x78, 0x4E, 0x23, 0xF6, 0x00, 0x09, 0x13, 0x3D, 0x66, 0x6F, 0x68,
+    0x79, 0xA3, 0x78, 0x4E, 0x23, 0xF6, 0x00, 0x09, 0x07, 0x2A, 0x44, 0x46, 0x4F, 0x79, 0xA3, 0x78, 0x4E, 0x23, 0xF5, 0x00,
+    0x08, 0x0A, 0x1B, 0x24, 0x4F, 0x79, 0xA3, 0x78, 0x4E, 0x23, 0xF3, 0x00, 0x06, 0x24, 0x4F, 0x79, 0xA3, 0x78, 0x4E, 0x23,
+    0xF5, 0x00, 0x0A, 0x02, 0x15, 0x24, 0x4F, 0x79, 0xA3, 0x78, 0x4E, 0x23, 0x15, 0x01, 0xF7, 0x00, 0x0A, 0x21, 0x3D, 0x45,
+    0x4F, 0x79, 0xA3, 0x78, 0x4E, 0x45, 0x3C, 0x20, 0xF8, 0x00, 0x0C, 0x0A, 0x34, 0x5C, 0x6F, 0x6F, 0x79, 0xA3, 0x78, 0x6F,
+    0x6F, 0x5B, 0x32, 0x08, 0xF9, 0x00, 0x0C, 0x0B, 0x35, 0x60, 0x8A, 0x9A, 0x9A, 0x9C, 0x9A, 0x9A, 0x89, 0x5E, 0x34, 0x09,
+    0xF9, 0x00, 0x02, 0x0A, 0x34, 0x5D, 0xFA, 0x72, 0x02, 0x5C, 0x33, 0x09, 0xF8, 0x00, 0x01, 0x22, 0x3F, 0xFA, 0x47, 0x01,
+    0x3E, 0x21, 0xF7, 0x00, 0x01, 0x04, 0x18, 0xFA, 0x1D, 0x01, 0x17, 0x03, 0x81, 0x00, 0x81, 0x00, 0xD6, 0x00, 0x90, 0x00,
+    0x03, 0x05, 0x0C, 0x0D, 0x09, 0xF2, 0x00, 0x07, 0x0D, 0x21, 0x2F, 0x36, 0x37, 0x33, 0x28, 0x17, 0xF5, 0x00, 0x0A, 0x15,
+    0x30, 0x47, 0x57, 0x61, 0x62, 0x5C, 0x50, 0x3B, 0x22, 0x04, 0xF8, 0x00, 0x0B, 0x10, 0x31, 0x51, 0x6C, 0x80, 0x8A, 0x8C,
+    0x86, 0x76, 0x5E, 0x40, 0x1F, 0xF8, 0x00, 0x0C, 0x25, 0x4A, 0x6D, 0x8D, 0x98, 0x86, 0x83, 0x8E, 0x99, 0x7C, 0x5B, 0x36,
+    0x10, 0xFA, 0x00, 0x0D, 0x0D, 0x36, 0x5D, 0x84, 0x9E, 0x7A, 0x5E, 0x58, 0x6C, 0x8D, 0x95, 0x6F, 0x47, 0x1F, 0xFA, 0x00,
+    0x0D, 0x16, 0x40, 0x6A, 0x93, 0x8E, 0x66, 0x3F, 0x30, 0x54, 0x7C, 0xA5, 0x7C, 0x53, 0x29, 0xFA, 0x00, 0x0E, 0x1A, 0x45,
+    0x6F, 0x9A, 0x88, 0x5D, 0x33, 0x20, 0x4A, 0x75, 0x9F, 0x82, 0x58, 0x2D, 0x03, 0xFB, 0x00, 0x0E, 0x1A, 0x45, 0x6F, 0x9A,
+    0x88, 0x5D, 0x33, 0x20, 0x4A, 0x75, 0x9F, 0x82, 0x58, 0x2D, 0x03, 0xFB, 0x00, 0x0D, 0x16, 0x40, 0x6A, 0x93, 0x8E, 0x65,
+    0x3E, 0x30, 0x54, 0x7C, 0xA5, 0x7C, 0x53, 0x29, 0xFA, 0x00, 0x0D, 0x0D, 0x36, 0x5D, 0x85, 0x9D, 0x79, 0x5E, 0x58, 0x6C,
+    0x8E, 0x95, 0x6F, 0x48, 0x1F, 0xF9, 0x00, 0x0C, 0x26, 0x4B, 0x6E, 0x8D, 0x98, 0x86, 0x82, 0x8F, 0x9A, 0x7D, 0x5B, 0x36,
+    0x10, 0xF9, 0x00, 0x0C, 0x1C, 0x36, 0x51, 0x6C, 0x80, 0x8B, 0x8C, 0x86, 0x76, 0x5E, 0x41, 0x28, 0x08, 0xFA, 0x00, 0x02,
+    0x09, 0x32, 0x58, 0xF9, 0x68, 0x02, 0x63, 0x42, 0x19, 0xFA, 0x00, 0x03, 0x0B, 0x36, 0x60, 0x8B, 0xFA, 0x92, 0x02, 0x71,
+    0x46, 0x1C, 0xFA, 0x00, 0x02, 0x0B, 0x36, 0x60, 0xF9, 0x80, 0x02, 0x71, 0x46, 0x1C, 0xFA, 0x00, 0x02, 0x04, 0x2A, 0x4B,
+    0xF9, 0x55, 0x02, 0x53, 0x38, 0x13, 0xF9, 0x00, 0x01, 0x0F, 0x25, 0xF9, 0x2B, 0x01, 0x29, 0x19, 0x81, 0x00, 0x81, 0x00,
+    0x00, 0x00, 0x81, 0x00, 0x97, 0x00, 0x09, 0x0B, 0x21, 0x26, 0x18, 0x00, 0x02, 0x1B, 0x27, 0x1E, 0x07, 0xF7, 0x00, 0x0B,
+    0x01, 0x27, 0x47, 0x50, 0x3A, 0x1E, 0x1C, 0x3E, 0x51, 0x43, 0x27, 0x0A, 0xF8, 0x00, 0x0C, 0x0A, 0x35, 0x5F, 0x76, 0x5A,
+    0x3D, 0x27, 0x51, 0x7A, 0x63, 0x46, 0x2A, 0x0E, 0xF9, 0x00, 0x0D, 0x0A, 0x35, 0x5F, 0x8A, 0x79, 0x5D, 0x41, 0x52, 0x7C,
+    0x82, 0x66, 0x4A, 0x2E, 0x11, 0xFA, 0x00, 0x0E, 0x0A, 0x35, 0x5F, 0x8A, 0x99, 0x7D, 0x61, 0x52, 0x7C, 0xA2, 0x86, 0x6A,
+    0x4D, 0x31, 0x15, 0xFB, 0x00, 0x0F, 0x07, 0x2F, 0x54, 0x71, 0x8D, 0x9D, 0x80, 0x64, 0x68, 0x84, 0xA0, 0x89, 0x6D, 0x51,
+    0x34, 0x18, 0xFB, 0x00, 0x0F, 0x18, 0x35, 0x51, 0x6D, 0x8A, 0xA0, 0x84, 0x67, 0x64, 0x81, 0x9D, 0x8D, 0x70, 0x54, 0x36,
+    0x10, 0xFB, 0x00, 0x0E, 0x15, 0x31, 0x4E, 0x6A, 0x86, 0xA3, 0x87, 0x60, 0x61, 0x7D, 0x99, 0x90, 0x6E, 0x43, 0x19, 0xFB,
+    0x00, 0x0E, 0x17, 0x33, 0x50, 0x6C, 0x88, 0xA1, 0x85, 0x60, 0x63, 0x7F, 0x9B, 0x8E, 0x6D, 0x43, 0x19, 0xFC, 0x00, 0x0F,
+    0x1A, 0x37, 0x53, 0x6F, 0x8C, 0x9E, 0x82, 0x65, 0x66, 0x83, 0x9F, 0x8B, 0x6F, 0x52, 0x34, 0x0F, 0xFD, 0x00, 0x0F, 0x07,
+    0x30, 0x56, 0x73, 0x8F, 0x9B, 0x7E, 0x62, 0x6A, 0x86, 0xA2, 0x87, 0x6B, 0x4F, 0x33, 0x16, 0xFC, 0x00, 0x0E, 0x0A, 0x35,
+    0x5F, 0x8A, 0x97, 0x7B, 0x5F, 0x52, 0x7C, 0xA0, 0x84, 0x68, 0x4B, 0x2F, 0x13, 0xFB, 0x00, 0x0D, 0x0A, 0x35, 0x5F, 0x8A,
+    0x77, 0x5B, 0x3F, 0x52, 0x7C, 0x80, 0x64, 0x48, 0x2C, 0x0F, 0xFA, 0x00, 0x0C, 0x0A, 0x34, 0x5E, 0x74, 0x58, 0x3B, 0x27,
+    0x51, 0x78, 0x61, 0x44, 0x28, 0x0C, 0xF8, 0x00, 0x0A, 0x26, 0x45, 0x4D, 0x38, 0x1C, 0x1A, 0x3C, 0x4E, 0x41, 0x25, 0x08,
+    0xF7, 0x00, 0x09, 0x09, 0x1E, 0x23, 0x16, 0x00, 0x00, 0x19, 0x24, 0x1C, 0x05, 0x81, 0x00, 0xD1, 0x00, 0xAB, 0x00, 0x03,
+    0x03, 0x12, 0x1A, 0x21, 0xFE, 0x28, 0x00, 0x1A, 0xF5, 0x00, 0x09, 0x03, 0x25, 0x3C, 0x44, 0x4B, 0x52, 0x53, 0x52, 0x3C,
+    0x18, 0xF6, 0x00, 0x09, 0x13, 0x3C, 0x61, 0x6D, 0x75, 0x7C, 0x7D, 0x77, 0x4D, 0x22, 0xF6, 0x00, 0x09, 0x15, 0x3F, 0x6A,
+    0x94, 0x99, 0x91, 0xA2, 0x77, 0x4D, 0x22, 0xF6, 0x00, 0x09, 0x15, 0x3F, 0x69, 0x76, 0x6F, 0x7A, 0xA2, 0x77, 0x4D, 0x22,
+    0xF6, 0x00, 0x09, 0x0B, 0x30, 0x4B, 0x4D, 0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0xF5, 0x00, 0x08, 0x11, 0x23, 0x25, 0x50,
+    0x7A, 0xA2, 0x77, 0x4D, 0x22, 0xF3, 0x00, 0x06, 0x25, 0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0xF4, 0x00, 0x08, 0x0F, 0x25,
+    0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0x0E, 0xF6, 0x00, 0x0F, 0x1D, 0x37, 0x3D, 0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x3D, 0x35,
+    0x1A, 0x0C, 0x16, 0x1F, 0x1A, 0x06, 0xFD, 0x00, 0x10, 0x0A, 0x33, 0x59, 0x68, 0x68, 0x7A, 0xA2, 0x77, 0x68, 0x68, 0x56,
+    0x2F, 0x35, 0x3F, 0x49, 0x41, 0x24, 0xFD, 0x00, 0x11, 0x0C, 0x36, 0x61, 0x8B, 0x92, 0x92, 0xA3, 0x92, 0x92, 0x88, 0x5D,
+    0x54, 0x5E, 0x68, 0x72, 0x5D, 0x34, 0x0B, 0xFE, 0x00, 0x02, 0x0C, 0x36, 0x60, 0xFA, 0x79, 0x07, 0x73, 0x7D, 0x87, 0x91,
+    0x91, 0x68, 0x3F, 0x15, 0xFE, 0x00, 0x3A, 0x20, 0x3D, 0x4B, 0x55, 0x5F, 0x69, 0x73, 0x7E, 0x88, 0x92, 0x9A, 0x90, 0x86,
+    0x7C, 0x71, 0x64, 0x3F, 0x16, 0x00, 0x00, 0x07, 0x31, 0x5A, 0x74, 0x7E, 0x88, 0x92, 0x9A, 0x8F, 0x85, 0x7B, 0x71, 0x67,
+    0x5D, 0x5A, 0x48, 0x3E, 0x28, 0x06, 0x00, 0x00, 0x04, 0x2E, 0x57, 0x81, 0x8F, 0x85, 0x7A, 0x70, 0x66, 0x5C, 0x52, 0x5E,
+    0x81, 0x85, 0x7D, 0x53, 0x28, 0x06, 0xFD, 0x00, 0x0F, 0x25, 0x4E, 0x6E, 0x66, 0x5B, 0x51, 0x47, 0x3D, 0x33, 0x53, 0x76,
+    0x94, 0x9F, 0x7D, 0x53, 0x28, 0xFC, 0x00, 0x0F, 0x14, 0x34, 0x44, 0x3C, 0x32, 0x28, 0x1E, 0x25, 0x48, 0x6B, 0x8E, 0x7C,
+    0x9C, 0x7D, 0x53, 0x28, 0xFB, 0x00, 0x0E, 0x0F, 0x19, 0x13, 0x09, 0x00, 0x1A, 0x3D, 0x60, 0x83, 0x88, 0x71, 0x9C, 0x7D,
+    0x53, 0x28, 0xF7, 0x00, 0x0B, 0x0F, 0x32, 0x55, 0x78, 0x94, 0x70, 0x71, 0x9C, 0x7D, 0x53, 0x28, 0x0A, 0xF8, 0x00, 0x0C,
+    0x27, 0x4A, 0x6D, 0x90, 0x7C, 0x59, 0x71, 0x9C, 0x7D, 0x53, 0x45, 0x28, 0x03, 0xFA, 0x00, 0x04, 0x09, 0x33, 0x5E, 0x85,
+    0x88, 0xFE, 0x78, 0x05, 0x9C, 0x7D, 0x78, 0x61, 0x37, 0x0D, 0xFA, 0x00, 0x03, 0x09, 0x33, 0x5E, 0x88, 0xFD, 0x94, 0x05,
+    0xA3, 0x94, 0x8D, 0x62, 0x38, 0x0D, 0xFA, 0x00, 0x02, 0x07, 0x30, 0x57, 0xFD, 0x6A, 0x06, 0x71, 0x9C, 0x7D, 0x6A, 0x5B,
+    0x34, 0x0B, 0xF9, 0x00, 0x01, 0x1C, 0x37, 0xFE, 0x3F, 0x06, 0x47, 0x71, 0x9C, 0x7D, 0x53, 0x39, 0x1F, 0xF7, 0x00, 0x09,
+    0x0F, 0x15, 0x15, 0x1B, 0x45, 0x6B, 0x71, 0x71, 0x51, 0x27, 0xF3, 0x00, 0x06, 0x0D, 0x2F, 0x45, 0x47, 0x47, 0x37, 0x17,
+    0xF2, 0x00, 0x04, 0x0D, 0x1B, 0x1C, 0x1C, 0x13, 0xBD, 0x00, 0xAB, 0x00, 0x03, 0x03, 0x12, 0x1A, 0x21, 0xFE, 0x28, 0x00,
+    0x1A, 0xF5, 0x00, 0x09, 0x03, 0x25, 0x3C, 0x44, 0x4B, 0x52, 0x53, 0x52, 0x3C, 0x18, 0xF6, 0x00, 0x09, 0x13, 0x3C, 0x61,
+    0x6D, 0x75, 0x7C, 0x7D, 0x77, 0x4D, 0x22, 0xF6, 0x00, 0x09, 0x15, 0x3F, 0x6A, 0x94, 0x99, 0x91, 0xA2, 0x77, 0x4D, 0x22,
+    0xF6, 0x00, 0x09, 0x15, 0x3F, 0x69, 0x76, 0x6F, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0xF6, 0x00, 0x09, 0x0B, 0x30, 0x4B, 0x4D,
+    0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0xF5, 0x00, 0x08, 0x11, 0x23, 0x25, 0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0xF3, 0x00,
+    0x06, 0x25, 0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0xF4, 0x00, 0x08, 0x0F, 0x25, 0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x22, 0x0E,
+    0xF6, 0x00, 0x0F, 0x1D, 0x37, 0x3D, 0x50, 0x7A, 0xA2, 0x77, 0x4D, 0x3D, 0x35, 0x1A, 0x0C, 0x16, 0x1F, 0x1A, 0x06, 0xFD,
+    0x00, 0x10, 0x0A, 0x33, 0x59, 0x68, 0x68, 0x7A, 0xA2, 0x77, 0x68, 0x68, 0x56, 0x2F, 0x35, 0x3F, 0x49, 0x41, 0x24, 0xFD,
+    0x00, 0x11, 0x0C, 0x36, 0x61, 0x8B, 0x92, 0x92, 0xA3, 0x92, 0x92, 0x88, 0x5D, 0x54, 0x5E, 0x68, 0x72, 0x5D, 0x34, 0x0B,
+    0xFE, 0x00, 0x02, 0x0C, 0x36, 0x60, 0xFA, 0x79, 0x07, 0x73, 0x7D, 0x87, 0x91, 0x91, 0x68, 0x3F, 0x15, 0xFE, 0x00, 0x3A,
+    0x20, 0x3D, 0x4B, 0x55, 0x5F, 0x69, 0x73, 0x7E, 0x88, 0x92, 0x9A, 0x90, 0x86, 0x7C, 0x71, 0x64, 0x3F, 0x16, 0x00, 0x00,
+    0x07, 0x31, 0x5A, 0x74, 0x7E, 0x88, 0x92, 0x9A, 0x8F, 0x85, 0x7B, 0x71, 0x67, 0x5D, 0x52, 0x48, 0x3E, 0x28, 0x06, 0x00,
+    0x00, 0x04, 0x2E, 0x57, 0x81, 0x8F, 0x85, 0x7A, 0x70, 0x66, 0x77, 0x84, 0x8C, 0x8C, 0x85, 0x75, 0x5C, 0x3C, 0x19, 0xFD,
+    0x00, 0x11, 0x25, 0x4E, 0x6E, 0x66, 0x5B, 0x51, 0x47, 0x62, 0x8C, 0x88, 0x7E, 0x80, 0x91, 0x98, 0x78, 0x52, 0x2B, 0x02,
+    0xFE, 0x00, 0x11, 0x14, 0x34, 0x44, 0x3C, 0x32, 0x28, 0x37, 0x61, 0x72, 0x60, 0x54, 0x57, 0x72, 0x99, 0x88, 0x5E, 0x34,
+    0x09, 0xFD, 0x00, 0x10, 0x0F, 0x19, 0x13, 0x09, 0x02, 0x27, 0x45, 0x4B, 0x39, 0x2A, 0x48, 0x6F, 0x98, 0x87, 0x5E, 0x34,
+    0x09, 0xF8, 0x00, 0x0B, 0x09, 0x1D, 0x21, 0x23, 0x42, 0x61, 0x83, 0x98, 0x76, 0x50, 0x29, 0x01, 0xF7, 0x00, 0x09, 0x06,
+    0x24, 0x42, 0x5F, 0x7E, 0x9B, 0x7C, 0x5C, 0x3B, 0x17, 0xF7, 0x00, 0x0A, 0x07, 0x25, 0x42, 0x60, 0x7E, 0x9B, 0x7D, 0x5F,
+    0x40, 0x20, 0x05, 0xF8, 0x00, 0x0B, 0x01, 0x25, 0x43, 0x61, 0x7E, 0x9A, 0x7C, 0x5E, 0x47, 0x47, 0x40, 0x24, 0xF8, 0x00,
+    0x05, 0x0F, 0x38, 0x60, 0x7F, 0x99, 0x7B, 0xFD, 0x72, 0x02, 0x5F, 0x37, 0x0D, 0xF9, 0x00, 0x03, 0x10, 0x3A, 0x65, 0x8F,
+    0xFC, 0x9C, 0x03, 0x8D, 0x63, 0x38, 0x0E, 0xF9, 0x00, 0x02, 0x0F, 0x39, 0x61, 0xFA, 0x71, 0x02, 0x5F, 0x37, 0x0D, 0xF9,
+    0x00, 0x02, 0x02, 0x26, 0x41, 0xFA, 0x47, 0x01, 0x40, 0x24, 0xF7, 0x00, 0x01, 0x06, 0x19, 0xFA, 0x1C, 0x01, 0x18, 0x05,
+    0xBF, 0x00, 0xBC, 0x00, 0x02, 0x05, 0x06, 0x03, 0xF2, 0x00, 0x07, 0x16, 0x22, 0x2A, 0x2F, 0x30, 0x2D, 0x24, 0x15, 0xF5,
+    0x00, 0x0A, 0x1B, 0x3B, 0x4B, 0x54, 0x59, 0x5B, 0x57, 0x4C, 0x3B, 0x22, 0x05, 0xF7, 0x00, 0x0A, 0x2A, 0x54, 0x74, 0x7E,
+    0x84, 0x85, 0x81, 0x74, 0x5E, 0x41, 0x1F, 0xF7, 0x00, 0x0B, 0x2B, 0x55, 0x80, 0x8E, 0x87, 0x86, 0x91, 0x99, 0x7D, 0x59,
+    0x32, 0x0A, 0xF8, 0x00, 0x0B, 0x2A, 0x53, 0x72, 0x65, 0x5C, 0x5C, 0x6D, 0x92, 0x90, 0x66, 0x3B, 0x11, 0xF8, 0x00, 0x0B,
+    0x1A, 0x3A, 0x48, 0x50, 0x56, 0x58, 0x6A, 0x91, 0x8D, 0x64, 0x3A, 0x10, 0xF7, 0x00, 0x0A, 0x15, 0x3E, 0x68, 0x81, 0x82,
+    0x8D, 0x8E, 0x76, 0x55, 0x2F, 0x07, 0xF7, 0x00, 0x0A, 0x13, 0x3E, 0x68, 0x8A, 0x8B, 0x95, 0x8A, 0x75, 0x56, 0x32, 0x0C,
+    0xF8, 0x00, 0x0B, 0x0D, 0x21, 0x36, 0x58, 0x5F, 0x61, 0x6F, 0x8F, 0x91, 0x6A, 0x42, 0x18, 0xF9, 0x00, 0x10, 0x05, 0x2A,
+    0x48, 0x4E, 0x40, 0x36, 0x39, 0x5A, 0x84, 0x9C, 0x71, 0x47, 0x1C, 0x16, 0x1F, 0x1A, 0x06, 0xFD, 0x00, 0x10, 0x0E, 0x39,
+    0x63, 0x76, 0x69, 0x61, 0x62, 0x71, 0x90, 0x93, 0x6C, 0x42, 0x35, 0x3F, 0x49, 0x41, 0x24, 0xFD, 0x00, 0x11, 0x0E, 0x39,
+    0x63, 0x8E, 0x92, 0x8B, 0x8C, 0x97, 0x94, 0x7B, 0x59, 0x54, 0x5E, 0x68, 0x72, 0x5D, 0x34, 0x0B, 0xFE, 0x00, 0x11, 0x0D,
+    0x36, 0x5D, 0x71, 0x7B, 0x80, 0x7F, 0x7A, 0x6E, 0x69, 0x73, 0x7D, 0x87, 0x91, 0x91, 0x68, 0x3F, 0x15, 0xFE, 0x00, 0x3A,
+    0x20, 0x3D, 0x4B, 0x55, 0x5F, 0x69, 0x73, 0x7E, 0x88, 0x92, 0x9A, 0x90, 0x86, 0x7C, 0x71, 0x64, 0x3F, 0x16, 0x00, 0x00,
+    0x07, 0x31, 0x5A, 0x74, 0x7E, 0x88, 0x92, 0x9A, 0x8F, 0x85, 0x7B, 0x71, 0x67, 0x5D, 0x5A, 0x48, 0x3E, 0x28, 0x06, 0x00,
+    0x00, 0x04, 0x2E, 0x57, 0x81, 0x8F, 0x85, 0x7A, 0x70, 0x66, 0x5C, 0x52, 0x5E, 0x81, 0x85, 0x7D, 0x53, 0x28, 0x06, 0xFD,
+    0x00, 0x0F, 0x25, 0x4E, 0x6E, 0x66, 0x5B, 0x51, 0x47, 0x3D, 0x33, 0x53, 0x76, 0x94, 0x9F, 0x7D, 0x53, 0x28, 0xFC, 0x00,
+    0x0F, 0x14, 0x34, 0x44, 0x3C, 0x32, 0x28, 0x1E, 0x25, 0x48, 0x6B, 0x8E, 0x7C, 0x9C, 0x7D, 0x53, 0x28, 0xFB, 0x00, 0x0E,
+    0x0F, 0x19, 0x13, 0x09, 0x00, 0x1A, 0x3D, 0x60, 0x83, 0x88, 0x71, 0x9C, 0x7D, 0x53, 0x28, 0xF7, 0x00, 0x0B, 0x0F, 0x32,
+    0x55, 0x78, 0x94, 0x70, 0x71, 0x9C, 0x7D, 0x53, 0x28, 0x0A, 0xF8, 0x00, 0x0C, 0x27, 0x4A, 0x6D, 0x90, 0x7C, 0x59, 0x71,
+    0x9C, 0x7D, 0x53, 0x45, 0x28, 0x03, 0xFA, 0x00, 0x04, 0x09, 0x33, 0x5E, 0x85, 0x88, 0xFE, 0x78, 0x05, 0x9C, 0x7D, 0x78,
+    0x61, 0x37, 0x0D, 0xFA, 0x00, 0x03, 0x09, 0x33, 0x5E, 0x88, 0xFD, 0x94, 0x05, 0xA3, 0x94, 0x8D, 0x62, 0x38, 0x0D, 0xFA,
+    0x00, 0x02, 0x07, 0x30, 0x57, 0xFD, 0x6A, 0x06, 0x71, 0x9C, 0x7D, 0x6A, 0x5B, 0x34, 0x0B, 0xF9, 0x00, 0x01, 0x1C, 0x37,
+    0xFE, 0x3F, 0x06, 0x47, 0x71, 0x9C, 0x7D, 0x53, 0x39, 0x1F, 0xF7, 0x00, 0x09, 0x0F, 0x15, 0x15, 0x1B, 0x45, 0x6B, 0x71,
+    0x71, 0x51, 0x27, 0xF3, 0x00, 0x06, 0x0D, 0x2F, 0x45, 0x47, 0x47, 0x37, 0x17, 0xF2, 0x00, 0x04, 0x0D, 0x1B, 0x1C, 0x1C,
+    0x13, 0xBD, 0x00, 0x81, 0x00, 0xA7, 0x00, 0x00, 0x14, 0xFE, 0x1B, 0x01, 0x15, 0x02, 0xF3, 0x00, 0x01, 0x1D, 0x3A, 0xFE,
+    0x45, 0x01, 0x3D, 0x20, 0xF4, 0x00, 0x02, 0x05, 0x2F, 0x57, 0xFE, 0x70, 0x02, 0x5B, 0x33, 0x09, 0xF5, 0x00, 0x08, 0x06,
+    0x30, 0x5B, 0x85, 0x9A, 0x89, 0x5F, 0x34, 0x0A, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xB0, 0x89, 0x5F, 0x34, 0x0A,
+    0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0x8E, 0x89, 0x5F, 0x34, 0x0A, 0xF5, 0x00, 0x02, 0x03, 0x2C, 0x52, 0xFE, 0x64,
+    0x02, 0x55, 0x2F, 0x07, 0xF5, 0x00, 0x02, 0x03, 0x2D, 0x58, 0xFE, 0x7C, 0x02, 0x5C, 0x31, 0x07, 0xF5, 0x00, 0x08, 0x03,
+    0x2D, 0x58, 0x82, 0xA7, 0x86, 0x5C, 0x31, 0x07, 0xF5, 0x00, 0x08, 0x04, 0x2E, 0x59, 0x83, 0xAE, 0x86, 0x5C, 0x31, 0x07,
+    0xF6, 0x00, 0x09, 0x01, 0x1F, 0x3D, 0x60, 0x88, 0xAB, 0x82, 0x58, 0x2E, 0x04, 0xF7, 0x00, 0x09, 0x01, 0x1F, 0x3D, 0x5B,
+    0x79, 0x9A, 0x9A, 0x75, 0x4E, 0x25, 0xF6, 0x00, 0x09, 0x1D, 0x3D, 0x5C, 0x79, 0x97, 0x9F, 0x80, 0x5F, 0x3B, 0x16, 0xF7,
+    0x00, 0x0A, 0x13, 0x37, 0x59, 0x79, 0x98, 0x9F, 0x81, 0x63, 0x44, 0x23, 0x01, 0xF7, 0x00, 0x0C, 0x25, 0x4C, 0x72, 0x95,
+    0xA1, 0x81, 0x63, 0x45, 0x27, 0x08, 0x05, 0x0E, 0x08, 0xFA, 0x00, 0x0E, 0x07, 0x30, 0x5A, 0x83, 0xAB, 0x8C, 0x66, 0x45,
+    0x27, 0x09, 0x14, 0x2B, 0x39, 0x2F, 0x14, 0xFB, 0x00, 0x0F, 0x0A, 0x35, 0x5F, 0x8A, 0xB0, 0x85, 0x5B, 0x30, 0x1F, 0x28,
+    0x39, 0x4F, 0x63, 0x50, 0x2A, 0x01, 0xFC, 0x00, 0x0F, 0x08, 0x32, 0x5B, 0x85, 0xAF, 0x8E, 0x6A, 0x50, 0x4A, 0x51, 0x5F,
+    0x73, 0x83, 0x59, 0x2E, 0x04, 0xFB, 0x00, 0x0E, 0x28, 0x50, 0x77, 0x9C, 0xA6, 0x8A, 0x79, 0x74, 0x7A, 0x87, 0x98, 0x83,
+    0x59, 0x2E, 0x04, 0xFB, 0x00, 0x0E, 0x18, 0x3E, 0x60, 0x80, 0x99, 0xA9, 0xA2, 0x9F, 0xA3, 0xA1, 0x90, 0x7C, 0x58, 0x2E,
+    0x04, 0xFB, 0x00, 0x0D, 0x03, 0x25, 0x44, 0x5E, 0x73, 0x80, 0x86, 0x87, 0x82, 0x78, 0x6A, 0x57, 0x42, 0x21, 0xF9, 0x00,
+    0x0C, 0x07, 0x23, 0x3A, 0x4B, 0x57, 0x5C, 0x5C, 0x58, 0x4F, 0x42, 0x31, 0x1E, 0x06, 0xF7, 0x00, 0x08, 0x14, 0x23, 0x2D,
+    0x32, 0x32, 0x2E, 0x26, 0x1A, 0x0B, 0xF3, 0x00, 0x03, 0x03, 0x07, 0x08, 0x04, 0xE3, 0x00, 0xE7, 0x00, 0x01, 0x02, 0x18,
+    0xFE, 0x20, 0x01, 0x18, 0x02, 0xF3, 0x00, 0x01, 0x1E, 0x3E, 0xFE, 0x4B, 0x01, 0x3E, 0x1E, 0xF4, 0x00, 0x02, 0x03, 0x2D,
+    0x57, 0xFE, 0x75, 0x02, 0x5A, 0x38, 0x16, 0xF4, 0x00, 0x08, 0x28, 0x4D, 0x6D, 0x8D, 0x95, 0x73, 0x51, 0x2F, 0x0D, 0xF5,
+    0x00, 0x09, 0x11, 0x31, 0x52, 0x72, 0x92, 0x8D, 0x6A, 0x48, 0x26, 0x03, 0xF5, 0x00, 0x08, 0x16, 0x36, 0x56, 0x76, 0x8E,
+    0x84, 0x62, 0x39, 0x0F, 0xF5, 0x00, 0x08, 0x15, 0x3A, 0x53, 0x5A, 0x63, 0x63, 0x59, 0x35, 0x0D, 0xF5, 0x00, 0x02, 0x22,
+    0x4B, 0x74, 0xFE, 0x7F, 0x02, 0x5D, 0x35, 0x0C, 0xF6, 0x00, 0x09, 0x06, 0x2F, 0x58, 0x80, 0xA9, 0xAA, 0x92, 0x6A, 0x41,
+    0x18, 0xF6, 0x00, 0x09, 0x13, 0x3B, 0x64, 0x8D, 0x9E, 0x8C, 0x9F, 0x76, 0x4E, 0x25, 0xF6, 0x00, 0x0A, 0x1F, 0x48, 0x70,
+    0x99, 0x93, 0x81, 0xAA, 0x83, 0x5A, 0x31, 0x09, 0xF8, 0x00, 0x0B, 0x03, 0x2C, 0x54, 0x7D, 0xA5, 0x87, 0x75, 0x9E, 0x8F,
+    0x66, 0x3E, 0x15, 0xF8, 0x00, 0x0B, 0x0F, 0x38, 0x61, 0x89, 0xA5, 0x7C, 0x6A, 0x93, 0x9C, 0x73, 0x4A, 0x22, 0xF8, 0x00,
+    0x0C, 0x1C, 0x44, 0x6D, 0x96, 0x99, 0x70, 0x5E, 0x87, 0xA8, 0x7F, 0x57, 0x2E, 0x05, 0xF9, 0x00, 0x0C, 0x28, 0x51, 0x7A,
+    0xA2, 0x8E, 0x65, 0x53, 0x7C, 0xA5, 0x8C, 0x63, 0x3A, 0x12, 0xFA, 0x00, 0x0D, 0x0C, 0x35, 0x5D, 0x86, 0xAB, 0x82, 0x59,
+    0x48, 0x70, 0x99, 0x98, 0x70, 0x47, 0x1E, 0xFA, 0x00, 0x0E, 0x18, 0x41, 0x6A, 0x92, 0xA0, 0x77, 0x4E, 0x3C, 0x65, 0x8E,
+    0xA5, 0x7C, 0x53, 0x2B, 0x02, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x76, 0x9F, 0x95, 0x6C, 0x53, 0x53, 0x5A, 0x83, 0xAC, 0x88,
+    0x60, 0x37, 0x0F, 0xFC, 0x00, 0x05, 0x09, 0x31, 0x5A, 0x83, 0xAB, 0x89, 0xFC, 0x7E, 0x04, 0xA1, 0x95, 0x6C, 0x44, 0x1B,
+    0xFC, 0x00, 0x04, 0x15, 0x3E, 0x66, 0x8F, 0xB0, 0xFB, 0xA8, 0x04, 0xA9, 0xA1, 0x79, 0x50, 0x27, 0xFC, 0x00, 0x04, 0x22,
+    0x4A, 0x73, 0x9B, 0x99, 0xFB, 0x7D, 0x05, 0x88, 0xAE, 0x85, 0x5C, 0x34, 0x0B, 0xFE, 0x00, 0x06, 0x05, 0x2E, 0x57, 0x7F,
+    0xA8, 0x8E, 0x65, 0xFC, 0x53, 0x05, 0x7C, 0xA5, 0x92, 0x69, 0x40, 0x18, 0xFE, 0x00, 0x07, 0x12, 0x3A, 0x63, 0x8C, 0xAC,
+    0x83, 0x5A, 0x31, 0xFE, 0x28, 0x06, 0x48, 0x71, 0x9A, 0x9E, 0x75, 0x4D, 0x24, 0xFE, 0x00, 0x2B, 0x1E, 0x47, 0x70, 0x98,
+    0xA0, 0x77, 0x4E, 0x25, 0x00, 0x00, 0x13, 0x3C, 0x65, 0x8E, 0xAA, 0x82, 0x59, 0x31, 0x08, 0x00, 0x01, 0x2B, 0x53, 0x7C,
+    0x95, 0x95, 0x6C, 0x43, 0x1A, 0x00, 0x00, 0x08, 0x31, 0x5A, 0x83, 0x95, 0x8E, 0x66, 0x3D, 0x14, 0x00, 0x01, 0x2B, 0x52,
+    0xFE, 0x6A, 0x02, 0x5E, 0x38, 0x0F, 0xFE, 0x00, 0x01, 0x25, 0x4D, 0xFE, 0x6A, 0x06, 0x62, 0x3D, 0x14, 0x00, 0x00, 0x17,
+    0x34, 0xFE, 0x40, 0x01, 0x3B, 0x22, 0xFD, 0x00, 0x01, 0x13, 0x31, 0xFE, 0x40, 0x02, 0x3D, 0x26, 0x04, 0xFE, 0x00, 0x00,
+    0x0E, 0xFE, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0xFE, 0x15, 0x01, 0x13, 0x04, 0x81, 0x00, 0xE3, 0x00, 0x05,
+    0x10, 0x1F, 0x20, 0x20, 0x1E, 0x0E, 0xF3, 0x00, 0x07, 0x0F, 0x31, 0x48, 0x4B, 0x4B, 0x47, 0x2E, 0x0B, 0xF5, 0x00, 0x08,
+    0x06, 0x28, 0x4A, 0x6C, 0x75, 0x75, 0x6A, 0x41, 0x17, 0xF5, 0x00, 0x08, 0x20, 0x42, 0x64, 0x86, 0x9C, 0x7C, 0x5C, 0x3A,
+    0x13, 0xF6, 0x00, 0x08, 0x17, 0x39, 0x5B, 0x7D, 0x9F, 0x81, 0x60, 0x40, 0x20, 0xF5, 0x00, 0x08, 0x26, 0x50, 0x75, 0x8E,
+    0x85, 0x65, 0x45, 0x25, 0x04, 0xF5, 0x00, 0x01, 0x23, 0x4A, 0xFE, 0x63, 0x02, 0x55, 0x48, 0x26, 0xF4, 0x00, 0x02, 0x22,
+    0x4B, 0x74, 0xFE, 0x7F, 0x02, 0x5D, 0x35, 0x0C, 0xF6, 0x00, 0x09, 0x06, 0x2F, 0x58, 0x80, 0xA9, 0xAA, 0x92, 0x6A, 0x41,
+    0x18, 0xF6, 0x00, 0x09, 0x13, 0x3B, 0x64, 0x8D, 0x9E, 0x8C, 0x9F, 0x76, 0x4E, 0x25, 0xF6, 0x00, 0x0A, 0x1F, 0x48, 0x70,
+    0x99, 0x93, 0x81, 0xAA, 0x83, 0x5A, 0x31, 0x09, 0xF8, 0x00, 0x0B, 0x03, 0x2C, 0x54, 0x7D, 0xA5, 0x87, 0x75, 0x9E, 0x8F,
+    0x66, 0x3E, 0x15, 0xF8, 0x00, 0x0B, 0x0F, 0x38, 0x61, 0x89, 0xA5, 0x7C, 0x6A, 0x93, 0x9C, 0x73, 0x4A, 0x22, 0xF8, 0x00,
+    0x0C, 0x1C, 0x44, 0x6D, 0x96, 0x99, 0x70, 0x5E, 0x87, 0xA8, 0x7F, 0x57, 0x2E, 0x05, 0xF9, 0x00, 0x0C, 0x28, 0x51, 0x7A,
+    0xA2, 0x8E, 0x65, 0x53, 0x7C, 0xA5, 0x8C, 0x63, 0x3A, 0x12, 0xFA, 0x00, 0x0D, 0x0C, 0x35, 0x5D, 0x86, 0xAB, 0x82, 0x59,
+    0x48, 0x70, 0x99, 0x98, 0x70, 0x47, 0x1E, 0xFA, 0x00, 0x0E, 0x18, 0x41, 0x6A, 0x92, 0xA0, 0x77, 0x4E, 0x3C, 0x65, 0x8E,
+    0xA5, 0x7C, 0x53, 0x2B, 0x02, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x76, 0x9F, 0x95, 0x6C, 0x53, 0x53, 0x5A, 0x83, 0xAC, 0x88,
+    0x60, 0x37, 0x0F, 0xFC, 0x00, 0x05, 0x09, 0x31, 0x5A, 0x83, 0xAB, 0x89, 0xFC, 0x7E, 0x04, 0xA1, 0x95, 0x6C, 0x44, 0x1B,
+    0xFC, 0x00, 0x04, 0x15, 0x3E, 0x66, 0x8F, 0xB0, 0xFB, 0xA8, 0x04, 0xA9, 0xA1, 0x79, 0x50, 0x27, 0xFC, 0x00, 0x04, 0x22,
+    0x4A, 0x73, 0x9B, 0x99, 0xFB, 0x7D, 0x05, 0x88, 0xAE, 0x85, 0x5C, 0x34, 0x0B, 0xFE, 0x00, 0x06, 0x05, 0x2E, 0x57, 0x7F,
+    0xA8, 0x8E, 0x65, 0xFC, 0x53, 0x05, 0x7C, 0xA5, 0x92, 0x69, 0x40, 0x18, 0xFE, 0x00, 0x07, 0x12, 0x3A, 0x63, 0x8C, 0xAC,
+    0x83, 0x5A, 0x31, 0xFE, 0x28, 0x06, 0x48, 0x71, 0x9A, 0x9E, 0x75, 0x4D, 0x24, 0xFE, 0x00, 0x2B, 0x1E, 0x47, 0x70, 0x98,
+    0xA0, 0x77, 0x4E, 0x25, 0x00, 0x00, 0x13, 0x3C, 0x65, 0x8E, 0xAA, 0x82, 0x59, 0x31, 0x08, 0x00, 0x01, 0x2B, 0x53, 0x7C,
+    0x95, 0x95, 0x6C, 0x43, 0x1A, 0x00, 0x00, 0x08, 0x31, 0x5A, 0x83, 0x95, 0x8E, 0x66, 0x3D, 0x14, 0x00, 0x01, 0x2B, 0x52,
+    0xFE, 0x6A, 0x02, 0x5E, 0x38, 0x0F, 0xFE, 0x00, 0x01, 0x25, 0x4D, 0xFE, 0x6A, 0x06, 0x62, 0x3D, 0x14, 0x00, 0x00, 0x17,
+    0x34, 0xFE, 0x40, 0x01, 0x3B, 0x22, 0xFD, 0x00, 0x01, 0x13, 0x31, 0xFE, 0x40, 0x02, 0x3D, 0x26, 0x04, 0xFE, 0x00, 0x00,
+    0x0E, 0xFE, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0xFE, 0x15, 0x01, 0x13, 0x04, 0x81, 0x00, 0xE5, 0x00, 0x01,
+    0x0B, 0x1D, 0xFE, 0x21, 0x00, 0x15, 0xF3, 0x00, 0x07, 0x08, 0x29, 0x45, 0x4C, 0x4C, 0x4B, 0x38, 0x17, 0xF5, 0x00, 0x09,
+    0x01, 0x22, 0x44, 0x65, 0x76, 0x76, 0x74, 0x53, 0x31, 0x10, 0xF6, 0x00, 0x0A, 0x1C, 0x3D, 0x5E, 0x7F, 0x9D, 0x90, 0x8E,
+    0x6D, 0x4C, 0x2B, 0x09, 0xF8, 0x00, 0x0B, 0x14, 0x36, 0x57, 0x79, 0x9A, 0x80, 0x73, 0x92, 0x88, 0x66, 0x45, 0x24, 0xF8,
+    0x00, 0x0C, 0x23, 0x4D, 0x72, 0x8E, 0x83, 0x63, 0x56, 0x75, 0x8E, 0x81, 0x5F, 0x36, 0x0C, 0xF9, 0x00, 0x0C, 0x20, 0x47,
+    0x63, 0x63, 0x62, 0x55, 0x55, 0x58, 0x63, 0x63, 0x57, 0x32, 0x0A, 0xF9, 0x00, 0x04, 0x0C, 0x2A, 0x39, 0x4B, 0x74, 0xFE,
+    0x7F, 0x03, 0x5D, 0x39, 0x33, 0x1B, 0xF7, 0x00, 0x09, 0x06, 0x2F, 0x58, 0x80, 0xA9, 0xAA, 0x92, 0x6A, 0x41, 0x18, 0xF6,
+    0x00, 0x09, 0x13, 0x3B, 0x64, 0x8D, 0x9E, 0x8C, 0x9F, 0x76, 0x4E, 0x25, 0xF6, 0x00, 0x0A, 0x1F, 0x48, 0x70, 0x99, 0x93,
+    0x81, 0xAA, 0x83, 0x5A, 0x31, 0x09, 0xF8, 0x00, 0x0B, 0x03, 0x2C, 0x54, 0x7D, 0xA5, 0x87, 0x75, 0x9E, 0x8F, 0x66, 0x3E,
+    0x15, 0xF8, 0x00, 0x0B, 0x0F, 0x38, 0x61, 0x89, 0xA5, 0x7C, 0x6A, 0x93, 0x9C, 0x73, 0x4A, 0x22, 0xF8, 0x00, 0x0C, 0x1C,
+    0x44, 0x6D, 0x96, 0x99, 0x70, 0x5E, 0x87, 0xA8, 0x7F, 0x57, 0x2E, 0x05, 0xF9, 0x00, 0x0C, 0x28, 0x51, 0x7A, 0xA2, 0x8E,
+    0x65, 0x53, 0x7C, 0xA5, 0x8C, 0x63, 0x3A, 0x12, 0xFA, 0x00, 0x0D, 0x0C, 0x35, 0x5D, 0x86, 0xAB, 0x82, 0x59, 0x48, 0x70,
+    0x99, 0x98, 0x70, 0x47, 0x1E, 0xFA, 0x00, 0x0E, 0x18, 0x41, 0x6A, 0x92, 0xA0, 0x77, 0x4E, 0x3C, 0x65, 0x8E, 0xA5, 0x7C,
+    0x53, 0x2B, 0x02, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x76, 0x9F, 0x95, 0x6C, 0x53, 0x53, 0x5A, 0x83, 0xAC, 0x88, 0x60, 0x37,
+    0x0F, 0xFC, 0x00, 0x05, 0x09, 0x31, 0x5A, 0x83, 0xAB, 0x89, 0xFC, 0x7E, 0x04, 0xA1, 0x95, 0x6C, 0x44, 0x1B, 0xFC, 0x00,
+    0x04, 0x15, 0x3E, 0x66, 0x8F, 0xB0, 0xFB, 0xA8, 0x04, 0xA9, 0xA1, 0x79, 0x50, 0x27, 0xFC, 0x00, 0x04, 0x22, 0x4A, 0x73,
+    0x9B, 0x99, 0xFB, 0x7D, 0x05, 0x88, 0xAE, 0x85, 0x5C, 0x34, 0x0B, 0xFE, 0x00, 0x06, 0x05, 0x2E, 0x57, 0x7F, 0xA8, 0x8E,
+    0x65, 0xFC, 0x53, 0x05, 0x7C, 0xA5, 0x92, 0x69, 0x40, 0x18, 0xFE, 0x00, 0x07, 0x12, 0x3A, 0x63, 0x8C, 0xAC, 0x83, 0x5A,
+    0x31, 0xFE, 0x28, 0x06, 0x48, 0x71, 0x9A, 0x9E, 0x75, 0x4D, 0x24, 0xFE, 0x00, 0x2B, 0x1E, 0x47, 0x70, 0x98, 0xA0, 0x77,
+    0x4E, 0x25, 0x00, 0x00, 0x13, 0x3C, 0x65, 0x8E, 0xAA, 0x82, 0x59, 0x31, 0x08, 0x00, 0x01, 0x2B, 0x53, 0x7C, 0x95, 0x95,
+    0x6C, 0x43, 0x1A, 0x00, 0x00, 0x08, 0x31, 0x5A, 0x83, 0x95, 0x8E, 0x66, 0x3D, 0x14, 0x00, 0x01, 0x2B, 0x52, 0xFE, 0x6A,
+    0x02, 0x5E, 0x38, 0x0F, 0xFE, 0x00, 0x01, 0x25, 0x4D, 0xFE, 0x6A, 0x06, 0x62, 0x3D, 0x14, 0x00, 0x00, 0x17, 0x34, 0xFE,
+    0x40, 0x01, 0x3B, 0x22, 0xFD, 0x00, 0x01, 0x13, 0x31, 0xFE, 0x40, 0x02, 0x3D, 0x26, 0x04, 0xFE, 0x00, 0x00, 0x0E, 0xFE,
+    0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0xFE, 0x15, 0x01, 0x13, 0x04, 0x81, 0x00, 0xE6, 0x00, 0x09, 0x07, 0x15,
+    0x1A, 0x16, 0x0C, 0x0F, 0x19, 0x1A, 0x18, 0x09, 0xF7, 0x00, 0x0B, 0x14, 0x2D, 0x3E, 0x44, 0x40, 0x33, 0x33, 0x44, 0x44,
+    0x42, 0x2B, 0x09, 0xF9, 0x00, 0x0C, 0x0F, 0x32, 0x50, 0x66, 0x6E, 0x6A, 0x59, 0x4D, 0x6E, 0x6F, 0x67, 0x41, 0x18, 0xF9,
+    0x00, 0x0C, 0x22, 0x49, 0x6D, 0x8C, 0x99, 0x92, 0x7F, 0x6B, 0x7E, 0x96, 0x6C, 0x42, 0x17, 0xFA, 0x00, 0x0D, 0x03, 0x2D,
+    0x57, 0x80, 0x96, 0x77, 0x82, 0x97, 0x94, 0x9B, 0x85, 0x60, 0x38, 0x10, 0xFA, 0x00, 0x0D, 0x06, 0x30, 0x5B, 0x7E, 0x7E,
+    0x63, 0x5D, 0x71, 0x7D, 0x7B, 0x68, 0x4A, 0x27, 0x01, 0xF9, 0x00, 0x04, 0x25, 0x46, 0x54, 0x54, 0x53, 0xFE, 0x55, 0x03,
+    0x51, 0x44, 0x2C, 0x0E, 0xF8, 0x00, 0x04, 0x0A, 0x22, 0x29, 0x4B, 0x74, 0xFE, 0x7F, 0x02, 0x5D, 0x35, 0x0C, 0xF6, 0x00,
+    0x09, 0x06, 0x2F, 0x58, 0x80, 0xA9, 0xAA, 0x92, 0x6A, 0x41, 0x18, 0xF6, 0x00, 0x09, 0x13, 0x3B, 0x64, 0x8D, 0x9E, 0x8C,
+    0x9F, 0x76, 0x4E, 0x25, 0xF6, 0x00, 0x0A, 0x1F, 0x48, 0x70, 0x99, 0x93, 0x81, 0xAA, 0x83, 0x5A, 0x31, 0x09, 0xF8, 0x00,
+    0x0B, 0x03, 0x2C, 0x54, 0x7D, 0xA5, 0x87, 0x75, 0x9E, 0x8F, 0x66, 0x3E, 0x15, 0xF8, 0x00, 0x0B, 0x0F, 0x38, 0x61, 0x89,
+    0xA5, 0x7C, 0x6A, 0x93, 0x9C, 0x73, 0x4A, 0x22, 0xF8, 0x00, 0x0C, 0x1C, 0x44, 0x6D, 0x96, 0x99, 0x70, 0x5E, 0x87, 0xA8,
+    0x7F, 0x57, 0x2E, 0x05, 0xF9, 0x00, 0x0C, 0x28, 0x51, 0x7A, 0xA2, 0x8E, 0x65, 0x53, 0x7C, 0xA5, 0x8C, 0x63, 0x3A, 0x12,
+    0xFA, 0x00, 0x0D, 0x0C, 0x35, 0x5D, 0x86, 0xAB, 0x82, 0x59, 0x48, 0x70, 0x99, 0x98, 0x70, 0x47, 0x1E, 0xFA, 0x00, 0x0E,
+    0x18, 0x41, 0x6A, 0x92, 0xA0, 0x77, 0x4E, 0x3C, 0x65, 0x8E, 0xA5, 0x7C, 0x53, 0x2B, 0x02, 0xFB, 0x00, 0x0E, 0x25, 0x4E,
+    0x76, 0x9F, 0x95, 0x6C, 0x53, 0x53, 0x5A, 0x83, 0xAC, 0x88, 0x60, 0x37, 0x0F, 0xFC, 0x00, 0x05, 0x09, 0x31, 0x5A, 0x83,
+    0xAB, 0x89, 0xFC, 0x7E, 0x04, 0xA1, 0x95, 0x6C, 0x44, 0x1B, 0xFC, 0x00, 0x04, 0x15, 0x3E, 0x66, 0x8F, 0xB0, 0xFB, 0xA8,
+    0x04, 0xA9, 0xA1, 0x79, 0x50, 0x27, 0xFC, 0x00, 0x04, 0x22, 0x4A, 0x73, 0x9B, 0x99, 0xFB, 0x7D, 0x05, 0x88, 0xAE, 0x85,
+    0x5C, 0x34, 0x0B, 0xFE, 0x00, 0x06, 0x05, 0x2E, 0x57, 0x7F, 0xA8, 0x8E, 0x65, 0xFC, 0x53, 0x05, 0x7C, 0xA5, 0x92, 0x69,
+    0x40, 0x18, 0xFE, 0x00, 0x07, 0x12, 0x3A, 0x63, 0x8C, 0xAC, 0x83, 0x5A, 0x31, 0xFE, 0x28, 0x06, 0x48, 0x71, 0x9A, 0x9E,
+    0x75, 0x4D, 0x24, 0xFE, 0x00, 0x2B, 0x1E, 0x47, 0x70, 0x98, 0xA0, 0x77, 0x4E, 0x25, 0x00, 0x00, 0x13, 0x3C, 0x65, 0x8E,
+    0xAA, 0x82, 0x59, 0x31, 0x08, 0x00, 0x01, 0x2B, 0x53, 0x7C, 0x95, 0x95, 0x6C, 0x43, 0x1A, 0x00, 0x00, 0x08, 0x31, 0x5A,
+    0x83, 0x95, 0x8E, 0x66, 0x3D, 0x14, 0x00, 0x01, 0x2B, 0x52, 0xFE, 0x6A, 0x02, 0x5E, 0x38, 0x0F, 0xFE, 0x00, 0x01, 0x25,
+    0x4D, 0xFE, 0x6A, 0x06, 0x62, 0x3D, 0x14, 0x00, 0x00, 0x17, 0x34, 0xFE, 0x40, 0x01, 0x3B, 0x22, 0xFD, 0x00, 0x01, 0x13,
+    0x31, 0xFE, 0x40, 0x02, 0x3D, 0x26, 0x04, 0xFE, 0x00, 0x00, 0x0E, 0xFE, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x00, 0x0C,
+    0xFE, 0x15, 0x01, 0x13, 0x04, 0x81, 0x00, 0xE7, 0x00, 0x05, 0x06, 0x11, 0x12, 0x12, 0x10, 0x0C, 0xFE, 0x12, 0x00, 0x0C,
+    0xF7, 0x00, 0x06, 0x0B, 0x2A, 0x3B, 0x3C, 0x3C, 0x3A, 0x33, 0xFE, 0x3C, 0x01, 0x34, 0x1A, 0xF8, 0x00, 0x06, 0x1D, 0x45,
+    0x65, 0x67, 0x67, 0x62, 0x54, 0xFE, 0x67, 0x02, 0x55, 0x2F, 0x06, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x91, 0x91, 0x6F,
+    0x5C, 0x87, 0x91, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0xA0, 0x9A, 0x6F, 0x5C, 0x87, 0xA9, 0x88,
+    0x5D, 0x33, 0x08, 0xF9, 0x00, 0x06, 0x20, 0x4B, 0x75, 0x7E, 0x7E, 0x6F, 0x5C, 0xFE, 0x7E, 0x02, 0x5D, 0x33, 0x08, 0xF9,
+    0x00, 0x04, 0x17, 0x3B, 0x52, 0x54, 0x54, 0xFE, 0x55, 0x04, 0x54, 0x54, 0x48, 0x27, 0x01, 0xF8, 0x00, 0x03, 0x1A, 0x28,
+    0x4B, 0x74, 0xFE, 0x7F, 0x03, 0x5D, 0x35, 0x23, 0x0C, 0xF7, 0x00, 0x09, 0x06, 0x2F, 0x58, 0x80, 0xA9, 0xAA, 0x92, 0x6A,
+    0x41, 0x18, 0xF6, 0x00, 0x09, 0x13, 0x3B, 0x64, 0x8D, 0x9E, 0x8C, 0x9F, 0x76, 0x4E, 0x25, 0xF6, 0x00, 0x0A, 0x1F, 0x48,
+    0x70, 0x99, 0x93, 0x81, 0xAA, 0x83, 0x5A, 0x31, 0x09, 0xF8, 0x00, 0x0B, 0x03, 0x2C, 0x54, 0x7D, 0xA5, 0x87, 0x75, 0x9E,
+    0x8F, 0x66, 0x3E, 0x15, 0xF8, 0x00, 0x0B, 0x0F, 0x38, 0x61, 0x89, 0xA5, 0x7C, 0x6A, 0x93, 0x9C, 0x73, 0x4A, 0x22, 0xF8,
+    0x00, 0x0C, 0x1C, 0x44, 0x6D, 0x96, 0x99, 0x70, 0x5E, 0x87, 0xA8, 0x7F, 0x57, 0x2E, 0x05, 0xF9, 0x00, 0x0C, 0x28, 0x51,
+    0x7A, 0xA2, 0x8E, 0x65, 0x53, 0x7C, 0xA5, 0x8C, 0x63, 0x3A, 0x12, 0xFA, 0x00, 0x0D, 0x0C, 0x35, 0x5D, 0x86, 0xAB, 0x82,
+    0x59, 0x48, 0x70, 0x99, 0x98, 0x70, 0x47, 0x1E, 0xFA, 0x00, 0x0E, 0x18, 0x41, 0x6A, 0x92, 0xA0, 0x77, 0x4E, 0x3C, 0x65,
+    0x8E, 0xA5, 0x7C, 0x53, 0x2B, 0x02, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x76, 0x9F, 0x95, 0x6C, 0x53, 0x53, 0x5A, 0x83, 0xAC,
+    0x88, 0x60, 0x37, 0x0F, 0xFC, 0x00, 0x05, 0x09, 0x31, 0x5A, 0x83, 0xAB, 0x89, 0xFC, 0x7E, 0x04, 0xA1, 0x95, 0x6C, 0x44,
+    0x1B, 0xFC, 0x00, 0x04, 0x15, 0x3E, 0x66, 0x8F, 0xB0, 0xFB, 0xA8, 0x04, 0xA9, 0xA1, 0x79, 0x50, 0x27, 0xFC, 0x00, 0x04,
+    0x22, 0x4A, 0x73, 0x9B, 0x99, 0xFB, 0x7D, 0x05, 0x88, 0xAE, 0x85, 0x5C, 0x34, 0x0B, 0xFE, 0x00, 0x06, 0x05, 0x2E, 0x57,
+    0x7F, 0xA8, 0x8E, 0x65, 0xFC, 0x53, 0x05, 0x7C, 0xA5, 0x92, 0x69, 0x40, 0x18, 0xFE, 0x00, 0x07, 0x12, 0x3A, 0x63, 0x8C,
+    0xAC, 0x83, 0x5A, 0x31, 0xFE, 0x28, 0x06, 0x48, 0x71, 0x9A, 0x9E, 0x75, 0x4D, 0x24, 0xFE, 0x00, 0x2B, 0x1E, 0x47, 0x70,
+    0x98, 0xA0, 0x77, 0x4E, 0x25, 0x00, 0x00, 0x13, 0x3C, 0x65, 0x8E, 0xAA, 0x82, 0x59, 0x31, 0x08, 0x00, 0x01, 0x2B, 0x53,
+    0x7C, 0x95, 0x95, 0x6C, 0x43, 0x1A, 0x00, 0x00, 0x08, 0x31, 0x5A, 0x83, 0x95, 0x8E, 0x66, 0x3D, 0x14, 0x00, 0x01, 0x2B,
+    0x52, 0xFE, 0x6A, 0x02, 0x5E, 0x38, 0x0F, 0xFE, 0x00, 0x01, 0x25, 0x4D, 0xFE, 0x6A, 0x06, 0x62, 0x3D, 0x14, 0x00, 0x00,
+    0x17, 0x34, 0xFE, 0x40, 0x01, 0x3B, 0x22, 0xFD, 0x00, 0x01, 0x13, 0x31, 0xFE, 0x40, 0x02, 0x3D, 0x26, 0x04, 0xFE, 0x00,
+    0x00, 0x0E, 0xFE, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0xFE, 0x15, 0x01, 0x13, 0x04, 0x81, 0x00, 0xE5, 0x00,
+    0x05, 0x06, 0x16, 0x1F, 0x20, 0x1B, 0x0E, 0xF3, 0x00, 0x08, 0x12, 0x2B, 0x3E, 0x49, 0x4B, 0x44, 0x34, 0x1E, 0x02, 0xF6,
+    0x00, 0x09, 0x10, 0x31, 0x4E, 0x65, 0x73, 0x75, 0x6C, 0x59, 0x3E, 0x1F, 0xF6, 0x00, 0x0A, 0x26, 0x4B, 0x6D, 0x89, 0x9C,
+    0x9C, 0x93, 0x7A, 0x5B, 0x37, 0x11, 0xF8, 0x00, 0x0B, 0x0E, 0x36, 0x5F, 0x85, 0x93, 0x78, 0x72, 0x86, 0x96, 0x70, 0x49,
+    0x20, 0xF8, 0x00, 0x0B, 0x14, 0x3E, 0x69, 0x93, 0x7F, 0x58, 0x4A, 0x6D, 0x97, 0x7C, 0x51, 0x27, 0xF8, 0x00, 0x0B, 0x14,
+    0x3E, 0x68, 0x92, 0x81, 0x5B, 0x4F, 0x6F, 0x97, 0x7B, 0x51, 0x27, 0xF8, 0x00, 0x0B, 0x0D, 0x35, 0x5D, 0x84, 0x97, 0x7D,
+    0x77, 0x8A, 0x94, 0x6F, 0x47, 0x1F, 0xF7, 0x00, 0x0A, 0x25, 0x49, 0x6A, 0x84, 0xA5, 0xA2, 0x95, 0x77, 0x58, 0x35, 0x10,
+    0xF7, 0x00, 0x09, 0x13, 0x3B, 0x64, 0x8D, 0x9E, 0x8D, 0x9F, 0x76, 0x4E, 0x25, 0xF6, 0x00, 0x0A, 0x1F, 0x48, 0x70, 0x99,
+    0x93, 0x81, 0xAA, 0x83, 0x5A, 0x31, 0x09, 0xF8, 0x00, 0x0B, 0x03, 0x2C, 0x54, 0x7D, 0xA6, 0x88, 0x76, 0x9F, 0x8F, 0x67,
+    0x3E, 0x15, 0xF8, 0x00, 0x0B, 0x0F, 0x38, 0x61, 0x89, 0xA5, 0x7C, 0x6A, 0x93, 0x9C, 0x73, 0x4A, 0x22, 0xF8, 0x00, 0x0C,
+    0x1C, 0x44, 0x6D, 0x96, 0x9A, 0x71, 0x5F, 0x88, 0xA8, 0x7F, 0x57, 0x2E, 0x05, 0xF9, 0x00, 0x0C, 0x28, 0x51, 0x7A, 0xA2,
+    0x8E, 0x65, 0x53, 0x7C, 0xA5, 0x8C, 0x63, 0x3B, 0x12, 0xFA, 0x00, 0x0D, 0x0C, 0x35, 0x5D, 0x86, 0xAC, 0x83, 0x5A, 0x48,
+    0x71, 0x9A, 0x98, 0x70, 0x47, 0x1E, 0xFA, 0x00, 0x0E, 0x19, 0x41, 0x6A, 0x92, 0xA0, 0x77, 0x4E, 0x3C, 0x65, 0x8E, 0xA5,
+    0x7C, 0x53, 0x2B, 0x02, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x76, 0x9F, 0x95, 0x6C, 0x53, 0x53, 0x5A, 0x83, 0xAC, 0x88, 0x60,
+    0x37, 0x0F, 0xFC, 0x00, 0x05, 0x09, 0x31, 0x5A, 0x83, 0xAB, 0x89, 0xFC, 0x7E, 0x04, 0xA1, 0x95, 0x6C, 0x44, 0x1B, 0xFC,
+    0x00, 0x04, 0x15, 0x3E, 0x66, 0x8F, 0xB0, 0xFB, 0xA8, 0x04, 0xA9, 0xA1, 0x79, 0x50, 0x27, 0xFC, 0x00, 0x04, 0x22, 0x4A,
+    0x73, 0x9C, 0x99, 0xFB, 0x7D, 0x05, 0x88, 0xAE, 0x85, 0x5D, 0x34, 0x0B, 0xFE, 0x00, 0x06, 0x05, 0x2E, 0x57, 0x7F, 0xA8,
+    0x8E, 0x65, 0xFC, 0x53, 0x05, 0x7C, 0xA5, 0x92, 0x69, 0x40, 0x18, 0xFE, 0x00, 0x07, 0x12, 0x3A, 0x63, 0x8C, 0xAC, 0x83,
+    0x5A, 0x31, 0xFE, 0x28, 0x06, 0x48, 0x71, 0x9A, 0x9E, 0x75, 0x4D, 0x24, 0xFE, 0x00, 0x2B, 0x1E, 0x47, 0x70, 0x98, 0xA0,
+    0x77, 0x4E, 0x25, 0x00, 0x00, 0x13, 0x3C, 0x65, 0x8E, 0xAA, 0x82, 0x59, 0x31, 0x08, 0x00, 0x01, 0x2B, 0x53, 0x7C, 0x95,
+    0x95, 0x6C, 0x43, 0x1A, 0x00, 0x00, 0x08, 0x31, 0x5A, 0x83, 0x95, 0x8E, 0x66, 0x3D, 0x14, 0x00, 0x01, 0x2B, 0x52, 0xFE,
+    0x6A, 0x02, 0x5E, 0x38, 0x0F, 0xFE, 0x00, 0x01, 0x25, 0x4D, 0xFE, 0x6A, 0x06, 0x62, 0x3D, 0x14, 0x00, 0x00, 0x17, 0x34,
+    0xFE, 0x40, 0x01, 0x3B, 0x22, 0xFD, 0x00, 0x01, 0x13, 0x31, 0xFE, 0x40, 0x02, 0x3D, 0x26, 0x04, 0xFE, 0x00, 0x00, 0x0E,
+    0xFE, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0xFE, 0x15, 0x01, 0x13, 0x04, 0x81, 0x00, 0x81, 0x00, 0xFD, 0x00,
+    0x01, 0x1A, 0x29, 0xF8, 0x2A, 0x01, 0x22, 0x0A, 0xFA, 0x00, 0x02, 0x15, 0x3A, 0x53, 0xF8, 0x55, 0x01, 0x46, 0x24, 0xFA,
+    0x00, 0x02, 0x21, 0x4A, 0x73, 0xF8, 0x7F, 0x02, 0x59, 0x2F, 0x04, 0xFC, 0x00, 0x04, 0x03, 0x2C, 0x55, 0x7E, 0xA7, 0xFA,
+    0xAA, 0x03, 0x84, 0x59, 0x2F, 0x04, 0xFC, 0x00, 0x08, 0x0F, 0x38, 0x60, 0x89, 0x9D, 0x7F, 0x81, 0xAB, 0x86, 0xFD, 0x7F,
+    0x02, 0x59, 0x2F, 0x04, 0xFC, 0x00, 0x09, 0x1A, 0x43, 0x6C, 0x95, 0x92, 0x69, 0x81, 0xAB, 0x86, 0x5B, 0xFE, 0x55, 0x01,
+    0x46, 0x24, 0xFB, 0x00, 0x0E, 0x25, 0x4E, 0x77, 0xA0, 0x87, 0x5E, 0x81, 0xAB, 0x86, 0x5B, 0x31, 0x2A, 0x2A, 0x22, 0x0A,
+    0xFC, 0x00, 0x0E, 0x07, 0x30, 0x59, 0x82, 0xA6, 0x7C, 0x56, 0x81, 0xAB, 0x86, 0x5B, 0x31, 0x23, 0x22, 0x15, 0xFB, 0x00,
+    0x0F, 0x13, 0x3C, 0x65, 0x8E, 0x9B, 0x72, 0x56, 0x81, 0xAB, 0x86, 0x5B, 0x4E, 0x4E, 0x4C, 0x36, 0x13, 0xFC, 0x00, 0x09,
+    0x1E, 0x47, 0x70, 0x99, 0x90, 0x67, 0x56, 0x81, 0xAB, 0x86, 0xFE, 0x78, 0x02, 0x72, 0x4A, 0x1F, 0xFC, 0x00, 0x08, 0x29,
+    0x52, 0x7B, 0xA4, 0x85, 0x5C, 0x56, 0x81, 0xAB, 0xFE, 0xA3, 0x03, 0x9F, 0x75, 0x4A, 0x20, 0xFD, 0x00, 0x0A, 0x0B, 0x34,
+    0x5D, 0x86, 0xA4, 0x7A, 0x51, 0x56, 0x81, 0xAB, 0x89, 0xFE, 0x87, 0x02, 0x75, 0x4A, 0x20, 0xFD, 0x00, 0x0A, 0x17, 0x40,
+    0x69, 0x92, 0x99, 0x70, 0x53, 0x56, 0x81, 0xAB, 0x86, 0xFE, 0x5C, 0x02, 0x5A, 0x3F, 0x19, 0xFD, 0x00, 0x04, 0x22, 0x4B,
+    0x74, 0x9D, 0x8E, 0xFE, 0x7E, 0x08, 0x81, 0xAB, 0x86, 0x5B, 0x32, 0x32, 0x31, 0x21, 0x04, 0xFE, 0x00, 0x05, 0x04, 0x2D,
+    0x56, 0x7F, 0xA8, 0xAA, 0xFD, 0xA8, 0x05, 0xB0, 0x86, 0x5B, 0x31, 0x07, 0x07, 0xFC, 0x00, 0x04, 0x0F, 0x38, 0x61, 0x8A,
+    0xA2, 0xFD, 0x80, 0x07, 0x81, 0xAB, 0x86, 0x5B, 0x31, 0x15, 0x15, 0x11, 0xFD, 0x00, 0x0C, 0x1B, 0x44, 0x6D, 0x96, 0x97,
+    0x6E, 0x55, 0x55, 0x56, 0x81, 0xAB, 0x86, 0x5B, 0xFE, 0x3F, 0x01, 0x39, 0x20, 0xFE, 0x00, 0x0B, 0x26, 0x4F, 0x78, 0xA1,
+    0x8C, 0x63, 0x3A, 0x2C, 0x56, 0x81, 0xAB, 0x86, 0xFD, 0x6A, 0x10, 0x5C, 0x35, 0x0C, 0x00, 0x08, 0x31, 0x5A, 0x83, 0xAB,
+    0x82, 0x59, 0x2F, 0x2C, 0x56, 0x81, 0xAB, 0x95, 0xFE, 0x94, 0x0F, 0x8D, 0x63, 0x38, 0x0E, 0x00, 0x13, 0x3C, 0x65, 0x8E,
+    0x95, 0x77, 0x4E, 0x25, 0x2C, 0x56, 0x81, 0xFC, 0x95, 0x0E, 0x8D, 0x63, 0x38, 0x0E, 0x00, 0x13, 0x3C, 0x61, 0x6A, 0x6A,
+    0x66, 0x43, 0x1A, 0x29, 0x51, 0xFA, 0x6A, 0x0D, 0x5C, 0x35, 0x0C, 0x00, 0x04, 0x25, 0x3C, 0x40, 0x40, 0x3E, 0x2A, 0x09,
+    0x16, 0x34, 0xFA, 0x40, 0x01, 0x3A, 0x20, 0xFE, 0x00, 0x08, 0x04, 0x13, 0x15, 0x15, 0x14, 0x07, 0x00, 0x00, 0x0E, 0xFA,
+    0x15, 0x00, 0x11, 0x81, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0x03, 0x0A, 0x0D, 0x0C, 0x07, 0xF3, 0x00, 0x09, 0x11, 0x21,
+    0x2D, 0x35, 0x37, 0x37, 0x31, 0x28, 0x1A, 0x09, 0xF8, 0x00, 0x0C, 0x05, 0x20, 0x36, 0x49, 0x57, 0x5F, 0x62, 0x61, 0x5B,
+    0x50, 0x42, 0x2F, 0x14, 0xFA, 0x00, 0x0D, 0x05, 0x25, 0x41, 0x5B, 0x70, 0x7F, 0x89, 0x8C, 0x8B, 0x85, 0x79, 0x68, 0x4F,
+    0x29, 0xFA, 0x00, 0x0E, 0x1F, 0x41, 0x61, 0x7D, 0x95, 0xA7, 0x9F, 0x9A, 0x9C, 0xA4, 0xA0, 0x83, 0x58, 0x2E, 0x03, 0xFC,
+    0x00, 0x0F, 0x11, 0x37, 0x5A, 0x7D, 0x9D, 0x9F, 0x86, 0x76, 0x70, 0x72, 0x7C, 0x8C, 0x83, 0x58, 0x2E, 0x03, 0xFC, 0x00,
+    0x0F, 0x24, 0x4A, 0x70, 0x95, 0xA3, 0x81, 0x63, 0x4D, 0x45, 0x48, 0x54, 0x68, 0x80, 0x58, 0x2E, 0x03, 0xFD, 0x00, 0x0F,
+    0x0A, 0x32, 0x5A, 0x83, 0xA9, 0x90, 0x6A, 0x46, 0x27, 0x1B, 0x1E, 0x2E, 0x44, 0x58, 0x48, 0x25, 0xFC, 0x00, 0x0F, 0x14,
+    0x3E, 0x67, 0x90, 0xAB, 0x82, 0x59, 0x31, 0x0B, 0x00, 0x00, 0x09, 0x22, 0x2E, 0x25, 0x0C, 0xFC, 0x00, 0x07, 0x1C, 0x46,
+    0x70, 0x9A, 0xA2, 0x78, 0x4E, 0x25, 0xFC, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x07, 0x21, 0x4C, 0x76, 0xA0, 0x9D, 0x72, 0x48,
+    0x1E, 0xF4, 0x00, 0x07, 0x24, 0x4E, 0x79, 0xA3, 0x9A, 0x6F, 0x45, 0x1B, 0xF4, 0x00, 0x07, 0x25, 0x4F, 0x7A, 0xA4, 0x99,
+    0x6F, 0x44, 0x1A, 0xF4, 0x00, 0x07, 0x23, 0x4E, 0x78, 0xA3, 0x9B, 0x70, 0x46, 0x1C, 0xF4, 0x00, 0x07, 0x1F, 0x49, 0x74,
+    0x9E, 0x9F, 0x74, 0x4B, 0x21, 0xF4, 0x00, 0x08, 0x19, 0x43, 0x6C, 0x96, 0xA5, 0x7C, 0x53, 0x2A, 0x02, 0xFE, 0x00, 0x02,
+    0x0E, 0x17, 0x10, 0xFB, 0x00, 0x0F, 0x10, 0x3A, 0x62, 0x8A, 0xB0, 0x88, 0x60, 0x3A, 0x16, 0x04, 0x08, 0x1A, 0x33, 0x42,
+    0x36, 0x19, 0xFC, 0x00, 0x10, 0x04, 0x2C, 0x54, 0x7B, 0xA1, 0x99, 0x74, 0x52, 0x39, 0x2F, 0x32, 0x3F, 0x55, 0x6C, 0x54,
+    0x2B, 0x02, 0xFC, 0x00, 0x0F, 0x1C, 0x42, 0x68, 0x8B, 0xAD, 0x8E, 0x73, 0x60, 0x59, 0x5B, 0x67, 0x79, 0x83, 0x58, 0x2E,
+    0x03, 0xFC, 0x00, 0x0F, 0x09, 0x2D, 0x50, 0x71, 0x8F, 0xA9, 0x97, 0x89, 0x84, 0x85, 0x8F, 0x9E, 0x83, 0x58, 0x2E, 0x03,
+    0xFB, 0x00, 0x0E, 0x15, 0x34, 0x53, 0x6E, 0x84, 0x95, 0x9D, 0x95, 0x95, 0x9A, 0x8E, 0x7C, 0x58, 0x2D, 0x03, 0xFA, 0x00,
+    0x0C, 0x17, 0x32, 0x4A, 0x5E, 0x6D, 0x75, 0x85, 0x88, 0x71, 0x66, 0x56, 0x42, 0x21, 0xF8, 0x00, 0x0B, 0x10, 0x31, 0x46,
+    0x43, 0x4B, 0x70, 0x98, 0x7C, 0x54, 0x2F, 0x1D, 0x06, 0xF8, 0x00, 0x0A, 0x1D, 0x47, 0x6D, 0x68, 0x62, 0x6E, 0x96, 0x86,
+    0x5B, 0x31, 0x06, 0xF7, 0x00, 0x0A, 0x1E, 0x48, 0x73, 0x91, 0x8D, 0x93, 0x9F, 0x7D, 0x56, 0x2C, 0x03, 0xF7, 0x00, 0x09,
+    0x1E, 0x48, 0x71, 0x80, 0x85, 0x83, 0x7A, 0x63, 0x43, 0x1E, 0xF6, 0x00, 0x09, 0x12, 0x36, 0x4D, 0x56, 0x5A, 0x59, 0x51,
+    0x41, 0x27, 0x08, 0xF5, 0x00, 0x07, 0x15, 0x24, 0x2C, 0x30, 0x2F, 0x28, 0x1B, 0x06, 0xF2, 0x00, 0x02, 0x02, 0x05, 0x05,
+    0xE3, 0x00, 0xE6, 0x00, 0x00, 0x15, 0xFE, 0x20, 0x01, 0x1B, 0x07, 0xF3, 0x00, 0x07, 0x17, 0x38, 0x4A, 0x4B, 0x4B, 0x42,
+    0x25, 0x03, 0xF4, 0x00, 0x07, 0x24, 0x4E, 0x74, 0x75, 0x75, 0x61, 0x3F, 0x1D, 0xF4, 0x00, 0x08, 0x20, 0x46, 0x66, 0x87,
+    0x9C, 0x7A, 0x58, 0x36, 0x14, 0xF5, 0x00, 0x09, 0x0A, 0x2B, 0x4B, 0x6B, 0x8B, 0x94, 0x72, 0x50, 0x2E, 0x0A, 0xF8, 0x00,
+    0x0E, 0x0D, 0x24, 0x2A, 0x2A, 0x2F, 0x4F, 0x6F, 0x8E, 0x8B, 0x69, 0x42, 0x2A, 0x2A, 0x24, 0x0D, 0xFC, 0x00, 0x02, 0x01,
+    0x28, 0x49, 0xFC, 0x55, 0x02, 0x63, 0x63, 0x5F, 0xFE, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x02, 0x08, 0x33, 0x5D,
+    0xF6, 0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0xAA, 0x03, 0x88, 0x5D, 0x33, 0x08,
+    0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x06, 0x08, 0x33,
+    0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87,
+    0x5C, 0x32, 0xFB, 0x2A, 0x01, 0x24, 0x0D, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x23,
+    0x00, 0x17, 0xFB, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x4E, 0x02, 0x4D, 0x39, 0x17, 0xFC, 0x00,
+    0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x78, 0x02, 0x75, 0x4E, 0x23, 0xFC, 0x00, 0x04, 0x08, 0x33, 0x5D, 0x88,
+    0xB2, 0xF9, 0xA3, 0x02, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x8A, 0xFA, 0x87, 0x02, 0x79,
+    0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x5C, 0x02, 0x5B, 0x43, 0x1D, 0xFC, 0x00, 0x06,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x32, 0x02, 0x31, 0x23, 0x07, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88,
+    0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x07, 0xFA, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x15, 0x01,
+    0x12, 0x01, 0xFC, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x3F, 0x01, 0x3B, 0x22, 0xFC, 0x00, 0x05,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x6A, 0x02, 0x5F, 0x39, 0x0F, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2,
+    0x96, 0xFA, 0x94, 0x03, 0x91, 0x67, 0x3C, 0x12, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0x95, 0x03, 0x91, 0x67,
+    0x3C, 0x12, 0xFD, 0x00, 0x02, 0x06, 0x30, 0x57, 0xF6, 0x6A, 0x02, 0x5F, 0x39, 0x10, 0xFC, 0x00, 0x01, 0x1C, 0x37, 0xF6,
+    0x40, 0x01, 0x3B, 0x23, 0xFA, 0x00, 0x00, 0x10, 0xF6, 0x15, 0x01, 0x12, 0x02, 0x81, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x01,
+    0x0B, 0x1D, 0xFE, 0x20, 0x00, 0x13, 0xF3, 0x00, 0x07, 0x08, 0x2A, 0x45, 0x4B, 0x4B, 0x4A, 0x35, 0x13, 0xF4, 0x00, 0x07,
+    0x21, 0x43, 0x65, 0x75, 0x75, 0x71, 0x4A, 0x20, 0xF5, 0x00, 0x08, 0x19, 0x3B, 0x5D, 0x7F, 0xA0, 0x83, 0x63, 0x42, 0x1B,
+    0xF6, 0x00, 0x09, 0x0F, 0x32, 0x54, 0x76, 0x98, 0x87, 0x67, 0x47, 0x27, 0x07, 0xF9, 0x00, 0x0E, 0x0D, 0x24, 0x2A, 0x2A,
+    0x47, 0x6D, 0x8E, 0x8C, 0x6B, 0x4B, 0x2B, 0x2A, 0x2A, 0x24, 0x0D, 0xFC, 0x00, 0x02, 0x01, 0x28, 0x49, 0xFE, 0x55, 0x02,
+    0x61, 0x63, 0x63, 0xFC, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x02, 0x08, 0x33, 0x5D, 0xF6, 0x7F, 0x02, 0x5D, 0x33,
+    0x08, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0xAA, 0x03, 0x88, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x05, 0x08, 0x33,
+    0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C,
+    0xFA, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x2A, 0x01,
+    0x24, 0x0D, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x23, 0x00, 0x17, 0xFB, 0x00, 0x06,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x4E, 0x02, 0x4D, 0x39, 0x17, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88,
+    0xB1, 0x87, 0xFA, 0x78, 0x02, 0x75, 0x4E, 0x23, 0xFC, 0x00, 0x04, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0xF9, 0xA3, 0x02, 0x79,
+    0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x8A, 0xFA, 0x87, 0x02, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x05,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x5C, 0x02, 0x5B, 0x43, 0x1D, 0xFC, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1,
+    0x87, 0x5C, 0xFB, 0x32, 0x02, 0x31, 0x23, 0x07, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB,
+    0x07, 0xFA, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x06,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x3F, 0x01, 0x3B, 0x22, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1,
+    0x87, 0xF9, 0x6A, 0x02, 0x5F, 0x39, 0x0F, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x96, 0xFA, 0x94, 0x03, 0x91,
+    0x67, 0x3C, 0x12, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0x95, 0x03, 0x91, 0x67, 0x3C, 0x12, 0xFD, 0x00, 0x02,
+    0x06, 0x30, 0x57, 0xF6, 0x6A, 0x02, 0x5F, 0x39, 0x10, 0xFC, 0x00, 0x01, 0x1C, 0x37, 0xF6, 0x40, 0x01, 0x3B, 0x23, 0xFA,
+    0x00, 0x00, 0x10, 0xF6, 0x15, 0x01, 0x12, 0x02, 0x81, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x01, 0x05, 0x1B, 0xFE, 0x21, 0x01,
+    0x19, 0x02, 0xF4, 0x00, 0x02, 0x01, 0x22, 0x41, 0xFE, 0x4C, 0x01, 0x3E, 0x1E, 0xF4, 0x00, 0x02, 0x1B, 0x3D, 0x5E, 0xFE,
+    0x76, 0x02, 0x5A, 0x38, 0x17, 0xF6, 0x00, 0x0A, 0x15, 0x36, 0x57, 0x78, 0x9A, 0x8B, 0x95, 0x74, 0x53, 0x32, 0x10, 0xF8,
+    0x00, 0x0C, 0x0C, 0x2F, 0x50, 0x72, 0x93, 0x87, 0x6C, 0x8B, 0x8F, 0x6D, 0x4C, 0x2B, 0x08, 0xFA, 0x00, 0x0E, 0x0D, 0x24,
+    0x44, 0x6B, 0x8C, 0x89, 0x6A, 0x4F, 0x6E, 0x8D, 0x88, 0x66, 0x3F, 0x24, 0x0D, 0xFC, 0x00, 0x06, 0x01, 0x28, 0x49, 0x55,
+    0x60, 0x63, 0x63, 0xFE, 0x55, 0x06, 0x63, 0x63, 0x5D, 0x55, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x02, 0x08, 0x33, 0x5D, 0xF6,
+    0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0xAA, 0x03, 0x88, 0x5D, 0x33, 0x08, 0xFD,
+    0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x06, 0x08, 0x33, 0x5D,
+    0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C,
+    0x32, 0xFB, 0x2A, 0x01, 0x24, 0x0D, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x23, 0x00,
+    0x17, 0xFB, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x4E, 0x02, 0x4D, 0x39, 0x17, 0xFC, 0x00, 0x05,
+    0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x78, 0x02, 0x75, 0x4E, 0x23, 0xFC, 0x00, 0x04, 0x08, 0x33, 0x5D, 0x88, 0xB2,
+    0xF9, 0xA3, 0x02, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x8A, 0xFA, 0x87, 0x02, 0x79, 0x4E,
+    0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x5C, 0x02, 0x5B, 0x43, 0x1D, 0xFC, 0x00, 0x06, 0x08,
+    0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x32, 0x02, 0x31, 0x23, 0x07, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1,
+    0x87, 0x5C, 0x32, 0xFB, 0x07, 0xFA, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x15, 0x01, 0x12,
+    0x01, 0xFC, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x3F, 0x01, 0x3B, 0x22, 0xFC, 0x00, 0x05, 0x08,
+    0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x6A, 0x02, 0x5F, 0x39, 0x0F, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x96,
+    0xFA, 0x94, 0x03, 0x91, 0x67, 0x3C, 0x12, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D, 0x88, 0xF8, 0x95, 0x03, 0x91, 0x67, 0x3C,
+    0x12, 0xFD, 0x00, 0x02, 0x06, 0x30, 0x57, 0xF6, 0x6A, 0x02, 0x5F, 0x39, 0x10, 0xFC, 0x00, 0x01, 0x1C, 0x37, 0xF6, 0x40,
+    0x01, 0x3B, 0x23, 0xFA, 0x00, 0x00, 0x10, 0xF6, 0x15, 0x01, 0x12, 0x02, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x05, 0x02,
+    0x10, 0x12, 0x12, 0x11, 0x09, 0xFE, 0x12, 0x00, 0x0F, 0xF7, 0x00, 0x02, 0x03, 0x24, 0x39, 0xFE, 0x3C, 0x00, 0x2F, 0xFE,
+    0x3C, 0x01, 0x38, 0x20, 0xF8, 0x00, 0x06, 0x14, 0x3D, 0x60, 0x67, 0x67, 0x66, 0x4D, 0xFE, 0x67, 0x02, 0x5C, 0x37, 0x0F,
+    0xF9, 0x00, 0x0C, 0x17, 0x42, 0x6C, 0x91, 0x91, 0x78, 0x53, 0x7E, 0x91, 0x91, 0x66, 0x3C, 0x11, 0xF9, 0x00, 0x0C, 0x17,
+    0x42, 0x6C, 0x97, 0xA3, 0x78, 0x53, 0x7E, 0xA8, 0x91, 0x66, 0x3C, 0x11, 0xFA, 0x00, 0x0E, 0x0D, 0x24, 0x42, 0x6C, 0x7E,
+    0x7E, 0x78, 0x53, 0x7D, 0x7E, 0x7E, 0x66, 0x3C, 0x24, 0x0D, 0xFC, 0x00, 0x02, 0x01, 0x28, 0x49, 0xF6, 0x55, 0x02, 0x49,
+    0x28, 0x01, 0xFD, 0x00, 0x02, 0x08, 0x33, 0x5D, 0xF6, 0x7F, 0x02, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x03, 0x08, 0x33, 0x5D,
+    0x88, 0xF8, 0xAA, 0x03, 0x88, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x7F, 0x02,
+    0x5D, 0x33, 0x08, 0xFD, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFA, 0x55, 0x02, 0x49, 0x28, 0x01, 0xFD,
+    0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x2A, 0x01, 0x24, 0x0D, 0xFC, 0x00, 0x07, 0x08, 0x33,
+    0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x23, 0x00, 0x17, 0xFB, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C,
+    0xFB, 0x4E, 0x02, 0x4D, 0x39, 0x17, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA, 0x78, 0x02, 0x75, 0x4E,
+    0x23, 0xFC, 0x00, 0x04, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0xF9, 0xA3, 0x02, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33,
+    0x5D, 0x88, 0xB2, 0x8A, 0xFA, 0x87, 0x02, 0x79, 0x4E, 0x24, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xFA,
+    0x5C, 0x02, 0x5B, 0x43, 0x1D, 0xFC, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0xFB, 0x32, 0x02, 0x31, 0x23,
+    0x07, 0xFC, 0x00, 0x07, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x07, 0xFA, 0x00, 0x07, 0x08, 0x33, 0x5D,
+    0x88, 0xB1, 0x87, 0x5C, 0x32, 0xFB, 0x15, 0x01, 0x12, 0x01, 0xFC, 0x00, 0x06, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0x5C,
+    0xFA, 0x3F, 0x01, 0x3B, 0x22, 0xFC, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB1, 0x87, 0xF9, 0x6A, 0x02, 0x5F, 0x39, 0x0F,
+    0xFD, 0x00, 0x05, 0x08, 0x33, 0x5D, 0x88, 0xB2, 0x96, 0xFA, 0x94, 0x03, 0x91, 0x67, 0x3C, 0x12, 0xFD, 0x00, 0x03, 0x08,
+    0x33, 0x5D, 0x88, 0xF8, 0x95, 0x03, 0x91, 0x67, 0x3C, 0x12, 0xFD, 0x00, 0x02, 0x06, 0x30, 0x57, 0xF6, 0x6A, 0x02, 0x5F,
+    0x39, 0x10, 0xFC, 0x00, 0x01, 0x1C, 0x37, 0xF6, 0x40, 0x01, 0x3B, 0x23, 0xFA, 0x00, 0x00, 0x10, 0xF6, 0x15, 0x01, 0x12,
+    0x02, 0x81, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x01, 0x02, 0x18, 0xFE, 0x20, 0x01, 0x18, 0x02, 0xF3, 0x00, 0x01, 0x1E, 0x3E,
+    0xFE, 0x4B, 0x01, 0x3E, 0x1E, 0xF4, 0x00, 0x02, 0x03, 0x2D, 0x57, 0xFE, 0x75, 0x02, 0x5A, 0x38, 0x16, 0xF4, 0x00, 0x08,
+    0x28, 0x4D, 0x6D, 0x8D, 0x95, 0x73, 0x51, 0x2F, 0x0D, 0xF5, 0x00, 0x09, 0x11, 0x31, 0x52, 0x72, 0x92, 0x8D, 0x6A, 0x48,
+    0x26, 0x03, 0xF8, 0x00, 0x0D, 0x0B, 0x23, 0x2A, 0x2A, 0x36, 0x56, 0x76, 0x8E, 0x84, 0x62, 0x39, 0x2A, 0x28, 0x17, 0xFA,
+    0x00, 0x01, 0x26, 0x47, 0xFD, 0x55, 0x08, 0x5A, 0x63, 0x63, 0x59, 0x55, 0x55, 0x51, 0x35, 0x10, 0xFC, 0x00, 0x02, 0x06,
+    0x31, 0x5B, 0xF7, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF9, 0xAA, 0x03, 0x98, 0x6D,
+    0x43, 0x18, 0xFC, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xFD, 0x7F, 0x01, 0x94, 0xA6, 0xFD, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFB,
+    0x00, 0x01, 0x26, 0x47, 0xFE, 0x55, 0x03, 0x69, 0x94, 0xA6, 0x7B, 0xFE, 0x55, 0x02, 0x51, 0x35, 0x10, 0xFB, 0x00, 0x0D,
+    0x0B, 0x23, 0x2A, 0x2A, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x2A, 0x2A, 0x28, 0x17, 0xF7, 0x00, 0x07, 0x14, 0x3F, 0x69,
+    0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14,
+    0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00,
+    0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26,
+    0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B,
+    0x51, 0x26, 0xF6, 0x00, 0x0C, 0x0F, 0x15, 0x15, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0x15, 0x13, 0x05, 0xFA, 0x00,
+    0x01, 0x1A, 0x36, 0xFE, 0x3F, 0x09, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x3F, 0x3F, 0x3D, 0x27, 0x06, 0xFC, 0x00, 0x02, 0x04,
+    0x2E, 0x55, 0xFD, 0x6A, 0x02, 0x94, 0xA6, 0x7B, 0xFE, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B,
+    0x86, 0xFE, 0x94, 0x01, 0x9D, 0xAB, 0xFD, 0x94, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF8,
+    0x95, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xF7, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFB, 0x00, 0x01,
+    0x1A, 0x36, 0xF7, 0x40, 0x02, 0x3D, 0x27, 0x06, 0xFA, 0x00, 0x00, 0x0F, 0xF7, 0x15, 0x01, 0x14, 0x05, 0x81, 0x00, 0x01,
+    0x00, 0x00, 0xE3, 0x00, 0x05, 0x10, 0x1F, 0x20, 0x20, 0x1E, 0x0E, 0xF3, 0x00, 0x07, 0x0F, 0x31, 0x48, 0x4B, 0x4B, 0x47,
+    0x2E, 0x0B, 0xF5, 0x00, 0x08, 0x06, 0x28, 0x4A, 0x6C, 0x75, 0x75, 0x6A, 0x41, 0x17, 0xF5, 0x00, 0x08, 0x20, 0x42, 0x64,
+    0x86, 0x9C, 0x7C, 0x5C, 0x3A, 0x13, 0xF6, 0x00, 0x08, 0x17, 0x39, 0x5B, 0x7D, 0x9F, 0x81, 0x60, 0x40, 0x20, 0xF8, 0x00,
+    0x0D, 0x0B, 0x23, 0x2A, 0x2A, 0x50, 0x75, 0x8E, 0x85, 0x65, 0x45, 0x2A, 0x2A, 0x28, 0x17, 0xFA, 0x00, 0x01, 0x26, 0x47,
+    0xFE, 0x55, 0xFE, 0x63, 0xFD, 0x55, 0x02, 0x51, 0x35, 0x10, 0xFC, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xF7, 0x7F, 0x02, 0x6D,
+    0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF9, 0xAA, 0x03, 0x98, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x02, 0x06,
+    0x31, 0x5B, 0xFD, 0x7F, 0x01, 0x94, 0xA6, 0xFD, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFB, 0x00, 0x01, 0x26, 0x47, 0xFE, 0x55,
+    0x03, 0x69, 0x94, 0xA6, 0x7B, 0xFE, 0x55, 0x02, 0x51, 0x35, 0x10, 0xFB, 0x00, 0x0D, 0x0B, 0x23, 0x2A, 0x2A, 0x3F, 0x69,
+    0x94, 0xA6, 0x7B, 0x51, 0x2A, 0x2A, 0x28, 0x17, 0xF7, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4,
+    0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51,
+    0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6,
+    0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69,
+    0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF6, 0x00, 0x0C, 0x0F,
+    0x15, 0x15, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0x15, 0x13, 0x05, 0xFA, 0x00, 0x01, 0x1A, 0x36, 0xFE, 0x3F, 0x09,
+    0x69, 0x94, 0xA6, 0x7B, 0x51, 0x3F, 0x3F, 0x3D, 0x27, 0x06, 0xFC, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xFD, 0x6A, 0x02, 0x94,
+    0xA6, 0x7B, 0xFE, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xFE, 0x94, 0x01, 0x9D, 0xAB,
+    0xFD, 0x94, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF8, 0x95, 0x02, 0x6D, 0x43, 0x18, 0xFC,
+    0x00, 0x02, 0x04, 0x2E, 0x55, 0xF7, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFB, 0x00, 0x01, 0x1A, 0x36, 0xF7, 0x40, 0x02, 0x3D,
+    0x27, 0x06, 0xFA, 0x00, 0x00, 0x0F, 0xF7, 0x15, 0x01, 0x14, 0x05, 0x81, 0x00, 0x01, 0x00, 0x00, 0xE5, 0x00, 0x01, 0x0B,
+    0x1D, 0xFE, 0x21, 0x00, 0x15, 0xF3, 0x00, 0x07, 0x08, 0x29, 0x45, 0x4C, 0x4C, 0x4B, 0x38, 0x17, 0xF5, 0x00, 0x09, 0x01,
+    0x22, 0x44, 0x65, 0x76, 0x76, 0x74, 0x53, 0x31, 0x10, 0xF6, 0x00, 0x0A, 0x1C, 0x3D, 0x5E, 0x7F, 0x9D, 0x90, 0x8E, 0x6D,
+    0x4C, 0x2B, 0x09, 0xF8, 0x00, 0x0B, 0x14, 0x36, 0x57, 0x79, 0x9A, 0x80, 0x73, 0x92, 0x88, 0x66, 0x45, 0x24, 0xF9, 0x00,
+    0x0D, 0x0B, 0x23, 0x4D, 0x72, 0x8E, 0x83, 0x63, 0x56, 0x75, 0x8E, 0x81, 0x5F, 0x36, 0x17, 0xFA, 0x00, 0x0E, 0x26, 0x47,
+    0x55, 0x63, 0x63, 0x62, 0x55, 0x55, 0x58, 0x63, 0x63, 0x57, 0x51, 0x35, 0x10, 0xFC, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xF7,
+    0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF9, 0xAA, 0x03, 0x98, 0x6D, 0x43, 0x18, 0xFC,
+    0x00, 0x02, 0x06, 0x31, 0x5B, 0xFD, 0x7F, 0x01, 0x94, 0xA6, 0xFD, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFB, 0x00, 0x01, 0x26,
+    0x47, 0xFE, 0x55, 0x03, 0x69, 0x94, 0xA6, 0x7B, 0xFE, 0x55, 0x02, 0x51, 0x35, 0x10, 0xFB, 0x00, 0x0D, 0x0B, 0x23, 0x2A,
+    0x2A, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x2A, 0x2A, 0x28, 0x17, 0xF7, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B,
+    0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94,
+    0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F,
+    0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07,
+    0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF6,
+    0x00, 0x0C, 0x0F, 0x15, 0x15, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0x15, 0x13, 0x05, 0xFA, 0x00, 0x01, 0x1A, 0x36,
+    0xFE, 0x3F, 0x09, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x3F, 0x3F, 0x3D, 0x27, 0x06, 0xFC, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xFD,
+    0x6A, 0x02, 0x94, 0xA6, 0x7B, 0xFE, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xFE, 0x94,
+    0x01, 0x9D, 0xAB, 0xFD, 0x94, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF8, 0x95, 0x02, 0x6D,
+    0x43, 0x18, 0xFC, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xF7, 0x6A, 0x02, 0x63, 0x3F, 0x16, 0xFB, 0x00, 0x01, 0x1A, 0x36, 0xF7,
+    0x40, 0x02, 0x3D, 0x27, 0x06, 0xFA, 0x00, 0x00, 0x0F, 0xF7, 0x15, 0x01, 0x14, 0x05, 0x81, 0x00, 0x01, 0x00, 0x00, 0xE7,
+    0x00, 0x05, 0x06, 0x11, 0x12, 0x12, 0x10, 0x0C, 0xFE, 0x12, 0x00, 0x0C, 0xF7, 0x00, 0x06, 0x0B, 0x2A, 0x3B, 0x3C, 0x3C,
+    0x3A, 0x33, 0xFE, 0x3C, 0x01, 0x34, 0x1A, 0xF8, 0x00, 0x06, 0x1D, 0x45, 0x65, 0x67, 0x67, 0x62, 0x54, 0xFE, 0x67, 0x02,
+    0x55, 0x2F, 0x06, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x91, 0x91, 0x6F, 0x5C, 0x87, 0x91, 0x88, 0x5D, 0x33, 0x08, 0xF9,
+    0x00, 0x0C, 0x20, 0x4B, 0x75, 0xA0, 0x9A, 0x6F, 0x5C, 0x87, 0xA9, 0x88, 0x5D, 0x33, 0x08, 0xFA, 0x00, 0x07, 0x0B, 0x23,
+    0x4B, 0x75, 0x7E, 0x7E, 0x6F, 0x5C, 0xFE, 0x7E, 0x02, 0x5D, 0x33, 0x17, 0xFA, 0x00, 0x01, 0x26, 0x47, 0xF7, 0x55, 0x02,
+    0x51, 0x35, 0x10, 0xFC, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xF7, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x03, 0x06, 0x31,
+    0x5B, 0x86, 0xF9, 0xAA, 0x03, 0x98, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xFD, 0x7F, 0x01, 0x94, 0xA6,
+    0xFD, 0x7F, 0x02, 0x6D, 0x43, 0x18, 0xFB, 0x00, 0x01, 0x26, 0x47, 0xFE, 0x55, 0x03, 0x69, 0x94, 0xA6, 0x7B, 0xFE, 0x55,
+    0x02, 0x51, 0x35, 0x10, 0xFB, 0x00, 0x0D, 0x0B, 0x23, 0x2A, 0x2A, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x2A, 0x2A, 0x28,
+    0x17, 0xF7, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6,
+    0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69,
+    0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14,
+    0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00,
+    0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF6, 0x00, 0x0C, 0x0F, 0x15, 0x15, 0x3F, 0x69, 0x94, 0xA6, 0x7B,
+    0x51, 0x26, 0x15, 0x13, 0x05, 0xFA, 0x00, 0x01, 0x1A, 0x36, 0xFE, 0x3F, 0x09, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x3F, 0x3F,
+    0x3D, 0x27, 0x06, 0xFC, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xFD, 0x6A, 0x02, 0x94, 0xA6, 0x7B, 0xFE, 0x6A, 0x02, 0x63, 0x3F,
+    0x16, 0xFC, 0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xFE, 0x94, 0x01, 0x9D, 0xAB, 0xFD, 0x94, 0x02, 0x6D, 0x43, 0x18, 0xFC,
+    0x00, 0x03, 0x06, 0x31, 0x5B, 0x86, 0xF8, 0x95, 0x02, 0x6D, 0x43, 0x18, 0xFC, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xF7, 0x6A,
+    0x02, 0x63, 0x3F, 0x16, 0xFB, 0x00, 0x01, 0x1A, 0x36, 0xF7, 0x40, 0x02, 0x3D, 0x27, 0x06, 0xFA, 0x00, 0x00, 0x0F, 0xF7,
+    0x15, 0x01, 0x14, 0x05, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x01, 0x05, 0x1F, 0xFC, 0x2A, 0x03, 0x28, 0x22, 0x19,
+    0x0D, 0xF7, 0x00, 0x01, 0x1E, 0x41, 0xFD, 0x55, 0x06, 0x54, 0x52, 0x4C, 0x42, 0x34, 0x23, 0x0C, 0xF9, 0x00, 0x02, 0x28,
+    0x53, 0x7D, 0xFD, 0x7F, 0x06, 0x7C, 0x76, 0x6B, 0x5B, 0x47, 0x2F, 0x12, 0xFA, 0x00, 0x0E, 0x28, 0x53, 0x7D, 0xA8, 0xAA,
+    0xA8, 0xA9, 0xA6, 0x9F, 0x93, 0x82, 0x6A, 0x4E, 0x30, 0x0E, 0xFB, 0x00, 0x0E, 0x28, 0x53, 0x7D, 0xA8, 0x94, 0x7D, 0x7E,
+    0x82, 0x8B, 0x9A, 0xA5, 0x8A, 0x6C, 0x49, 0x26, 0xFB, 0x00, 0x0F, 0x28, 0x53, 0x7D, 0xA8, 0x94, 0x6A, 0x54, 0x58, 0x62,
+    0x76, 0x92, 0xA7, 0x85, 0x5F, 0x39, 0x13, 0xFC, 0x00, 0x0F, 0x28, 0x53, 0x7D, 0xA8, 0x94, 0x6A, 0x3F, 0x2E, 0x3B, 0x56,
+    0x7A, 0xA0, 0x98, 0x71, 0x49, 0x21, 0xFD, 0x00, 0x2F, 0x03, 0x28, 0x53, 0x7D, 0xA8, 0x94, 0x6A, 0x3F, 0x18, 0x1B, 0x42,
+    0x6A, 0x93, 0xA7, 0x7E, 0x55, 0x2B, 0x02, 0x00, 0x00, 0x01, 0x24, 0x3D, 0x53, 0x7D, 0xA8, 0x94, 0x6A, 0x42, 0x42, 0x40,
+    0x36, 0x60, 0x8A, 0xB1, 0x88, 0x5E, 0x34, 0x09, 0x00, 0x00, 0x10, 0x39, 0x60, 0x6D, 0x7D, 0xA8, 0x94, 0xFE, 0x6D, 0x11,
+    0x65, 0x40, 0x5A, 0x84, 0xAF, 0x8D, 0x63, 0x39, 0x0E, 0x00, 0x00, 0x11, 0x3C, 0x66, 0x91, 0x97, 0xAE, 0x9F, 0xFE, 0x97,
+    0x11, 0x6E, 0x43, 0x57, 0x82, 0xAC, 0x90, 0x65, 0x3B, 0x10, 0x00, 0x00, 0x11, 0x3C, 0x66, 0x88, 0x88, 0xA8, 0x96, 0xFE,
+    0x88, 0x1D, 0x6E, 0x43, 0x57, 0x81, 0xAC, 0x91, 0x66, 0x3C, 0x11, 0x00, 0x00, 0x0C, 0x34, 0x55, 0x5D, 0x7D, 0xA8, 0x94,
+    0x6A, 0x5D, 0x5D, 0x59, 0x3A, 0x58, 0x82, 0xAD, 0x8F, 0x65, 0x3A, 0x10, 0xFE, 0x00, 0x11, 0x19, 0x2F, 0x53, 0x7D, 0xA8,
+    0x94, 0x6A, 0x3F, 0x33, 0x31, 0x32, 0x5C, 0x86, 0xB1, 0x8B, 0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x28, 0x53, 0x7D, 0xA8,
+    0x94, 0x6A, 0x3F, 0x15, 0x12, 0x3B, 0x64, 0x8D, 0xAD, 0x83, 0x5A, 0x30, 0x07, 0xFD, 0x00, 0x0F, 0x28, 0x53, 0x7D, 0xA8,
+    0x94, 0x6A, 0x3F, 0x19, 0x2A, 0x4B, 0x71, 0x98, 0xA0, 0x78, 0x50, 0x27, 0xFC, 0x00, 0x0F, 0x28, 0x53, 0x7D, 0xA8, 0x94,
+    0x6A, 0x3F, 0x43, 0x4F, 0x65, 0x85, 0xA9, 0x8F, 0x69, 0x42, 0x1A, 0xFC, 0x00, 0x0F, 0x28, 0x53, 0x7D, 0xA8, 0x94, 0x6A,
+    0x69, 0x6D, 0x76, 0x88, 0xA1, 0x9A, 0x78, 0x55, 0x30, 0x0A, 0xFC, 0x00, 0x0E, 0x28, 0x53, 0x7D, 0xA8, 0x9B, 0x92, 0x93,
+    0x97, 0x9F, 0xA7, 0x93, 0x7B, 0x5E, 0x3D, 0x1B, 0xFB, 0x00, 0x02, 0x28, 0x53, 0x7D, 0xFE, 0x95, 0x08, 0x94, 0x91, 0x8B,
+    0x7F, 0x6E, 0x59, 0x3F, 0x22, 0x01, 0xFB, 0x00, 0x01, 0x25, 0x4E, 0xFC, 0x6A, 0x06, 0x67, 0x61, 0x56, 0x48, 0x35, 0x1E,
+    0x03, 0xFA, 0x00, 0x01, 0x13, 0x31, 0xFD, 0x40, 0x05, 0x3F, 0x3D, 0x37, 0x2D, 0x21, 0x0F, 0xF7, 0x00, 0x00, 0x0C, 0xFC,
+    0x15, 0x02, 0x13, 0x0D, 0x04, 0x81, 0x00, 0xFA, 0x00, 0xE6, 0x00, 0x09, 0x09, 0x17, 0x1C, 0x18, 0x0D, 0x11, 0x1B, 0x1C,
+    0x1A, 0x0B, 0xF7, 0x00, 0x0B, 0x16, 0x2F, 0x40, 0x46, 0x42, 0x35, 0x35, 0x46, 0x46, 0x43, 0x2C, 0x0A, 0xF9, 0x00, 0x0C,
+    0x10, 0x33, 0x52, 0x68, 0x70, 0x6B, 0x5B, 0x4E, 0x70, 0x71, 0x68, 0x42, 0x18, 0xF9, 0x00, 0x0C, 0x23, 0x4A, 0x6F, 0x8D,
+    0x9B, 0x94, 0x81, 0x6D, 0x7F, 0x95, 0x6B, 0x41, 0x17, 0xFA, 0x00, 0x0D, 0x03, 0x2D, 0x57, 0x80, 0x95, 0x76, 0x80, 0x96,
+    0x96, 0x9D, 0x84, 0x5F, 0x38, 0x0F, 0xFB, 0x00, 0x0F, 0x03, 0x1E, 0x30, 0x5B, 0x7C, 0x7C, 0x63, 0x5C, 0x6F, 0x7B, 0x79,
+    0x66, 0x48, 0x2A, 0x26, 0x10, 0xFC, 0x00, 0x02, 0x1B, 0x3F, 0x54, 0xFE, 0x55, 0x04, 0x49, 0x36, 0x48, 0x51, 0x4F, 0xFE,
+    0x55, 0x02, 0x4C, 0x2C, 0x06, 0xFD, 0x00, 0x02, 0x25, 0x50, 0x7A, 0xFE, 0x7F, 0x0A, 0x5D, 0x36, 0x1F, 0x29, 0x54, 0x7E,
+    0x7F, 0x7F, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0xAA, 0x95, 0x6D, 0x46, 0x1F, 0x29, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0xB1, 0xA5, 0x7D, 0x56, 0x2F, 0x29, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x92, 0x98, 0x8E, 0x66, 0x3F, 0x29, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x88, 0x9E, 0x76, 0x4F, 0x29, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x78, 0x9F, 0x86, 0x5F, 0x38, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x68, 0x8F, 0x97, 0x6F, 0x48, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x7F, 0xA6, 0x7F, 0x58, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x6F, 0x96, 0x90, 0x68, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x5F, 0x86, 0xA0, 0x78, 0x54, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x4F, 0x76, 0x9D, 0x88, 0x61, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x3E, 0x66, 0x8D, 0x99, 0x71, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x56, 0x7D, 0xA4, 0x81, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x46, 0x6D, 0x94, 0x92, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x35, 0x5D, 0x84, 0xA2, 0x7E,
+    0xA9, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x25, 0x4D, 0x74, 0x9B, 0x99,
+    0xB0, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0xA5, 0x91, 0x67, 0x3C, 0x15, 0x3C, 0x64, 0x8B, 0xB2,
+    0xB8, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x50, 0x7A, 0x95, 0x91, 0x67, 0x3C, 0x12, 0x2C, 0x54, 0x7B, 0x95,
+    0x95, 0x8D, 0x63, 0x38, 0x0E, 0xFD, 0x00, 0x01, 0x23, 0x4B, 0xFE, 0x6A, 0x05, 0x5F, 0x39, 0x10, 0x1C, 0x44, 0x66, 0xFE,
+    0x6A, 0x02, 0x5C, 0x35, 0x0C, 0xFD, 0x00, 0x01, 0x11, 0x30, 0xFE, 0x40, 0x05, 0x3B, 0x23, 0x00, 0x0A, 0x2B, 0x3E, 0xFE,
+    0x40, 0x01, 0x3A, 0x20, 0xFB, 0x00, 0x00, 0x0B, 0xFE, 0x15, 0x05, 0x12, 0x02, 0x00, 0x00, 0x07, 0x14, 0xFE, 0x15, 0x00,
+    0x11, 0x81, 0x00, 0x01, 0x00, 0x00, 0xE7, 0x00, 0x01, 0x02, 0x18, 0xFE, 0x20, 0x01, 0x18, 0x02, 0xF3, 0x00, 0x01, 0x1E,
+    0x3E, 0xFE, 0x4B, 0x01, 0x3E, 0x1E, 0xF4, 0x00, 0x02, 0x03, 0x2D, 0x57, 0xFE, 0x75, 0x02, 0x5A, 0x38, 0x16, 0xF4, 0x00,
+    0x08, 0x28, 0x4D, 0x6D, 0x8D, 0x95, 0x73, 0x51, 0x2F, 0x0D, 0xF5, 0x00, 0x09, 0x11, 0x31, 0x52, 0x72, 0x92, 0x8D, 0x6A,
+    0x48, 0x26, 0x03, 0xF5, 0x00, 0x08, 0x16, 0x36, 0x56, 0x76, 0x8E, 0x84, 0x62, 0x39, 0x0F, 0xF7, 0x00, 0x0B, 0x04, 0x21,
+    0x39, 0x4C, 0x59, 0x60, 0x63, 0x63, 0x59, 0x43, 0x2C, 0x11, 0xF8, 0x00, 0x0C, 0x21, 0x40, 0x5D, 0x73, 0x83, 0x8B, 0x8C,
+    0x87, 0x7A, 0x67, 0x4D, 0x30, 0x0E, 0xFA, 0x00, 0x0E, 0x16, 0x3B, 0x5D, 0x7C, 0x97, 0xAA, 0x9C, 0x9A, 0xA2, 0xA1, 0x89,
+    0x6C, 0x4A, 0x27, 0x01, 0xFC, 0x00, 0x0F, 0x02, 0x2A, 0x50, 0x75, 0x98, 0xA2, 0x85, 0x73, 0x70, 0x7B, 0x94, 0xA7, 0x86,
+    0x60, 0x3B, 0x14, 0xFC, 0x00, 0x0F, 0x11, 0x39, 0x60, 0x88, 0xAF, 0x8A, 0x66, 0x4B, 0x46, 0x58, 0x79, 0x9F, 0x9A, 0x72,
+    0x4B, 0x23, 0xFC, 0x00, 0x10, 0x1B, 0x45, 0x6E, 0x97, 0xA3, 0x7A, 0x52, 0x2B, 0x1C, 0x40, 0x68, 0x90, 0xA9, 0x80, 0x57,
+    0x2E, 0x05, 0xFD, 0x00, 0x10, 0x24, 0x4D, 0x77, 0xA1, 0x9A, 0x70, 0x46, 0x1D, 0x0A, 0x33, 0x5D, 0x87, 0xB1, 0x8A, 0x60,
+    0x36, 0x0C, 0xFD, 0x00, 0x10, 0x2A, 0x54, 0x7E, 0xA8, 0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2C, 0x57, 0x81, 0xAB, 0x91, 0x67,
+    0x3D, 0x12, 0xFE, 0x00, 0x11, 0x03, 0x2D, 0x58, 0x82, 0xAC, 0x90, 0x66, 0x3C, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x95,
+    0x6B, 0x40, 0x16, 0xFE, 0x00, 0x11, 0x05, 0x2F, 0x5A, 0x84, 0xAF, 0x8F, 0x64, 0x3A, 0x0F, 0x00, 0x27, 0x51, 0x7C, 0xA6,
+    0x97, 0x6D, 0x42, 0x18, 0xFE, 0x00, 0x11, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8E, 0x64, 0x39, 0x0F, 0x00, 0x26, 0x51, 0x7B,
+    0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x04, 0x2F, 0x59, 0x84, 0xAE, 0x8F, 0x65, 0x3A, 0x10, 0x00, 0x27, 0x52,
+    0x7C, 0xA6, 0x97, 0x6C, 0x42, 0x17, 0xFE, 0x00, 0x11, 0x01, 0x2C, 0x56, 0x80, 0xAB, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A,
+    0x54, 0x7F, 0xA9, 0x93, 0x69, 0x3F, 0x14, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7B, 0xA5, 0x96, 0x6C, 0x42, 0x18, 0x05, 0x2F,
+    0x59, 0x83, 0xAD, 0x8E, 0x64, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9D, 0x9D, 0x74, 0x4B, 0x22, 0x10, 0x38,
+    0x61, 0x8A, 0xAF, 0x86, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x0F, 0x17, 0x40, 0x69, 0x91, 0xA8, 0x81, 0x5A, 0x38, 0x2F, 0x49,
+    0x6F, 0x96, 0xA2, 0x7A, 0x52, 0x29, 0xFC, 0x00, 0x0F, 0x0A, 0x32, 0x5A, 0x80, 0xA5, 0x94, 0x73, 0x5D, 0x5A, 0x68, 0x85,
+    0xA8, 0x90, 0x6B, 0x43, 0x1C, 0xFB, 0x00, 0x0E, 0x21, 0x46, 0x6B, 0x8C, 0xAA, 0x96, 0x86, 0x84, 0x8D, 0xA3, 0x9A, 0x79,
+    0x57, 0x31, 0x0C, 0xFB, 0x00, 0x0D, 0x0D, 0x2F, 0x51, 0x6E, 0x87, 0x98, 0xA1, 0xA2, 0x9D, 0x8F, 0x7A, 0x5E, 0x3E, 0x1C,
+    0xF9, 0x00, 0x0C, 0x15, 0x32, 0x4C, 0x61, 0x6F, 0x77, 0x78, 0x73, 0x68, 0x56, 0x3E, 0x22, 0x02, 0xF8, 0x00, 0x0A, 0x11,
+    0x28, 0x3A, 0x46, 0x4C, 0x4E, 0x4A, 0x40, 0x31, 0x1B, 0x02, 0xF6, 0x00, 0x07, 0x02, 0x12, 0x1C, 0x22, 0x23, 0x20, 0x17,
+    0x09, 0x81, 0x00, 0xFC, 0x00, 0xE3, 0x00, 0x05, 0x10, 0x1F, 0x20, 0x20, 0x1E, 0x0E, 0xF3, 0x00, 0x07, 0x0F, 0x31, 0x48,
+    0x4B, 0x4B, 0x47, 0x2E, 0x0B, 0xF5, 0x00, 0x08, 0x06, 0x28, 0x4A, 0x6C, 0x75, 0x75, 0x6A, 0x41, 0x17, 0xF5, 0x00, 0x08,
+    0x20, 0x42, 0x64, 0x86, 0x9C, 0x7C, 0x5C, 0x3A, 0x13, 0xF6, 0x00, 0x08, 0x17, 0x39, 0x5B, 0x7D, 0x9F, 0x81, 0x60, 0x40,
+    0x20, 0xF5, 0x00, 0x08, 0x26, 0x50, 0x75, 0x8E, 0x85, 0x65, 0x45, 0x25, 0x08, 0xF7, 0x00, 0x03, 0x04, 0x21, 0x39, 0x4C,
+    0xFE, 0x63, 0x04, 0x5D, 0x53, 0x43, 0x2C, 0x11, 0xF8, 0x00, 0x0C, 0x21, 0x40, 0x5D, 0x73, 0x83, 0x8B, 0x8C, 0x87, 0x7A,
+    0x67, 0x4D, 0x30, 0x0E, 0xFA, 0x00, 0x0E, 0x16, 0x3B, 0x5D, 0x7C, 0x97, 0xAA, 0x9C, 0x9A, 0xA2, 0xA1, 0x89, 0x6C, 0x4A,
+    0x27, 0x01, 0xFC, 0x00, 0x0F, 0x02, 0x2A, 0x50, 0x75, 0x98, 0xA2, 0x85, 0x73, 0x70, 0x7B, 0x94, 0xA7, 0x86, 0x60, 0x3B,
+    0x14, 0xFC, 0x00, 0x0F, 0x11, 0x39, 0x60, 0x88, 0xAF, 0x8A, 0x66, 0x4B, 0x46, 0x58, 0x79, 0x9F, 0x9A, 0x72, 0x4B, 0x23,
+    0xFC, 0x00, 0x10, 0x1B, 0x45, 0x6E, 0x97, 0xA3, 0x7A, 0x52, 0x2B, 0x1C, 0x40, 0x68, 0x90, 0xA9, 0x80, 0x57, 0x2E, 0x05,
+    0xFD, 0x00, 0x10, 0x24, 0x4D, 0x77, 0xA1, 0x9A, 0x70, 0x46, 0x1D, 0x0A, 0x33, 0x5D, 0x87, 0xB1, 0x8A, 0x60, 0x36, 0x0C,
+    0xFD, 0x00, 0x10, 0x2A, 0x54, 0x7E, 0xA8, 0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2C, 0x57, 0x81, 0xAB, 0x91, 0x67, 0x3D, 0x12,
+    0xFE, 0x00, 0x11, 0x03, 0x2D, 0x58, 0x82, 0xAC, 0x90, 0x66, 0x3C, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x95, 0x6B, 0x40,
+    0x16, 0xFE, 0x00, 0x11, 0x05, 0x2F, 0x5A, 0x84, 0xAF, 0x8F, 0x64, 0x3A, 0x0F, 0x00, 0x27, 0x51, 0x7C, 0xA6, 0x97, 0x6D,
+    0x42, 0x18, 0xFE, 0x00, 0x11, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8E, 0x64, 0x39, 0x0F, 0x00, 0x26, 0x51, 0x7B, 0xA6, 0x98,
+    0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x04, 0x2F, 0x59, 0x84, 0xAE, 0x8F, 0x65, 0x3A, 0x10, 0x00, 0x27, 0x52, 0x7C, 0xA6,
+    0x97, 0x6C, 0x42, 0x17, 0xFE, 0x00, 0x11, 0x01, 0x2C, 0x56, 0x80, 0xAB, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F,
+    0xA9, 0x93, 0x69, 0x3F, 0x14, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7B, 0xA5, 0x96, 0x6C, 0x42, 0x18, 0x05, 0x2F, 0x59, 0x83,
+    0xAD, 0x8E, 0x64, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9D, 0x9D, 0x74, 0x4B, 0x22, 0x10, 0x38, 0x61, 0x8A,
+    0xAF, 0x86, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x0F, 0x17, 0x40, 0x69, 0x91, 0xA8, 0x81, 0x5A, 0x38, 0x2F, 0x49, 0x6F, 0x96,
+    0xA2, 0x7A, 0x52, 0x29, 0xFC, 0x00, 0x0F, 0x0A, 0x32, 0x5A, 0x80, 0xA5, 0x94, 0x73, 0x5D, 0x5A, 0x68, 0x85, 0xA8, 0x90,
+    0x6B, 0x43, 0x1C, 0xFB, 0x00, 0x0E, 0x21, 0x46, 0x6B, 0x8C, 0xAA, 0x96, 0x86, 0x84, 0x8D, 0xA3, 0x9A, 0x79, 0x57, 0x31,
+    0x0C, 0xFB, 0x00, 0x0D, 0x0D, 0x2F, 0x51, 0x6E, 0x87, 0x98, 0xA1, 0xA2, 0x9D, 0x8F, 0x7A, 0x5E, 0x3E, 0x1C, 0xF9, 0x00,
+    0x0C, 0x15, 0x32, 0x4C, 0x61, 0x6F, 0x77, 0x78, 0x73, 0x68, 0x56, 0x3E, 0x22, 0x02, 0xF8, 0x00, 0x0A, 0x11, 0x28, 0x3A,
+    0x46, 0x4C, 0x4E, 0x4A, 0x40, 0x31, 0x1B, 0x02, 0xF6, 0x00, 0x07, 0x02, 0x12, 0x1C, 0x22, 0x23, 0x20, 0x17, 0x09, 0x81,
+    0x00, 0xFC, 0x00, 0xE5, 0x00, 0x01, 0x0B, 0x1D, 0xFE, 0x21, 0x00, 0x15, 0xF3, 0x00, 0x07, 0x08, 0x29, 0x45, 0x4C, 0x4C,
+    0x4B, 0x38, 0x17, 0xF5, 0x00, 0x09, 0x01, 0x22, 0x44, 0x65, 0x76, 0x76, 0x74, 0x53, 0x31, 0x10, 0xF6, 0x00, 0x0A, 0x1C,
+    0x3D, 0x5E, 0x7F, 0x9D, 0x90, 0x8E, 0x6D, 0x4C, 0x2B, 0x09, 0xF8, 0x00, 0x0B, 0x14, 0x36, 0x57, 0x79, 0x9A, 0x80, 0x73,
+    0x92, 0x88, 0x66, 0x45, 0x24, 0xF8, 0x00, 0x0C, 0x23, 0x4D, 0x72, 0x8E, 0x83, 0x63, 0x56, 0x75, 0x8E, 0x81, 0x5F, 0x36,
+    0x0C, 0xF9, 0x00, 0x0C, 0x20, 0x47, 0x63, 0x63, 0x62, 0x60, 0x62, 0x5D, 0x63, 0x63, 0x57, 0x32, 0x0A, 0xF9, 0x00, 0x0C,
+    0x21, 0x40, 0x5D, 0x73, 0x83, 0x8B, 0x8C, 0x87, 0x7A, 0x67, 0x4D, 0x30, 0x0E, 0xFA, 0x00, 0x0E, 0x16, 0x3B, 0x5D, 0x7C,
+    0x97, 0xAA, 0x9C, 0x9A, 0xA2, 0xA1, 0x89, 0x6C, 0x4A, 0x27, 0x01, 0xFC, 0x00, 0x0F, 0x02, 0x2A, 0x50, 0x75, 0x98, 0xA2,
+    0x85, 0x73, 0x70, 0x7B, 0x94, 0xA7, 0x86, 0x60, 0x3B, 0x14, 0xFC, 0x00, 0x0F, 0x11, 0x39, 0x60, 0x88, 0xAF, 0x8A, 0x66,
+    0x4B, 0x46, 0x58, 0x79, 0x9F, 0x9A, 0x72, 0x4B, 0x23, 0xFC, 0x00, 0x10, 0x1B, 0x45, 0x6E, 0x97, 0xA3, 0x7A, 0x52, 0x2B,
+    0x1C, 0x40, 0x68, 0x90, 0xA9, 0x80, 0x57, 0x2E, 0x05, 0xFD, 0x00, 0x10, 0x24, 0x4D, 0x77, 0xA1, 0x9A, 0x70, 0x46, 0x1D,
+    0x0A, 0x33, 0x5D, 0x87, 0xB1, 0x8A, 0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x2A, 0x54, 0x7E, 0xA8, 0x94, 0x6A, 0x3F, 0x15,
+    0x02, 0x2C, 0x57, 0x81, 0xAB, 0x91, 0x67, 0x3D, 0x12, 0xFE, 0x00, 0x11, 0x03, 0x2D, 0x58, 0x82, 0xAC, 0x90, 0x66, 0x3C,
+    0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x11, 0x05, 0x2F, 0x5A, 0x84, 0xAF, 0x8F, 0x64,
+    0x3A, 0x0F, 0x00, 0x27, 0x51, 0x7C, 0xA6, 0x97, 0x6D, 0x42, 0x18, 0xFE, 0x00, 0x11, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8E,
+    0x64, 0x39, 0x0F, 0x00, 0x26, 0x51, 0x7B, 0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x04, 0x2F, 0x59, 0x84, 0xAE,
+    0x8F, 0x65, 0x3A, 0x10, 0x00, 0x27, 0x52, 0x7C, 0xA6, 0x97, 0x6C, 0x42, 0x17, 0xFE, 0x00, 0x11, 0x01, 0x2C, 0x56, 0x80,
+    0xAB, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F, 0xA9, 0x93, 0x69, 0x3F, 0x14, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7B,
+    0xA5, 0x96, 0x6C, 0x42, 0x18, 0x05, 0x2F, 0x59, 0x83, 0xAD, 0x8E, 0x64, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74,
+    0x9D, 0x9D, 0x74, 0x4B, 0x22, 0x10, 0x38, 0x61, 0x8A, 0xAF, 0x86, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x0F, 0x17, 0x40, 0x69,
+    0x91, 0xA8, 0x81, 0x5A, 0x38, 0x2F, 0x49, 0x6F, 0x96, 0xA2, 0x7A, 0x52, 0x29, 0xFC, 0x00, 0x0F, 0x0A, 0x32, 0x5A, 0x80,
+    0xA5, 0x94, 0x73, 0x5D, 0x5A, 0x68, 0x85, 0xA8, 0x90, 0x6B, 0x43, 0x1C, 0xFB, 0x00, 0x0E, 0x21, 0x46, 0x6B, 0x8C, 0xAA,
+    0x96, 0x86, 0x84, 0x8D, 0xA3, 0x9A, 0x79, 0x57, 0x31, 0x0C, 0xFB, 0x00, 0x0D, 0x0D, 0x2F, 0x51, 0x6E, 0x87, 0x98, 0xA1,
+    0xA2, 0x9D, 0x8F, 0x7A, 0x5E, 0x3E, 0x1C, 0xF9, 0x00, 0x0C, 0x15, 0x32, 0x4C, 0x61, 0x6F, 0x77, 0x78, 0x73, 0x68, 0x56,
+    0x3E, 0x22, 0x02, 0xF8, 0x00, 0x0A, 0x11, 0x28, 0x3A, 0x46, 0x4C, 0x4E, 0x4A, 0x40, 0x31, 0x1B, 0x02, 0xF6, 0x00, 0x07,
+    0x02, 0x12, 0x1C, 0x22, 0x23, 0x20, 0x17, 0x09, 0x81, 0x00, 0xFC, 0x00, 0xE6, 0x00, 0x09, 0x07, 0x15, 0x1A, 0x16, 0x0C,
+    0x0F, 0x19, 0x1A, 0x18, 0x09, 0xF7, 0x00, 0x0B, 0x14, 0x2D, 0x3E, 0x44, 0x40, 0x33, 0x33, 0x44, 0x44, 0x42, 0x2B, 0x09,
+    0xF9, 0x00, 0x0C, 0x0F, 0x32, 0x50, 0x66, 0x6E, 0x6A, 0x59, 0x4D, 0x6E, 0x6F, 0x67, 0x41, 0x18, 0xF9, 0x00, 0x0C, 0x22,
+    0x49, 0x6D, 0x8C, 0x99, 0x92, 0x7F, 0x6B, 0x7E, 0x96, 0x6C, 0x42, 0x17, 0xFA, 0x00, 0x0D, 0x03, 0x2D, 0x57, 0x80, 0x96,
+    0x77, 0x82, 0x97, 0x94, 0x9B, 0x85, 0x60, 0x38, 0x10, 0xFA, 0x00, 0x0D, 0x06, 0x30, 0x5B, 0x7E, 0x7E, 0x63, 0x5D, 0x71,
+    0x7D, 0x7B, 0x68, 0x4A, 0x27, 0x01, 0xF9, 0x00, 0x0B, 0x25, 0x46, 0x54, 0x54, 0x59, 0x60, 0x62, 0x5D, 0x53, 0x44, 0x2C,
+    0x11, 0xF8, 0x00, 0x0C, 0x21, 0x40, 0x5D, 0x73, 0x83, 0x8B, 0x8C, 0x87, 0x7A, 0x67, 0x4D, 0x30, 0x0E, 0xFA, 0x00, 0x0E,
+    0x16, 0x3B, 0x5D, 0x7C, 0x97, 0xAA, 0x9C, 0x9A, 0xA2, 0xA1, 0x89, 0x6C, 0x4A, 0x27, 0x01, 0xFC, 0x00, 0x0F, 0x02, 0x2A,
+    0x50, 0x75, 0x98, 0xA2, 0x85, 0x73, 0x70, 0x7B, 0x94, 0xA7, 0x86, 0x60, 0x3B, 0x14, 0xFC, 0x00, 0x0F, 0x11, 0x39, 0x60,
+    0x88, 0xAF, 0x8A, 0x66, 0x4B, 0x46, 0x58, 0x79, 0x9F, 0x9A, 0x72, 0x4B, 0x23, 0xFC, 0x00, 0x10, 0x1B, 0x45, 0x6E, 0x97,
+    0xA3, 0x7A, 0x52, 0x2B, 0x1C, 0x40, 0x68, 0x90, 0xA9, 0x80, 0x57, 0x2E, 0x05, 0xFD, 0x00, 0x10, 0x24, 0x4D, 0x77, 0xA1,
+    0x9A, 0x70, 0x46, 0x1D, 0x0A, 0x33, 0x5D, 0x87, 0xB1, 0x8A, 0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x2A, 0x54, 0x7E, 0xA8,
+    0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2C, 0x57, 0x81, 0xAB, 0x91, 0x67, 0x3D, 0x12, 0xFE, 0x00, 0x11, 0x03, 0x2D, 0x58, 0x82,
+    0xAC, 0x90, 0x66, 0x3C, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x11, 0x05, 0x2F, 0x5A,
+    0x84, 0xAF, 0x8F, 0x64, 0x3A, 0x0F, 0x00, 0x27, 0x51, 0x7C, 0xA6, 0x97, 0x6D, 0x42, 0x18, 0xFE, 0x00, 0x11, 0x05, 0x30,
+    0x5A, 0x85, 0xAF, 0x8E, 0x64, 0x39, 0x0F, 0x00, 0x26, 0x51, 0x7B, 0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x04,
+    0x2F, 0x59, 0x84, 0xAE, 0x8F, 0x65, 0x3A, 0x10, 0x00, 0x27, 0x52, 0x7C, 0xA6, 0x97, 0x6C, 0x42, 0x17, 0xFE, 0x00, 0x11,
+    0x01, 0x2C, 0x56, 0x80, 0xAB, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F, 0xA9, 0x93, 0x69, 0x3F, 0x14, 0xFD, 0x00,
+    0x10, 0x27, 0x51, 0x7B, 0xA5, 0x96, 0x6C, 0x42, 0x18, 0x05, 0x2F, 0x59, 0x83, 0xAD, 0x8E, 0x64, 0x3A, 0x10, 0xFD, 0x00,
+    0x10, 0x20, 0x4A, 0x74, 0x9D, 0x9D, 0x74, 0x4B, 0x22, 0x10, 0x38, 0x61, 0x8A, 0xAF, 0x86, 0x5D, 0x33, 0x09, 0xFD, 0x00,
+    0x0F, 0x17, 0x40, 0x69, 0x91, 0xA8, 0x81, 0x5A, 0x38, 0x2F, 0x49, 0x6F, 0x96, 0xA2, 0x7A, 0x52, 0x29, 0xFC, 0x00, 0x0F,
+    0x0A, 0x32, 0x5A, 0x80, 0xA5, 0x94, 0x73, 0x5D, 0x5A, 0x68, 0x85, 0xA8, 0x90, 0x6B, 0x43, 0x1C, 0xFB, 0x00, 0x0E, 0x21,
+    0x46, 0x6B, 0x8C, 0xAA, 0x96, 0x86, 0x84, 0x8D, 0xA3, 0x9A, 0x79, 0x57, 0x31, 0x0C, 0xFB, 0x00, 0x0D, 0x0D, 0x2F, 0x51,
+    0x6E, 0x87, 0x98, 0xA1, 0xA2, 0x9D, 0x8F, 0x7A, 0x5E, 0x3E, 0x1C, 0xF9, 0x00, 0x0C, 0x15, 0x32, 0x4C, 0x61, 0x6F, 0x77,
+    0x78, 0x73, 0x68, 0x56, 0x3E, 0x22, 0x02, 0xF8, 0x00, 0x0A, 0x11, 0x28, 0x3A, 0x46, 0x4C, 0x4E, 0x4A, 0x40, 0x31, 0x1B,
+    0x02, 0xF6, 0x00, 0x07, 0x02, 0x12, 0x1C, 0x22, 0x23, 0x20, 0x17, 0x09, 0x81, 0x00, 0xFC, 0x00, 0xE7, 0x00, 0x05, 0x06,
+    0x11, 0x12, 0x12, 0x10, 0x0C, 0xFE, 0x12, 0x00, 0x0C, 0xF7, 0x00, 0x06, 0x0B, 0x2A, 0x3B, 0x3C, 0x3C, 0x3A, 0x33, 0xFE,
+    0x3C, 0x01, 0x34, 0x1A, 0xF8, 0x00, 0x06, 0x1D, 0x45, 0x65, 0x67, 0x67, 0x62, 0x54, 0xFE, 0x67, 0x02, 0x55, 0x2F, 0x06,
+    0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x91, 0x91, 0x6F, 0x5C, 0x87, 0x91, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x0C, 0x20,
+    0x4B, 0x75, 0xA0, 0x9A, 0x6F, 0x5C, 0x87, 0xA9, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x06, 0x20, 0x4B, 0x75, 0x7E, 0x7E,
+    0x6F, 0x5C, 0xFE, 0x7E, 0x02, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x0C, 0x17, 0x3B, 0x52, 0x54, 0x59, 0x60, 0x62, 0x5D, 0x54,
+    0x54, 0x48, 0x27, 0x01, 0xF9, 0x00, 0x0C, 0x21, 0x40, 0x5D, 0x73, 0x83, 0x8B, 0x8C, 0x87, 0x7A, 0x67, 0x4D, 0x30, 0x0E,
+    0xFA, 0x00, 0x0E, 0x16, 0x3B, 0x5D, 0x7C, 0x97, 0xAA, 0x9C, 0x9A, 0xA2, 0xA1, 0x89, 0x6C, 0x4A, 0x27, 0x01, 0xFC, 0x00,
+    0x0F, 0x02, 0x2A, 0x50, 0x75, 0x98, 0xA2, 0x85, 0x73, 0x70, 0x7B, 0x94, 0xA7, 0x86, 0x60, 0x3B, 0x14, 0xFC, 0x00, 0x0F,
+    0x11, 0x39, 0x60, 0x88, 0xAF, 0x8A, 0x66, 0x4B, 0x46, 0x58, 0x79, 0x9F, 0x9A, 0x72, 0x4B, 0x23, 0xFC, 0x00, 0x10, 0x1B,
+    0x45, 0x6E, 0x97, 0xA3, 0x7A, 0x52, 0x2B, 0x1C, 0x40, 0x68, 0x90, 0xA9, 0x80, 0x57, 0x2E, 0x05, 0xFD, 0x00, 0x10, 0x24,
+    0x4D, 0x77, 0xA1, 0x9A, 0x70, 0x46, 0x1D, 0x0A, 0x33, 0x5D, 0x87, 0xB1, 0x8A, 0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x2A,
+    0x54, 0x7E, 0xA8, 0x94, 0x6A, 0x3F, 0x15, 0x02, 0x2C, 0x57, 0x81, 0xAB, 0x91, 0x67, 0x3D, 0x12, 0xFE, 0x00, 0x11, 0x03,
+    0x2D, 0x58, 0x82, 0xAC, 0x90, 0x66, 0x3C, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x11,
+    0x05, 0x2F, 0x5A, 0x84, 0xAF, 0x8F, 0x64, 0x3A, 0x0F, 0x00, 0x27, 0x51, 0x7C, 0xA6, 0x97, 0x6D, 0x42, 0x18, 0xFE, 0x00,
+    0x11, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8E, 0x64, 0x39, 0x0F, 0x00, 0x26, 0x51, 0x7B, 0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE,
+    0x00, 0x11, 0x04, 0x2F, 0x59, 0x84, 0xAE, 0x8F, 0x65, 0x3A, 0x10, 0x00, 0x27, 0x52, 0x7C, 0xA6, 0x97, 0x6C, 0x42, 0x17,
+    0xFE, 0x00, 0x11, 0x01, 0x2C, 0x56, 0x80, 0xAB, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F, 0xA9, 0x93, 0x69, 0x3F,
+    0x14, 0xFD, 0x00, 0x10, 0x27, 0x51, 0x7B, 0xA5, 0x96, 0x6C, 0x42, 0x18, 0x05, 0x2F, 0x59, 0x83, 0xAD, 0x8E, 0x64, 0x3A,
+    0x10, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9D, 0x9D, 0x74, 0x4B, 0x22, 0x10, 0x38, 0x61, 0x8A, 0xAF, 0x86, 0x5D, 0x33,
+    0x09, 0xFD, 0x00, 0x0F, 0x17, 0x40, 0x69, 0x91, 0xA8, 0x81, 0x5A, 0x38, 0x2F, 0x49, 0x6F, 0x96, 0xA2, 0x7A, 0x52, 0x29,
+    0xFC, 0x00, 0x0F, 0x0A, 0x32, 0x5A, 0x80, 0xA5, 0x94, 0x73, 0x5D, 0x5A, 0x68, 0x85, 0xA8, 0x90, 0x6B, 0x43, 0x1C, 0xFB,
+    0x00, 0x0E, 0x21, 0x46, 0x6B, 0x8C, 0xAA, 0x96, 0x86, 0x84, 0x8D, 0xA3, 0x9A, 0x79, 0x57, 0x31, 0x0C, 0xFB, 0x00, 0x0D,
+    0x0D, 0x2F, 0x51, 0x6E, 0x87, 0x98, 0xA1, 0xA2, 0x9D, 0x8F, 0x7A, 0x5E, 0x3E, 0x1C, 0xF9, 0x00, 0x0C, 0x15, 0x32, 0x4C,
+    0x61, 0x6F, 0x77, 0x78, 0x73, 0x68, 0x56, 0x3E, 0x22, 0x02, 0xF8, 0x00, 0x0A, 0x11, 0x28, 0x3A, 0x46, 0x4C, 0x4E, 0x4A,
+    0x40, 0x31, 0x1B, 0x02, 0xF6, 0x00, 0x07, 0x02, 0x12, 0x1C, 0x22, 0x23, 0x20, 0x17, 0x09, 0x81, 0x00, 0xFC, 0x00, 0x81,
+    0x00, 0xAA, 0x00, 0x02, 0x11, 0x13, 0x05, 0xFC, 0x00, 0x02, 0x0F, 0x14, 0x0A, 0xF9, 0x00, 0x05, 0x03, 0x21, 0x3A, 0x3D,
+    0x28, 0x0A, 0xFE, 0x00, 0x04, 0x1B, 0x36, 0x3F, 0x2E, 0x11, 0xFB, 0x00, 0x0F, 0x02, 0x21, 0x3F, 0x5D, 0x64, 0x46, 0x28,
+    0x0A, 0x00, 0x1B, 0x39, 0x57, 0x68, 0x4D, 0x2F, 0x10, 0xFC, 0x00, 0x10, 0x18, 0x3E, 0x5D, 0x7B, 0x83, 0x65, 0x46, 0x28,
+    0x1B, 0x39, 0x57, 0x75, 0x89, 0x6B, 0x4D, 0x2A, 0x02, 0xFD, 0x00, 0x10, 0x1F, 0x4A, 0x74, 0x92, 0xA1, 0x83, 0x65, 0x46,
+    0x39, 0x57, 0x75, 0x93, 0xA0, 0x82, 0x5D, 0x32, 0x08, 0xFD, 0x00, 0x0F, 0x15, 0x38, 0x56, 0x74, 0x92, 0xA1, 0x83, 0x65,
+    0x57, 0x75, 0x93, 0xA0, 0x82, 0x64, 0x46, 0x25, 0xFB, 0x00, 0x0E, 0x1A, 0x38, 0x56, 0x74, 0x92, 0xA1, 0x83, 0x75, 0x93,
+    0xA0, 0x82, 0x64, 0x46, 0x28, 0x0A, 0xFA, 0x00, 0x0C, 0x1A, 0x38, 0x56, 0x74, 0x92, 0xA1, 0x94, 0xA0, 0x82, 0x64, 0x46,
+    0x28, 0x0A, 0xF8, 0x00, 0x0A, 0x1B, 0x39, 0x57, 0x75, 0x9B, 0xAE, 0x83, 0x65, 0x46, 0x28, 0x0A, 0xF8, 0x00, 0x0C, 0x1B,
+    0x39, 0x57, 0x75, 0x93, 0xA0, 0x93, 0xA1, 0x83, 0x65, 0x46, 0x28, 0x0A, 0xFA, 0x00, 0x0E, 0x1C, 0x39, 0x57, 0x75, 0x93,
+    0xA0, 0x82, 0x75, 0x93, 0xA1, 0x83, 0x65, 0x46, 0x28, 0x0A, 0xFC, 0x00, 0x0F, 0x15, 0x39, 0x58, 0x76, 0x94, 0xA0, 0x82,
+    0x64, 0x57, 0x75, 0x93, 0xA1, 0x83, 0x65, 0x46, 0x25, 0xFC, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x94, 0xA0, 0x82, 0x64, 0x46,
+    0x39, 0x57, 0x75, 0x93, 0xA1, 0x83, 0x5C, 0x32, 0x07, 0xFD, 0x00, 0x10, 0x18, 0x3D, 0x5C, 0x7A, 0x82, 0x64, 0x46, 0x28,
+    0x1B, 0x39, 0x57, 0x75, 0x87, 0x69, 0x4A, 0x28, 0x01, 0xFD, 0x00, 0x0F, 0x01, 0x20, 0x3E, 0x5C, 0x64, 0x46, 0x28, 0x0A,
+    0x00, 0x1B, 0x39, 0x57, 0x67, 0x4B, 0x2D, 0x0E, 0xFB, 0x00, 0x05, 0x02, 0x20, 0x39, 0x3C, 0x28, 0x0A, 0xFE, 0x00, 0x04,
+    0x1B, 0x36, 0x3E, 0x2D, 0x0F, 0xF8, 0x00, 0x02, 0x10, 0x13, 0x05, 0xFC, 0x00, 0x02, 0x0E, 0x13, 0x08, 0x81, 0x00, 0xD4,
+    0x00, 0x90, 0x00, 0x09, 0x06, 0x0C, 0x0D, 0x0A, 0x01, 0x00, 0x10, 0x1F, 0x1D, 0x0B, 0xF8, 0x00, 0x0C, 0x14, 0x25, 0x30,
+    0x36, 0x37, 0x34, 0x2A, 0x1B, 0x31, 0x49, 0x45, 0x2D, 0x13, 0xFB, 0x00, 0x0F, 0x04, 0x21, 0x39, 0x4C, 0x59, 0x60, 0x62,
+    0x5E, 0x53, 0x41, 0x49, 0x6C, 0x68, 0x4F, 0x33, 0x0E, 0xFC, 0x00, 0x0F, 0x21, 0x40, 0x5D, 0x73, 0x83, 0x8B, 0x8C, 0x87,
+    0x7A, 0x66, 0x61, 0x84, 0x8A, 0x6C, 0x42, 0x18, 0xFD, 0x00, 0x10, 0x16, 0x3B, 0x5D, 0x7C, 0x97, 0xAA, 0x9C, 0x9A, 0xA2,
+    0xA0, 0x87, 0x7A, 0x9D, 0x7D, 0x5A, 0x37, 0x11, 0xFE, 0x00, 0x10, 0x02, 0x2A, 0x50, 0x75, 0x98, 0xA2, 0x85, 0x73, 0x6F,
+    0x7B, 0x94, 0xA4, 0x94, 0x87, 0x64, 0x42, 0x1F, 0xFD, 0x00, 0x10, 0x11, 0x39, 0x60, 0x88, 0xAF, 0x8A, 0x66, 0x4B, 0x45,
+    0x58, 0x7A, 0xA1, 0x99, 0x72, 0x4C, 0x29, 0x06, 0xFD, 0x00, 0x10, 0x1B, 0x45, 0x6E, 0x97, 0xA3, 0x7A, 0x52, 0x2B, 0x38,
+    0x5B, 0x7E, 0xA0, 0xA9, 0x80, 0x57, 0x2E, 0x05, 0xFD, 0x00, 0x10, 0x24, 0x4D, 0x77, 0xA1, 0x9B, 0x71, 0x47, 0x2E, 0x50,
+    0x73, 0x96, 0x90, 0xB2, 0x8A, 0x61, 0x37, 0x0D, 0xFD, 0x00, 0x10, 0x2A, 0x54, 0x7E, 0xA8, 0x95, 0x6B, 0x40, 0x46, 0x69,
+    0x8C, 0x8E, 0x80, 0xAB, 0x91, 0x67, 0x3D, 0x13, 0xFE, 0x00, 0x11, 0x03, 0x2D, 0x58, 0x82, 0xAC, 0x91, 0x67, 0x3C, 0x5E,
+    0x81, 0x99, 0x76, 0x7D, 0xA7, 0x95, 0x6B, 0x41, 0x16, 0xFE, 0x00, 0x11, 0x05, 0x2F, 0x5A, 0x84, 0xAF, 0x8F, 0x65, 0x54,
+    0x77, 0x9A, 0x80, 0x5D, 0x7B, 0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x05, 0x30, 0x5A, 0x85, 0xAF, 0x8E, 0x64,
+    0x6C, 0x8F, 0x8B, 0x68, 0x51, 0x7B, 0xA6, 0x98, 0x6D, 0x43, 0x18, 0xFE, 0x00, 0x11, 0x04, 0x2F, 0x59, 0x84, 0xAE, 0x8E,
+    0x64, 0x85, 0x95, 0x72, 0x4F, 0x52, 0x7C, 0xA6, 0x97, 0x6C, 0x42, 0x17, 0xFE, 0x00, 0x11, 0x02, 0x2C, 0x57, 0x81, 0xAC,
+    0x8F, 0x7A, 0x9D, 0x7D, 0x5A, 0x37, 0x54, 0x7F, 0xA9, 0x93, 0x69, 0x3F, 0x14, 0xFD, 0x00, 0x10, 0x28, 0x52, 0x7D, 0xA7,
+    0x93, 0x93, 0x87, 0x64, 0x41, 0x2F, 0x59, 0x83, 0xAD, 0x8E, 0x64, 0x3A, 0x10, 0xFD, 0x00, 0x10, 0x22, 0x4C, 0x76, 0xA0,
+    0xAF, 0x91, 0x6F, 0x4C, 0x29, 0x38, 0x61, 0x8A, 0xAF, 0x86, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x0F, 0x1A, 0x43, 0x6C, 0x95,
+    0xA4, 0x7A, 0x56, 0x36, 0x2F, 0x49, 0x6F, 0x96, 0xA2, 0x7A, 0x52, 0x29, 0xFD, 0x00, 0x10, 0x0B, 0x2E, 0x50, 0x73, 0x96,
+    0xAD, 0x90, 0x71, 0x5D, 0x5A, 0x68, 0x85, 0xA8, 0x90, 0x6B, 0x43, 0x1C, 0xFD, 0x00, 0x10, 0x23, 0x46, 0x69, 0x8C, 0x8F,
+    0x8F, 0xAC, 0x95, 0x86, 0x84, 0x8D, 0xA3, 0x9A, 0x79, 0x57, 0x31, 0x0C, 0xFE, 0x00, 0x10, 0x0F, 0x39, 0x5F, 0x81, 0x99,
+    0x76, 0x70, 0x89, 0x99, 0xA2, 0xA2, 0x9D, 0x8F, 0x7A, 0x5E, 0x3E, 0x1C, 0xFD, 0x00, 0x10, 0x0F, 0x39, 0x5F, 0x78, 0x80,
+    0x5E, 0x4E, 0x63, 0x70, 0x77, 0x78, 0x73, 0x68, 0x56, 0x3E, 0x22, 0x02, 0xFC, 0x00, 0x0E, 0x22, 0x3D, 0x54, 0x61, 0x45,
+    0x2A, 0x3B, 0x47, 0x4D, 0x4E, 0x4A, 0x40, 0x31, 0x1B, 0x02, 0xFB, 0x00, 0x0C, 0x02, 0x19, 0x30, 0x38, 0x28, 0x0A, 0x13,
+    0x1D, 0x23, 0x23, 0x20, 0x17, 0x09, 0xF7, 0x00, 0x02, 0x09, 0x0D, 0x03, 0x89, 0x00, 0xE7, 0x00, 0x01, 0x02, 0x18, 0xFE,
+    0x20, 0x01, 0x18, 0x02, 0xF3, 0x00, 0x01, 0x1E, 0x3E, 0xFE, 0x4B, 0x01, 0x3E, 0x1E, 0xF4, 0x00, 0x02, 0x03, 0x2D, 0x57,
+    0xFE, 0x75, 0x02, 0x5A, 0x38, 0x16, 0xF4, 0x00, 0x08, 0x28, 0x4D, 0x6D, 0x8D, 0x95, 0x73, 0x51, 0x2F, 0x0D, 0xF5, 0x00,
+    0x09, 0x11, 0x31, 0x52, 0x72, 0x92, 0x8D, 0x6A, 0x48, 0x26, 0x03, 0xF8, 0x00, 0x00, 0x1C, 0xFE, 0x2A, 0x0A, 0x36, 0x56,
+    0x76, 0x8E, 0x84, 0x62, 0x39, 0x2A, 0x2A, 0x24, 0x0D, 0xFC, 0x00, 0x0A, 0x18, 0x3C, 0x54, 0x55, 0x55, 0x52, 0x3A, 0x5A,
+    0x63, 0x63, 0x59, 0xFE, 0x55, 0x02, 0x49, 0x28, 0x02, 0xFD, 0x00, 0x0A, 0x21, 0x4C, 0x76, 0x7F, 0x7F, 0x6F, 0x44, 0x35,
+    0x39, 0x39, 0x5B, 0xFE, 0x7F, 0x02, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x0E, 0x31, 0x5B, 0x86, 0xAA, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0xA0, 0x99, 0x6F, 0x44, 0x1A,
+    0x06, 0x31, 0x5B, 0x86, 0xB0, 0x88, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x10, 0x1E, 0x48, 0x73, 0x9D, 0x9A, 0x6F, 0x45, 0x1B,
+    0x07, 0x32, 0x5C, 0x87, 0xB0, 0x85, 0x5B, 0x31, 0x06, 0xFD, 0x00, 0x10, 0x1A, 0x43, 0x6D, 0x97, 0x9E, 0x74, 0x4D, 0x32,
+    0x2F, 0x3E, 0x62, 0x8B, 0xAA, 0x80, 0x56, 0x2C, 0x02, 0xFD, 0x00, 0x0F, 0x12, 0x3B, 0x63, 0x8B, 0xAB, 0x88, 0x6B, 0x5B,
+    0x59, 0x62, 0x7A, 0x9B, 0x9C, 0x75, 0x4D, 0x24, 0xFC, 0x00, 0x0F, 0x05, 0x2C, 0x52, 0x76, 0x96, 0xA6, 0x90, 0x85, 0x83,
+    0x8A, 0x9B, 0xA3, 0x85, 0x63, 0x3D, 0x17, 0xFB, 0x00, 0x0E, 0x18, 0x3B, 0x5A, 0x75, 0x8B, 0x9A, 0xA2, 0xA3, 0x9E, 0x93,
+    0x80, 0x67, 0x49, 0x27, 0x04, 0xFA, 0x00, 0x0C, 0x1E, 0x3A, 0x52, 0x64, 0x71, 0x77, 0x78, 0x74, 0x6B, 0x5B, 0x45, 0x2B,
+    0x0D, 0xF8, 0x00, 0x0A, 0x17, 0x2C, 0x3C, 0x47, 0x4D, 0x4E, 0x4A, 0x42, 0x34, 0x21, 0x0A, 0xF6, 0x00, 0x07, 0x06, 0x14,
+    0x1D, 0x23, 0x23, 0x20, 0x19, 0x0C, 0x81, 0x00, 0xFC, 0x00, 0xE3, 0x00, 0x05, 0x10, 0x1F, 0x20, 0x20, 0x1E, 0x0E, 0xF3,
+    0x00, 0x07, 0x0F, 0x31, 0x48, 0x4B, 0x4B, 0x47, 0x2E, 0x0B, 0xF5, 0x00, 0x08, 0x06, 0x28, 0x4A, 0x6C, 0x75, 0x75, 0x6A,
+    0x41, 0x17, 0xF5, 0x00, 0x08, 0x20, 0x42, 0x64, 0x86, 0x9C, 0x7C, 0x5C, 0x3A, 0x13, 0xF6, 0x00, 0x08, 0x17, 0x39, 0x5B,
+    0x7D, 0x9F, 0x81, 0x60, 0x40, 0x20, 0xF8, 0x00, 0x00, 0x1C, 0xFE, 0x2A, 0x05, 0x50, 0x75, 0x8E, 0x85, 0x65, 0x45, 0xFE,
+    0x2A, 0x01, 0x24, 0x0D, 0xFC, 0x00, 0x05, 0x18, 0x3C, 0x54, 0x55, 0x55, 0x52, 0xFE, 0x63, 0x01, 0x49, 0x48, 0xFE, 0x55,
+    0x02, 0x49, 0x28, 0x02, 0xFD, 0x00, 0x0A, 0x21, 0x4C, 0x76, 0x7F, 0x7F, 0x6F, 0x44, 0x39, 0x39, 0x31, 0x5B, 0xFE, 0x7F,
+    0x02, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x0E, 0x31, 0x5B, 0x86, 0xAA,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x88, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x10, 0x1E, 0x48, 0x73, 0x9D, 0x9A, 0x6F, 0x45, 0x1B, 0x07, 0x32, 0x5C, 0x87, 0xB0,
+    0x85, 0x5B, 0x31, 0x06, 0xFD, 0x00, 0x10, 0x1A, 0x43, 0x6D, 0x97, 0x9E, 0x74, 0x4D, 0x32, 0x2F, 0x3E, 0x62, 0x8B, 0xAA,
+    0x80, 0x56, 0x2C, 0x02, 0xFD, 0x00, 0x0F, 0x12, 0x3B, 0x63, 0x8B, 0xAB, 0x88, 0x6B, 0x5B, 0x59, 0x62, 0x7A, 0x9B, 0x9C,
+    0x75, 0x4D, 0x24, 0xFC, 0x00, 0x0F, 0x05, 0x2C, 0x52, 0x76, 0x96, 0xA6, 0x90, 0x85, 0x83, 0x8A, 0x9B, 0xA3, 0x85, 0x63,
+    0x3D, 0x17, 0xFB, 0x00, 0x0E, 0x18, 0x3B, 0x5A, 0x75, 0x8B, 0x9A, 0xA2, 0xA3, 0x9E, 0x93, 0x80, 0x67, 0x49, 0x27, 0x04,
+    0xFA, 0x00, 0x0C, 0x1E, 0x3A, 0x52, 0x64, 0x71, 0x77, 0x78, 0x74, 0x6B, 0x5B, 0x45, 0x2B, 0x0D, 0xF8, 0x00, 0x0A, 0x17,
+    0x2C, 0x3C, 0x47, 0x4D, 0x4E, 0x4A, 0x42, 0x34, 0x21, 0x0A, 0xF6, 0x00, 0x07, 0x06, 0x14, 0x1D, 0x23, 0x23, 0x20, 0x19,
+    0x0C, 0x81, 0x00, 0xFC, 0x00, 0xE5, 0x00, 0x01, 0x0B, 0x1D, 0xFE, 0x21, 0x00, 0x15, 0xF3, 0x00, 0x07, 0x08, 0x29, 0x45,
+    0x4C, 0x4C, 0x4B, 0x38, 0x17, 0xF5, 0x00, 0x09, 0x01, 0x22, 0x44, 0x65, 0x76, 0x76, 0x74, 0x53, 0x31, 0x10, 0xF6, 0x00,
+    0x0A, 0x1C, 0x3D, 0x5E, 0x7F, 0x9D, 0x90, 0x8E, 0x6D, 0x4C, 0x2B, 0x09, 0xF8, 0x00, 0x0B, 0x14, 0x36, 0x57, 0x79, 0x9A,
+    0x80, 0x73, 0x92, 0x88, 0x66, 0x45, 0x24, 0xF9, 0x00, 0x0E, 0x1C, 0x2A, 0x4D, 0x72, 0x8E, 0x83, 0x63, 0x56, 0x75, 0x8E,
+    0x81, 0x5F, 0x36, 0x24, 0x0D, 0xFC, 0x00, 0x10, 0x18, 0x3C, 0x54, 0x55, 0x63, 0x63, 0x62, 0x47, 0x39, 0x58, 0x63, 0x63,
+    0x57, 0x55, 0x49, 0x28, 0x02, 0xFD, 0x00, 0x0A, 0x21, 0x4C, 0x76, 0x7F, 0x7F, 0x6F, 0x44, 0x28, 0x1C, 0x34, 0x5B, 0xFE,
+    0x7F, 0x02, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xAA, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x89, 0x5E, 0x34, 0x09, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86,
+    0xB0, 0x88, 0x5D, 0x33, 0x08, 0xFD, 0x00, 0x10, 0x1E, 0x48, 0x73, 0x9D, 0x9A, 0x6F, 0x45, 0x1B, 0x07, 0x32, 0x5C, 0x87,
+    0xB0, 0x85, 0x5B, 0x31, 0x06, 0xFD, 0x00, 0x10, 0x1A, 0x43, 0x6D, 0x97, 0x9E, 0x74, 0x4D, 0x32, 0x2F, 0x3E, 0x62, 0x8B,
+    0xAA, 0x80, 0x56, 0x2C, 0x02, 0xFD, 0x00, 0x0F, 0x12, 0x3B, 0x63, 0x8B, 0xAB, 0x88, 0x6B, 0x5B, 0x59, 0x62, 0x7A, 0x9B,
+    0x9C, 0x75, 0x4D, 0x24, 0xFC, 0x00, 0x0F, 0x05, 0x2C, 0x52, 0x76, 0x96, 0xA6, 0x90, 0x85, 0x83, 0x8A, 0x9B, 0xA3, 0x85,
+    0x63, 0x3D, 0x17, 0xFB, 0x00, 0x0E, 0x18, 0x3B, 0x5A, 0x75, 0x8B, 0x9A, 0xA2, 0xA3, 0x9E, 0x93, 0x80, 0x67, 0x49, 0x27,
+    0x04, 0xFA, 0x00, 0x0C, 0x1E, 0x3A, 0x52, 0x64, 0x71, 0x77, 0x78, 0x74, 0x6B, 0x5B, 0x45, 0x2B, 0x0D, 0xF8, 0x00, 0x0A,
+    0x17, 0x2C, 0x3C, 0x47, 0x4D, 0x4E, 0x4A, 0x42, 0x34, 0x21, 0x0A, 0xF6, 0x00, 0x07, 0x06, 0x14, 0x1D, 0x23, 0x23, 0x20,
+    0x19, 0x0C, 0x81, 0x00, 0xFC, 0x00, 0xE7, 0x00, 0x05, 0x06, 0x11, 0x12, 0x12, 0x10, 0x0C, 0xFE, 0x12, 0x00, 0x0C, 0xF7,
+    0x00, 0x06, 0x0B, 0x2A, 0x3B, 0x3C, 0x3C, 0x3A, 0x33, 0xFE, 0x3C, 0x01, 0x34, 0x1A, 0xF8, 0x00, 0x06, 0x1D, 0x45, 0x65,
+    0x67, 0x67, 0x62, 0x54, 0xFE, 0x67, 0x02, 0x55, 0x2F, 0x06, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x91, 0x91, 0x6F, 0x5C,
+    0x87, 0x91, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0xA0, 0x9A, 0x6F, 0x5C, 0x87, 0xA9, 0x88, 0x5D,
+    0x33, 0x08, 0xFA, 0x00, 0x07, 0x1C, 0x2A, 0x4B, 0x75, 0x7E, 0x7E, 0x6F, 0x5C, 0xFE, 0x7E, 0x03, 0x5D, 0x33, 0x24, 0x0D,
+    0xFC, 0x00, 0x0A, 0x18, 0x3C, 0x54, 0x55, 0x55, 0x54, 0x54, 0x51, 0x47, 0x54, 0x54, 0xFE, 0x55, 0x02, 0x49, 0x28, 0x02,
+    0xFD, 0x00, 0x0A, 0x21, 0x4C, 0x76, 0x7F, 0x7F, 0x6F, 0x44, 0x27, 0x22, 0x31, 0x5B, 0xFE, 0x7F, 0x02, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xAA, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4C, 0x76, 0xA1, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x21, 0x4B, 0x76, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09,
+    0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0xA0, 0x99, 0x6F, 0x44, 0x1A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x88, 0x5D, 0x33, 0x08,
+    0xFD, 0x00, 0x10, 0x1E, 0x48, 0x73, 0x9D, 0x9A, 0x6F, 0x45, 0x1B, 0x07, 0x32, 0x5C, 0x87, 0xB0, 0x85, 0x5B, 0x31, 0x06,
+    0xFD, 0x00, 0x10, 0x1A, 0x43, 0x6D, 0x97, 0x9E, 0x74, 0x4D, 0x32, 0x2F, 0x3E, 0x62, 0x8B, 0xAA, 0x80, 0x56, 0x2C, 0x02,
+    0xFD, 0x00, 0x0F, 0x12, 0x3B, 0x63, 0x8B, 0xAB, 0x88, 0x6B, 0x5B, 0x59, 0x62, 0x7A, 0x9B, 0x9C, 0x75, 0x4D, 0x24, 0xFC,
+    0x00, 0x0F, 0x05, 0x2C, 0x52, 0x76, 0x96, 0xA6, 0x90, 0x85, 0x83, 0x8A, 0x9B, 0xA3, 0x85, 0x63, 0x3D, 0x17, 0xFB, 0x00,
+    0x0E, 0x18, 0x3B, 0x5A, 0x75, 0x8B, 0x9A, 0xA2, 0xA3, 0x9E, 0x93, 0x80, 0x67, 0x49, 0x27, 0x04, 0xFA, 0x00, 0x0C, 0x1E,
+    0x3A, 0x52, 0x64, 0x71, 0x77, 0x78, 0x74, 0x6B, 0x5B, 0x45, 0x2B, 0x0D, 0xF8, 0x00, 0x0A, 0x17, 0x2C, 0x3C, 0x47, 0x4D,
+    0x4E, 0x4A, 0x42, 0x34, 0x21, 0x0A, 0xF6, 0x00, 0x07, 0x06, 0x14, 0x1D, 0x23, 0x23, 0x20, 0x19, 0x0C, 0x81, 0x00, 0xFC,
+    0x00, 0xE3, 0x00, 0x05, 0x10, 0x1F, 0x20, 0x20, 0x1E, 0x0E, 0xF3, 0x00, 0x07, 0x0F, 0x31, 0x48, 0x4B, 0x4B, 0x47, 0x2E,
+    0x0B, 0xF5, 0x00, 0x08, 0x06, 0x28, 0x4A, 0x6C, 0x75, 0x75, 0x6A, 0x41, 0x17, 0xF5, 0x00, 0x08, 0x20, 0x42, 0x64, 0x86,
+    0x9C, 0x7C, 0x5C, 0x3A, 0x13, 0xF6, 0x00, 0x08, 0x17, 0x39, 0x5B, 0x7D, 0x9F, 0x81, 0x60, 0x40, 0x20, 0xFA, 0x00, 0x01,
+    0x09, 0x22, 0xFE, 0x2A, 0x07, 0x27, 0x50, 0x75, 0x8E, 0x85, 0x65, 0x45, 0x25, 0xFE, 0x2A, 0x01, 0x28, 0x16, 0xFE, 0x00,
+    0x01, 0x23, 0x45, 0xFE, 0x55, 0x01, 0x4F, 0x4A, 0xFE, 0x63, 0x02, 0x49, 0x29, 0x44, 0xFE, 0x55, 0x06, 0x50, 0x33, 0x0E,
+    0x00, 0x03, 0x2D, 0x58, 0xFE, 0x7F, 0x01, 0x6B, 0x46, 0xFE, 0x39, 0x02, 0x2A, 0x36, 0x5B, 0xFE, 0x7F, 0x2B, 0x6B, 0x40,
+    0x16, 0x00, 0x00, 0x23, 0x48, 0x6D, 0x91, 0xA5, 0x80, 0x5A, 0x35, 0x10, 0x0E, 0x25, 0x4A, 0x70, 0x95, 0xA2, 0x7D, 0x58,
+    0x34, 0x0E, 0x00, 0x00, 0x0E, 0x33, 0x57, 0x7C, 0xA1, 0x94, 0x6F, 0x4A, 0x25, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0x8C, 0x68,
+    0x43, 0x1E, 0xFD, 0x00, 0x10, 0x1D, 0x42, 0x67, 0x8C, 0xA9, 0x84, 0x5E, 0x39, 0x29, 0x4E, 0x74, 0x99, 0x9C, 0x77, 0x52,
+    0x2E, 0x09, 0xFD, 0x00, 0x0F, 0x08, 0x2D, 0x52, 0x76, 0x9B, 0x98, 0x73, 0x4E, 0x3E, 0x63, 0x88, 0xAB, 0x86, 0x62, 0x3D,
+    0x18, 0xFB, 0x00, 0x0E, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0x87, 0x62, 0x52, 0x77, 0x9D, 0x96, 0x71, 0x4C, 0x28, 0x03, 0xFB,
+    0x00, 0x0D, 0x02, 0x27, 0x4C, 0x70, 0x95, 0x9C, 0x77, 0x67, 0x8C, 0xA5, 0x80, 0x5C, 0x37, 0x12, 0xF9, 0x00, 0x0B, 0x12,
+    0x36, 0x5B, 0x80, 0xA5, 0x8B, 0x7B, 0xA0, 0x90, 0x6B, 0x46, 0x22, 0xF7, 0x00, 0x0A, 0x21, 0x46, 0x6B, 0x8F, 0xA0, 0x90,
+    0x9F, 0x7A, 0x56, 0x31, 0x0C, 0xF7, 0x00, 0x09, 0x0C, 0x31, 0x55, 0x7A, 0x9F, 0xAF, 0x8A, 0x65, 0x40, 0x1C, 0xF5, 0x00,
+    0x08, 0x1B, 0x40, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x2B, 0x06, 0xF5, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51,
+    0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6,
+    0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69,
+    0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14, 0x3F, 0x69, 0x94, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x14,
+    0x3F, 0x69, 0x94, 0x95, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x02, 0x12, 0x3B, 0x61, 0xFE, 0x6A, 0x01, 0x4C, 0x24, 0xF4, 0x00,
+    0x02, 0x03, 0x25, 0x3C, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF3, 0x00, 0x01, 0x03, 0x13, 0xFE, 0x15, 0x00, 0x0B, 0x81, 0x00,
+    0xFB, 0x00, 0x81, 0x00, 0x02, 0x00, 0x0B, 0x23, 0xFE, 0x2A, 0x01, 0x24, 0x0E, 0xF3, 0x00, 0x01, 0x26, 0x47, 0xFE, 0x55,
+    0x02, 0x4A, 0x29, 0x02, 0xF5, 0x00, 0x02, 0x06, 0x31, 0x5B, 0xFE, 0x7F, 0x02, 0x5E, 0x34, 0x09, 0xF5, 0x00, 0x0C, 0x06,
+    0x31, 0x5B, 0x86, 0xAA, 0x89, 0x5E, 0x34, 0x23, 0x22, 0x1E, 0x17, 0x0C, 0xF9, 0x00, 0x0E, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x4E, 0x4E, 0x4D, 0x49, 0x41, 0x34, 0x23, 0x0C, 0xFB, 0x00, 0x05, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0xFE,
+    0x78, 0x06, 0x77, 0x73, 0x6A, 0x5C, 0x48, 0x2E, 0x10, 0xFC, 0x00, 0x05, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0xA4, 0xFE, 0xA3,
+    0x07, 0xA2, 0x9D, 0x93, 0x82, 0x6A, 0x4C, 0x2A, 0x07, 0xFD, 0x00, 0x05, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x8A, 0xFE, 0x84,
+    0x07, 0x87, 0x92, 0xA5, 0xA6, 0x88, 0x65, 0x40, 0x19, 0xFD, 0x00, 0x10, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x5A,
+    0x5A, 0x5D, 0x6A, 0x84, 0xA5, 0x9F, 0x77, 0x4F, 0x26, 0xFD, 0x00, 0x11, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34,
+    0x2F, 0x34, 0x48, 0x6C, 0x95, 0xAC, 0x82, 0x58, 0x2E, 0x04, 0xFE, 0x00, 0x11, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E,
+    0x34, 0x09, 0x0F, 0x3A, 0x64, 0x8E, 0xB0, 0x86, 0x5B, 0x31, 0x06, 0xFE, 0x00, 0x11, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89,
+    0x5E, 0x34, 0x1F, 0x24, 0x3F, 0x67, 0x91, 0xAE, 0x84, 0x5A, 0x2F, 0x05, 0xFE, 0x00, 0x10, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0x5E, 0x4A, 0x4A, 0x4E, 0x5C, 0x7A, 0x9E, 0xA5, 0x7C, 0x53, 0x29, 0xFD, 0x00, 0x05, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x89, 0xFE, 0x74, 0x07, 0x77, 0x82, 0x98, 0xB2, 0x91, 0x6D, 0x46, 0x1E, 0xFD, 0x00, 0x05, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0xA0, 0xFE, 0x9F, 0x07, 0xA2, 0xAB, 0xA1, 0x90, 0x76, 0x56, 0x33, 0x0E, 0xFD, 0x00, 0x05, 0x06, 0x31, 0x5B, 0x86, 0xB0,
+    0x8C, 0xFE, 0x88, 0x06, 0x87, 0x82, 0x79, 0x6A, 0x55, 0x3A, 0x1B, 0xFC, 0x00, 0x0E, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89,
+    0x5E, 0x5D, 0x5D, 0x5C, 0x58, 0x50, 0x43, 0x31, 0x19, 0xFB, 0x00, 0x0D, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34,
+    0x33, 0x32, 0x2E, 0x27, 0x1B, 0x0B, 0xFA, 0x00, 0x0A, 0x06, 0x31, 0x5B, 0x86, 0xB0, 0x89, 0x5E, 0x34, 0x09, 0x07, 0x04,
+    0xF7, 0x00, 0x08, 0x06, 0x31, 0x5B, 0x86, 0x95, 0x89, 0x5E, 0x34, 0x09, 0xF5, 0x00, 0x02, 0x04, 0x2E, 0x55, 0xFE, 0x6A,
+    0x02, 0x58, 0x31, 0x08, 0xF4, 0x00, 0x01, 0x1A, 0x36, 0xFE, 0x40, 0x01, 0x38, 0x1D, 0xF2, 0x00, 0x00, 0x0F, 0xFE, 0x15,
+    0x00, 0x10, 0x81, 0x00, 0xF7, 0x00, 0x92, 0x00, 0x07, 0x03, 0x11, 0x1A, 0x1E, 0x1F, 0x1B, 0x13, 0x06, 0xF5, 0x00, 0x09,
+    0x15, 0x2A, 0x3A, 0x44, 0x49, 0x49, 0x45, 0x3C, 0x2D, 0x18, 0xF7, 0x00, 0x0B, 0x18, 0x36, 0x4F, 0x61, 0x6D, 0x73, 0x74,
+    0x6F, 0x65, 0x53, 0x3B, 0x1E, 0xF9, 0x00, 0x0D, 0x0E, 0x33, 0x54, 0x72, 0x89, 0x97, 0x9D, 0x9E, 0x99, 0x8C, 0x77, 0x5A,
+    0x39, 0x15, 0xFA, 0x00, 0x0D, 0x20, 0x48, 0x6D, 0x90, 0xA9, 0x91, 0x84, 0x83, 0x8B, 0xA0, 0x96, 0x74, 0x4F, 0x28, 0xFB,
+    0x00, 0x0F, 0x04, 0x2D, 0x56, 0x7F, 0xA6, 0x8F, 0x6D, 0x5A, 0x58, 0x65, 0x82, 0xA7, 0x87, 0x5F, 0x36, 0x0C, 0xFC, 0x00,
+    0x0F, 0x0A, 0x34, 0x5E, 0x88, 0xAA, 0x80, 0x57, 0x32, 0x42, 0x54, 0x71, 0x9B, 0x92, 0x68, 0x3E, 0x14, 0xFC, 0x00, 0x0F,
+    0x0C, 0x37, 0x61, 0x8C, 0xA6, 0x7B, 0x51, 0x4C, 0x67, 0x7B, 0x89, 0x9B, 0x93, 0x6C, 0x42, 0x18, 0xFC, 0x00, 0x0F, 0x0D,
+    0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x51, 0x69, 0x88, 0x9E, 0x84, 0x73, 0x69, 0x60, 0x3D, 0x15, 0xFC, 0x00, 0x0F, 0x0D, 0x37,
+    0x62, 0x8C, 0xA6, 0x7B, 0x58, 0x7F, 0xA4, 0x83, 0x62, 0x4B, 0x3F, 0x39, 0x24, 0x04, 0xFC, 0x00, 0x0E, 0x0D, 0x37, 0x62,
+    0x8C, 0xA6, 0x7B, 0x61, 0x8B, 0xA1, 0x77, 0x4D, 0x26, 0x15, 0x0F, 0x01, 0xFB, 0x00, 0x0D, 0x0D, 0x37, 0x62, 0x8C, 0xA6,
+    0x7B, 0x61, 0x8B, 0xA6, 0x7F, 0x5E, 0x45, 0x2E, 0x16, 0xFA, 0x00, 0x0F, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x57, 0x7D,
+    0xA1, 0x9A, 0x7F, 0x68, 0x51, 0x39, 0x1E, 0x01, 0xFC, 0x00, 0x0F, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x51, 0x65, 0x83,
+    0x9C, 0xA3, 0x8C, 0x74, 0x5A, 0x3D, 0x1D, 0xFC, 0x00, 0x10, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x51, 0x47, 0x61, 0x78,
+    0x8E, 0xA6, 0x96, 0x79, 0x58, 0x34, 0x0E, 0xFD, 0x00, 0x10, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x51, 0x26, 0x3E, 0x53,
+    0x6B, 0x84, 0xA3, 0x93, 0x6D, 0x46, 0x1E, 0xFD, 0x00, 0x10, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x51, 0x26, 0x19, 0x2F,
+    0x48, 0x68, 0x8F, 0xA4, 0x7A, 0x50, 0x26, 0xFD, 0x00, 0x10, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x51, 0x39, 0x2D, 0x28,
+    0x34, 0x5E, 0x89, 0xA8, 0x7E, 0x53, 0x29, 0xFD, 0x00, 0x10, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x70, 0x61, 0x57, 0x53,
+    0x59, 0x6F, 0x92, 0xA1, 0x79, 0x4F, 0x25, 0xFD, 0x00, 0x10, 0x0D, 0x37, 0x62, 0x8C, 0xA6, 0x7B, 0x85, 0x8A, 0x81, 0x7D,
+    0x82, 0x91, 0xAB, 0x8D, 0x69, 0x43, 0x1B, 0xFD, 0x00, 0x10, 0x0D, 0x37, 0x62, 0x8C, 0x95, 0x7B, 0x85, 0x98, 0xA0, 0xA3,
+    0xA1, 0x98, 0x87, 0x6F, 0x51, 0x2F, 0x0A, 0xFD, 0x00, 0x02, 0x0B, 0x34, 0x5B, 0xFE, 0x6A, 0x09, 0x64, 0x6F, 0x76, 0x79,
+    0x76, 0x6F, 0x61, 0x4D, 0x33, 0x15, 0xFB, 0x00, 0x01, 0x1F, 0x39, 0xFE, 0x40, 0x08, 0x3B, 0x45, 0x4C, 0x4E, 0x4C, 0x46,
+    0x3A, 0x28, 0x12, 0xF9, 0x00, 0x00, 0x11, 0xFE, 0x15, 0x07, 0x12, 0x1C, 0x22, 0x24, 0x22, 0x1C, 0x12, 0x02, 0x81, 0x00,
+    0xFE, 0x00, 0xA9, 0x00, 0x01, 0x04, 0x18, 0xFE, 0x1E, 0x00, 0x16, 0xF2, 0x00, 0x01, 0x22, 0x3F, 0xFE, 0x48, 0x01, 0x3C,
+    0x1D, 0xF4, 0x00, 0x02, 0x09, 0x33, 0x5C, 0xFE, 0x73, 0x02, 0x59, 0x37, 0x15, 0xF5, 0x00, 0x09, 0x06, 0x2F, 0x53, 0x74,
+    0x94, 0x94, 0x72, 0x50, 0x2E, 0x0C, 0xF5, 0x00, 0x09, 0x17, 0x38, 0x58, 0x78, 0x98, 0x8C, 0x6A, 0x48, 0x26, 0x03, 0xF5,
+    0x00, 0x08, 0x1C, 0x3C, 0x5C, 0x7C, 0x9C, 0x83, 0x61, 0x3F, 0x1D, 0xF5, 0x00, 0x09, 0x08, 0x20, 0x40, 0x61, 0x81, 0x9C,
+    0x7A, 0x58, 0x34, 0x0C, 0xF8, 0x00, 0x0C, 0x08, 0x21, 0x30, 0x3D, 0x47, 0x4E, 0x65, 0x73, 0x73, 0x63, 0x3A, 0x23, 0x0A,
+    0xF9, 0x00, 0x0D, 0x20, 0x44, 0x58, 0x66, 0x71, 0x79, 0x7D, 0x7C, 0x78, 0x6D, 0x5D, 0x46, 0x2A, 0x0B, 0xFA, 0x00, 0x0D,
+    0x2A, 0x54, 0x7F, 0x8E, 0x9A, 0xA3, 0xA6, 0xA6, 0xA1, 0x95, 0x81, 0x67, 0x47, 0x25, 0xFA, 0x00, 0x0E, 0x2A, 0x54, 0x7F,
+    0x98, 0x8A, 0x80, 0x7B, 0x7C, 0x83, 0x95, 0xA3, 0x83, 0x5F, 0x39, 0x12, 0xFB, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x71, 0x62,
+    0x57, 0x51, 0x51, 0x5B, 0x76, 0x9A, 0x98, 0x70, 0x46, 0x1D, 0xFB, 0x00, 0x0E, 0x22, 0x47, 0x5A, 0x4B, 0x3E, 0x46, 0x4B,
+    0x4C, 0x4C, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x06, 0x0C, 0x29, 0x43, 0x58, 0x67, 0x70, 0x75, 0xFE, 0x76,
+    0x04, 0x8A, 0xA5, 0x7B, 0x50, 0x26, 0xFC, 0x00, 0x07, 0x01, 0x26, 0x47, 0x65, 0x7E, 0x8F, 0x9A, 0xA0, 0xFE, 0xA1, 0x04,
+    0xA3, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x07, 0x14, 0x3B, 0x60, 0x83, 0xA1, 0x98, 0x86, 0x7E, 0xFE, 0x7B, 0x04, 0x8A,
+    0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x72, 0x9A, 0x99, 0x76, 0x5F, 0x54, 0x51, 0x51, 0x61, 0x8C, 0xA6,
+    0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA5, 0x8B, 0x61, 0x3A, 0x2A, 0x26, 0x40, 0x68, 0x92, 0xA6, 0x7C,
+    0x51, 0x27, 0xFC, 0x00, 0x0F, 0x27, 0x52, 0x7C, 0xA7, 0x8A, 0x60, 0x37, 0x29, 0x35, 0x53, 0x78, 0x9E, 0xA6, 0x7C, 0x51,
+    0x27, 0xFC, 0x00, 0x0F, 0x23, 0x4D, 0x76, 0x9E, 0x96, 0x72, 0x5A, 0x54, 0x5B, 0x70, 0x8E, 0x99, 0xA6, 0x7C, 0x51, 0x27,
+    0xFC, 0x00, 0x0F, 0x18, 0x40, 0x67, 0x8B, 0xAB, 0x93, 0x82, 0x7E, 0x84, 0x94, 0x8F, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC,
+    0x00, 0x0F, 0x07, 0x2D, 0x50, 0x6F, 0x89, 0x9A, 0xA2, 0xA2, 0x9B, 0x8A, 0x71, 0x8A, 0x95, 0x7C, 0x51, 0x27, 0xFB, 0x00,
+    0x09, 0x14, 0x33, 0x4E, 0x63, 0x71, 0x78, 0x78, 0x71, 0x64, 0x59, 0xFE, 0x6A, 0x01, 0x4D, 0x24, 0xFA, 0x00, 0x08, 0x12,
+    0x2A, 0x3C, 0x48, 0x4D, 0x4D, 0x48, 0x3C, 0x38, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF9, 0x00, 0x07, 0x04, 0x14, 0x1E, 0x23,
+    0x23, 0x1E, 0x14, 0x11, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x00, 0x00, 0xA3, 0x00, 0x05, 0x0E, 0x1C, 0x1E, 0x1E,
+    0x1D, 0x0F, 0xF3, 0x00, 0x07, 0x0E, 0x2F, 0x46, 0x48, 0x48, 0x46, 0x31, 0x0E, 0xF5, 0x00, 0x08, 0x05, 0x27, 0x49, 0x6B,
+    0x73, 0x73, 0x6D, 0x46, 0x1C, 0xF5, 0x00, 0x08, 0x1F, 0x41, 0x63, 0x85, 0x9D, 0x82, 0x62, 0x40, 0x19, 0xF6, 0x00, 0x09,
+    0x16, 0x38, 0x5A, 0x7C, 0x9E, 0x86, 0x66, 0x46, 0x26, 0x05, 0xF7, 0x00, 0x09, 0x0E, 0x30, 0x52, 0x74, 0x96, 0x8B, 0x6B,
+    0x4A, 0x2A, 0x0A, 0xF7, 0x00, 0x09, 0x08, 0x23, 0x49, 0x6B, 0x8D, 0x8F, 0x6F, 0x4F, 0x2F, 0x0E, 0xF8, 0x00, 0x0C, 0x08,
+    0x21, 0x30, 0x3D, 0x51, 0x73, 0x73, 0x72, 0x53, 0x45, 0x36, 0x23, 0x0A, 0xF9, 0x00, 0x0D, 0x20, 0x44, 0x58, 0x66, 0x71,
+    0x79, 0x7D, 0x7C, 0x78, 0x6D, 0x5D, 0x46, 0x2A, 0x0B, 0xFA, 0x00, 0x0D, 0x2A, 0x54, 0x7F, 0x8E, 0x9A, 0xA3, 0xA6, 0xA6,
+    0xA1, 0x95, 0x81, 0x67, 0x47, 0x25, 0xFA, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x98, 0x8A, 0x80, 0x7B, 0x7C, 0x83, 0x95, 0xA3,
+    0x83, 0x5F, 0x39, 0x12, 0xFB, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x71, 0x62, 0x57, 0x51, 0x51, 0x5B, 0x76, 0x9A, 0x98, 0x70,
+    0x46, 0x1D, 0xFB, 0x00, 0x0E, 0x22, 0x47, 0x5A, 0x4B, 0x3E, 0x46, 0x4B, 0x4C, 0x4C, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23,
+    0xFB, 0x00, 0x06, 0x0C, 0x29, 0x43, 0x58, 0x67, 0x70, 0x75, 0xFE, 0x76, 0x04, 0x8A, 0xA5, 0x7B, 0x50, 0x26, 0xFC, 0x00,
+    0x07, 0x01, 0x26, 0x47, 0x65, 0x7E, 0x8F, 0x9A, 0xA0, 0xFE, 0xA1, 0x04, 0xA3, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x07,
+    0x14, 0x3B, 0x60, 0x83, 0xA1, 0x98, 0x86, 0x7E, 0xFE, 0x7B, 0x04, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x20,
+    0x4A, 0x72, 0x9A, 0x99, 0x76, 0x5F, 0x54, 0x51, 0x51, 0x61, 0x8C, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x26, 0x51,
+    0x7B, 0xA5, 0x8B, 0x61, 0x3A, 0x2A, 0x26, 0x40, 0x68, 0x92, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x27, 0x52, 0x7C,
+    0xA7, 0x8A, 0x60, 0x37, 0x29, 0x35, 0x53, 0x78, 0x9E, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x23, 0x4D, 0x76, 0x9E,
+    0x96, 0x72, 0x5A, 0x54, 0x5B, 0x70, 0x8E, 0x99, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x18, 0x40, 0x67, 0x8B, 0xAB,
+    0x93, 0x82, 0x7E, 0x84, 0x94, 0x8F, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x07, 0x2D, 0x50, 0x6F, 0x89, 0x9A,
+    0xA2, 0xA2, 0x9B, 0x8A, 0x71, 0x8A, 0x95, 0x7C, 0x51, 0x27, 0xFB, 0x00, 0x09, 0x14, 0x33, 0x4E, 0x63, 0x71, 0x78, 0x78,
+    0x71, 0x64, 0x59, 0xFE, 0x6A, 0x01, 0x4D, 0x24, 0xFA, 0x00, 0x08, 0x12, 0x2A, 0x3C, 0x48, 0x4D, 0x4D, 0x48, 0x3C, 0x38,
+    0xFE, 0x40, 0x01, 0x31, 0x12, 0xF9, 0x00, 0x07, 0x04, 0x14, 0x1E, 0x23, 0x23, 0x1E, 0x14, 0x11, 0xFE, 0x15, 0x00, 0x0C,
+    0x81, 0x00, 0x01, 0x00, 0x00, 0xA6, 0x00, 0x05, 0x02, 0x17, 0x1E, 0x1E, 0x1C, 0x0D, 0xF2, 0x00, 0x06, 0x1F, 0x3D, 0x48,
+    0x48, 0x45, 0x2E, 0x0B, 0xF4, 0x00, 0x07, 0x13, 0x36, 0x5A, 0x73, 0x73, 0x6A, 0x46, 0x23, 0xF5, 0x00, 0x09, 0x06, 0x2A,
+    0x4D, 0x71, 0x95, 0x9D, 0x81, 0x5D, 0x3A, 0x16, 0xF6, 0x00, 0x0A, 0x1E, 0x41, 0x65, 0x88, 0x94, 0x85, 0x98, 0x75, 0x51,
+    0x2E, 0x0A, 0xF8, 0x00, 0x0B, 0x11, 0x35, 0x58, 0x7C, 0x9D, 0x7B, 0x6C, 0x8E, 0x8C, 0x68, 0x45, 0x21, 0xF8, 0x00, 0x0C,
+    0x26, 0x4C, 0x70, 0x93, 0x84, 0x62, 0x53, 0x75, 0x97, 0x80, 0x5C, 0x38, 0x10, 0xFA, 0x00, 0x0D, 0x08, 0x2A, 0x54, 0x73,
+    0x73, 0x6B, 0x52, 0x52, 0x5B, 0x73, 0x73, 0x66, 0x3D, 0x13, 0xFA, 0x00, 0x0D, 0x20, 0x44, 0x58, 0x66, 0x71, 0x79, 0x7D,
+    0x7C, 0x78, 0x6D, 0x5D, 0x46, 0x2A, 0x0B, 0xFA, 0x00, 0x0D, 0x2A, 0x54, 0x7F, 0x8E, 0x9A, 0xA3, 0xA6, 0xA6, 0xA1, 0x95,
+    0x81, 0x67, 0x47, 0x25, 0xFA, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x98, 0x8A, 0x80, 0x7B, 0x7C, 0x83, 0x95, 0xA3, 0x83, 0x5F,
+    0x39, 0x12, 0xFB, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x71, 0x62, 0x57, 0x51, 0x51, 0x5B, 0x76, 0x9A, 0x98, 0x70, 0x46, 0x1D,
+    0xFB, 0x00, 0x0E, 0x22, 0x47, 0x5A, 0x4B, 0x3E, 0x46, 0x4B, 0x4C, 0x4C, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00,
+    0x06, 0x0C, 0x29, 0x43, 0x58, 0x67, 0x70, 0x75, 0xFE, 0x76, 0x04, 0x8A, 0xA5, 0x7B, 0x50, 0x26, 0xFC, 0x00, 0x07, 0x01,
+    0x26, 0x47, 0x65, 0x7E, 0x8F, 0x9A, 0xA0, 0xFE, 0xA1, 0x04, 0xA3, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x07, 0x14, 0x3B,
+    0x60, 0x83, 0xA1, 0x98, 0x86, 0x7E, 0xFE, 0x7B, 0x04, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x72,
+    0x9A, 0x99, 0x76, 0x5F, 0x54, 0x51, 0x51, 0x61, 0x8C, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA5,
+    0x8B, 0x61, 0x3A, 0x2A, 0x26, 0x40, 0x68, 0x92, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x27, 0x52, 0x7C, 0xA7, 0x8A,
+    0x60, 0x37, 0x29, 0x35, 0x53, 0x78, 0x9E, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x23, 0x4D, 0x76, 0x9E, 0x96, 0x72,
+    0x5A, 0x54, 0x5B, 0x70, 0x8E, 0x99, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x18, 0x40, 0x67, 0x8B, 0xAB, 0x93, 0x82,
+    0x7E, 0x84, 0x94, 0x8F, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x07, 0x2D, 0x50, 0x6F, 0x89, 0x9A, 0xA2, 0xA2,
+    0x9B, 0x8A, 0x71, 0x8A, 0x95, 0x7C, 0x51, 0x27, 0xFB, 0x00, 0x09, 0x14, 0x33, 0x4E, 0x63, 0x71, 0x78, 0x78, 0x71, 0x64,
+    0x59, 0xFE, 0x6A, 0x01, 0x4D, 0x24, 0xFA, 0x00, 0x08, 0x12, 0x2A, 0x3C, 0x48, 0x4D, 0x4D, 0x48, 0x3C, 0x38, 0xFE, 0x40,
+    0x01, 0x31, 0x12, 0xF9, 0x00, 0x07, 0x04, 0x14, 0x1E, 0x23, 0x23, 0x1E, 0x14, 0x11, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00,
+    0x01, 0x00, 0x00, 0xA6, 0x00, 0x07, 0x01, 0x06, 0x03, 0x00, 0x00, 0x06, 0x06, 0x05, 0xF6, 0x00, 0x0A, 0x02, 0x1A, 0x2A,
+    0x30, 0x2D, 0x1F, 0x23, 0x30, 0x31, 0x2F, 0x1C, 0xF7, 0x00, 0x0B, 0x21, 0x3E, 0x52, 0x5B, 0x56, 0x44, 0x44, 0x5B, 0x5B,
+    0x57, 0x39, 0x13, 0xF9, 0x00, 0x0C, 0x15, 0x3A, 0x5D, 0x79, 0x85, 0x7E, 0x67, 0x50, 0x7B, 0x86, 0x6E, 0x43, 0x19, 0xF9,
+    0x00, 0x0C, 0x24, 0x4C, 0x74, 0x98, 0x8F, 0x9A, 0x86, 0x69, 0x80, 0x93, 0x6A, 0x40, 0x16, 0xFA, 0x00, 0x0D, 0x03, 0x2D,
+    0x57, 0x81, 0x93, 0x6A, 0x79, 0x97, 0x8F, 0x98, 0x85, 0x5E, 0x36, 0x0E, 0xFA, 0x00, 0x0C, 0x06, 0x30, 0x5B, 0x85, 0x86,
+    0x63, 0x5B, 0x75, 0x85, 0x82, 0x6B, 0x4B, 0x26, 0xF9, 0x00, 0x0C, 0x08, 0x29, 0x4C, 0x5C, 0x5C, 0x51, 0x52, 0x52, 0x5B,
+    0x58, 0x49, 0x2F, 0x0F, 0xF9, 0x00, 0x0D, 0x20, 0x44, 0x58, 0x66, 0x71, 0x79, 0x7D, 0x7C, 0x78, 0x6D, 0x5D, 0x46, 0x2A,
+    0x0B, 0xFA, 0x00, 0x0D, 0x2A, 0x54, 0x7F, 0x8E, 0x9A, 0xA3, 0xA6, 0xA6, 0xA1, 0x95, 0x81, 0x67, 0x47, 0x25, 0xFA, 0x00,
+    0x0E, 0x2A, 0x54, 0x7F, 0x98, 0x8A, 0x80, 0x7B, 0x7C, 0x83, 0x95, 0xA3, 0x83, 0x5F, 0x39, 0x12, 0xFB, 0x00, 0x0E, 0x2A,
+    0x54, 0x7F, 0x71, 0x62, 0x57, 0x51, 0x51, 0x5B, 0x76, 0x9A, 0x98, 0x70, 0x46, 0x1D, 0xFB, 0x00, 0x0E, 0x22, 0x47, 0x5A,
+    0x4B, 0x3E, 0x46, 0x4B, 0x4C, 0x4C, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x06, 0x0C, 0x29, 0x43, 0x58, 0x67,
+    0x70, 0x75, 0xFE, 0x76, 0x04, 0x8A, 0xA5, 0x7B, 0x50, 0x26, 0xFC, 0x00, 0x07, 0x01, 0x26, 0x47, 0x65, 0x7E, 0x8F, 0x9A,
+    0xA0, 0xFE, 0xA1, 0x04, 0xA3, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x07, 0x14, 0x3B, 0x60, 0x83, 0xA1, 0x98, 0x86, 0x7E,
+    0xFE, 0x7B, 0x04, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x72, 0x9A, 0x99, 0x76, 0x5F, 0x54, 0x51,
+    0x51, 0x61, 0x8C, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA5, 0x8B, 0x61, 0x3A, 0x2A, 0x26, 0x40,
+    0x68, 0x92, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x27, 0x52, 0x7C, 0xA7, 0x8A, 0x60, 0x37, 0x29, 0x35, 0x53, 0x78,
+    0x9E, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x23, 0x4D, 0x76, 0x9E, 0x96, 0x72, 0x5A, 0x54, 0x5B, 0x70, 0x8E, 0x99,
+    0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x18, 0x40, 0x67, 0x8B, 0xAB, 0x93, 0x82, 0x7E, 0x84, 0x94, 0x8F, 0x8A, 0xA6,
+    0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x07, 0x2D, 0x50, 0x6F, 0x89, 0x9A, 0xA2, 0xA2, 0x9B, 0x8A, 0x71, 0x8A, 0x95, 0x7C,
+    0x51, 0x27, 0xFB, 0x00, 0x09, 0x14, 0x33, 0x4E, 0x63, 0x71, 0x78, 0x78, 0x71, 0x64, 0x59, 0xFE, 0x6A, 0x01, 0x4D, 0x24,
+    0xFA, 0x00, 0x08, 0x12, 0x2A, 0x3C, 0x48, 0x4D, 0x4D, 0x48, 0x3C, 0x38, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF9, 0x00, 0x07,
+    0x04, 0x14, 0x1E, 0x23, 0x23, 0x1E, 0x14, 0x11, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x00, 0x00, 0x93, 0x00, 0x00,
+    0x10, 0xFE, 0x1D, 0x01, 0x1C, 0x17, 0xFE, 0x1D, 0x01, 0x17, 0x03, 0xF8, 0x00, 0x06, 0x11, 0x33, 0x47, 0x48, 0x48, 0x45,
+    0x3D, 0xFE, 0x48, 0x01, 0x3E, 0x21, 0xF8, 0x00, 0x06, 0x1F, 0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02, 0x5B,
+    0x32, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x9D, 0x9A, 0x6F, 0x5C, 0x87, 0x9D, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00,
+    0x0C, 0x20, 0x4B, 0x75, 0x9C, 0x9A, 0x6F, 0x5C, 0x87, 0x9C, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x06, 0x1F, 0x49, 0x6F,
+    0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02, 0x5B, 0x32, 0x08, 0xFA, 0x00, 0x0C, 0x08, 0x21, 0x33, 0x46, 0x47, 0x4E, 0x52,
+    0x52, 0x4E, 0x47, 0x47, 0x3E, 0x21, 0xF9, 0x00, 0x0D, 0x20, 0x44, 0x58, 0x66, 0x71, 0x79, 0x7D, 0x7C, 0x78, 0x6D, 0x5D,
+    0x46, 0x2A, 0x0B, 0xFA, 0x00, 0x0D, 0x2A, 0x54, 0x7F, 0x8E, 0x9A, 0xA3, 0xA6, 0xA6, 0xA1, 0x95, 0x81, 0x67, 0x47, 0x25,
+    0xFA, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x98, 0x8A, 0x80, 0x7B, 0x7C, 0x83, 0x95, 0xA3, 0x83, 0x5F, 0x39, 0x12, 0xFB, 0x00,
+    0x0E, 0x2A, 0x54, 0x7F, 0x71, 0x62, 0x57, 0x51, 0x51, 0x5B, 0x76, 0x9A, 0x98, 0x70, 0x46, 0x1D, 0xFB, 0x00, 0x0E, 0x22,
+    0x47, 0x5A, 0x4B, 0x3E, 0x46, 0x4B, 0x4C, 0x4C, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x06, 0x0C, 0x29, 0x43,
+    0x58, 0x67, 0x70, 0x75, 0xFE, 0x76, 0x04, 0x8A, 0xA5, 0x7B, 0x50, 0x26, 0xFC, 0x00, 0x07, 0x01, 0x26, 0x47, 0x65, 0x7E,
+    0x8F, 0x9A, 0xA0, 0xFE, 0xA1, 0x04, 0xA3, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x07, 0x14, 0x3B, 0x60, 0x83, 0xA1, 0x98,
+    0x86, 0x7E, 0xFE, 0x7B, 0x04, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x72, 0x9A, 0x99, 0x76, 0x5F,
+    0x54, 0x51, 0x51, 0x61, 0x8C, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA5, 0x8B, 0x61, 0x3A, 0x2A,
+    0x26, 0x40, 0x68, 0x92, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x27, 0x52, 0x7C, 0xA7, 0x8A, 0x60, 0x37, 0x29, 0x35,
+    0x53, 0x78, 0x9E, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x23, 0x4D, 0x76, 0x9E, 0x96, 0x72, 0x5A, 0x54, 0x5B, 0x70,
+    0x8E, 0x99, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x18, 0x40, 0x67, 0x8B, 0xAB, 0x93, 0x82, 0x7E, 0x84, 0x94, 0x8F,
+    0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x07, 0x2D, 0x50, 0x6F, 0x89, 0x9A, 0xA2, 0xA2, 0x9B, 0x8A, 0x71, 0x8A,
+    0x95, 0x7C, 0x51, 0x27, 0xFB, 0x00, 0x09, 0x14, 0x33, 0x4E, 0x63, 0x71, 0x78, 0x78, 0x71, 0x64, 0x59, 0xFE, 0x6A, 0x01,
+    0x4D, 0x24, 0xFA, 0x00, 0x08, 0x12, 0x2A, 0x3C, 0x48, 0x4D, 0x4D, 0x48, 0x3C, 0x38, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF9,
+    0x00, 0x07, 0x04, 0x14, 0x1E, 0x23, 0x23, 0x1E, 0x14, 0x11, 0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x00, 0x00, 0xCF,
+    0x00, 0x04, 0x0E, 0x16, 0x18, 0x12, 0x06, 0xF3, 0x00, 0x07, 0x0C, 0x24, 0x36, 0x40, 0x42, 0x3C, 0x2D, 0x17, 0xF5, 0x00,
+    0x09, 0x0B, 0x2B, 0x47, 0x5D, 0x6A, 0x6D, 0x64, 0x52, 0x38, 0x1A, 0xF6, 0x00, 0x0A, 0x23, 0x47, 0x67, 0x82, 0x94, 0x97,
+    0x8C, 0x74, 0x56, 0x33, 0x0E, 0xF8, 0x00, 0x0B, 0x0C, 0x34, 0x5C, 0x82, 0x99, 0x80, 0x7B, 0x8C, 0x91, 0x6D, 0x46, 0x1E,
+    0xF8, 0x00, 0x0B, 0x13, 0x3E, 0x68, 0x91, 0x82, 0x5D, 0x52, 0x71, 0x98, 0x7A, 0x51, 0x26, 0xF8, 0x00, 0x0B, 0x14, 0x3F,
+    0x69, 0x93, 0x7F, 0x56, 0x47, 0x6C, 0x96, 0x7C, 0x52, 0x27, 0xF8, 0x00, 0x0B, 0x0E, 0x38, 0x60, 0x87, 0x91, 0x75, 0x6F,
+    0x83, 0x98, 0x72, 0x4A, 0x21, 0xF8, 0x00, 0x0B, 0x02, 0x28, 0x4D, 0x6F, 0x8D, 0x9C, 0x99, 0x97, 0x7D, 0x5D, 0x39, 0x13,
+    0xF9, 0x00, 0x0C, 0x08, 0x21, 0x30, 0x3D, 0x51, 0x68, 0x76, 0x79, 0x70, 0x5C, 0x41, 0x23, 0x0A, 0xF9, 0x00, 0x0D, 0x20,
+    0x44, 0x58, 0x66, 0x71, 0x79, 0x7D, 0x7C, 0x78, 0x6D, 0x5D, 0x46, 0x2A, 0x0B, 0xFA, 0x00, 0x0D, 0x2A, 0x54, 0x7F, 0x8E,
+    0x9A, 0xA3, 0xA6, 0xA6, 0xA1, 0x95, 0x81, 0x67, 0x47, 0x25, 0xFA, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x98, 0x8A, 0x80, 0x7B,
+    0x7C, 0x83, 0x95, 0xA3, 0x83, 0x5F, 0x39, 0x12, 0xFB, 0x00, 0x0E, 0x2A, 0x54, 0x7F, 0x71, 0x62, 0x57, 0x51, 0x51, 0x5B,
+    0x76, 0x9A, 0x98, 0x70, 0x46, 0x1D, 0xFB, 0x00, 0x0E, 0x22, 0x47, 0x5A, 0x4B, 0x3E, 0x46, 0x4B, 0x4C, 0x4C, 0x64, 0x8E,
+    0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x06, 0x0C, 0x29, 0x43, 0x58, 0x67, 0x70, 0x75, 0xFE, 0x76, 0x04, 0x8A, 0xA5, 0x7B,
+    0x50, 0x26, 0xFC, 0x00, 0x07, 0x01, 0x26, 0x47, 0x65, 0x7E, 0x8F, 0x9A, 0xA0, 0xFE, 0xA1, 0x04, 0xA3, 0xA6, 0x7C, 0x51,
+    0x27, 0xFC, 0x00, 0x07, 0x14, 0x3B, 0x60, 0x83, 0xA1, 0x98, 0x86, 0x7E, 0xFE, 0x7B, 0x04, 0x8A, 0xA6, 0x7C, 0x51, 0x27,
+    0xFC, 0x00, 0x0F, 0x20, 0x4A, 0x72, 0x9A, 0x99, 0x76, 0x5F, 0x54, 0x51, 0x51, 0x61, 0x8C, 0xA6, 0x7C, 0x51, 0x27, 0xFC,
+    0x00, 0x0F, 0x26, 0x51, 0x7B, 0xA5, 0x8B, 0x61, 0x3A, 0x2A, 0x26, 0x40, 0x68, 0x92, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00,
+    0x0F, 0x27, 0x52, 0x7C, 0xA7, 0x8A, 0x60, 0x37, 0x29, 0x35, 0x53, 0x78, 0x9E, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F,
+    0x23, 0x4D, 0x76, 0x9E, 0x96, 0x72, 0x5A, 0x54, 0x5B, 0x70, 0x8E, 0x99, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x18,
+    0x40, 0x67, 0x8B, 0xAB, 0x93, 0x82, 0x7E, 0x84, 0x94, 0x8F, 0x8A, 0xA6, 0x7C, 0x51, 0x27, 0xFC, 0x00, 0x0F, 0x07, 0x2D,
+    0x50, 0x6F, 0x89, 0x9A, 0xA2, 0xA2, 0x9B, 0x8A, 0x71, 0x8A, 0x95, 0x7C, 0x51, 0x27, 0xFB, 0x00, 0x09, 0x14, 0x33, 0x4E,
+    0x63, 0x71, 0x78, 0x78, 0x71, 0x64, 0x59, 0xFE, 0x6A, 0x01, 0x4D, 0x24, 0xFA, 0x00, 0x08, 0x12, 0x2A, 0x3C, 0x48, 0x4D,
+    0x4D, 0x48, 0x3C, 0x38, 0xFE, 0x40, 0x01, 0x31, 0x12, 0xF9, 0x00, 0x07, 0x04, 0x14, 0x1E, 0x23, 0x23, 0x1E, 0x14, 0x11,
+    0xFE, 0x15, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0xAC, 0x00, 0x0D, 0x04, 0x13, 0x1E, 0x26, 0x28, 0x24,
+    0x1B, 0x0F, 0x1E, 0x26, 0x28, 0x24, 0x19, 0x08, 0xFB, 0x00, 0x0F, 0x13, 0x2B, 0x3B, 0x48, 0x50, 0x52, 0x4E, 0x43, 0x35,
+    0x46, 0x50, 0x52, 0x4D, 0x41, 0x2D, 0x12, 0xFD, 0x00, 0x11, 0x05, 0x2D, 0x4F, 0x62, 0x70, 0x7A, 0x7D, 0x78, 0x69, 0x59,
+    0x6E, 0x7A, 0x7D, 0x77, 0x67, 0x4E, 0x2F, 0x0C, 0xFE, 0x00, 0x11, 0x0B, 0x35, 0x60, 0x8A, 0x99, 0xA4, 0xA5, 0xA1, 0x8C,
+    0x78, 0x94, 0xA4, 0xA5, 0xA0, 0x8A, 0x6A, 0x46, 0x20, 0xFE, 0x00, 0x3C, 0x0B, 0x35, 0x60, 0x8A, 0x88, 0x7C, 0x7B, 0x89,
+    0xA5, 0x94, 0x99, 0x7F, 0x7A, 0x8B, 0xA5, 0x7F, 0x56, 0x2E, 0x05, 0x00, 0x00, 0x0B, 0x35, 0x5F, 0x73, 0x60, 0x53, 0x51,
+    0x6A, 0x8F, 0xAC, 0x84, 0x5D, 0x51, 0x72, 0x9A, 0x8B, 0x61, 0x38, 0x0E, 0x00, 0x00, 0x01, 0x26, 0x44, 0x4C, 0x39, 0x2E,
+    0x32, 0x5B, 0x85, 0xA5, 0x7B, 0x50, 0x3D, 0x67, 0x91, 0x92, 0x68, 0x3D, 0x13, 0xFE, 0x00, 0x11, 0x09, 0x23, 0x3B, 0x4C,
+    0x58, 0x5D, 0x5D, 0x82, 0xA2, 0x78, 0x5D, 0x5D, 0x64, 0x8F, 0x95, 0x6B, 0x41, 0x16, 0xFE, 0x00, 0x08, 0x23, 0x43, 0x5F,
+    0x74, 0x81, 0x87, 0x88, 0x88, 0xA3, 0xFD, 0x88, 0x10, 0x91, 0x97, 0x6D, 0x42, 0x18, 0x00, 0x00, 0x13, 0x3A, 0x5E, 0x7F,
+    0x9A, 0x9F, 0x97, 0x94, 0x95, 0xA7, 0xFB, 0x94, 0x0F, 0x6D, 0x42, 0x18, 0x00, 0x00, 0x21, 0x4A, 0x73, 0x99, 0x92, 0x77,
+    0x6D, 0x6A, 0x85, 0xA1, 0x76, 0xFC, 0x69, 0x10, 0x63, 0x3E, 0x16, 0x00, 0x00, 0x29, 0x53, 0x7D, 0xA7, 0x7F, 0x57, 0x43,
+    0x5B, 0x86, 0xA1, 0x77, 0x4D, 0xFD, 0x3F, 0x56, 0x3C, 0x26, 0x05, 0x00, 0x01, 0x2B, 0x56, 0x80, 0xA6, 0x7C, 0x51, 0x35,
+    0x5F, 0x89, 0xA6, 0x7C, 0x53, 0x2A, 0x2D, 0x40, 0x5A, 0x51, 0x2F, 0x08, 0x00, 0x00, 0x28, 0x52, 0x7C, 0xA6, 0x84, 0x60,
+    0x54, 0x6A, 0x92, 0xA9, 0x89, 0x66, 0x54, 0x56, 0x64, 0x7C, 0x62, 0x37, 0x0D, 0x00, 0x00, 0x20, 0x49, 0x70, 0x97, 0x9C,
+    0x85, 0x7E, 0x89, 0x9F, 0x84, 0xA2, 0x89, 0x7F, 0x80, 0x8B, 0x8C, 0x62, 0x37, 0x0D, 0x00, 0x00, 0x12, 0x38, 0x5C, 0x7C,
+    0x94, 0xA1, 0xA3, 0x9A, 0x83, 0x6D, 0x8A, 0x9C, 0xA3, 0xA1, 0x95, 0x82, 0x61, 0x37, 0x0D, 0xFE, 0x00, 0x11, 0x20, 0x40,
+    0x5A, 0x6D, 0x77, 0x78, 0x71, 0x61, 0x4E, 0x65, 0x73, 0x78, 0x77, 0x6D, 0x5D, 0x47, 0x29, 0x03, 0xFE, 0x00, 0x10, 0x04,
+    0x20, 0x35, 0x45, 0x4D, 0x4E, 0x48, 0x3B, 0x2B, 0x3E, 0x49, 0x4E, 0x4C, 0x45, 0x37, 0x23, 0x0B, 0xFB, 0x00, 0x0C, 0x0F,
+    0x1C, 0x22, 0x23, 0x1F, 0x13, 0x06, 0x16, 0x1F, 0x23, 0x22, 0x1B, 0x0F, 0x81, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0xA8,
+    0x00, 0x08, 0x03, 0x12, 0x1E, 0x25, 0x28, 0x27, 0x21, 0x17, 0x09, 0xF6, 0x00, 0x0B, 0x13, 0x29, 0x3B, 0x47, 0x4F, 0x52,
+    0x51, 0x4B, 0x3F, 0x30, 0x1D, 0x03, 0xF9, 0x00, 0x0C, 0x19, 0x36, 0x4E, 0x62, 0x70, 0x79, 0x7C, 0x7B, 0x74, 0x67, 0x56,
+    0x3F, 0x1D, 0xFA, 0x00, 0x0D, 0x15, 0x36, 0x55, 0x71, 0x88, 0x99, 0xA3, 0xA6, 0xA6, 0x9D, 0x8F, 0x7C, 0x52, 0x28, 0xFB,
+    0x00, 0x0E, 0x07, 0x2C, 0x50, 0x72, 0x91, 0xA8, 0x91, 0x81, 0x7B, 0x7D, 0x86, 0x96, 0x7D, 0x52, 0x28, 0xFB, 0x00, 0x0E,
+    0x17, 0x3E, 0x66, 0x8A, 0xAC, 0x8A, 0x6D, 0x59, 0x51, 0x52, 0x5E, 0x72, 0x7D, 0x52, 0x28, 0xFB, 0x00, 0x0E, 0x24, 0x4D,
+    0x76, 0x9D, 0x98, 0x72, 0x4E, 0x32, 0x26, 0x29, 0x38, 0x50, 0x63, 0x4A, 0x23, 0xFC, 0x00, 0x0F, 0x03, 0x2D, 0x57, 0x81,
+    0xAA, 0x8B, 0x62, 0x3A, 0x13, 0x00, 0x00, 0x14, 0x2E, 0x38, 0x2B, 0x0F, 0xFC, 0x00, 0x08, 0x07, 0x32, 0x5C, 0x87, 0xAE,
+    0x84, 0x5A, 0x30, 0x06, 0xFE, 0x00, 0x02, 0x07, 0x0E, 0x05, 0xFB, 0x00, 0x08, 0x09, 0x34, 0x5E, 0x89, 0xAD, 0x82, 0x58,
+    0x2D, 0x03, 0xF5, 0x00, 0x08, 0x07, 0x32, 0x5C, 0x86, 0xAF, 0x85, 0x5B, 0x30, 0x07, 0xFE, 0x00, 0x02, 0x0A, 0x11, 0x08,
+    0xFB, 0x00, 0x0F, 0x02, 0x2C, 0x56, 0x80, 0xA9, 0x8C, 0x63, 0x3B, 0x16, 0x00, 0x03, 0x16, 0x31, 0x3C, 0x2E, 0x11, 0xFB,
+    0x00, 0x0E, 0x23, 0x4C, 0x74, 0x9C, 0x9A, 0x74, 0x51, 0x36, 0x2B, 0x2D, 0x3A, 0x52, 0x66, 0x4C, 0x24, 0xFB, 0x00, 0x0E,
+    0x16, 0x3D, 0x64, 0x88, 0xAB, 0x8D, 0x71, 0x5D, 0x55, 0x57, 0x61, 0x74, 0x7D, 0x52, 0x28, 0xFB, 0x00, 0x0E, 0x05, 0x29,
+    0x4E, 0x6F, 0x8E, 0xA9, 0x95, 0x85, 0x80, 0x81, 0x89, 0x99, 0x7D, 0x52, 0x28, 0xFA, 0x00, 0x0D, 0x12, 0x33, 0x52, 0x6E,
+    0x84, 0x95, 0x9F, 0x95, 0x95, 0x99, 0x8B, 0x78, 0x52, 0x27, 0xF9, 0x00, 0x0C, 0x16, 0x33, 0x4A, 0x5E, 0x6C, 0x75, 0x84,
+    0x88, 0x70, 0x64, 0x52, 0x3C, 0x1B, 0xF8, 0x00, 0x0A, 0x0F, 0x30, 0x46, 0x43, 0x4B, 0x6E, 0x96, 0x7E, 0x56, 0x2D, 0x19,
+    0xF7, 0x00, 0x0A, 0x1B, 0x45, 0x6C, 0x69, 0x62, 0x6D, 0x94, 0x88, 0x5D, 0x33, 0x08, 0xF7, 0x00, 0x0A, 0x1C, 0x46, 0x71,
+    0x92, 0x8D, 0x92, 0xA0, 0x7F, 0x57, 0x2E, 0x05, 0xF7, 0x00, 0x09, 0x1C, 0x46, 0x6F, 0x7F, 0x84, 0x84, 0x7A, 0x64, 0x45,
+    0x20, 0xF6, 0x00, 0x09, 0x10, 0x34, 0x4C, 0x56, 0x5A, 0x59, 0x52, 0x42, 0x28, 0x09, 0xF5, 0x00, 0x07, 0x14, 0x23, 0x2C,
+    0x30, 0x2F, 0x29, 0x1B, 0x07, 0xF2, 0x00, 0x02, 0x01, 0x05, 0x05, 0xE3, 0x00, 0xA8, 0x00, 0x00, 0x16, 0xFE, 0x1E, 0x01,
+    0x19, 0x05, 0xF3, 0x00, 0x01, 0x1C, 0x3B, 0xFE, 0x48, 0x02, 0x40, 0x23, 0x01, 0xF5, 0x00, 0x02, 0x02, 0x2C, 0x56, 0xFE,
+    0x73, 0x02, 0x5E, 0x3C, 0x1A, 0xF4, 0x00, 0x08, 0x28, 0x4E, 0x6E, 0x8E, 0x9A, 0x78, 0x56, 0x34, 0x12, 0xF5, 0x00, 0x09,
+    0x12, 0x32, 0x53, 0x73, 0x93, 0x91, 0x6F, 0x4D, 0x2B, 0x09, 0xF5, 0x00, 0x08, 0x17, 0x37, 0x57, 0x77, 0x97, 0x89, 0x67,
+    0x45, 0x23, 0xF4, 0x00, 0x08, 0x1B, 0x3B, 0x5B, 0x7B, 0x9C, 0x80, 0x5E, 0x3B, 0x13, 0xF6, 0x00, 0x0A, 0x10, 0x27, 0x3A,
+    0x47, 0x60, 0x73, 0x73, 0x69, 0x41, 0x28, 0x0F, 0xF8, 0x00, 0x0C, 0x14, 0x32, 0x4B, 0x60, 0x70, 0x79, 0x7D, 0x7B, 0x71,
+    0x61, 0x4A, 0x2F, 0x11, 0xFA, 0x00, 0x0E, 0x0F, 0x31, 0x50, 0x6E, 0x86, 0x98, 0xA3, 0xA5, 0xA4, 0x99, 0x86, 0x6B, 0x4D,
+    0x2B, 0x08, 0xFB, 0x00, 0x0E, 0x25, 0x4A, 0x6C, 0x8C, 0xA9, 0x90, 0x80, 0x7B, 0x7F, 0x8F, 0xA8, 0x88, 0x66, 0x41, 0x1C,
+    0xFC, 0x00, 0x10, 0x10, 0x38, 0x5F, 0x84, 0xA8, 0x8C, 0x6E, 0x58, 0x50, 0x57, 0x6D, 0x8E, 0xA0, 0x7B, 0x53, 0x2B, 0x03,
+    0xFD, 0x00, 0x06, 0x1D, 0x46, 0x6F, 0x97, 0x9C, 0x76, 0x51, 0xFE, 0x34, 0x06, 0x54, 0x7C, 0xA4, 0x89, 0x60, 0x36, 0x0D,
+    0xFD, 0x00, 0x05, 0x26, 0x50, 0x7A, 0xA3, 0x90, 0x67, 0xFC, 0x5F, 0x05, 0x72, 0x9C, 0x92, 0x67, 0x3D, 0x13, 0xFE, 0x00,
+    0x05, 0x01, 0x2B, 0x56, 0x80, 0xAA, 0x8E, 0xFA, 0x89, 0x04, 0x9C, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x05, 0x02, 0x2D,
+    0x57, 0x82, 0xAC, 0x94, 0xF8, 0x93, 0x02, 0x6C, 0x41, 0x17, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x55, 0x80, 0xAA, 0x89, 0xF8,
+    0x68, 0x02, 0x61, 0x3D, 0x14, 0xFD, 0x00, 0x05, 0x25, 0x50, 0x79, 0xA2, 0x8E, 0x65, 0xF9, 0x3E, 0x02, 0x3B, 0x25, 0x04,
+    0xFD, 0x00, 0x0F, 0x1C, 0x45, 0x6E, 0x95, 0x9B, 0x75, 0x52, 0x37, 0x2B, 0x2B, 0x34, 0x41, 0x52, 0x62, 0x4D, 0x27, 0xFC,
+    0x00, 0x10, 0x0F, 0x36, 0x5E, 0x82, 0xA6, 0x8E, 0x72, 0x5E, 0x56, 0x56, 0x5D, 0x69, 0x79, 0x81, 0x56, 0x2C, 0x01, 0xFC,
+    0x00, 0x0F, 0x23, 0x48, 0x6A, 0x89, 0xA5, 0x96, 0x87, 0x80, 0x80, 0x86, 0x91, 0xA0, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00,
+    0x0F, 0x0D, 0x2E, 0x4D, 0x6A, 0x81, 0x92, 0x9D, 0xA2, 0xA2, 0x9D, 0x94, 0x88, 0x79, 0x56, 0x2B, 0x01, 0xFB, 0x00, 0x0D,
+    0x11, 0x2E, 0x46, 0x5B, 0x6A, 0x73, 0x78, 0x78, 0x73, 0x6B, 0x60, 0x52, 0x3F, 0x1E, 0xF9, 0x00, 0x0C, 0x0B, 0x22, 0x34,
+    0x41, 0x49, 0x4D, 0x4D, 0x49, 0x42, 0x37, 0x2A, 0x1B, 0x03, 0xF7, 0x00, 0x08, 0x0C, 0x18, 0x20, 0x23, 0x23, 0x1F, 0x18,
+    0x0E, 0x02, 0x81, 0x00, 0xFE, 0x00, 0xA3, 0x00, 0x05, 0x0A, 0x1B, 0x1E, 0x1E, 0x1D, 0x12, 0xF3, 0x00, 0x02, 0x08, 0x2A,
+    0x44, 0xFE, 0x48, 0x01, 0x35, 0x14, 0xF4, 0x00, 0x07, 0x22, 0x44, 0x66, 0x73, 0x73, 0x71, 0x4D, 0x23, 0xF5, 0x00, 0x08,
+    0x19, 0x3B, 0x5D, 0x7F, 0x9D, 0x87, 0x67, 0x46, 0x1F, 0xF6, 0x00, 0x09, 0x11, 0x33, 0x55, 0x77, 0x99, 0x8C, 0x6C, 0x4B,
+    0x2B, 0x0B, 0xF7, 0x00, 0x09, 0x08, 0x2A, 0x4C, 0x6E, 0x90, 0x90, 0x70, 0x50, 0x30, 0x0F, 0xF6, 0x00, 0x08, 0x1C, 0x43,
+    0x66, 0x88, 0x94, 0x74, 0x54, 0x34, 0x14, 0xF6, 0x00, 0x0A, 0x10, 0x27, 0x4A, 0x70, 0x73, 0x73, 0x58, 0x49, 0x3B, 0x28,
+    0x0F, 0xF8, 0x00, 0x0C, 0x14, 0x32, 0x4B, 0x60, 0x70, 0x79, 0x7D, 0x7B, 0x71, 0x61, 0x4A, 0x2F, 0x11, 0xFA, 0x00, 0x0E,
+    0x0F, 0x31, 0x50, 0x6E, 0x86, 0x98, 0xA3, 0xA5, 0xA4, 0x99, 0x86, 0x6B, 0x4D, 0x2B, 0x08, 0xFB, 0x00, 0x0E, 0x25, 0x4A,
+    0x6C, 0x8C, 0xA9, 0x90, 0x80, 0x7B, 0x7F, 0x8F, 0xA8, 0x88, 0x66, 0x41, 0x1C, 0xFC, 0x00, 0x10, 0x10, 0x38, 0x5F, 0x84,
+    0xA8, 0x8C, 0x6E, 0x58, 0x50, 0x57, 0x6D, 0x8E, 0xA0, 0x7B, 0x53, 0x2B, 0x03, 0xFD, 0x00, 0x06, 0x1D, 0x46, 0x6F, 0x97,
+    0x9C, 0x76, 0x51, 0xFE, 0x34, 0x06, 0x54, 0x7C, 0xA4, 0x89, 0x60, 0x36, 0x0D, 0xFD, 0x00, 0x05, 0x26, 0x50, 0x7A, 0xA3,
+    0x90, 0x67, 0xFC, 0x5F, 0x05, 0x72, 0x9C, 0x92, 0x67, 0x3D, 0x13, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x56, 0x80, 0xAA, 0x8E,
+    0xFA, 0x89, 0x04, 0x9C, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x05, 0x02, 0x2D, 0x57, 0x82, 0xAC, 0x94, 0xF8, 0x93, 0x02,
+    0x6C, 0x41, 0x17, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x55, 0x80, 0xAA, 0x89, 0xF8, 0x68, 0x02, 0x61, 0x3D, 0x14, 0xFD, 0x00,
+    0x05, 0x25, 0x50, 0x79, 0xA2, 0x8E, 0x65, 0xF9, 0x3E, 0x02, 0x3B, 0x25, 0x04, 0xFD, 0x00, 0x0F, 0x1C, 0x45, 0x6E, 0x95,
+    0x9B, 0x75, 0x52, 0x37, 0x2B, 0x2B, 0x34, 0x41, 0x52, 0x62, 0x4D, 0x27, 0xFC, 0x00, 0x10, 0x0F, 0x36, 0x5E, 0x82, 0xA6,
+    0x8E, 0x72, 0x5E, 0x56, 0x56, 0x5D, 0x69, 0x79, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x23, 0x48, 0x6A, 0x89, 0xA5,
+    0x96, 0x87, 0x80, 0x80, 0x86, 0x91, 0xA0, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x0D, 0x2E, 0x4D, 0x6A, 0x81, 0x92,
+    0x9D, 0xA2, 0xA2, 0x9D, 0x94, 0x88, 0x79, 0x56, 0x2B, 0x01, 0xFB, 0x00, 0x0D, 0x11, 0x2E, 0x46, 0x5B, 0x6A, 0x73, 0x78,
+    0x78, 0x73, 0x6B, 0x60, 0x52, 0x3F, 0x1E, 0xF9, 0x00, 0x0C, 0x0B, 0x22, 0x34, 0x41, 0x49, 0x4D, 0x4D, 0x49, 0x42, 0x37,
+    0x2A, 0x1B, 0x03, 0xF7, 0x00, 0x08, 0x0C, 0x18, 0x20, 0x23, 0x23, 0x1F, 0x18, 0x0E, 0x02, 0x81, 0x00, 0xFE, 0x00, 0xA5,
+    0x00, 0x04, 0x14, 0x1E, 0x1E, 0x1D, 0x10, 0xF2, 0x00, 0x06, 0x19, 0x39, 0x48, 0x48, 0x47, 0x33, 0x11, 0xF4, 0x00, 0x08,
+    0x0D, 0x30, 0x54, 0x72, 0x73, 0x6F, 0x4C, 0x28, 0x05, 0xF5, 0x00, 0x08, 0x24, 0x48, 0x6B, 0x8F, 0x9D, 0x87, 0x63, 0x40,
+    0x1C, 0xF6, 0x00, 0x0A, 0x18, 0x3B, 0x5F, 0x82, 0x9A, 0x7F, 0x9E, 0x7A, 0x57, 0x33, 0x10, 0xF8, 0x00, 0x0C, 0x0B, 0x2F,
+    0x53, 0x76, 0x9A, 0x81, 0x66, 0x88, 0x92, 0x6E, 0x4B, 0x27, 0x04, 0xF9, 0x00, 0x0C, 0x1F, 0x46, 0x6A, 0x8D, 0x8A, 0x67,
+    0x4D, 0x6F, 0x91, 0x85, 0x62, 0x3E, 0x16, 0xF9, 0x00, 0x0C, 0x24, 0x4D, 0x72, 0x73, 0x70, 0x4F, 0x52, 0x56, 0x73, 0x73,
+    0x6C, 0x44, 0x1A, 0xF9, 0x00, 0x0C, 0x15, 0x36, 0x4B, 0x60, 0x70, 0x79, 0x7D, 0x7B, 0x71, 0x61, 0x4A, 0x30, 0x11, 0xFA,
+    0x00, 0x0E, 0x0F, 0x31, 0x50, 0x6E, 0x86, 0x98, 0xA3, 0xA5, 0xA4, 0x99, 0x86, 0x6B, 0x4D, 0x2B, 0x08, 0xFB, 0x00, 0x0E,
+    0x25, 0x4A, 0x6C, 0x8C, 0xA9, 0x90, 0x80, 0x7B, 0x7F, 0x8F, 0xA8, 0x88, 0x66, 0x41, 0x1C, 0xFC, 0x00, 0x10, 0x10, 0x38,
+    0x5F, 0x84, 0xA8, 0x8C, 0x6E, 0x58, 0x50, 0x57, 0x6D, 0x8E, 0xA0, 0x7B, 0x53, 0x2B, 0x03, 0xFD, 0x00, 0x06, 0x1D, 0x46,
+    0x6F, 0x97, 0x9C, 0x76, 0x51, 0xFE, 0x34, 0x06, 0x54, 0x7C, 0xA4, 0x89, 0x60, 0x36, 0x0D, 0xFD, 0x00, 0x05, 0x26, 0x50,
+    0x7A, 0xA3, 0x90, 0x67, 0xFC, 0x5F, 0x05, 0x72, 0x9C, 0x92, 0x67, 0x3D, 0x13, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x56, 0x80,
+    0xAA, 0x8E, 0xFA, 0x89, 0x04, 0x9C, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00, 0x05, 0x02, 0x2D, 0x57, 0x82, 0xAC, 0x94, 0xF8,
+    0x93, 0x02, 0x6C, 0x41, 0x17, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x55, 0x80, 0xAA, 0x89, 0xF8, 0x68, 0x02, 0x61, 0x3D, 0x14,
+    0xFD, 0x00, 0x05, 0x25, 0x50, 0x79, 0xA2, 0x8E, 0x65, 0xF9, 0x3E, 0x02, 0x3B, 0x25, 0x04, 0xFD, 0x00, 0x0F, 0x1C, 0x45,
+    0x6E, 0x95, 0x9B, 0x75, 0x52, 0x37, 0x2B, 0x2B, 0x34, 0x41, 0x52, 0x62, 0x4D, 0x27, 0xFC, 0x00, 0x10, 0x0F, 0x36, 0x5E,
+    0x82, 0xA6, 0x8E, 0x72, 0x5E, 0x56, 0x56, 0x5D, 0x69, 0x79, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x23, 0x48, 0x6A,
+    0x89, 0xA5, 0x96, 0x87, 0x80, 0x80, 0x86, 0x91, 0xA0, 0x81, 0x56, 0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x0D, 0x2E, 0x4D, 0x6A,
+    0x81, 0x92, 0x9D, 0xA2, 0xA2, 0x9D, 0x94, 0x88, 0x79, 0x56, 0x2B, 0x01, 0xFB, 0x00, 0x0D, 0x11, 0x2E, 0x46, 0x5B, 0x6A,
+    0x73, 0x78, 0x78, 0x73, 0x6B, 0x60, 0x52, 0x3F, 0x1E, 0xF9, 0x00, 0x0C, 0x0B, 0x22, 0x34, 0x41, 0x49, 0x4D, 0x4D, 0x49,
+    0x42, 0x37, 0x2A, 0x1B, 0x03, 0xF7, 0x00, 0x08, 0x0C, 0x18, 0x20, 0x23, 0x23, 0x1F, 0x18, 0x0E, 0x02, 0x81, 0x00, 0xFE,
+    0x00, 0x93, 0x00, 0x01, 0x0D, 0x1C, 0xFE, 0x1D, 0x00, 0x14, 0xFE, 0x1D, 0x01, 0x1A, 0x07, 0xF8, 0x00, 0x06, 0x0B, 0x2E,
+    0x45, 0x48, 0x48, 0x47, 0x39, 0xFE, 0x48, 0x02, 0x42, 0x26, 0x02, 0xF9, 0x00, 0x06, 0x19, 0x42, 0x6A, 0x72, 0x72, 0x6F,
+    0x53, 0xFE, 0x72, 0x02, 0x61, 0x39, 0x0F, 0xF9, 0x00, 0x0C, 0x19, 0x44, 0x6E, 0x99, 0x9D, 0x76, 0x55, 0x80, 0x9D, 0x8F,
+    0x64, 0x3A, 0x0F, 0xF9, 0x00, 0x0C, 0x19, 0x44, 0x6E, 0x99, 0x9C, 0x76, 0x55, 0x80, 0x9C, 0x8F, 0x64, 0x3A, 0x0F, 0xF9,
+    0x00, 0x06, 0x18, 0x42, 0x6A, 0x72, 0x72, 0x6F, 0x53, 0xFE, 0x72, 0x02, 0x61, 0x39, 0x0F, 0xF9, 0x00, 0x0C, 0x0B, 0x2E,
+    0x45, 0x47, 0x47, 0x4F, 0x52, 0x50, 0x49, 0x47, 0x41, 0x26, 0x02, 0xF9, 0x00, 0x0C, 0x14, 0x32, 0x4B, 0x60, 0x70, 0x79,
+    0x7D, 0x7B, 0x71, 0x61, 0x4A, 0x2F, 0x11, 0xFA, 0x00, 0x0E, 0x0F, 0x31, 0x50, 0x6E, 0x86, 0x98, 0xA3, 0xA5, 0xA4, 0x99,
+    0x86, 0x6B, 0x4D, 0x2B, 0x08, 0xFB, 0x00, 0x0E, 0x25, 0x4A, 0x6C, 0x8C, 0xA9, 0x90, 0x80, 0x7B, 0x7F, 0x8F, 0xA8, 0x88,
+    0x66, 0x41, 0x1C, 0xFC, 0x00, 0x10, 0x10, 0x38, 0x5F, 0x84, 0xA8, 0x8C, 0x6E, 0x58, 0x50, 0x57, 0x6D, 0x8E, 0xA0, 0x7B,
+    0x53, 0x2B, 0x03, 0xFD, 0x00, 0x06, 0x1D, 0x46, 0x6F, 0x97, 0x9C, 0x76, 0x51, 0xFE, 0x34, 0x06, 0x54, 0x7C, 0xA4, 0x89,
+    0x60, 0x36, 0x0D, 0xFD, 0x00, 0x05, 0x26, 0x50, 0x7A, 0xA3, 0x90, 0x67, 0xFC, 0x5F, 0x05, 0x72, 0x9C, 0x92, 0x67, 0x3D,
+    0x13, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x56, 0x80, 0xAA, 0x8E, 0xFA, 0x89, 0x04, 0x9C, 0x95, 0x6B, 0x40, 0x16, 0xFE, 0x00,
+    0x05, 0x02, 0x2D, 0x57, 0x82, 0xAC, 0x94, 0xF8, 0x93, 0x02, 0x6C, 0x41, 0x17, 0xFE, 0x00, 0x05, 0x01, 0x2B, 0x55, 0x80,
+    0xAA, 0x89, 0xF8, 0x68, 0x02, 0x61, 0x3D, 0x14, 0xFD, 0x00, 0x05, 0x25, 0x50, 0x79, 0xA2, 0x8E, 0x65, 0xF9, 0x3E, 0x02,
+    0x3B, 0x25, 0x04, 0xFD, 0x00, 0x0F, 0x1C, 0x45, 0x6E, 0x95, 0x9B, 0x75, 0x52, 0x37, 0x2B, 0x2B, 0x34, 0x41, 0x52, 0x62,
+    0x4D, 0x27, 0xFC, 0x00, 0x10, 0x0F, 0x36, 0x5E, 0x82, 0xA6, 0x8E, 0x72, 0x5E, 0x56, 0x56, 0x5D, 0x69, 0x79, 0x81, 0x56,
+    0x2C, 0x01, 0xFC, 0x00, 0x0F, 0x23, 0x48, 0x6A, 0x89, 0xA5, 0x96, 0x87, 0x80, 0x80, 0x86, 0x91, 0xA0, 0x81, 0x56, 0x2C,
+    0x01, 0xFC, 0x00, 0x0F, 0x0D, 0x2E, 0x4D, 0x6A, 0x81, 0x92, 0x9D, 0xA2, 0xA2, 0x9D, 0x94, 0x88, 0x79, 0x56, 0x2B, 0x01,
+    0xFB, 0x00, 0x0D, 0x11, 0x2E, 0x46, 0x5B, 0x6A, 0x73, 0x78, 0x78, 0x73, 0x6B, 0x60, 0x52, 0x3F, 0x1E, 0xF9, 0x00, 0x0C,
+    0x0B, 0x22, 0x34, 0x41, 0x49, 0x4D, 0x4D, 0x49, 0x42, 0x37, 0x2A, 0x1B, 0x03, 0xF7, 0x00, 0x08, 0x0C, 0x18, 0x20, 0x23,
+    0x23, 0x1F, 0x18, 0x0E, 0x02, 0x81, 0x00, 0xFE, 0x00, 0xA9, 0x00, 0x01, 0x04, 0x18, 0xFE, 0x1E, 0x00, 0x16, 0xF2, 0x00,
+    0x01, 0x22, 0x3F, 0xFE, 0x48, 0x01, 0x3C, 0x1D, 0xF4, 0x00, 0x02, 0x09, 0x33, 0x5C, 0xFE, 0x73, 0x02, 0x59, 0x37, 0x15,
+    0xF5, 0x00, 0x09, 0x06, 0x2F, 0x53, 0x74, 0x94, 0x94, 0x72, 0x50, 0x2E, 0x0C, 0xF5, 0x00, 0x09, 0x17, 0x38, 0x58, 0x78,
+    0x98, 0x8C, 0x6A, 0x48, 0x26, 0x03, 0xF5, 0x00, 0x08, 0x1C, 0x3C, 0x5C, 0x7C, 0x9C, 0x83, 0x61, 0x3F, 0x1D, 0xF6, 0x00,
+    0x0A, 0x08, 0x18, 0x20, 0x40, 0x61, 0x81, 0x9C, 0x7A, 0x58, 0x34, 0x0C, 0xF8, 0x00, 0x02, 0x06, 0x29, 0x41, 0xFE, 0x45,
+    0x05, 0x65, 0x73, 0x73, 0x63, 0x3A, 0x10, 0xF8, 0x00, 0x02, 0x14, 0x3E, 0x65, 0xFB, 0x70, 0x02, 0x53, 0x2A, 0x04, 0xF8,
+    0x00, 0x03, 0x15, 0x40, 0x6A, 0x95, 0xFD, 0x9A, 0x03, 0x80, 0x56, 0x2B, 0x01, 0xF8, 0x00, 0x02, 0x15, 0x40, 0x6A, 0xFE,
+    0x82, 0x05, 0x86, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF8, 0x00, 0x0B, 0x0E, 0x34, 0x52, 0x57, 0x57, 0x5B, 0x85, 0xAB, 0x80,
+    0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0A, 0x17, 0x2A, 0x2D, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08,
+    0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B,
+    0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85,
+    0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0C, 0x05, 0x07, 0x07, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x07, 0x07,
+    0x04, 0xFA, 0x00, 0x01, 0x19, 0x2E, 0xFE, 0x32, 0x04, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0xFE, 0x32, 0x01, 0x2C, 0x15, 0xFC,
+    0x00, 0x02, 0x0C, 0x34, 0x55, 0xFD, 0x5C, 0x02, 0x85, 0xAB, 0x80, 0xFD, 0x5C, 0x02, 0x51, 0x2F, 0x07, 0xFD, 0x00, 0x02,
+    0x12, 0x3C, 0x67, 0xFD, 0x87, 0x01, 0x89, 0xAB, 0xFC, 0x87, 0x02, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x03, 0x12, 0x3C, 0x67,
+    0x91, 0xF8, 0x95, 0x03, 0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x02, 0x10, 0x39, 0x5F, 0xF6, 0x6A, 0x02, 0x5B, 0x34, 0x0B,
+    0xFC, 0x00, 0x01, 0x23, 0x3B, 0xF6, 0x40, 0x01, 0x39, 0x1F, 0xFB, 0x00, 0x01, 0x02, 0x12, 0xF6, 0x15, 0x00, 0x11, 0x81,
+    0x00, 0x01, 0x00, 0x00, 0xA3, 0x00, 0x05, 0x0E, 0x1C, 0x1E, 0x1E, 0x1D, 0x0F, 0xF3, 0x00, 0x07, 0x0E, 0x2F, 0x46, 0x48,
+    0x48, 0x46, 0x31, 0x0E, 0xF5, 0x00, 0x08, 0x05, 0x27, 0x49, 0x6B, 0x73, 0x73, 0x6D, 0x46, 0x1C, 0xF5, 0x00, 0x08, 0x1F,
+    0x41, 0x63, 0x85, 0x9D, 0x82, 0x62, 0x40, 0x19, 0xF6, 0x00, 0x09, 0x16, 0x38, 0x5A, 0x7C, 0x9E, 0x86, 0x66, 0x46, 0x26,
+    0x05, 0xF7, 0x00, 0x09, 0x0E, 0x30, 0x52, 0x74, 0x96, 0x8B, 0x6B, 0x4A, 0x2A, 0x0A, 0xF8, 0x00, 0x0A, 0x08, 0x18, 0x23,
+    0x49, 0x6B, 0x8D, 0x8F, 0x6F, 0x4F, 0x2F, 0x0E, 0xF8, 0x00, 0x0A, 0x06, 0x29, 0x41, 0x45, 0x51, 0x73, 0x73, 0x72, 0x53,
+    0x38, 0x19, 0xF7, 0x00, 0x02, 0x14, 0x3E, 0x65, 0xFB, 0x70, 0x01, 0x53, 0x2A, 0xF7, 0x00, 0x03, 0x15, 0x40, 0x6A, 0x95,
+    0xFD, 0x9A, 0x03, 0x80, 0x56, 0x2B, 0x01, 0xF8, 0x00, 0x02, 0x15, 0x40, 0x6A, 0xFE, 0x82, 0x05, 0x86, 0xAB, 0x80, 0x56,
+    0x2B, 0x01, 0xF8, 0x00, 0x0B, 0x0E, 0x34, 0x52, 0x57, 0x57, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0A,
+    0x17, 0x2A, 0x2D, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80,
+    0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30,
+    0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF7,
+    0x00, 0x0C, 0x05, 0x07, 0x07, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x07, 0x07, 0x04, 0xFA, 0x00, 0x01, 0x19, 0x2E,
+    0xFE, 0x32, 0x04, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0xFE, 0x32, 0x01, 0x2C, 0x15, 0xFC, 0x00, 0x02, 0x0C, 0x34, 0x55, 0xFD,
+    0x5C, 0x02, 0x85, 0xAB, 0x80, 0xFD, 0x5C, 0x02, 0x51, 0x2F, 0x07, 0xFD, 0x00, 0x02, 0x12, 0x3C, 0x67, 0xFD, 0x87, 0x01,
+    0x89, 0xAB, 0xFC, 0x87, 0x02, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x03, 0x12, 0x3C, 0x67, 0x91, 0xF8, 0x95, 0x03, 0x8C, 0x62,
+    0x37, 0x0D, 0xFD, 0x00, 0x02, 0x10, 0x39, 0x5F, 0xF6, 0x6A, 0x02, 0x5B, 0x34, 0x0B, 0xFC, 0x00, 0x01, 0x23, 0x3B, 0xF6,
+    0x40, 0x01, 0x39, 0x1F, 0xFB, 0x00, 0x01, 0x02, 0x12, 0xF6, 0x15, 0x00, 0x11, 0x81, 0x00, 0x01, 0x00, 0x00, 0xA6, 0x00,
+    0x05, 0x02, 0x17, 0x1E, 0x1E, 0x1C, 0x0D, 0xF2, 0x00, 0x06, 0x1F, 0x3D, 0x48, 0x48, 0x45, 0x2E, 0x0B, 0xF4, 0x00, 0x07,
+    0x13, 0x36, 0x5A, 0x73, 0x73, 0x6A, 0x46, 0x23, 0xF5, 0x00, 0x09, 0x06, 0x2A, 0x4D, 0x71, 0x95, 0x9D, 0x81, 0x5D, 0x3A,
+    0x16, 0xF6, 0x00, 0x0A, 0x1E, 0x41, 0x65, 0x88, 0x94, 0x85, 0x98, 0x75, 0x51, 0x2E, 0x0A, 0xF8, 0x00, 0x0B, 0x11, 0x35,
+    0x58, 0x7C, 0x9D, 0x7B, 0x6C, 0x8E, 0x8C, 0x68, 0x45, 0x21, 0xF8, 0x00, 0x0C, 0x26, 0x4C, 0x70, 0x93, 0x84, 0x62, 0x53,
+    0x75, 0x97, 0x80, 0x5C, 0x38, 0x10, 0xFA, 0x00, 0x0D, 0x06, 0x2A, 0x54, 0x73, 0x73, 0x6B, 0x49, 0x45, 0x5B, 0x73, 0x73,
+    0x66, 0x3D, 0x13, 0xFA, 0x00, 0x02, 0x14, 0x3E, 0x65, 0xFB, 0x70, 0x04, 0x53, 0x49, 0x44, 0x2A, 0x07, 0xFA, 0x00, 0x03,
+    0x15, 0x40, 0x6A, 0x95, 0xFD, 0x9A, 0x04, 0x80, 0x56, 0x2B, 0x1C, 0x0A, 0xF9, 0x00, 0x02, 0x15, 0x40, 0x6A, 0xFE, 0x82,
+    0x05, 0x86, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF8, 0x00, 0x0B, 0x0E, 0x34, 0x52, 0x57, 0x57, 0x5B, 0x85, 0xAB, 0x80, 0x56,
+    0x2B, 0x01, 0xF7, 0x00, 0x0A, 0x17, 0x2A, 0x2D, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06,
+    0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01,
+    0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB,
+    0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0C, 0x05, 0x07, 0x07, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x07, 0x07, 0x04,
+    0xFA, 0x00, 0x01, 0x19, 0x2E, 0xFE, 0x32, 0x04, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0xFE, 0x32, 0x01, 0x2C, 0x15, 0xFC, 0x00,
+    0x02, 0x0C, 0x34, 0x55, 0xFD, 0x5C, 0x02, 0x85, 0xAB, 0x80, 0xFD, 0x5C, 0x02, 0x51, 0x2F, 0x07, 0xFD, 0x00, 0x02, 0x12,
+    0x3C, 0x67, 0xFD, 0x87, 0x01, 0x89, 0xAB, 0xFC, 0x87, 0x02, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x03, 0x12, 0x3C, 0x67, 0x91,
+    0xF8, 0x95, 0x03, 0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x02, 0x10, 0x39, 0x5F, 0xF6, 0x6A, 0x02, 0x5B, 0x34, 0x0B, 0xFC,
+    0x00, 0x01, 0x23, 0x3B, 0xF6, 0x40, 0x01, 0x39, 0x1F, 0xFB, 0x00, 0x01, 0x02, 0x12, 0xF6, 0x15, 0x00, 0x11, 0x81, 0x00,
+    0x01, 0x00, 0x00, 0x93, 0x00, 0x01, 0x0A, 0x1B, 0xFE, 0x1D, 0x00, 0x13, 0xFE, 0x1D, 0x01, 0x1B, 0x0A, 0xF8, 0x00, 0x02,
+    0x07, 0x2A, 0x44, 0xFE, 0x48, 0x00, 0x37, 0xFE, 0x48, 0x02, 0x44, 0x2A, 0x07, 0xF9, 0x00, 0x02, 0x14, 0x3E, 0x66, 0xFE,
+    0x72, 0x06, 0x4F, 0x71, 0x72, 0x72, 0x66, 0x3E, 0x14, 0xF9, 0x00, 0x0C, 0x14, 0x3F, 0x69, 0x94, 0x9D, 0x7B, 0x51, 0x7B,
+    0x9D, 0x94, 0x69, 0x3F, 0x14, 0xF9, 0x00, 0x0C, 0x14, 0x3F, 0x69, 0x94, 0x9C, 0x7B, 0x51, 0x7B, 0x9C, 0x94, 0x69, 0x3F,
+    0x14, 0xF9, 0x00, 0x0C, 0x14, 0x3E, 0x66, 0x72, 0x72, 0x71, 0x4F, 0x71, 0x72, 0x72, 0x66, 0x3E, 0x14, 0xFA, 0x00, 0x03,
+    0x06, 0x29, 0x41, 0x45, 0xFE, 0x47, 0x00, 0x45, 0xFE, 0x47, 0x02, 0x43, 0x2A, 0x07, 0xFA, 0x00, 0x02, 0x14, 0x3E, 0x65,
+    0xFB, 0x70, 0x03, 0x53, 0x2A, 0x1A, 0x0A, 0xF9, 0x00, 0x03, 0x15, 0x40, 0x6A, 0x95, 0xFD, 0x9A, 0x03, 0x80, 0x56, 0x2B,
+    0x01, 0xF8, 0x00, 0x02, 0x15, 0x40, 0x6A, 0xFE, 0x82, 0x05, 0x86, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF8, 0x00, 0x0B, 0x0E,
+    0x34, 0x52, 0x57, 0x57, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0A, 0x17, 0x2A, 0x2D, 0x30, 0x5B, 0x85,
+    0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08,
+    0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B,
+    0x01, 0xF5, 0x00, 0x08, 0x06, 0x30, 0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x01, 0xF7, 0x00, 0x0C, 0x05, 0x07, 0x07, 0x30,
+    0x5B, 0x85, 0xAB, 0x80, 0x56, 0x2B, 0x07, 0x07, 0x04, 0xFA, 0x00, 0x01, 0x19, 0x2E, 0xFE, 0x32, 0x04, 0x5B, 0x85, 0xAB,
+    0x80, 0x56, 0xFE, 0x32, 0x01, 0x2C, 0x15, 0xFC, 0x00, 0x02, 0x0C, 0x34, 0x55, 0xFD, 0x5C, 0x02, 0x85, 0xAB, 0x80, 0xFD,
+    0x5C, 0x02, 0x51, 0x2F, 0x07, 0xFD, 0x00, 0x02, 0x12, 0x3C, 0x67, 0xFD, 0x87, 0x01, 0x89, 0xAB, 0xFC, 0x87, 0x02, 0x62,
+    0x37, 0x0D, 0xFD, 0x00, 0x03, 0x12, 0x3C, 0x67, 0x91, 0xF8, 0x95, 0x03, 0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x02, 0x10,
+    0x39, 0x5F, 0xF6, 0x6A, 0x02, 0x5B, 0x34, 0x0B, 0xFC, 0x00, 0x01, 0x23, 0x3B, 0xF6, 0x40, 0x01, 0x39, 0x1F, 0xFB, 0x00,
+    0x01, 0x02, 0x12, 0xF6, 0x15, 0x00, 0x11, 0x81, 0x00, 0x01, 0x00, 0x00, 0x93, 0x00, 0x00, 0x16, 0xFE, 0x1F, 0x05, 0x1D,
+    0x0E, 0x00, 0x00, 0x04, 0x04, 0xF7, 0x00, 0x01, 0x1B, 0x3B, 0xFE, 0x4A, 0x06, 0x47, 0x2E, 0x14, 0x21, 0x2E, 0x2D, 0x18,
+    0xF8, 0x00, 0x01, 0x2A, 0x53, 0xFE, 0x74, 0x07, 0x6A, 0x4A, 0x3C, 0x4A, 0x57, 0x54, 0x34, 0x0D, 0xF9, 0x00, 0x0C, 0x25,
+    0x4B, 0x6A, 0x8A, 0x9F, 0x86, 0x66, 0x65, 0x72, 0x7F, 0x6B, 0x43, 0x1A, 0xFA, 0x00, 0x0D, 0x08, 0x28, 0x3C, 0x4E, 0x6D,
+    0x8D, 0xA2, 0x82, 0x8D, 0x98, 0x8B, 0x78, 0x4E, 0x23, 0xFA, 0x00, 0x0D, 0x19, 0x41, 0x64, 0x72, 0x80, 0x8D, 0x9A, 0xA6,
+    0x7E, 0x6F, 0x62, 0x55, 0x3E, 0x1A, 0xFA, 0x00, 0x0D, 0x19, 0x43, 0x6B, 0x94, 0x8A, 0x7D, 0x76, 0x96, 0x9A, 0x7A, 0x59,
+    0x37, 0x1D, 0x02, 0xFA, 0x00, 0x0D, 0x0E, 0x36, 0x5F, 0x6F, 0x62, 0x5C, 0x62, 0x7B, 0x9D, 0x95, 0x73, 0x50, 0x2D, 0x09,
+    0xFA, 0x00, 0x0D, 0x04, 0x26, 0x45, 0x60, 0x76, 0x85, 0x8C, 0x8E, 0x93, 0xAE, 0x8B, 0x67, 0x43, 0x1E, 0xFA, 0x00, 0x0E,
+    0x1C, 0x40, 0x62, 0x81, 0x9B, 0xA3, 0x96, 0x92, 0x96, 0xA0, 0xA2, 0x7D, 0x57, 0x31, 0x0A, 0xFC, 0x00, 0x0F, 0x07, 0x2F,
+    0x55, 0x7B, 0x9D, 0x9B, 0x7E, 0x6C, 0x68, 0x6C, 0x81, 0xA6, 0x90, 0x69, 0x42, 0x1A, 0xFC, 0x00, 0x0F, 0x15, 0x3E, 0x66,
+    0x8E, 0xA9, 0x82, 0x5F, 0x44, 0x3D, 0x47, 0x6D, 0x95, 0xA0, 0x78, 0x4F, 0x26, 0xFC, 0x00, 0x10, 0x1E, 0x48, 0x71, 0x9B,
+    0x9B, 0x72, 0x4A, 0x24, 0x13, 0x37, 0x5F, 0x88, 0xAD, 0x83, 0x5A, 0x30, 0x06, 0xFD, 0x00, 0x10, 0x24, 0x4E, 0x78, 0xA2,
+    0x93, 0x69, 0x3F, 0x15, 0x03, 0x2C, 0x56, 0x80, 0xAB, 0x8B, 0x60, 0x36, 0x0C, 0xFD, 0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5,
+    0x90, 0x66, 0x3B, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x8E, 0x63, 0x39, 0x0E, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4,
+    0x91, 0x67, 0x3D, 0x12, 0x00, 0x2A, 0x54, 0x7E, 0xA9, 0x8D, 0x62, 0x38, 0x0D, 0xFD, 0x00, 0x10, 0x21, 0x4B, 0x75, 0x9F,
+    0x97, 0x6D, 0x44, 0x1B, 0x09, 0x31, 0x5A, 0x84, 0xAE, 0x88, 0x5E, 0x34, 0x0A, 0xFD, 0x00, 0x10, 0x19, 0x43, 0x6C, 0x95,
+    0xA1, 0x7A, 0x54, 0x33, 0x2B, 0x44, 0x68, 0x8F, 0xA7, 0x7F, 0x55, 0x2C, 0x03, 0xFD, 0x00, 0x0F, 0x0E, 0x36, 0x5E, 0x84,
+    0xAA, 0x8E, 0x6F, 0x59, 0x55, 0x63, 0x7F, 0xA2, 0x95, 0x70, 0x48, 0x20, 0xFB, 0x00, 0x0E, 0x25, 0x4B, 0x6E, 0x8F, 0xAB,
+    0x91, 0x82, 0x80, 0x89, 0x9E, 0x9D, 0x7E, 0x5B, 0x36, 0x11, 0xFB, 0x00, 0x0D, 0x11, 0x33, 0x53, 0x71, 0x88, 0x99, 0xA1,
+    0xA2, 0x9D, 0x91, 0x7C, 0x61, 0x42, 0x20, 0xF9, 0x00, 0x0C, 0x17, 0x35, 0x4E, 0x62, 0x70, 0x77, 0x78, 0x74, 0x69, 0x58,
+    0x40, 0x25, 0x06, 0xF8, 0x00, 0x0A, 0x13, 0x29, 0x3B, 0x46, 0x4D, 0x4E, 0x4A, 0x41, 0x32, 0x1E, 0x05, 0xF6, 0x00, 0x07,
+    0x03, 0x12, 0x1D, 0x22, 0x23, 0x20, 0x18, 0x0B, 0x81, 0x00, 0xFC, 0x00, 0xA6, 0x00, 0x07, 0x01, 0x06, 0x03, 0x00, 0x00,
+    0x06, 0x06, 0x05, 0xF6, 0x00, 0x0A, 0x02, 0x1A, 0x2A, 0x30, 0x2D, 0x1F, 0x23, 0x30, 0x31, 0x2F, 0x1C, 0xF7, 0x00, 0x0B,
+    0x21, 0x3E, 0x52, 0x5B, 0x56, 0x44, 0x44, 0x5B, 0x5B, 0x57, 0x39, 0x13, 0xF9, 0x00, 0x0C, 0x15, 0x3A, 0x5D, 0x79, 0x85,
+    0x7E, 0x67, 0x50, 0x7B, 0x86, 0x6E, 0x43, 0x19, 0xF9, 0x00, 0x0C, 0x24, 0x4C, 0x74, 0x98, 0x8F, 0x9A, 0x86, 0x69, 0x80,
+    0x93, 0x6A, 0x40, 0x16, 0xFA, 0x00, 0x0D, 0x03, 0x2D, 0x57, 0x81, 0x93, 0x6A, 0x79, 0x97, 0x8F, 0x98, 0x85, 0x5E, 0x36,
+    0x0E, 0xFA, 0x00, 0x0C, 0x06, 0x30, 0x5B, 0x85, 0x86, 0x63, 0x5B, 0x75, 0x85, 0x82, 0x6B, 0x4B, 0x26, 0xF9, 0x00, 0x0C,
+    0x20, 0x3C, 0x4C, 0x5C, 0x5C, 0x51, 0x47, 0x50, 0x5B, 0x58, 0x49, 0x2F, 0x15, 0xFA, 0x00, 0x0E, 0x08, 0x32, 0x5B, 0x70,
+    0x70, 0x6F, 0x5D, 0x70, 0x7A, 0x7D, 0x77, 0x69, 0x51, 0x33, 0x12, 0xFB, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x9A, 0x7D,
+    0x80, 0x97, 0xA4, 0xA7, 0xA0, 0x8D, 0x6F, 0x4D, 0x28, 0x01, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x97,
+    0x84, 0x7D, 0x82, 0x96, 0xAB, 0x87, 0x60, 0x38, 0x10, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xB0, 0x9B, 0x78, 0x5D,
+    0x52, 0x5B, 0x79, 0x9F, 0x96, 0x6D, 0x44, 0x1A, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xB2, 0x89, 0x62, 0x3C, 0x28,
+    0x41, 0x6A, 0x93, 0x9F, 0x74, 0x4A, 0x20, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xAA, 0x80, 0x56, 0x2C, 0x0F, 0x3A,
+    0x64, 0x8F, 0xA2, 0x77, 0x4D, 0x22, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64,
+    0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E,
+    0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2,
+    0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78,
+    0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D,
+    0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23,
+    0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC,
+    0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x95, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0x95, 0x78, 0x4D, 0x23, 0xFC, 0x00,
+    0x02, 0x07, 0x31, 0x58, 0xFE, 0x6A, 0x09, 0x4E, 0x25, 0x0D, 0x36, 0x5D, 0x6A, 0x6A, 0x69, 0x49, 0x20, 0xFB, 0x00, 0x01,
+    0x1C, 0x38, 0xFE, 0x40, 0x09, 0x31, 0x13, 0x00, 0x21, 0x3A, 0x40, 0x40, 0x3F, 0x2E, 0x0F, 0xFA, 0x00, 0x00, 0x10, 0xFE,
+    0x15, 0x00, 0x0C, 0xFE, 0x00, 0x00, 0x12, 0xFE, 0x15, 0x00, 0x0A, 0x81, 0x00, 0x01, 0x00, 0x00, 0xA9, 0x00, 0x01, 0x04,
+    0x18, 0xFE, 0x1E, 0x00, 0x16, 0xF2, 0x00, 0x01, 0x22, 0x3F, 0xFE, 0x48, 0x01, 0x3C, 0x1D, 0xF4, 0x00, 0x02, 0x09, 0x33,
+    0x5C, 0xFE, 0x73, 0x02, 0x59, 0x37, 0x15, 0xF5, 0x00, 0x09, 0x06, 0x2F, 0x53, 0x74, 0x94, 0x94, 0x72, 0x50, 0x2E, 0x0C,
+    0xF5, 0x00, 0x09, 0x17, 0x38, 0x58, 0x78, 0x98, 0x8C, 0x6A, 0x48, 0x26, 0x03, 0xF5, 0x00, 0x08, 0x1C, 0x3C, 0x5C, 0x7C,
+    0x9C, 0x83, 0x61, 0x3F, 0x1D, 0xF4, 0x00, 0x08, 0x20, 0x40, 0x61, 0x81, 0x9C, 0x7A, 0x58, 0x34, 0x0C, 0xF6, 0x00, 0x0A,
+    0x17, 0x2D, 0x3F, 0x4B, 0x65, 0x73, 0x73, 0x63, 0x3A, 0x22, 0x08, 0xF8, 0x00, 0x0C, 0x1A, 0x39, 0x52, 0x67, 0x75, 0x7B,
+    0x7C, 0x78, 0x6D, 0x5C, 0x44, 0x28, 0x09, 0xFA, 0x00, 0x0D, 0x13, 0x35, 0x56, 0x74, 0x8C, 0x9D, 0xA6, 0xA6, 0xA2, 0x95,
+    0x7F, 0x64, 0x45, 0x22, 0xFA, 0x00, 0x0E, 0x27, 0x4D, 0x71, 0x92, 0xA7, 0x8D, 0x7E, 0x7B, 0x85, 0x9A, 0xA0, 0x80, 0x5D,
+    0x38, 0x12, 0xFC, 0x00, 0x0F, 0x0F, 0x37, 0x5F, 0x86, 0xAC, 0x8C, 0x6B, 0x55, 0x51, 0x5F, 0x7D, 0xA0, 0x97, 0x71, 0x49,
+    0x21, 0xFC, 0x00, 0x10, 0x19, 0x43, 0x6C, 0x95, 0xA1, 0x79, 0x52, 0x2F, 0x27, 0x41, 0x67, 0x8E, 0xA7, 0x7F, 0x55, 0x2C,
+    0x02, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0x9F, 0x97, 0x6D, 0x43, 0x1A, 0x08, 0x31, 0x5A, 0x84, 0xAE, 0x88, 0x5E, 0x33,
+    0x09, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F, 0xA9, 0x8D, 0x62, 0x38,
+    0x0D, 0xFD, 0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5, 0x90, 0x66, 0x3B, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x8E, 0x64, 0x39,
+    0x0F, 0xFD, 0x00, 0x10, 0x24, 0x4F, 0x79, 0xA4, 0x92, 0x68, 0x3D, 0x13, 0x00, 0x2A, 0x55, 0x7F, 0xA9, 0x8C, 0x62, 0x37,
+    0x0D, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x98, 0x6E, 0x45, 0x1C, 0x0A, 0x32, 0x5B, 0x85, 0xAF, 0x87, 0x5D, 0x33,
+    0x09, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6B, 0x94, 0xA2, 0x7A, 0x54, 0x32, 0x2B, 0x44, 0x69, 0x90, 0xA6, 0x7E, 0x55, 0x2B,
+    0x02, 0xFD, 0x00, 0x0F, 0x0D, 0x36, 0x5E, 0x84, 0xA9, 0x8E, 0x6E, 0x59, 0x55, 0x63, 0x7F, 0xA2, 0x95, 0x6F, 0x48, 0x1F,
+    0xFB, 0x00, 0x0E, 0x25, 0x4B, 0x6E, 0x90, 0xAA, 0x91, 0x82, 0x80, 0x89, 0x9E, 0x9D, 0x7E, 0x5B, 0x36, 0x10, 0xFB, 0x00,
+    0x0D, 0x10, 0x33, 0x54, 0x71, 0x88, 0x99, 0xA1, 0xA2, 0x9D, 0x91, 0x7C, 0x61, 0x43, 0x20, 0xF9, 0x00, 0x0C, 0x17, 0x35,
+    0x4F, 0x63, 0x70, 0x77, 0x78, 0x74, 0x69, 0x58, 0x41, 0x25, 0x07, 0xF8, 0x00, 0x0A, 0x13, 0x29, 0x3B, 0x46, 0x4D, 0x4E,
+    0x4A, 0x41, 0x32, 0x1E, 0x05, 0xF6, 0x00, 0x07, 0x04, 0x12, 0x1D, 0x22, 0x23, 0x20, 0x18, 0x0B, 0x81, 0x00, 0xFC, 0x00,
+    0xA3, 0x00, 0x05, 0x0E, 0x1C, 0x1E, 0x1E, 0x1D, 0x0F, 0xF3, 0x00, 0x07, 0x0E, 0x2F, 0x46, 0x48, 0x48, 0x46, 0x31, 0x0E,
+    0xF5, 0x00, 0x08, 0x05, 0x27, 0x49, 0x6B, 0x73, 0x73, 0x6D, 0x46, 0x1C, 0xF5, 0x00, 0x08, 0x1F, 0x41, 0x63, 0x85, 0x9D,
+    0x82, 0x62, 0x40, 0x19, 0xF6, 0x00, 0x09, 0x16, 0x38, 0x5A, 0x7C, 0x9E, 0x86, 0x66, 0x46, 0x26, 0x05, 0xF7, 0x00, 0x09,
+    0x0E, 0x30, 0x52, 0x74, 0x96, 0x8B, 0x6B, 0x4A, 0x2A, 0x0A, 0xF6, 0x00, 0x08, 0x23, 0x49, 0x6B, 0x8D, 0x8F, 0x6F, 0x4F,
+    0x2F, 0x0E, 0xF6, 0x00, 0x0A, 0x17, 0x2D, 0x51, 0x73, 0x73, 0x72, 0x53, 0x45, 0x36, 0x22, 0x08, 0xF8, 0x00, 0x0C, 0x1A,
+    0x39, 0x52, 0x67, 0x75, 0x7B, 0x7C, 0x78, 0x6D, 0x5C, 0x44, 0x28, 0x09, 0xFA, 0x00, 0x0D, 0x13, 0x35, 0x56, 0x74, 0x8C,
+    0x9D, 0xA6, 0xA6, 0xA2, 0x95, 0x7F, 0x64, 0x45, 0x22, 0xFA, 0x00, 0x0E, 0x27, 0x4D, 0x71, 0x92, 0xA7, 0x8D, 0x7E, 0x7B,
+    0x85, 0x9A, 0xA0, 0x80, 0x5D, 0x38, 0x12, 0xFC, 0x00, 0x0F, 0x0F, 0x37, 0x5F, 0x86, 0xAC, 0x8C, 0x6B, 0x55, 0x51, 0x5F,
+    0x7D, 0xA0, 0x97, 0x71, 0x49, 0x21, 0xFC, 0x00, 0x10, 0x19, 0x43, 0x6C, 0x95, 0xA1, 0x79, 0x52, 0x2F, 0x27, 0x41, 0x67,
+    0x8E, 0xA7, 0x7F, 0x55, 0x2C, 0x02, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0x9F, 0x97, 0x6D, 0x43, 0x1A, 0x08, 0x31, 0x5A,
+    0x84, 0xAE, 0x88, 0x5E, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54,
+    0x7F, 0xA9, 0x8D, 0x62, 0x38, 0x0D, 0xFD, 0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5, 0x90, 0x66, 0x3B, 0x11, 0x00, 0x28, 0x53,
+    0x7D, 0xA8, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x24, 0x4F, 0x79, 0xA4, 0x92, 0x68, 0x3D, 0x13, 0x00, 0x2A, 0x55,
+    0x7F, 0xA9, 0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x98, 0x6E, 0x45, 0x1C, 0x0A, 0x32, 0x5B,
+    0x85, 0xAF, 0x87, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6B, 0x94, 0xA2, 0x7A, 0x54, 0x32, 0x2B, 0x44, 0x69,
+    0x90, 0xA6, 0x7E, 0x55, 0x2B, 0x02, 0xFD, 0x00, 0x0F, 0x0D, 0x36, 0x5E, 0x84, 0xA9, 0x8E, 0x6E, 0x59, 0x55, 0x63, 0x7F,
+    0xA2, 0x95, 0x6F, 0x48, 0x1F, 0xFB, 0x00, 0x0E, 0x25, 0x4B, 0x6E, 0x90, 0xAA, 0x91, 0x82, 0x80, 0x89, 0x9E, 0x9D, 0x7E,
+    0x5B, 0x36, 0x10, 0xFB, 0x00, 0x0D, 0x10, 0x33, 0x54, 0x71, 0x88, 0x99, 0xA1, 0xA2, 0x9D, 0x91, 0x7C, 0x61, 0x43, 0x20,
+    0xF9, 0x00, 0x0C, 0x17, 0x35, 0x4F, 0x63, 0x70, 0x77, 0x78, 0x74, 0x69, 0x58, 0x41, 0x25, 0x07, 0xF8, 0x00, 0x0A, 0x13,
+    0x29, 0x3B, 0x46, 0x4D, 0x4E, 0x4A, 0x41, 0x32, 0x1E, 0x05, 0xF6, 0x00, 0x07, 0x04, 0x12, 0x1D, 0x22, 0x23, 0x20, 0x18,
+    0x0B, 0x81, 0x00, 0xFC, 0x00, 0xA6, 0x00, 0x05, 0x02, 0x17, 0x1E, 0x1E, 0x1C, 0x0D, 0xF2, 0x00, 0x06, 0x1F, 0x3D, 0x48,
+    0x48, 0x45, 0x2E, 0x0B, 0xF4, 0x00, 0x07, 0x13, 0x36, 0x5A, 0x73, 0x73, 0x6A, 0x46, 0x23, 0xF5, 0x00, 0x09, 0x06, 0x2A,
+    0x4D, 0x71, 0x95, 0x9D, 0x81, 0x5D, 0x3A, 0x16, 0xF6, 0x00, 0x0A, 0x1E, 0x41, 0x65, 0x88, 0x94, 0x85, 0x98, 0x75, 0x51,
+    0x2E, 0x0A, 0xF8, 0x00, 0x0B, 0x11, 0x35, 0x58, 0x7C, 0x9D, 0x7B, 0x6C, 0x8E, 0x8C, 0x68, 0x45, 0x21, 0xF8, 0x00, 0x0C,
+    0x26, 0x4C, 0x70, 0x93, 0x84, 0x62, 0x53, 0x75, 0x97, 0x80, 0x5C, 0x38, 0x10, 0xF9, 0x00, 0x0C, 0x2A, 0x54, 0x73, 0x73,
+    0x6B, 0x51, 0x52, 0x5B, 0x73, 0x73, 0x66, 0x3D, 0x13, 0xF9, 0x00, 0x0C, 0x1B, 0x3B, 0x52, 0x67, 0x75, 0x7B, 0x7C, 0x78,
+    0x6D, 0x5C, 0x44, 0x2A, 0x09, 0xFA, 0x00, 0x0D, 0x13, 0x35, 0x56, 0x74, 0x8C, 0x9D, 0xA6, 0xA6, 0xA2, 0x95, 0x7F, 0x64,
+    0x45, 0x22, 0xFA, 0x00, 0x0E, 0x27, 0x4D, 0x71, 0x92, 0xA7, 0x8D, 0x7E, 0x7B, 0x85, 0x9A, 0xA0, 0x80, 0x5D, 0x38, 0x12,
+    0xFC, 0x00, 0x0F, 0x0F, 0x37, 0x5F, 0x86, 0xAC, 0x8C, 0x6B, 0x55, 0x51, 0x5F, 0x7D, 0xA0, 0x97, 0x71, 0x49, 0x21, 0xFC,
+    0x00, 0x10, 0x19, 0x43, 0x6C, 0x95, 0xA1, 0x79, 0x52, 0x2F, 0x27, 0x41, 0x67, 0x8E, 0xA7, 0x7F, 0x55, 0x2C, 0x02, 0xFD,
+    0x00, 0x10, 0x20, 0x4B, 0x75, 0x9F, 0x97, 0x6D, 0x43, 0x1A, 0x08, 0x31, 0x5A, 0x84, 0xAE, 0x88, 0x5E, 0x33, 0x09, 0xFD,
+    0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54, 0x7F, 0xA9, 0x8D, 0x62, 0x38, 0x0D, 0xFD,
+    0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5, 0x90, 0x66, 0x3B, 0x11, 0x00, 0x28, 0x53, 0x7D, 0xA8, 0x8E, 0x64, 0x39, 0x0F, 0xFD,
+    0x00, 0x10, 0x24, 0x4F, 0x79, 0xA4, 0x92, 0x68, 0x3D, 0x13, 0x00, 0x2A, 0x55, 0x7F, 0xA9, 0x8C, 0x62, 0x37, 0x0D, 0xFD,
+    0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x98, 0x6E, 0x45, 0x1C, 0x0A, 0x32, 0x5B, 0x85, 0xAF, 0x87, 0x5D, 0x33, 0x09, 0xFD,
+    0x00, 0x10, 0x18, 0x42, 0x6B, 0x94, 0xA2, 0x7A, 0x54, 0x32, 0x2B, 0x44, 0x69, 0x90, 0xA6, 0x7E, 0x55, 0x2B, 0x02, 0xFD,
+    0x00, 0x0F, 0x0D, 0x36, 0x5E, 0x84, 0xA9, 0x8E, 0x6E, 0x59, 0x55, 0x63, 0x7F, 0xA2, 0x95, 0x6F, 0x48, 0x1F, 0xFB, 0x00,
+    0x0E, 0x25, 0x4B, 0x6E, 0x90, 0xAA, 0x91, 0x82, 0x80, 0x89, 0x9E, 0x9D, 0x7E, 0x5B, 0x36, 0x10, 0xFB, 0x00, 0x0D, 0x10,
+    0x33, 0x54, 0x71, 0x88, 0x99, 0xA1, 0xA2, 0x9D, 0x91, 0x7C, 0x61, 0x43, 0x20, 0xF9, 0x00, 0x0C, 0x17, 0x35, 0x4F, 0x63,
+    0x70, 0x77, 0x78, 0x74, 0x69, 0x58, 0x41, 0x25, 0x07, 0xF8, 0x00, 0x0A, 0x13, 0x29, 0x3B, 0x46, 0x4D, 0x4E, 0x4A, 0x41,
+    0x32, 0x1E, 0x05, 0xF6, 0x00, 0x07, 0x04, 0x12, 0x1D, 0x22, 0x23, 0x20, 0x18, 0x0B, 0x81, 0x00, 0xFC, 0x00, 0xA6, 0x00,
+    0x07, 0x01, 0x06, 0x03, 0x00, 0x00, 0x06, 0x06, 0x05, 0xF6, 0x00, 0x0A, 0x02, 0x1A, 0x2A, 0x30, 0x2D, 0x1F, 0x23, 0x30,
+    0x31, 0x2F, 0x1C, 0xF7, 0x00, 0x0B, 0x21, 0x3E, 0x52, 0x5B, 0x56, 0x44, 0x44, 0x5B, 0x5B, 0x57, 0x39, 0x13, 0xF9, 0x00,
+    0x0C, 0x15, 0x3A, 0x5D, 0x79, 0x85, 0x7E, 0x67, 0x50, 0x7B, 0x86, 0x6E, 0x43, 0x19, 0xF9, 0x00, 0x0C, 0x24, 0x4C, 0x74,
+    0x98, 0x8F, 0x9A, 0x86, 0x69, 0x80, 0x93, 0x6A, 0x40, 0x16, 0xFA, 0x00, 0x0D, 0x03, 0x2D, 0x57, 0x81, 0x93, 0x6A, 0x79,
+    0x97, 0x8F, 0x98, 0x85, 0x5E, 0x36, 0x0E, 0xFA, 0x00, 0x0C, 0x06, 0x30, 0x5B, 0x85, 0x86, 0x63, 0x5B, 0x75, 0x85, 0x82,
+    0x6B, 0x4B, 0x26, 0xF9, 0x00, 0x0C, 0x01, 0x29, 0x4C, 0x5C, 0x5C, 0x51, 0x51, 0x52, 0x5B, 0x58, 0x49, 0x2F, 0x0F, 0xF8,
+    0x00, 0x0C, 0x1A, 0x39, 0x52, 0x67, 0x75, 0x7B, 0x7C, 0x78, 0x6D, 0x5C, 0x44, 0x28, 0x09, 0xFA, 0x00, 0x0D, 0x13, 0x35,
+    0x56, 0x74, 0x8C, 0x9D, 0xA6, 0xA6, 0xA2, 0x95, 0x7F, 0x64, 0x45, 0x22, 0xFA, 0x00, 0x0E, 0x27, 0x4D, 0x71, 0x92, 0xA7,
+    0x8D, 0x7E, 0x7B, 0x85, 0x9A, 0xA0, 0x80, 0x5D, 0x38, 0x12, 0xFC, 0x00, 0x0F, 0x0F, 0x37, 0x5F, 0x86, 0xAC, 0x8C, 0x6B,
+    0x55, 0x51, 0x5F, 0x7D, 0xA0, 0x97, 0x71, 0x49, 0x21, 0xFC, 0x00, 0x10, 0x19, 0x43, 0x6C, 0x95, 0xA1, 0x79, 0x52, 0x2F,
+    0x27, 0x41, 0x67, 0x8E, 0xA7, 0x7F, 0x55, 0x2C, 0x02, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0x9F, 0x97, 0x6D, 0x43, 0x1A,
+    0x08, 0x31, 0x5A, 0x84, 0xAE, 0x88, 0x5E, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x67, 0x3D, 0x13,
+    0x00, 0x2A, 0x54, 0x7F, 0xA9, 0x8D, 0x62, 0x38, 0x0D, 0xFD, 0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5, 0x90, 0x66, 0x3B, 0x11,
+    0x00, 0x28, 0x53, 0x7D, 0xA8, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x24, 0x4F, 0x79, 0xA4, 0x92, 0x68, 0x3D, 0x13,
+    0x00, 0x2A, 0x55, 0x7F, 0xA9, 0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x98, 0x6E, 0x45, 0x1C,
+    0x0A, 0x32, 0x5B, 0x85, 0xAF, 0x87, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6B, 0x94, 0xA2, 0x7A, 0x54, 0x32,
+    0x2B, 0x44, 0x69, 0x90, 0xA6, 0x7E, 0x55, 0x2B, 0x02, 0xFD, 0x00, 0x0F, 0x0D, 0x36, 0x5E, 0x84, 0xA9, 0x8E, 0x6E, 0x59,
+    0x55, 0x63, 0x7F, 0xA2, 0x95, 0x6F, 0x48, 0x1F, 0xFB, 0x00, 0x0E, 0x25, 0x4B, 0x6E, 0x90, 0xAA, 0x91, 0x82, 0x80, 0x89,
+    0x9E, 0x9D, 0x7E, 0x5B, 0x36, 0x10, 0xFB, 0x00, 0x0D, 0x10, 0x33, 0x54, 0x71, 0x88, 0x99, 0xA1, 0xA2, 0x9D, 0x91, 0x7C,
+    0x61, 0x43, 0x20, 0xF9, 0x00, 0x0C, 0x17, 0x35, 0x4F, 0x63, 0x70, 0x77, 0x78, 0x74, 0x69, 0x58, 0x41, 0x25, 0x07, 0xF8,
+    0x00, 0x0A, 0x13, 0x29, 0x3B, 0x46, 0x4D, 0x4E, 0x4A, 0x41, 0x32, 0x1E, 0x05, 0xF6, 0x00, 0x07, 0x04, 0x12, 0x1D, 0x22,
+    0x23, 0x20, 0x18, 0x0B, 0x81, 0x00, 0xFC, 0x00, 0x93, 0x00, 0x00, 0x10, 0xFE, 0x1D, 0x01, 0x1C, 0x17, 0xFE, 0x1D, 0x01,
+    0x17, 0x03, 0xF8, 0x00, 0x06, 0x11, 0x33, 0x47, 0x48, 0x48, 0x45, 0x3D, 0xFE, 0x48, 0x01, 0x3E, 0x21, 0xF8, 0x00, 0x06,
+    0x1F, 0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02, 0x5B, 0x32, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x9D,
+    0x9A, 0x6F, 0x5C, 0x87, 0x9D, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x9C, 0x9A, 0x6F, 0x5C, 0x87,
+    0x9C, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x06, 0x1F, 0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02, 0x5B, 0x32,
+    0x08, 0xF9, 0x00, 0x0B, 0x11, 0x33, 0x46, 0x47, 0x4B, 0x51, 0x52, 0x4E, 0x47, 0x47, 0x3E, 0x21, 0xF8, 0x00, 0x0C, 0x1A,
+    0x39, 0x52, 0x67, 0x75, 0x7B, 0x7C, 0x78, 0x6D, 0x5C, 0x44, 0x28, 0x09, 0xFA, 0x00, 0x0D, 0x13, 0x35, 0x56, 0x74, 0x8C,
+    0x9D, 0xA6, 0xA6, 0xA2, 0x95, 0x7F, 0x64, 0x45, 0x22, 0xFA, 0x00, 0x0E, 0x27, 0x4D, 0x71, 0x92, 0xA7, 0x8D, 0x7E, 0x7B,
+    0x85, 0x9A, 0xA0, 0x80, 0x5D, 0x38, 0x12, 0xFC, 0x00, 0x0F, 0x0F, 0x37, 0x5F, 0x86, 0xAC, 0x8C, 0x6B, 0x55, 0x51, 0x5F,
+    0x7D, 0xA0, 0x97, 0x71, 0x49, 0x21, 0xFC, 0x00, 0x10, 0x19, 0x43, 0x6C, 0x95, 0xA1, 0x79, 0x52, 0x2F, 0x27, 0x41, 0x67,
+    0x8E, 0xA7, 0x7F, 0x55, 0x2C, 0x02, 0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0x9F, 0x97, 0x6D, 0x43, 0x1A, 0x08, 0x31, 0x5A,
+    0x84, 0xAE, 0x88, 0x5E, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x92, 0x67, 0x3D, 0x13, 0x00, 0x2A, 0x54,
+    0x7F, 0xA9, 0x8D, 0x62, 0x38, 0x0D, 0xFD, 0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5, 0x90, 0x66, 0x3B, 0x11, 0x00, 0x28, 0x53,
+    0x7D, 0xA8, 0x8E, 0x64, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x24, 0x4F, 0x79, 0xA4, 0x92, 0x68, 0x3D, 0x13, 0x00, 0x2A, 0x55,
+    0x7F, 0xA9, 0x8C, 0x62, 0x37, 0x0D, 0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x98, 0x6E, 0x45, 0x1C, 0x0A, 0x32, 0x5B,
+    0x85, 0xAF, 0x87, 0x5D, 0x33, 0x09, 0xFD, 0x00, 0x10, 0x18, 0x42, 0x6B, 0x94, 0xA2, 0x7A, 0x54, 0x32, 0x2B, 0x44, 0x69,
+    0x90, 0xA6, 0x7E, 0x55, 0x2B, 0x02, 0xFD, 0x00, 0x0F, 0x0D, 0x36, 0x5E, 0x84, 0xA9, 0x8E, 0x6E, 0x59, 0x55, 0x63, 0x7F,
+    0xA2, 0x95, 0x6F, 0x48, 0x1F, 0xFB, 0x00, 0x0E, 0x25, 0x4B, 0x6E, 0x90, 0xAA, 0x91, 0x82, 0x80, 0x89, 0x9E, 0x9D, 0x7E,
+    0x5B, 0x36, 0x10, 0xFB, 0x00, 0x0D, 0x10, 0x33, 0x54, 0x71, 0x88, 0x99, 0xA1, 0xA2, 0x9D, 0x91, 0x7C, 0x61, 0x43, 0x20,
+    0xF9, 0x00, 0x0C, 0x17, 0x35, 0x4F, 0x63, 0x70, 0x77, 0x78, 0x74, 0x69, 0x58, 0x41, 0x25, 0x07, 0xF8, 0x00, 0x0A, 0x13,
+    0x29, 0x3B, 0x46, 0x4D, 0x4E, 0x4A, 0x41, 0x32, 0x1E, 0x05, 0xF6, 0x00, 0x07, 0x04, 0x12, 0x1D, 0x22, 0x23, 0x20, 0x18,
+    0x0B, 0x81, 0x00, 0xFC, 0x00, 0x81, 0x00, 0xA8, 0x00, 0x01, 0x13, 0x21, 0xFE, 0x22, 0x01, 0x1B, 0x06, 0xF4, 0x00, 0x02,
+    0x12, 0x35, 0x4B, 0xFE, 0x4D, 0x01, 0x41, 0x22, 0xF4, 0x00, 0x02, 0x1E, 0x48, 0x71, 0xFE, 0x77, 0x02, 0x5B, 0x31, 0x07,
+    0xF5, 0x00, 0x08, 0x1E, 0x49, 0x73, 0x9E, 0xA2, 0x86, 0x5C, 0x31, 0x07, 0xF7, 0x00, 0x0C, 0x01, 0x01, 0x1E, 0x49, 0x73,
+    0x9E, 0xAD, 0x86, 0x5C, 0x31, 0x07, 0x01, 0x01, 0xFB, 0x00, 0x01, 0x15, 0x28, 0xFE, 0x2B, 0x01, 0x49, 0x73, 0xFE, 0x83,
+    0x01, 0x5C, 0x31, 0xFE, 0x2B, 0x01, 0x20, 0x05, 0xFE, 0x00, 0x02, 0x0C, 0x32, 0x50, 0xFD, 0x56, 0x00, 0x57, 0xFE, 0x58,
+    0xFC, 0x56, 0x01, 0x41, 0x1E, 0xFE, 0x00, 0x02, 0x14, 0x3E, 0x69, 0xF5, 0x80, 0x02, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x03,
+    0x14, 0x3E, 0x69, 0x93, 0xF7, 0xA9, 0x03, 0xA7, 0x7C, 0x52, 0x27, 0xFE, 0x00, 0x02, 0x14, 0x3E, 0x69, 0xF5, 0x7E, 0x02,
+    0x7C, 0x51, 0x27, 0xFE, 0x00, 0x02, 0x0B, 0x31, 0x4E, 0xFD, 0x54, 0x00, 0x58, 0xFE, 0x5A, 0xFC, 0x54, 0x01, 0x40, 0x1D,
+    0xFD, 0x00, 0x01, 0x14, 0x26, 0xFE, 0x29, 0x01, 0x49, 0x73, 0xFE, 0x85, 0x01, 0x5C, 0x31, 0xFE, 0x29, 0x01, 0x1E, 0x04,
+    0xF9, 0x00, 0x08, 0x1E, 0x49, 0x73, 0x9E, 0xAF, 0x86, 0x5C, 0x31, 0x07, 0xF5, 0x00, 0x08, 0x1E, 0x49, 0x73, 0x9E, 0x9F,
+    0x86, 0x5C, 0x31, 0x07, 0xF5, 0x00, 0x02, 0x1E, 0x48, 0x6F, 0xFE, 0x75, 0x02, 0x5A, 0x31, 0x06, 0xF5, 0x00, 0x02, 0x10,
+    0x33, 0x49, 0xFE, 0x4A, 0x01, 0x3F, 0x21, 0xF3, 0x00, 0x01, 0x11, 0x1F, 0xFE, 0x20, 0x01, 0x19, 0x04, 0x81, 0x00, 0xD2,
+    0x00, 0x81, 0x00, 0xB6, 0x00, 0x03, 0x12, 0x1E, 0x18, 0x03, 0xF8, 0x00, 0x0C, 0x07, 0x17, 0x21, 0x26, 0x28, 0x24, 0x1C,
+    0x15, 0x35, 0x48, 0x3E, 0x23, 0x08, 0xFA, 0x00, 0x0D, 0x17, 0x2D, 0x3F, 0x4B, 0x51, 0x52, 0x4F, 0x45, 0x36, 0x51, 0x71,
+    0x5F, 0x44, 0x26, 0xFB, 0x00, 0x0F, 0x1A, 0x39, 0x52, 0x67, 0x75, 0x7B, 0x7D, 0x78, 0x6E, 0x5C, 0x6D, 0x8D, 0x80, 0x5F,
+    0x35, 0x0B, 0xFD, 0x00, 0x10, 0x13, 0x35, 0x56, 0x74, 0x8C, 0x9D, 0xA6, 0xA6, 0xA2, 0x95, 0x80, 0x88, 0x93, 0x72, 0x51,
+    0x2E, 0x06, 0xFD, 0x00, 0x0F, 0x27, 0x4D, 0x71, 0x92, 0xA7, 0x8D, 0x7E, 0x7B, 0x84, 0x9A, 0xA1, 0x98, 0x77, 0x57, 0x36,
+    0x16, 0xFD, 0x00, 0x0F, 0x0F, 0x37, 0x5F, 0x86, 0xAC, 0x8A, 0x6B, 0x55, 0x51, 0x5F, 0x7D, 0xA7, 0x97, 0x71, 0x49, 0x21,
+    0xFC, 0x00, 0x10, 0x19, 0x43, 0x6C, 0x95, 0x9F, 0x77, 0x50, 0x36, 0x57, 0x78, 0x98, 0x91, 0xA8, 0x7F, 0x56, 0x2C, 0x03,
+    0xFD, 0x00, 0x10, 0x20, 0x4B, 0x75, 0x9F, 0x94, 0x6B, 0x41, 0x51, 0x72, 0x93, 0x88, 0x84, 0xAE, 0x88, 0x5E, 0x34, 0x0A,
+    0xFD, 0x00, 0x10, 0x25, 0x4F, 0x7A, 0xA4, 0x8F, 0x65, 0x4C, 0x6C, 0x8D, 0x8D, 0x6C, 0x7F, 0xA9, 0x8D, 0x62, 0x38, 0x0D,
+    0xFD, 0x00, 0x10, 0x26, 0x50, 0x7B, 0xA5, 0x8E, 0x64, 0x67, 0x88, 0x93, 0x72, 0x53, 0x7D, 0xA8, 0x8E, 0x64, 0x39, 0x0F,
+    0xFD, 0x00, 0x10, 0x25, 0x4F, 0x79, 0xA4, 0x91, 0x67, 0x82, 0x98, 0x78, 0x57, 0x55, 0x7F, 0xA9, 0x8C, 0x62, 0x37, 0x0D,
+    0xFD, 0x00, 0x10, 0x20, 0x4A, 0x74, 0x9E, 0x98, 0x7C, 0x9D, 0x7D, 0x5D, 0x3C, 0x5B, 0x85, 0xAF, 0x87, 0x5D, 0x33, 0x09,
+    0xFD, 0x00, 0x10, 0x19, 0x42, 0x6B, 0x94, 0xA3, 0x98, 0x83, 0x62, 0x41, 0x44, 0x69, 0x90, 0xA6, 0x7E, 0x55, 0x2B, 0x02,
+    0xFD, 0x00, 0x0F, 0x12, 0x36, 0x5E, 0x85, 0xAB, 0x8F, 0x6E, 0x59, 0x55, 0x63, 0x7F, 0xA2, 0x95, 0x6F, 0x48, 0x1F, 0xFD,
+    0x00, 0x10, 0x0D, 0x2E, 0x4E, 0x6E, 0x8F, 0x92, 0xAA, 0x91, 0x82, 0x80, 0x89, 0x9E, 0x9D, 0x7E, 0x5B, 0x36, 0x10, 0xFD,
+    0x00, 0x0F, 0x23, 0x49, 0x6A, 0x8A, 0x90, 0x70, 0x87, 0x99, 0xA2, 0xA2, 0x9D, 0x91, 0x7C, 0x61, 0x43, 0x20, 0xFC, 0x00,
+    0x0F, 0x28, 0x51, 0x75, 0x90, 0x75, 0x55, 0x62, 0x70, 0x77, 0x78, 0x74, 0x69, 0x58, 0x41, 0x25, 0x07, 0xFC, 0x00, 0x0E,
+    0x19, 0x3A, 0x55, 0x6F, 0x59, 0x39, 0x3B, 0x47, 0x4D, 0x4E, 0x4A, 0x41, 0x32, 0x1E, 0x05, 0xFA, 0x00, 0x0B, 0x19, 0x34,
+    0x45, 0x3A, 0x1D, 0x13, 0x1D, 0x23, 0x23, 0x20, 0x18, 0x0B, 0xF7, 0x00, 0x02, 0x10, 0x1A, 0x14, 0x89, 0x00, 0xA9, 0x00,
+    0x01, 0x04, 0x18, 0xFE, 0x1E, 0x00, 0x16, 0xF2, 0x00, 0x01, 0x22, 0x3F, 0xFE, 0x48, 0x01, 0x3C, 0x1D, 0xF4, 0x00, 0x02,
+    0x09, 0x33, 0x5C, 0xFE, 0x73, 0x02, 0x59, 0x37, 0x15, 0xF5, 0x00, 0x09, 0x06, 0x2F, 0x53, 0x74, 0x94, 0x94, 0x72, 0x50,
+    0x2E, 0x0C, 0xF5, 0x00, 0x09, 0x17, 0x38, 0x58, 0x78, 0x98, 0x8C, 0x6A, 0x48, 0x26, 0x03, 0xF5, 0x00, 0x08, 0x1C, 0x3C,
+    0x5C, 0x7C, 0x9C, 0x83, 0x61, 0x3F, 0x1D, 0xF6, 0x00, 0x0C, 0x14, 0x1A, 0x20, 0x40, 0x61, 0x81, 0x9C, 0x7A, 0x58, 0x34,
+    0x1A, 0x19, 0x0E, 0xFA, 0x00, 0x01, 0x1F, 0x3B, 0xFE, 0x44, 0x04, 0x45, 0x65, 0x73, 0x73, 0x63, 0xFE, 0x44, 0x01, 0x32,
+    0x11, 0xFC, 0x00, 0x0F, 0x08, 0x32, 0x5A, 0x6F, 0x6F, 0x6E, 0x4F, 0x43, 0x49, 0x49, 0x5F, 0x6F, 0x6F, 0x6D, 0x4A, 0x21,
+    0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x99, 0x7D, 0x53, 0x28, 0x1E, 0x39, 0x64, 0x8E, 0x99, 0x78, 0x4D, 0x23, 0xFC,
+    0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00,
+    0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F,
+    0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09,
+    0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34,
+    0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E,
+    0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89,
+    0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x3A, 0x64, 0x8F, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x33, 0x5E, 0x88, 0xA8,
+    0x7E, 0x53, 0x29, 0x15, 0x3E, 0x68, 0x92, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x06, 0x30, 0x5A, 0x85, 0xAD, 0x83,
+    0x5A, 0x32, 0x2F, 0x4D, 0x73, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x2A, 0x53, 0x7D, 0xA5, 0x91, 0x6E, 0x59,
+    0x59, 0x69, 0x88, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x1F, 0x47, 0x6E, 0x94, 0xAA, 0x90, 0x83, 0x82, 0x8E,
+    0x8D, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x0F, 0x35, 0x59, 0x79, 0x92, 0xA0, 0xA3, 0x9C, 0x8A, 0x70, 0x8E,
+    0x95, 0x78, 0x4D, 0x23, 0xFA, 0x00, 0x0D, 0x1D, 0x3D, 0x58, 0x6C, 0x76, 0x78, 0x73, 0x65, 0x5D, 0x6A, 0x6A, 0x69, 0x49,
+    0x20, 0xFA, 0x00, 0x0D, 0x01, 0x1D, 0x33, 0x44, 0x4C, 0x4E, 0x49, 0x3E, 0x3A, 0x40, 0x40, 0x3F, 0x2E, 0x0F, 0xF8, 0x00,
+    0x06, 0x0D, 0x1B, 0x22, 0x23, 0x20, 0x15, 0x12, 0xFE, 0x15, 0x00, 0x0A, 0x81, 0x00, 0x01, 0x00, 0x00, 0xA3, 0x00, 0x05,
+    0x0E, 0x1C, 0x1E, 0x1E, 0x1D, 0x0F, 0xF3, 0x00, 0x07, 0x0E, 0x2F, 0x46, 0x48, 0x48, 0x46, 0x31, 0x0E, 0xF5, 0x00, 0x08,
+    0x05, 0x27, 0x49, 0x6B, 0x73, 0x73, 0x6D, 0x46, 0x1C, 0xF5, 0x00, 0x08, 0x1F, 0x41, 0x63, 0x85, 0x9D, 0x82, 0x62, 0x40,
+    0x19, 0xF6, 0x00, 0x09, 0x16, 0x38, 0x5A, 0x7C, 0x9E, 0x86, 0x66, 0x46, 0x26, 0x05, 0xF7, 0x00, 0x09, 0x0E, 0x30, 0x52,
+    0x74, 0x96, 0x8B, 0x6B, 0x4A, 0x2A, 0x0A, 0xF8, 0x00, 0x0C, 0x14, 0x1A, 0x23, 0x49, 0x6B, 0x8D, 0x8F, 0x6F, 0x4F, 0x2F,
+    0x1A, 0x19, 0x0E, 0xFA, 0x00, 0x09, 0x1F, 0x3B, 0x44, 0x44, 0x51, 0x73, 0x73, 0x72, 0x53, 0x3E, 0xFE, 0x44, 0x01, 0x32,
+    0x11, 0xFC, 0x00, 0x0F, 0x08, 0x32, 0x5A, 0x6F, 0x6F, 0x6E, 0x4F, 0x49, 0x48, 0x37, 0x5F, 0x6F, 0x6F, 0x6D, 0x4A, 0x21,
+    0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x99, 0x7D, 0x53, 0x28, 0x1E, 0x39, 0x64, 0x8E, 0x99, 0x78, 0x4D, 0x23, 0xFC,
+    0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00,
+    0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F,
+    0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09,
+    0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34,
+    0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E,
+    0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89,
+    0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x3A, 0x64, 0x8F, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x33, 0x5E, 0x88, 0xA8,
+    0x7E, 0x53, 0x29, 0x15, 0x3E, 0x68, 0x92, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x06, 0x30, 0x5A, 0x85, 0xAD, 0x83,
+    0x5A, 0x32, 0x2F, 0x4D, 0x73, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x2A, 0x53, 0x7D, 0xA5, 0x91, 0x6E, 0x59,
+    0x59, 0x69, 0x88, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x1F, 0x47, 0x6E, 0x94, 0xAA, 0x90, 0x83, 0x82, 0x8E,
+    0x8D, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x0F, 0x35, 0x59, 0x79, 0x92, 0xA0, 0xA3, 0x9C, 0x8A, 0x70, 0x8E,
+    0x95, 0x78, 0x4D, 0x23, 0xFA, 0x00, 0x0D, 0x1D, 0x3D, 0x58, 0x6C, 0x76, 0x78, 0x73, 0x65, 0x5D, 0x6A, 0x6A, 0x69, 0x49,
+    0x20, 0xFA, 0x00, 0x0D, 0x01, 0x1D, 0x33, 0x44, 0x4C, 0x4E, 0x49, 0x3E, 0x3A, 0x40, 0x40, 0x3F, 0x2E, 0x0F, 0xF8, 0x00,
+    0x06, 0x0D, 0x1B, 0x22, 0x23, 0x20, 0x15, 0x12, 0xFE, 0x15, 0x00, 0x0A, 0x81, 0x00, 0x01, 0x00, 0x00, 0xA6, 0x00, 0x05,
+    0x02, 0x17, 0x1E, 0x1E, 0x1C, 0x0D, 0xF2, 0x00, 0x06, 0x1F, 0x3D, 0x48, 0x48, 0x45, 0x2E, 0x0B, 0xF4, 0x00, 0x07, 0x13,
+    0x36, 0x5A, 0x73, 0x73, 0x6A, 0x46, 0x23, 0xF5, 0x00, 0x09, 0x06, 0x2A, 0x4D, 0x71, 0x95, 0x9D, 0x81, 0x5D, 0x3A, 0x16,
+    0xF6, 0x00, 0x0A, 0x1E, 0x41, 0x65, 0x88, 0x94, 0x85, 0x98, 0x75, 0x51, 0x2E, 0x0A, 0xF8, 0x00, 0x0B, 0x11, 0x35, 0x58,
+    0x7C, 0x9D, 0x7B, 0x6C, 0x8E, 0x8C, 0x68, 0x45, 0x21, 0xF8, 0x00, 0x0C, 0x26, 0x4C, 0x70, 0x93, 0x84, 0x62, 0x53, 0x75,
+    0x97, 0x80, 0x5C, 0x38, 0x10, 0xFA, 0x00, 0x0E, 0x1F, 0x3B, 0x54, 0x73, 0x73, 0x6B, 0x49, 0x39, 0x5B, 0x73, 0x73, 0x66,
+    0x44, 0x32, 0x11, 0xFC, 0x00, 0x0F, 0x08, 0x32, 0x5A, 0x6F, 0x6F, 0x6E, 0x4F, 0x2F, 0x20, 0x3E, 0x5F, 0x6F, 0x6F, 0x6D,
+    0x4A, 0x21, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x99, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0x99, 0x78, 0x4D,
+    0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23,
+    0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC,
+    0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00,
+    0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F,
+    0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09,
+    0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34,
+    0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x3A, 0x64, 0x8F, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x33, 0x5E,
+    0x88, 0xA8, 0x7E, 0x53, 0x29, 0x15, 0x3E, 0x68, 0x92, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x06, 0x30, 0x5A, 0x85,
+    0xAD, 0x83, 0x5A, 0x32, 0x2F, 0x4D, 0x73, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x2A, 0x53, 0x7D, 0xA5, 0x91,
+    0x6E, 0x59, 0x59, 0x69, 0x88, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x1F, 0x47, 0x6E, 0x94, 0xAA, 0x90, 0x83,
+    0x82, 0x8E, 0x8D, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x0F, 0x35, 0x59, 0x79, 0x92, 0xA0, 0xA3, 0x9C, 0x8A,
+    0x70, 0x8E, 0x95, 0x78, 0x4D, 0x23, 0xFA, 0x00, 0x0D, 0x1D, 0x3D, 0x58, 0x6C, 0x76, 0x78, 0x73, 0x65, 0x5D, 0x6A, 0x6A,
+    0x69, 0x49, 0x20, 0xFA, 0x00, 0x0D, 0x01, 0x1D, 0x33, 0x44, 0x4C, 0x4E, 0x49, 0x3E, 0x3A, 0x40, 0x40, 0x3F, 0x2E, 0x0F,
+    0xF8, 0x00, 0x06, 0x0D, 0x1B, 0x22, 0x23, 0x20, 0x15, 0x12, 0xFE, 0x15, 0x00, 0x0A, 0x81, 0x00, 0x01, 0x00, 0x00, 0x93,
+    0x00, 0x00, 0x10, 0xFE, 0x1D, 0x01, 0x1C, 0x17, 0xFE, 0x1D, 0x01, 0x17, 0x03, 0xF8, 0x00, 0x06, 0x11, 0x33, 0x47, 0x48,
+    0x48, 0x45, 0x3D, 0xFE, 0x48, 0x01, 0x3E, 0x21, 0xF8, 0x00, 0x06, 0x1F, 0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72,
+    0x02, 0x5B, 0x32, 0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x9D, 0x9A, 0x6F, 0x5C, 0x87, 0x9D, 0x88, 0x5D, 0x33, 0x08,
+    0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x9C, 0x9A, 0x6F, 0x5C, 0x87, 0x9C, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x06, 0x1F,
+    0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02, 0x5B, 0x32, 0x0E, 0xFA, 0x00, 0x07, 0x1F, 0x3B, 0x44, 0x46, 0x47,
+    0x47, 0x45, 0x3D, 0xFE, 0x47, 0x03, 0x44, 0x44, 0x32, 0x11, 0xFC, 0x00, 0x0F, 0x08, 0x32, 0x5A, 0x6F, 0x6F, 0x6E, 0x4F,
+    0x26, 0x17, 0x37, 0x5F, 0x6F, 0x6F, 0x6D, 0x4A, 0x21, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0x99, 0x7D, 0x53, 0x28,
+    0x0F, 0x39, 0x64, 0x8E, 0x99, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F,
+    0x39, 0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39,
+    0x64, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64,
+    0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E,
+    0xA2, 0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2,
+    0x78, 0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x39, 0x64, 0x8E, 0xA2, 0x78,
+    0x4D, 0x23, 0xFC, 0x00, 0x0F, 0x09, 0x34, 0x5E, 0x89, 0xA8, 0x7D, 0x53, 0x28, 0x0F, 0x3A, 0x64, 0x8F, 0xA2, 0x78, 0x4D,
+    0x23, 0xFC, 0x00, 0x0F, 0x09, 0x33, 0x5E, 0x88, 0xA8, 0x7E, 0x53, 0x29, 0x15, 0x3E, 0x68, 0x92, 0xA2, 0x78, 0x4D, 0x23,
+    0xFC, 0x00, 0x0F, 0x06, 0x30, 0x5A, 0x85, 0xAD, 0x83, 0x5A, 0x32, 0x2F, 0x4D, 0x73, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB,
+    0x00, 0x0E, 0x2A, 0x53, 0x7D, 0xA5, 0x91, 0x6E, 0x59, 0x59, 0x69, 0x88, 0x9B, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E,
+    0x1F, 0x47, 0x6E, 0x94, 0xAA, 0x90, 0x83, 0x82, 0x8E, 0x8D, 0x8E, 0xA2, 0x78, 0x4D, 0x23, 0xFB, 0x00, 0x0E, 0x0F, 0x35,
+    0x59, 0x79, 0x92, 0xA0, 0xA3, 0x9C, 0x8A, 0x70, 0x8E, 0x95, 0x78, 0x4D, 0x23, 0xFA, 0x00, 0x0D, 0x1D, 0x3D, 0x58, 0x6C,
+    0x76, 0x78, 0x73, 0x65, 0x5D, 0x6A, 0x6A, 0x69, 0x49, 0x20, 0xFA, 0x00, 0x0D, 0x01, 0x1D, 0x33, 0x44, 0x4C, 0x4E, 0x49,
+    0x3E, 0x3A, 0x40, 0x40, 0x3F, 0x2E, 0x0F, 0xF8, 0x00, 0x06, 0x0D, 0x1B, 0x22, 0x23, 0x20, 0x15, 0x12, 0xFE, 0x15, 0x00,
+    0x0A, 0x81, 0x00, 0x01, 0x00, 0x00, 0xA3, 0x00, 0x05, 0x0E, 0x1C, 0x1E, 0x1E, 0x1D, 0x0F, 0xF3, 0x00, 0x07, 0x0E, 0x2F,
+    0x46, 0x48, 0x48, 0x46, 0x31, 0x0E, 0xF5, 0x00, 0x08, 0x05, 0x27, 0x49, 0x6B, 0x73, 0x73, 0x6D, 0x46, 0x1C, 0xF5, 0x00,
+    0x08, 0x1F, 0x41, 0x63, 0x85, 0x9D, 0x82, 0x62, 0x40, 0x19, 0xF6, 0x00, 0x09, 0x16, 0x38, 0x5A, 0x7C, 0x9E, 0x86, 0x66,
+    0x46, 0x26, 0x05, 0xF7, 0x00, 0x09, 0x0E, 0x30, 0x52, 0x74, 0x96, 0x8B, 0x6B, 0x4A, 0x2A, 0x0A, 0xFA, 0x00, 0x0B, 0x03,
+    0x16, 0x1B, 0x1B, 0x23, 0x49, 0x6B, 0x8D, 0x8F, 0x6F, 0x4F, 0x2F, 0xFE, 0x1B, 0x00, 0x12, 0xFC, 0x00, 0x01, 0x22, 0x3E,
+    0xFE, 0x45, 0x06, 0x51, 0x73, 0x73, 0x72, 0x53, 0x33, 0x3D, 0xFE, 0x45, 0x01, 0x38, 0x19, 0xFE, 0x00, 0x02, 0x0B, 0x35,
+    0x5D, 0xFE, 0x70, 0x06, 0x52, 0x49, 0x49, 0x48, 0x37, 0x35, 0x5D, 0xFE, 0x70, 0x01, 0x53, 0x2A, 0xFE, 0x00, 0x11, 0x09,
+    0x32, 0x59, 0x81, 0x9A, 0x89, 0x61, 0x3A, 0x1E, 0x1E, 0x1C, 0x44, 0x6C, 0x94, 0x9A, 0x76, 0x4F, 0x27, 0xFD, 0x00, 0x10,
+    0x22, 0x4A, 0x71, 0x99, 0x98, 0x70, 0x49, 0x21, 0x03, 0x2B, 0x53, 0x7B, 0xA3, 0x8F, 0x67, 0x3F, 0x18, 0xFD, 0x00, 0x10,
+    0x13, 0x3A, 0x62, 0x89, 0xA7, 0x7F, 0x58, 0x30, 0x12, 0x3A, 0x62, 0x8A, 0xA7, 0x7F, 0x58, 0x30, 0x08, 0xFD, 0x00, 0x0F,
+    0x03, 0x2B, 0x52, 0x7A, 0xA1, 0x8F, 0x67, 0x3F, 0x21, 0x49, 0x71, 0x98, 0x97, 0x70, 0x48, 0x21, 0xFB, 0x00, 0x0E, 0x1B,
+    0x43, 0x6A, 0x92, 0x9E, 0x76, 0x4E, 0x30, 0x58, 0x7F, 0xA7, 0x88, 0x60, 0x39, 0x11, 0xFB, 0x00, 0x0E, 0x0C, 0x33, 0x5B,
+    0x82, 0xAA, 0x85, 0x5D, 0x3F, 0x67, 0x8E, 0xA0, 0x79, 0x51, 0x29, 0x02, 0xFA, 0x00, 0x0C, 0x24, 0x4B, 0x73, 0x9A, 0x94,
+    0x6C, 0x4E, 0x75, 0x9D, 0x91, 0x69, 0x42, 0x1A, 0xF9, 0x00, 0x0C, 0x14, 0x3C, 0x63, 0x8B, 0xA3, 0x7B, 0x5C, 0x84, 0xA9,
+    0x82, 0x5A, 0x32, 0x0B, 0xF9, 0x00, 0x0B, 0x05, 0x2C, 0x54, 0x7B, 0xA3, 0x8A, 0x6B, 0x93, 0x9A, 0x72, 0x4B, 0x23, 0xF7,
+    0x00, 0x0A, 0x1D, 0x44, 0x6C, 0x93, 0x99, 0x7A, 0xA2, 0x8A, 0x63, 0x3B, 0x14, 0xF7, 0x00, 0x0A, 0x0D, 0x35, 0x5C, 0x84,
+    0xA8, 0x8F, 0xA3, 0x7B, 0x54, 0x2C, 0x04, 0xF6, 0x00, 0x08, 0x25, 0x4D, 0x74, 0x9C, 0xB9, 0x94, 0x6C, 0x44, 0x1D, 0xF5,
+    0x00, 0x08, 0x16, 0x3D, 0x65, 0x8C, 0xAD, 0x85, 0x5D, 0x36, 0x0E, 0xF7, 0x00, 0x09, 0x0A, 0x0D, 0x1D, 0x43, 0x6B, 0x92,
+    0x9E, 0x76, 0x4E, 0x27, 0xF7, 0x00, 0x0A, 0x1B, 0x33, 0x38, 0x38, 0x56, 0x7C, 0xA2, 0x8E, 0x67, 0x3F, 0x17, 0xF8, 0x00,
+    0x0B, 0x0B, 0x33, 0x57, 0x62, 0x62, 0x6F, 0x90, 0xA4, 0x7E, 0x56, 0x2F, 0x08, 0xF8, 0x00, 0x0A, 0x0F, 0x39, 0x64, 0x8D,
+    0x8D, 0x95, 0xAB, 0x8D, 0x6A, 0x45, 0x1F, 0xF7, 0x00, 0x0A, 0x0F, 0x39, 0x64, 0x8E, 0x94, 0x93, 0x86, 0x6F, 0x51, 0x30,
+    0x0C, 0xF7, 0x00, 0x09, 0x0D, 0x36, 0x5C, 0x6A, 0x6A, 0x68, 0x5F, 0x4C, 0x33, 0x15, 0xF5, 0x00, 0x07, 0x20, 0x3A, 0x3F,
+    0x3F, 0x3E, 0x36, 0x27, 0x12, 0xF3, 0x00, 0x04, 0x11, 0x15, 0x15, 0x14, 0x0D, 0xE0, 0x00, 0x95, 0x00, 0x01, 0x0B, 0x20,
+    0xFE, 0x25, 0x00, 0x19, 0xF3, 0x00, 0x02, 0x02, 0x28, 0x46, 0xFE, 0x4F, 0x01, 0x3C, 0x1A, 0xF4, 0x00, 0x07, 0x0B, 0x36,
+    0x60, 0x7A, 0x7A, 0x78, 0x50, 0x26, 0xF4, 0x00, 0x07, 0x0C, 0x36, 0x61, 0x8B, 0xA4, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07,
+    0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x0C, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x26, 0x27,
+    0x26, 0x20, 0x14, 0x03, 0xF9, 0x00, 0x0D, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x4C, 0x52, 0x51, 0x4A, 0x3C, 0x28,
+    0x0F, 0xFA, 0x00, 0x0E, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x64, 0x74, 0x7C, 0x7B, 0x73, 0x62, 0x4B, 0x2F, 0x0F, 0xFB,
+    0x00, 0x0F, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x87, 0x9C, 0xA5, 0xA6, 0x9B, 0x87, 0x6B, 0x4B, 0x28, 0x04, 0xFC, 0x00,
+    0x0F, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x82, 0x97, 0x83, 0x7B, 0x80, 0x94, 0xA7, 0x87, 0x63, 0x3E, 0x17, 0xFC, 0x00, 0x0F,
+    0x0C, 0x36, 0x61, 0x8B, 0xB6, 0x9D, 0x7A, 0x5C, 0x51, 0x59, 0x75, 0x98, 0x9D, 0x76, 0x4F, 0x26, 0xFC, 0x00, 0x10, 0x0C,
+    0x36, 0x61, 0x8B, 0xB5, 0x8C, 0x64, 0x3E, 0x26, 0x39, 0x5F, 0x87, 0xAD, 0x84, 0x5B, 0x32, 0x08, 0xFD, 0x00, 0x10, 0x0C,
+    0x36, 0x61, 0x8B, 0xAC, 0x82, 0x58, 0x2F, 0x06, 0x2A, 0x53, 0x7D, 0xA7, 0x8E, 0x63, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x0C,
+    0x36, 0x61, 0x8B, 0xA7, 0x7D, 0x52, 0x28, 0x00, 0x23, 0x4D, 0x78, 0xA2, 0x93, 0x68, 0x3E, 0x13, 0xFD, 0x00, 0x10, 0x0C,
+    0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x26, 0x00, 0x21, 0x4C, 0x76, 0xA1, 0x94, 0x6A, 0x3F, 0x15, 0xFD, 0x00, 0x10, 0x0C,
+    0x36, 0x61, 0x8B, 0xA7, 0x7D, 0x53, 0x28, 0x00, 0x23, 0x4E, 0x78, 0xA2, 0x92, 0x68, 0x3E, 0x13, 0xFD, 0x00, 0x10, 0x0C,
+    0x36, 0x61, 0x8B, 0xAC, 0x83, 0x59, 0x30, 0x07, 0x2B, 0x54, 0x7D, 0xA7, 0x8D, 0x63, 0x39, 0x0F, 0xFD, 0x00, 0x10, 0x0C,
+    0x36, 0x61, 0x8B, 0xB6, 0x8E, 0x66, 0x41, 0x2A, 0x3C, 0x61, 0x88, 0xAC, 0x83, 0x5B, 0x31, 0x08, 0xFD, 0x00, 0x0F, 0x0C,
+    0x36, 0x61, 0x8B, 0xB4, 0x9F, 0x7C, 0x60, 0x55, 0x5D, 0x77, 0x9A, 0x9B, 0x75, 0x4E, 0x25, 0xFC, 0x00, 0x0F, 0x0C, 0x36,
+    0x61, 0x8B, 0xA6, 0x80, 0x9B, 0x87, 0x7F, 0x85, 0x97, 0xA4, 0x84, 0x61, 0x3C, 0x16, 0xFC, 0x00, 0x0F, 0x0C, 0x36, 0x61,
+    0x8B, 0xA6, 0x7B, 0x84, 0x99, 0xA2, 0xA1, 0x97, 0x83, 0x68, 0x48, 0x26, 0x02, 0xFC, 0x00, 0x0E, 0x0C, 0x36, 0x61, 0x8B,
+    0xA6, 0x7B, 0x60, 0x70, 0x78, 0x77, 0x6F, 0x5E, 0x48, 0x2C, 0x0C, 0xFB, 0x00, 0x0D, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B,
+    0x51, 0x48, 0x4E, 0x4D, 0x46, 0x38, 0x24, 0x0C, 0xFA, 0x00, 0x0B, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x26, 0x23,
+    0x22, 0x1C, 0x10, 0xF8, 0x00, 0x07, 0x0C, 0x36, 0x61, 0x8B, 0xA6, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x0C, 0x36, 0x61,
+    0x8B, 0x94, 0x7B, 0x51, 0x26, 0xF4, 0x00, 0x07, 0x0A, 0x33, 0x5A, 0x6A, 0x6A, 0x69, 0x4C, 0x23, 0xF3, 0x00, 0x01, 0x1E,
+    0x38, 0xFE, 0x3F, 0x01, 0x30, 0x11, 0xF2, 0x00, 0x00, 0x11, 0xFE, 0x15, 0x00, 0x0B, 0xE0, 0x00, 0x93, 0x00, 0x00, 0x10,
+    0xFE, 0x1D, 0x01, 0x1C, 0x17, 0xFE, 0x1D, 0x01, 0x17, 0x03, 0xF8, 0x00, 0x06, 0x11, 0x33, 0x47, 0x48, 0x48, 0x45, 0x3D,
+    0xFE, 0x48, 0x01, 0x3E, 0x21, 0xF8, 0x00, 0x06, 0x1F, 0x49, 0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x02, 0x5B, 0x32,
+    0x08, 0xF9, 0x00, 0x0C, 0x20, 0x4B, 0x75, 0x9D, 0x9A, 0x6F, 0x5C, 0x87, 0x9D, 0x88, 0x5D, 0x33, 0x08, 0xF9, 0x00, 0x0C,
+    0x20, 0x4B, 0x75, 0x9C, 0x9A, 0x6F, 0x5C, 0x87, 0x9C, 0x88, 0x5D, 0x33, 0x08, 0xFB, 0x00, 0x08, 0x03, 0x16, 0x1F, 0x49,
+    0x6F, 0x72, 0x72, 0x6A, 0x5A, 0xFE, 0x72, 0x03, 0x5B, 0x32, 0x1B, 0x12, 0xFC, 0x00, 0x08, 0x22, 0x3E, 0x45, 0x45, 0x46,
+    0x47, 0x47, 0x45, 0x3D, 0xFE, 0x47, 0xFE, 0x45, 0x01, 0x38, 0x19, 0xFE, 0x00, 0x02, 0x0B, 0x35, 0x5D, 0xFE, 0x70, 0x06,
+    0x52, 0x2B, 0x1C, 0x17, 0x1D, 0x35, 0x5D, 0xFE, 0x70, 0x01, 0x53, 0x2A, 0xFE, 0x00, 0x11, 0x09, 0x32, 0x59, 0x81, 0x9A,
+    0x89, 0x61, 0x3A, 0x12, 0x00, 0x1C, 0x44, 0x6C, 0x94, 0x9A, 0x76, 0x4F, 0x27, 0xFD, 0x00, 0x10, 0x22, 0x4A, 0x71, 0x99,
+    0x98, 0x70, 0x49, 0x21, 0x03, 0x2B, 0x53, 0x7B, 0xA3, 0x8F, 0x67, 0x3F, 0x18, 0xFD, 0x00, 0x10, 0x13, 0x3A, 0x62, 0x89,
+    0xA7, 0x7F, 0x58, 0x30, 0x12, 0x3A, 0x62, 0x8A, 0xA7, 0x7F, 0x58, 0x30, 0x08, 0xFD, 0x00, 0x0F, 0x03, 0x2B, 0x52, 0x7A,
+    0xA1, 0x8F, 0x67, 0x3F, 0x21, 0x49, 0x71, 0x98, 0x97, 0x70, 0x48, 0x21, 0xFB, 0x00, 0x0E, 0x1B, 0x43, 0x6A, 0x92, 0x9E,
+    0x76, 0x4E, 0x30, 0x58, 0x7F, 0xA7, 0x88, 0x60, 0x39, 0x11, 0xFB, 0x00, 0x0E, 0x0C, 0x33, 0x5B, 0x82, 0xAA, 0x85, 0x5D,
+    0x3F, 0x67, 0x8E, 0xA0, 0x79, 0x51, 0x29, 0x02, 0xFA, 0x00, 0x0C, 0x24, 0x4B, 0x73, 0x9A, 0x94, 0x6C, 0x4E, 0x75, 0x9D,
+    0x91, 0x69, 0x42, 0x1A, 0xF9, 0x00, 0x0C, 0x14, 0x3C, 0x63, 0x8B, 0xA3, 0x7B, 0x5C, 0x84, 0xA9, 0x82, 0x5A, 0x32, 0x0B,
+    0xF9, 0x00, 0x0B, 0x05, 0x2C, 0x54, 0x7B, 0xA3, 0x8A, 0x6B, 0x93, 0x9A, 0x72, 0x4B, 0x23, 0xF7, 0x00, 0x0A, 0x1D, 0x44,
+    0x6C, 0x93, 0x99, 0x7A, 0xA2, 0x8A, 0x63, 0x3B, 0x14, 0xF7, 0x00, 0x0A, 0x0D, 0x35, 0x5C, 0x84, 0xA8, 0x8F, 0xA3, 0x7B,
+    0x54, 0x2C, 0x04, 0xF6, 0x00, 0x08, 0x25, 0x4D, 0x74, 0x9C, 0xB9, 0x94, 0x6C, 0x44, 0x1D, 0xF5, 0x00, 0x08, 0x16, 0x3D,
+    0x65, 0x8C, 0xAD, 0x85, 0x5D, 0x36, 0x0E, 0xF7, 0x00, 0x09, 0x0A, 0x0D, 0x1D, 0x43, 0x6B, 0x92, 0x9E, 0x76, 0x4E, 0x27,
+    0xF7, 0x00, 0x0A, 0x1B, 0x33, 0x38, 0x38, 0x56, 0x7C, 0xA2, 0x8E, 0x67, 0x3F, 0x17, 0xF8, 0x00, 0x0B, 0x0B, 0x33, 0x57,
+    0x62, 0x62, 0x6F, 0x90, 0xA4, 0x7E, 0x56, 0x2F, 0x08, 0xF8, 0x00, 0x0A, 0x0F, 0x39, 0x64, 0x8D, 0x8D, 0x95, 0xAB, 0x8D,
+    0x6A, 0x45, 0x1F, 0xF7, 0x00, 0x0A, 0x0F, 0x39, 0x64, 0x8E, 0x94, 0x93, 0x86, 0x6F, 0x51, 0x30, 0x0C, 0xF7, 0x00, 0x09,
+    0x0D, 0x36, 0x5C, 0x6A, 0x6A, 0x68, 0x5F, 0x4C, 0x33, 0x15, 0xF5, 0x00, 0x07, 0x20, 0x3A, 0x3F, 0x3F, 0x3E, 0x36, 0x27,
+    0x12, 0xF3, 0x00, 0x04, 0x11, 0x15, 0x15, 0x14, 0x0D, 0xE0, 0x00,
+};
+
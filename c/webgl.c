@@ -1,17 +1,27 @@
 // WebGL Interactive Grid - GPU-Accelerated Rendering from C
 //
 // Grid cell backgrounds + text are BOTH rendered via WebGL shaders.
-// Text uses a 5x7 bitmap font baked into a texture atlas.
+// Cell backgrounds are procedural: one fullscreen quad, with cells, stripes and
+// gaps computed in the fragment shader and per-cell overrides in a texture.
+// Only the visible window of the logical grid is laid out; see VIEWPORT.
+// Text uses a signed-distance-field font atlas generated offline (font_sdf.h).
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
 #include <GLES2/gl2.h>
+#define GL_GLEXT_PROTOTYPES
+#include <GLES2/gl2ext.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 #include <math.h>
 
 static EMSCRIPTEN_WEBGL_CONTEXT_HANDLE webgl_ctx = 0;
+static int canvas_width = 0;
+static int canvas_height = 0;
+static int damage_full = 1;  // the next frame repaints every surface whole, see damage tracking
 
 static GLuint compile_shader(GLenum type, const char* source) {
     GLuint shader = glCreateShader(type);
@@ -28,13 +38,21 @@ static GLuint compile_shader(GLenum type, const char* source) {
     return shader;
 }
 
-static GLuint create_program(const char* vert_src, const char* frag_src) {
+// Links a program with attribute i of the NULL-terminated `attribs` bound
+// to location i, so each pass sets its vertex arrays up once against fixed
+// locations (see the VAOs below). The locations of the NULL-terminated
+// `uniforms` (the ones a pass sets per frame) go into `locations`; nothing
+// is looked up by name while drawing.
+static GLuint create_program(const char* vert_src, const char* frag_src,
+                             const char* const* attribs, const char* const* uniforms,
+                             GLint* locations) {
     GLuint vert = compile_shader(GL_VERTEX_SHADER, vert_src);
     GLuint frag = compile_shader(GL_FRAGMENT_SHADER, frag_src);
     if (!vert || !frag) return 0;
     GLuint prog = glCreateProgram();
     glAttachShader(prog, vert);
     glAttachShader(prog, frag);
+    for (int i = 0; attribs[i]; i++) glBindAttribLocation(prog, i, attribs[i]);
     glLinkProgram(prog);
     GLint success;
     glGetProgramiv(prog, GL_LINK_STATUS, &success);
@@ -46,9 +64,21 @@ static GLuint create_program(const char* vert_src, const char* frag_src) {
     }
     glDeleteShader(vert);
     glDeleteShader(frag);
+    for (int i = 0; uniforms[i]; i++) locations[i] = glGetUniformLocation(prog, uniforms[i]);
     return prog;
 }
 
+// Every pass draws through vertex array objects that capture its attribute
+// layout (buffers, pointers, divisors) when its buffers are created, so a
+// draw is a glBindVertexArrayOES instead of re-specifying each attribute,
+// and no pass can leak attribute state into another.
+static GLuint create_vao(void) {
+    GLuint vao;
+    glGenVertexArraysOES(1, &vao);
+    glBindVertexArrayOES(vao);
+    return vao;
+}
+
 static void ensure_context(void) {
     if (webgl_ctx > 0) {
         emscripten_webgl_make_context_current(webgl_ctx);
@@ -65,7 +95,9 @@ int init_webgl(int width, int height) {
     emscripten_webgl_init_context_attributes(&attrs);
     attrs.alpha = 1;
     attrs.depth = 0;
-    attrs.antialias = 1;
+    // Everything is drawn into surface framebuffers, which are never
+    // multisampled, and the canvas only receives the composite
+    attrs.antialias = 0;
     attrs.majorVersion = 1;
 
     webgl_ctx = emscripten_webgl_create_context("#grid-canvas", &attrs);
@@ -74,496 +106,3571 @@ int init_webgl(int width, int height) {
         return 0;
     }
     emscripten_webgl_make_context_current(webgl_ctx);
+
+    // Text is drawn as instanced glyph quads
+    if (!emscripten_webgl_enable_extension(webgl_ctx, "ANGLE_instanced_arrays")) {
+        printf("ANGLE_instanced_arrays is not supported\n");
+        return 0;
+    }
+    if (!emscripten_webgl_enable_extension(webgl_ctx, "OES_vertex_array_object")) {
+        printf("OES_vertex_array_object is not supported\n");
+        return 0;
+    }
+
+    canvas_width = width;
+    canvas_height = height;
     glViewport(0, 0, width, height);
+    damage_full = 1;
     return 1;
 }
 
+// ============================================================
+// LAYOUT - column widths / row heights as prefix-sum offsets
+// ============================================================
+//
+// Each axis keeps offset[i] = pixel start of item i, with offset[count] the
+// total extent. Position and size of any cell are O(1) lookups, hit testing
+// is a binary search, and resizing one item shifts only the offsets after it.
+
+typedef struct {
+    double* offset;  // count + 1 entries
+    int count;
+} AxisLayout;
+
+static AxisLayout col_layout = { NULL, 0 };
+static AxisLayout row_layout = { NULL, 0 };
+
+static void axis_init(AxisLayout* axis, int count, double size) {
+    if (axis->offset) free(axis->offset);
+    axis->offset = (double*)malloc((count + 1) * sizeof(double));
+    axis->count = count;
+    for (int i = 0; i <= count; i++) axis->offset[i] = i * size;
+}
+
+static double axis_start(const AxisLayout* axis, int i) {
+    return axis->offset[i];
+}
+
+static double axis_size(const AxisLayout* axis, int i) {
+    return axis->offset[i + 1] - axis->offset[i];
+}
+
+static double axis_total(const AxisLayout* axis) {
+    return axis->offset[axis->count];
+}
+
+static void axis_resize_item(AxisLayout* axis, int i, double size) {
+    double delta = size - axis_size(axis, i);
+    if (delta == 0.0) return;
+    for (int j = i + 1; j <= axis->count; j++) axis->offset[j] += delta;
+}
+
+// Index of the item containing pos, clamped to [0, count - 1]
+static int axis_find(const AxisLayout* axis, double pos) {
+    int lo = 0, hi = axis->count - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) >> 1;
+        if (axis->offset[mid] <= pos) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
+}
+
 // ============================================================
 // GRID BACKGROUNDS
 // ============================================================
 
+// The background is fully procedural: one fullscreen quad per layer, and the
+// fragment shader works out which cell each pixel falls in from gl_FragCoord.
+// The header color, the row striping and the gaps between cells are computed
+// per fragment, so there is no per-cell geometry.
+//
+// With variable column widths and row heights, pixel -> cell goes through two
+// small lookup textures per layer (one texel per pixel along each axis)
+// holding the segment-relative cell index and whether the pixel falls in the
+// gap between cells. They are rebuilt from the prefix sums only when their
+// segment moves or a size inside it changes.
+//
+// Cells with a non-default style are the only per-cell state: an RGBA8
+// override texture with one texel per built cell, where alpha 0 means "use
+// the default style". Recoloring a cell is a 4-byte write plus a
+// glTexSubImage2D of the dirty texels.
+
+#define GRID_CELL_INSET 0.005f
+
+static const float grid_header_color[3] = { 0.0f, 0.5f, 0.7f };
+static const float grid_stripe_even[3] = { 0.15f, 0.15f, 0.25f };
+static const float grid_stripe_odd[3] = { 0.2f, 0.2f, 0.32f };
+
 static const char* grid_vertex_src =
+    "attribute vec2 a_position;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* grid_fragment_src =
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"
+    "precision highp float;\n"
+    "#else\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "uniform vec2 u_resolution;\n"
+    "uniform vec2 u_scroll;\n"
+    "uniform vec2 u_band;\n"
+    "uniform vec2 u_cell_base;\n"
+    "uniform sampler2D u_col_lut;\n"
+    "uniform sampler2D u_row_lut;\n"
+    "uniform vec2 u_lut_size;\n"
+    "uniform float u_header_rows;\n"
+    "uniform vec3 u_header_color;\n"
+    "uniform vec3 u_stripe_even;\n"
+    "uniform vec3 u_stripe_odd;\n"
+    "uniform sampler2D u_colors;\n"
+    "uniform vec2 u_colors_size;\n"
+    "void main() {\n"
+    "    vec2 px = floor(vec2(gl_FragCoord.x, u_resolution.y - gl_FragCoord.y) + u_scroll);\n"
+    "    if (any(lessThan(px, vec2(0.0))) || any(greaterThanEqual(px, u_lut_size))) discard;\n"
+    "    vec2 uv = (px + 0.5) / u_lut_size;\n"
+    "    vec4 col_info = texture2D(u_col_lut, vec2(uv.x, 0.5));\n"
+    "    vec4 row_info = texture2D(u_row_lut, vec2(uv.y, 0.5));\n"
+    "    if (col_info.b > 0.5 || row_info.b > 0.5) discard;\n"
+    "    vec2 cell = floor(vec2(col_info.r + col_info.g * 256.0, row_info.r + row_info.g * 256.0) * 255.0 + 0.5);\n"
+    "    float row = cell.y + u_band.y;\n"
+    "    vec3 color = row < u_header_rows ? u_header_color\n"
+    "               : (mod(row, 2.0) < 0.5 ? u_stripe_even : u_stripe_odd);\n"
+    "    vec4 override_color = texture2D(u_colors, (cell + u_cell_base + 0.5) / u_colors_size);\n"
+    "    gl_FragColor = vec4(mix(color, override_color.rgb, override_color.a), 1.0);\n"
+    "}\n";
+
+// Plain position + color shader (header span quads)
+static const char* solid_vertex_src =
     "attribute vec2 a_position;\n"
     "attribute vec3 a_color;\n"
+    "uniform vec2 u_translate;\n"
     "varying vec3 v_color;\n"
     "void main() {\n"
     "    v_color = a_color;\n"
-    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "    gl_Position = vec4(a_position + u_translate, 0.0, 1.0);\n"
     "}\n";
 
-static const char* grid_fragment_src =
+static const char* solid_fragment_src =
     "precision mediump float;\n"
     "varying vec3 v_color;\n"
     "void main() {\n"
     "    gl_FragColor = vec4(v_color, 1.0);\n"
     "}\n";
 
+static const float fullscreen_quad[6][2] = {
+    {-1, -1}, {1, -1}, {1, 1},
+    {-1, -1}, {1, 1}, {-1, 1}
+};
+
+enum { GRID_A_POSITION };
+static const char* const grid_attribs[] = { "a_position", NULL };
+enum { GRID_U_RESOLUTION, GRID_U_HEADER_ROWS, GRID_U_COLORS_SIZE, GRID_U_SCROLL, GRID_U_BAND,
+       GRID_U_CELL_BASE, GRID_U_LUT_SIZE, GRID_UNIFORMS };
+static const char* const grid_uniform_names[] = {
+    "u_resolution", "u_header_rows", "u_colors_size", "u_scroll", "u_band", "u_cell_base", "u_lut_size", NULL
+};
+
+enum { SOLID_A_POSITION, SOLID_A_COLOR };
+static const char* const solid_attribs[] = { "a_position", "a_color", NULL };
+static const char* const solid_uniform_names[] = { "u_translate", NULL };
+
 static GLuint grid_program = 0;
-static GLuint grid_vbo = 0;
-static float* grid_vertices = NULL;
-static int grid_vertex_count = 0;
+static GLint grid_uniforms[GRID_UNIFORMS];
+static GLuint solid_program = 0;
+static GLint solid_translate = -1;
+static GLuint quad_vbo = 0;
+static GLuint grid_vao = 0;
+static GLuint grid_color_texture = 0;
+static unsigned char* cell_colors = NULL;  // RGBA8 overrides for every logical cell, grid_cols per row
+static unsigned char* cell_format_bg = NULL;  // format rule background per logical cell, 0 = none
+static unsigned char* view_colors = NULL;  // RGBA8 overrides for the built segments, color_cap_cols per row
+static int color_cap_rows = 0;
+static int color_cap_cols = 0;
+static int override_count = 0;
+
+// Virtual viewport: grid_rows x grid_cols is the logical (dataset) size,
+// and set_viewport picks default sizes so view_rows x view_cols cells fit
+// on the canvas.
+//
+// Each axis is split into segments: rows into the frozen header rows and the
+// scrolling body, columns into pinned-left, scrolling center and pinned-right.
+// scroll_x/scroll_y is the pixel position of the center/body content shown at
+// the top-left of its screen area; frozen and pinned segments never move.
+//
+// A scrolling segment is built for a "band": the visible items plus an
+// overscan margin, positioned relative to the band origin. Scrolling inside
+// the band only changes the translation uniforms; the band is rebuilt when
+// the visible items cross its edge.
+#define SCROLL_OVERSCAN_ROWS 8
+#define SCROLL_OVERSCAN_COLS 2
+
+typedef struct {
+    int first;            // first logical row/col built into the segment
+    int count;            // fixed segments: all their items; scrolling: the band
+    int scrolls;          // follows scroll_x/scroll_y along its axis
+    int tex_base;         // offset of the segment in view_colors along the axis
+    double screen_start;  // on-canvas extent along the axis, in pixels
+    double screen_size;
+    GLuint lut;
+    int lut_size;
+    int lut_dirty;
+} AxisSegment;
+
+enum { SEG_FROZEN, SEG_BODY, ROW_SEGMENTS };
+enum { SEG_LEFT, SEG_CENTER, SEG_RIGHT, COL_SEGMENTS };
+#define LAYER_COUNT (ROW_SEGMENTS * COL_SEGMENTS)
+
+// One (row segment, col segment) pair: drawn under its own scissor rectangle
+// from its own text buffer, so scrolling the body never rebuilds the header
+// or the pinned columns.
+typedef struct {
+    AxisSegment* rows;
+    AxisSegment* cols;
+    GLuint text_vbo;
+    GLuint text_vao;            // text_vbo + glyph corners
+    struct GlyphInstance* text_batch;  // CPU layout: TEXT_SLOT_GLYPHS per slot
+    struct GlyphInstance* text_packed; // CPU mirror of text_vbo: each slot's glyphs, packed
+    int* text_slot_offset;      // slot -> first instance in text_packed, text_slots + 1 entries
+    unsigned char* text_slot_glyphs;   // glyphs laid out per slot
+    int text_packed_cap;
+    unsigned int* text_slot_dirty;
+    int text_slot_cap;
+    int text_slots;
+    int text_dirty_min;
+    int text_dirty_max;
+    int text_dirty;             // segments moved: lay out every slot
+    unsigned char* glyph_rows;  // GPU text layout: glyph indices, GLYPH_ROW_TEXELS per slot
+    GLuint glyph_texture;
+    GLuint cell_vbo;            // GPU text layout: one CellInstance per slot
+    GLuint cell_vao;            // cell_vbo + glyph corners
+    GLuint span_vbo;        // merged header span quads, see HEADERS
+    GLuint span_vao;
+    int span_vertex_count;
+    int spans_dirty;
+} GridLayer;
+
+static AxisSegment row_segments[ROW_SEGMENTS];
+static AxisSegment col_segments[COL_SEGMENTS];
+static GridLayer layers[LAYER_COUNT];
+
 static int grid_rows = 0;
 static int grid_cols = 0;
-static float* text_batch = NULL;
+static int view_rows = 0;
+static int view_cols = 0;
+static int requested_view_rows = 0;  // 0 = fit the whole grid
+static int requested_view_cols = 0;
+static int requested_frozen_rows = 1;  // row 0 is the header by default
+static int requested_pinned_left = 0;
+static int requested_pinned_right = 0;
+static int frozen_rows = 0;            // the requests clamped to the grid
+static int pinned_left_cols = 0;
+static int pinned_right_cols = 0;
+static double scroll_x = 0.0;
+static double scroll_y = 0.0;
+static int scroll_row = 0;  // first (possibly partly) visible body row/center col
+static int scroll_col = 0;
+static int max_texture_size = 4096;
+static int overlay_dirty = 1;  // selection/caret geometry needs rebuilding, see OVERLAY
+
+static int resize_cell_text(int rows, int cols);
+static int resize_header_spans(int cols);
+static void invalidate_header_cell(int row, int col);
+void clear_header_spans(void);
+static int drop_format_rules(int cols);
+static const unsigned char* cell_background(int row, int col);
+
+// Dirty tracking for view_colors: one bit per texel plus the index bounds,
+// so update_grid_buffer only uploads the spans set_cell_color touched.
+// Past either threshold a single full upload is cheaper than many small ones.
+#define GRID_DIRTY_FULL_FRACTION 4
+#define GRID_DIRTY_MAX_SPANS 32
+
+static unsigned int* grid_dirty = NULL;
+static int grid_dirty_count = 0;
+static int grid_dirty_min = 0;
+static int grid_dirty_max = -1;
+static int view_colors_stale = 0;  // segments moved: re-upload them whole
+
+static void clear_grid_dirty(void) {
+    if (grid_dirty && grid_dirty_max >= grid_dirty_min) {
+        int first = grid_dirty_min >> 5;
+        int last = grid_dirty_max >> 5;
+        memset(grid_dirty + first, 0, (last - first + 1) * sizeof(unsigned int));
+    }
+    grid_dirty_count = 0;
+    grid_dirty_min = color_cap_rows * color_cap_cols;
+    grid_dirty_max = -1;
+}
 
-static void cell_to_clip(int row, int col, int total_rows, int total_cols,
-                         float* x1, float* y1, float* x2, float* y2) {
-    float cell_w = 2.0f / total_cols;
-    float cell_h = 2.0f / total_rows;
-    *x1 = -1.0f + col * cell_w + 0.005f;
-    *x2 = -1.0f + (col + 1) * cell_w - 0.005f;
-    *y1 = 1.0f - (row + 1) * cell_h + 0.005f;
-    *y2 = 1.0f - row * cell_h - 0.005f;
+static void mark_cell_dirty(int cell_idx) {
+    unsigned int bit = 1u << (cell_idx & 31);
+    unsigned int* word = &grid_dirty[cell_idx >> 5];
+    if (*word & bit) return;
+    *word |= bit;
+    grid_dirty_count++;
+    if (cell_idx < grid_dirty_min) grid_dirty_min = cell_idx;
+    if (cell_idx > grid_dirty_max) grid_dirty_max = cell_idx;
 }
 
-EMSCRIPTEN_KEEPALIVE
-int init_grid(int rows, int cols) {
-    ensure_context();
-    grid_rows = rows;
-    grid_cols = cols;
+static int is_cell_dirty(int cell_idx) {
+    return (grid_dirty[cell_idx >> 5] >> (cell_idx & 31)) & 1u;
+}
 
-    if (!grid_program) {
-        grid_program = create_program(grid_vertex_src, grid_fragment_src);
-        if (!grid_program) return 0;
+static int segment_contains(const AxisSegment* seg, int item) {
+    return item >= seg->first && item < seg->first + seg->count;
+}
+
+static int segment_visible(const AxisSegment* seg) {
+    return seg->count > 0 && seg->screen_size > 0.0;
+}
+
+// The layer a logical cell is built into, or NULL if it is outside every band
+static GridLayer* layer_of(int row, int col) {
+    for (int r = 0; r < ROW_SEGMENTS; r++) {
+        if (!segment_contains(&row_segments[r], row)) continue;
+        for (int c = 0; c < COL_SEGMENTS; c++) {
+            if (segment_contains(&col_segments[c], col)) return &layers[r * COL_SEGMENTS + c];
+        }
     }
+    return NULL;
+}
+
+// Canvas pixel position of a segment's first item: fixed segments sit at
+// their screen start, scrolling ones are shifted back by the scroll offset.
+static double segment_origin(const AxisSegment* seg, const AxisLayout* axis, int content_start,
+                             double scroll) {
+    if (!seg->scrolls) return seg->screen_start;
+    return seg->screen_start - (axis_start(axis, content_start) + scroll - axis_start(axis, seg->first));
+}
+
+static double col_segment_origin(const AxisSegment* seg) {
+    return segment_origin(seg, &col_layout, pinned_left_cols, scroll_x);
+}
+
+static double row_segment_origin(const AxisSegment* seg) {
+    return segment_origin(seg, &row_layout, frozen_rows, scroll_y);
+}
 
-    int cells = rows * cols;
-    grid_vertex_count = cells * 6;
-    int floats_needed = grid_vertex_count * 5;
+// Clip-space offset from layer space (the layer's first cell at the
+// canvas's top-left) to where the layer is drawn. Fed to the text and solid
+// shaders.
+static void layer_translation(const GridLayer* layer, float* tx, float* ty) {
+    *tx = (float)col_segment_origin(layer->cols) * 2.0f / canvas_width;
+    *ty = -(float)row_segment_origin(layer->rows) * 2.0f / canvas_height;
+}
+
+// Damage tracking. What is on screen is kept in retained surfaces (see
+// SURFACES): the backgrounds, the header text, the body text and the
+// overlay each render into their own framebuffer texture, which keeps its
+// pixels between frames. A change adds a canvas pixel rectangle to the
+// surface it affects - a cell's background or text, the old and new overlay
+// geometry, the caret when it blinks - and render_grid repaints a surface
+// only inside its rectangles, with the layer scissors cut down to them.
+// Layout changes damage every surface whole, and a surface whose damage
+// covers more than DAMAGE_FULL_FRACTION of the canvas is repainted whole,
+// which is cheaper than many partial passes.
+#define DAMAGE_MAX_RECTS 8
+#define DAMAGE_FULL_FRACTION 0.5
+
+enum { SURFACE_BACKGROUND, SURFACE_HEADER_TEXT, SURFACE_BODY_TEXT, SURFACE_OVERLAY, SURFACES };
+
+typedef struct {
+    int x0, y0, x1, y1;  // canvas pixels, y down, end exclusive
+} DamageRect;
+
+typedef struct {
+    GLuint texture;
+    GLuint fbo;
+    DamageRect rects[DAMAGE_MAX_RECTS];
+    int count;
+    int full;  // repaint the whole surface
+} Surface;
+
+static Surface surfaces[SURFACES];
+static DamageRect damage_clip = { 0, 0, 0, 0 };  // the rectangle being repainted
+
+static int rect_empty(const DamageRect* r) {
+    return r->x1 <= r->x0 || r->y1 <= r->y0;
+}
+
+static long rect_area(const DamageRect* r) {
+    return rect_empty(r) ? 0 : (long)(r->x1 - r->x0) * (r->y1 - r->y0);
+}
 
-    if (grid_vertices) free(grid_vertices);
-    grid_vertices = (float*)malloc(floats_needed * sizeof(float));
+static DamageRect rect_union(const DamageRect* a, const DamageRect* b) {
+    DamageRect r;
+    r.x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+    r.y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+    r.x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+    r.y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+    return r;
+}
 
-    if (text_batch) { free(text_batch); text_batch = NULL; }
+static DamageRect rect_intersect(const DamageRect* a, const DamageRect* b) {
+    DamageRect r;
+    r.x0 = a->x0 > b->x0 ? a->x0 : b->x0;
+    r.y0 = a->y0 > b->y0 ? a->y0 : b->y0;
+    r.x1 = a->x1 < b->x1 ? a->x1 : b->x1;
+    r.y1 = a->y1 < b->y1 ? a->y1 : b->y1;
+    return r;
+}
 
-    int idx = 0;
-    for (int row = 0; row < rows; row++) {
-        for (int col = 0; col < cols; col++) {
-            float x1, y1, x2, y2;
-            cell_to_clip(row, col, rows, cols, &x1, &y1, &x2, &y2);
+static void damage_all(void) {
+    damage_full = 1;
+}
 
-            float r, g, b;
-            if (row == 0) { r = 0.0f; g = 0.5f; b = 0.7f; }
-            else if (row % 2 == 0) { r = 0.15f; g = 0.15f; b = 0.25f; }
-            else { r = 0.2f; g = 0.2f; b = 0.32f; }
+static void damage_surface(int surface) {
+    surfaces[surface].full = 1;
+}
 
-            float vdata[6][5] = {
-                {x1,y1,r,g,b}, {x2,y1,r,g,b}, {x2,y2,r,g,b},
-                {x1,y1,r,g,b}, {x2,y2,r,g,b}, {x1,y2,r,g,b}
-            };
-            for (int v = 0; v < 6; v++)
-                for (int f = 0; f < 5; f++)
-                    grid_vertices[idx++] = vdata[v][f];
+// Adds a rectangle to a surface, merged with any it overlaps or touches.
+// With the list full it is merged into the rectangle it grows least.
+static void add_damage(int surface, DamageRect r) {
+    Surface* surf = &surfaces[surface];
+    if (damage_full || surf->full) return;
+    DamageRect canvas = { 0, 0, canvas_width, canvas_height };
+    r = rect_intersect(&r, &canvas);
+    if (rect_empty(&r)) return;
+
+    for (int i = 0; i < surf->count; i++) {
+        const DamageRect* d = &surf->rects[i];
+        if (r.x0 > d->x1 || d->x0 > r.x1 || r.y0 > d->y1 || d->y0 > r.y1) continue;
+        r = rect_union(&r, d);
+        surf->rects[i] = surf->rects[--surf->count];
+        i = -1;  // the union may now touch rectangles already passed
+    }
+    if (surf->count < DAMAGE_MAX_RECTS) {
+        surf->rects[surf->count++] = r;
+        return;
+    }
+    int best = 0;
+    long best_growth = -1;
+    for (int i = 0; i < surf->count; i++) {
+        DamageRect u = rect_union(&r, &surf->rects[i]);
+        long growth = rect_area(&u) - rect_area(&surf->rects[i]);
+        if (best_growth < 0 || growth < best_growth) {
+            best = i;
+            best_growth = growth;
         }
     }
+    surf->rects[best] = rect_union(&r, &surf->rects[best]);
+}
+
+static long damage_area(const Surface* surf) {
+    long area = 0;
+    for (int i = 0; i < surf->count; i++) area += rect_area(&surf->rects[i]);
+    return area;
+}
+
+// Frozen rows draw their text into the header surface, the rest into the body one
+static int text_surface(const GridLayer* layer) {
+    return layer->rows == &row_segments[SEG_FROZEN] ? SURFACE_HEADER_TEXT : SURFACE_BODY_TEXT;
+}
+
+// The layer's on-screen rectangle
+static DamageRect layer_screen_rect(const GridLayer* layer) {
+    DamageRect r;
+    r.x0 = (int)floor(layer->cols->screen_start);
+    r.x1 = (int)ceil(layer->cols->screen_start + layer->cols->screen_size);
+    r.y0 = (int)floor(layer->rows->screen_start);
+    r.y1 = (int)ceil(layer->rows->screen_start + layer->rows->screen_size);
+    return r;
+}
+
+static void damage_layer(int surface, const GridLayer* layer) {
+    add_damage(surface, layer_screen_rect(layer));
+}
+
+// Damages a rectangle given in layer pixels (the layer's first cell at the
+// canvas's top-left), cut to the layer
+static void damage_layer_px(int surface, const GridLayer* layer, double x0, double y0, double x1, double y1) {
+    double ox = col_segment_origin(layer->cols);
+    double oy = row_segment_origin(layer->rows);
+    DamageRect r = { (int)floor(ox + x0), (int)floor(oy + y0), (int)ceil(ox + x1), (int)ceil(oy + y1) };
+    DamageRect screen = layer_screen_rect(layer);
+    add_damage(surface, rect_intersect(&r, &screen));
+}
+
+// Damages the cells [r1, r2] x [c1, c2] of a layer, gaps included
+static void damage_cells(int surface, const GridLayer* layer, int r1, int c1, int r2, int c2) {
+    double left = axis_start(&col_layout, layer->cols->first);
+    double top = axis_start(&row_layout, layer->rows->first);
+    damage_layer_px(surface, layer, axis_start(&col_layout, c1) - left, axis_start(&row_layout, r1) - top,
+                    axis_start(&col_layout, c2 + 1) - left, axis_start(&row_layout, r2 + 1) - top);
+}
 
-    if (!grid_vbo) glGenBuffers(1, &grid_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, grid_vbo);
-    glBufferData(GL_ARRAY_BUFFER, floats_needed * sizeof(float), grid_vertices, GL_DYNAMIC_DRAW);
+// Restricts drawing to the part of the layer's on-screen rectangle being
+// redrawn. Returns 0 if there is none.
+static int layer_scissor(const GridLayer* layer) {
+    DamageRect screen = layer_screen_rect(layer);
+    DamageRect r = rect_intersect(&screen, &damage_clip);
+    if (rect_empty(&r)) return 0;
+    glScissor(r.x0, canvas_height - r.y1, r.x1 - r.x0, r.y1 - r.y0);
     return 1;
 }
 
-EMSCRIPTEN_KEEPALIVE
-void set_cell_color(int row, int col, int total_cols, float r, float g, float b) {
-    if (!grid_vertices) return;
-    ensure_context();
-    int cell_idx = row * total_cols + col;
-    int base = cell_idx * 6 * 5;
-    for (int v = 0; v < 6; v++) {
-        int offset = base + v * 5 + 2;
-        grid_vertices[offset + 0] = r;
-        grid_vertices[offset + 1] = g;
-        grid_vertices[offset + 2] = b;
+// Logical cell -> clip rectangle in layer space, inset by the cell gap
+static void cell_to_clip(const GridLayer* layer, int row, int col,
+                         float* x1, float* y1, float* x2, float* y2) {
+    float left = (float)(axis_start(&col_layout, col) - axis_start(&col_layout, layer->cols->first));
+    float top = (float)(axis_start(&row_layout, row) - axis_start(&row_layout, layer->rows->first));
+    float w = (float)axis_size(&col_layout, col);
+    float h = (float)axis_size(&row_layout, row);
+    *x1 = -1.0f + left * 2.0f / canvas_width + GRID_CELL_INSET;
+    *x2 = -1.0f + (left + w) * 2.0f / canvas_width - GRID_CELL_INSET;
+    *y1 = 1.0f - (top + h) * 2.0f / canvas_height + GRID_CELL_INSET;
+    *y2 = 1.0f - top * 2.0f / canvas_height - GRID_CELL_INSET;
+}
+
+static unsigned char unit_to_byte(float v) {
+    if (v <= 0.0f) return 0;
+    if (v >= 1.0f) return 255;
+    return (unsigned char)(v * 255.0f + 0.5f);
+}
+
+static int round_up_pow2(int n) {
+    int p = 16;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+// The window texture only ever grows, so shrinking or re-growing within
+// capacity costs nothing. Texture coordinates are scaled by the capacity,
+// not the window size, in the fragment shader.
+static void ensure_color_capacity(int rows, int cols) {
+    if (rows <= color_cap_rows && cols <= color_cap_cols) return;
+
+    color_cap_rows = round_up_pow2(rows > color_cap_rows ? rows : color_cap_rows);
+    color_cap_cols = round_up_pow2(cols > color_cap_cols ? cols : color_cap_cols);
+    int texels = color_cap_rows * color_cap_cols;
+
+    if (view_colors) free(view_colors);
+    view_colors = (unsigned char*)calloc(texels, 4);
+    if (grid_dirty) free(grid_dirty);
+    grid_dirty = (unsigned int*)calloc((texels + 31) / 32, sizeof(unsigned int));
+    grid_dirty_max = -1;
+    clear_grid_dirty();
+
+    if (!grid_color_texture) {
+        glGenTextures(1, &grid_color_texture);
+        glBindTexture(GL_TEXTURE_2D, grid_color_texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     }
+    glBindTexture(GL_TEXTURE_2D, grid_color_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, color_cap_cols, color_cap_rows, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, view_colors);
 }
 
-EMSCRIPTEN_KEEPALIVE
-void update_grid_buffer(void) {
-    if (!grid_vertices || !grid_vbo) return;
-    ensure_context();
-    glBindBuffer(GL_ARRAY_BUFFER, grid_vbo);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, grid_vertex_count * 5 * sizeof(float), grid_vertices);
+// view_colors holds every segment's cells side by side: frozen rows then the
+// body band, and left, center band, right along each row. Stacks the
+// segments of one axis and returns the total.
+static int assign_tex_bases(AxisSegment* segs, int count) {
+    int base = 0;
+    for (int i = 0; i < count; i++) {
+        segs[i].tex_base = base;
+        base += segs[i].count;
+    }
+    return base;
 }
 
-static void render_grid_bg(void) {
-    glUseProgram(grid_program);
-    glBindBuffer(GL_ARRAY_BUFFER, grid_vbo);
-    GLint a_pos = glGetAttribLocation(grid_program, "a_position");
-    GLint a_col = glGetAttribLocation(grid_program, "a_color");
-    glEnableVertexAttribArray(a_pos);
-    glEnableVertexAttribArray(a_col);
-    glVertexAttribPointer(a_pos, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glVertexAttribPointer(a_col, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(2 * sizeof(float)));
-    glDrawArrays(GL_TRIANGLES, 0, grid_vertex_count);
-    glDisableVertexAttribArray(a_pos);
-    glDisableVertexAttribArray(a_col);
+// Copies the built segments of the logical override table into view_colors.
+// Cost is proportional to what is on screen, never to the dataset.
+static void refresh_view_colors(void) {
+    int rows = assign_tex_bases(row_segments, ROW_SEGMENTS);
+    int cols = assign_tex_bases(col_segments, COL_SEGMENTS);
+    ensure_color_capacity(rows, cols);
+    for (int rs = 0; rs < ROW_SEGMENTS; rs++) {
+        const AxisSegment* rseg = &row_segments[rs];
+        for (int r = 0; r < rseg->count; r++) {
+            unsigned char* dst = view_colors + (rseg->tex_base + r) * color_cap_cols * 4;
+            for (int cs = 0; cs < COL_SEGMENTS; cs++) {
+                const AxisSegment* cseg = &col_segments[cs];
+                if (cseg->count == 0) continue;
+                if (cell_format_bg) {
+                    for (int c = 0; c < cseg->count; c++)
+                        memcpy(dst + (cseg->tex_base + c) * 4, cell_background(rseg->first + r, cseg->first + c), 4);
+                } else if (cell_colors)
+                    memcpy(dst + cseg->tex_base * 4,
+                           cell_colors + ((rseg->first + r) * grid_cols + cseg->first) * 4, cseg->count * 4);
+                else
+                    memset(dst + cseg->tex_base * 4, 0, cseg->count * 4);
+            }
+        }
+    }
+    clear_grid_dirty();
+    view_colors_stale = 1;
 }
 
-// ============================================================
-// TEXT RENDERING - Bitmap font texture atlas
-// ============================================================
-//
-// How this works:
-//   1. A 5x7 pixel bitmap for each character is embedded in C.
-//   2. All bitmaps are packed into one small texture (the "atlas").
-//   3. To draw a character, we draw a textured quad sampling
-//      the right region of the atlas via UV coordinates.
-//   4. The fragment shader uses the texture's red channel as alpha,
-//      so the background shows through where the font pixel is 0.
-
-// 5x7 bitmap font data. Each byte is a row, low 5 bits = pixels.
-// Supports: 0-9 . + - C o l A B D E F G H I J K L M N O P Q R S T U V W X Y Z space
-#define FONT_CHAR_COUNT 40
-
-static const unsigned char font_5x7[FONT_CHAR_COUNT][7] = {
-    { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E }, /*  0: '0' */
-    { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E }, /*  1: '1' */
-    { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F }, /*  2: '2' */
-    { 0x0E, 0x11, 0x01, 0x06, 0x01, 0x11, 0x0E }, /*  3: '3' */
-    { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 }, /*  4: '4' */
-    { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E }, /*  5: '5' */
-    { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E }, /*  6: '6' */
-    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 }, /*  7: '7' */
-    { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E }, /*  8: '8' */
-    { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C }, /*  9: '9' */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C }, /* 10: '.' */
-    { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 }, /* 11: '-' */
-    { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 }, /* 12: '+' */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 13: ' ' (space) */
-    { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, /* 14: 'A' */
-    { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E }, /* 15: 'B' */
-    { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E }, /* 16: 'C' */
-    { 0x1E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E }, /* 17: 'D' */
-    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F }, /* 18: 'E' */
-    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 }, /* 19: 'F' */
-    { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F }, /* 20: 'G' */
-    { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, /* 21: 'H' */
-    { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E }, /* 22: 'I' */
-    { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C }, /* 23: 'J' */
-    { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 }, /* 24: 'K' */
-    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F }, /* 25: 'L' */
-    { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 }, /* 26: 'M' */
-    { 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x11 }, /* 27: 'N' */
-    { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, /* 28: 'O' */
-    { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 }, /* 29: 'P' */
-    { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D }, /* 30: 'Q' */
-    { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 }, /* 31: 'R' */
-    { 0x0E, 0x11, 0x10, 0x0E, 0x01, 0x11, 0x0E }, /* 32: 'S' */
-    { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, /* 33: 'T' */
-    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, /* 34: 'U' */
-    { 0x11, 0x11, 0x11, 0x11, 0x0A, 0x0A, 0x04 }, /* 35: 'V' */
-    { 0x11, 0x11, 0x11, 0x15, 0x15, 0x1B, 0x11 }, /* 36: 'W' */
-    { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 }, /* 37: 'X' */
-    { 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04 }, /* 38: 'Y' */
-    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F }, /* 39: 'Z' */
-};
+// A segment's cells moved or resized: its LUT and the text of every layer
+// built from it need rebuilding. Layers on other segments are untouched.
+static void invalidate_segment(AxisSegment* seg) {
+    seg->lut_dirty = 1;
+    overlay_dirty = 1;
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        if (layers[i].rows == seg || layers[i].cols == seg) layers[i].text_dirty = layers[i].spans_dirty = 1;
+    }
+}
 
-#define FONT_CHAR_W 5
-#define FONT_CHAR_H 7
-#define FONT_COLS 8
-#define FONT_ATLAS_W (FONT_COLS * 6)
-#define FONT_ATLAS_H (((FONT_CHAR_COUNT + FONT_COLS - 1) / FONT_COLS) * 8)
-#define MAX_CELL_LEN 32
-#define MAX_ROWS 256
-#define MAX_COLS 64
-
-static char cell_text[MAX_ROWS][MAX_COLS][MAX_CELL_LEN];
-
-static int char_to_index(char c) {
-    if (c >= '0' && c <= '9') return c - '0';
-    if (c == '.') return 10;
-    if (c == '-') return 11;
-    if (c == '+') return 12;
-    if (c == ' ') return 13;
-    if (c >= 'A' && c <= 'Z') return 14 + (c - 'A');
-    if (c >= 'a' && c <= 'z') return 14 + (c - 'a');
-    return -1;
+// Rebuilds a scrolling segment's band around the items visible in
+// [content_start, content_end) at the given scroll offset, if they have left
+// it (or unconditionally with force). Returns 1 if the band moved.
+static int ensure_segment_band(AxisSegment* seg, const AxisLayout* axis, int content_start,
+                               int content_end, double scroll, int overscan, int force) {
+    if (content_end <= content_start || seg->screen_size <= 0.0) {
+        if (seg->count == 0 && !force) return 0;
+        seg->first = content_start;
+        seg->count = 0;
+        invalidate_segment(seg);
+        return 1;
+    }
+
+    // The first and last item touching the screen area, including partly
+    // visible edges
+    double view_start = axis_start(axis, content_start) + scroll;
+    int first_visible = axis_find(axis, view_start);
+    int last_visible = axis_find(axis, view_start + seg->screen_size);
+    if (first_visible < content_start) first_visible = content_start;
+    if (last_visible >= content_end) last_visible = content_end - 1;
+    if (!force && seg->count > 0 &&
+        first_visible >= seg->first && last_visible < seg->first + seg->count) return 0;
+
+    int first = first_visible - overscan;
+    int end = last_visible + 1 + overscan;
+    if (first < content_start) first = content_start;
+    if (end > content_end) end = content_end;
+    seg->first = first;
+    seg->count = end - first;
+    invalidate_segment(seg);
+    return 1;
 }
 
-// Text shader: textured quad per character
-static const char* text_vertex_src =
-    "attribute vec2 a_position;\n"
-    "attribute vec2 a_uv;\n"
-    "varying vec2 v_uv;\n"
-    "void main() {\n"
-    "    v_uv = a_uv;\n"
-    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
-    "}\n";
+// Keeps the body and center bands around the visible cells. Returns 1 if
+// either band moved.
+static int ensure_band(int force) {
+    int moved = ensure_segment_band(&row_segments[SEG_BODY], &row_layout, frozen_rows, grid_rows,
+                                    scroll_y, SCROLL_OVERSCAN_ROWS, force);
+    moved |= ensure_segment_band(&col_segments[SEG_CENTER], &col_layout, pinned_left_cols,
+                                 grid_cols - pinned_right_cols, scroll_x, SCROLL_OVERSCAN_COLS, force);
+    if (moved) refresh_view_colors();
+    return moved;
+}
 
-static const char* text_fragment_src =
-    "precision mediump float;\n"
-    "varying vec2 v_uv;\n"
-    "uniform sampler2D u_texture;\n"
-    "uniform vec3 u_color;\n"
-    "void main() {\n"
-    "    float a = texture2D(u_texture, v_uv).r;\n"
-    "    gl_FragColor = vec4(u_color, a);\n"
-    "}\n";
+// Scrollable extent of the body/center content beyond its screen area
+static double max_scroll_x(void) {
+    const AxisSegment* center = &col_segments[SEG_CENTER];
+    return axis_start(&col_layout, grid_cols - pinned_right_cols) -
+           axis_start(&col_layout, pinned_left_cols) - center->screen_size;
+}
 
-static GLuint text_program = 0;
-static GLuint font_texture = 0;
-static GLuint text_vbo = 0;
+static double max_scroll_y(void) {
+    const AxisSegment* body = &row_segments[SEG_BODY];
+    return axis_total(&row_layout) - axis_start(&row_layout, frozen_rows) - body->screen_size;
+}
 
-static void init_font_texture(void) {
-    if (font_texture) return;
+// Clamps a pixel scroll position to the body/center content, derives the
+// first visible row/col and keeps the bands around them. Returns 1 if the
+// position changed.
+static int set_scroll_px(double x, double y) {
+    double max_x = max_scroll_x();
+    double max_y = max_scroll_y();
+    if (x > max_x) x = max_x;
+    if (y > max_y) y = max_y;
+    if (x < 0.0) x = 0.0;
+    if (y < 0.0) y = 0.0;
+    int moved = x != scroll_x || y != scroll_y;
+    scroll_x = x;
+    scroll_y = y;
+    scroll_col = axis_find(&col_layout, axis_start(&col_layout, pinned_left_cols) + x);
+    scroll_row = axis_find(&row_layout, axis_start(&row_layout, frozen_rows) + y);
+    ensure_band(0);
+    return moved;
+}
 
-    unsigned char* pixels = (unsigned char*)calloc(FONT_ATLAS_W * FONT_ATLAS_H, 1);
-
-    for (int c = 0; c < FONT_CHAR_COUNT; c++) {
-        int atlas_col = c % FONT_COLS;
-        int atlas_row = c / FONT_COLS;
-        int ox = atlas_col * 6;
-        int oy = atlas_row * 8;
-
-        for (int y = 0; y < 7; y++) {
-            unsigned char row_bits = font_5x7[c][y];
-            for (int x = 0; x < 5; x++) {
-                int px = ox + x;
-                int py = oy + y;
-                if (px < FONT_ATLAS_W && py < FONT_ATLAS_H) {
-                    pixels[py * FONT_ATLAS_W + px] = (row_bits & (1 << (4 - x))) ? 255 : 0;
-                }
-            }
+static void set_fixed_segment(AxisSegment* seg, int first, int count, double screen_start,
+                              double screen_size) {
+    seg->first = first;
+    seg->count = count;
+    seg->scrolls = 0;
+    seg->screen_start = screen_start;
+    seg->screen_size = screen_size;
+}
+
+// Lays the frozen/pinned segments out on the canvas from the current sizes
+// and gives the scrolling segments what is left. Invalidates every layer.
+static void update_segments(void) {
+    frozen_rows = requested_frozen_rows < grid_rows ? requested_frozen_rows : grid_rows;
+    pinned_left_cols = requested_pinned_left < grid_cols ? requested_pinned_left : grid_cols;
+    pinned_right_cols = requested_pinned_right < grid_cols - pinned_left_cols
+        ? requested_pinned_right : grid_cols - pinned_left_cols;
+
+    double frozen_h = fmin(axis_start(&row_layout, frozen_rows), canvas_height);
+    double left_w = fmin(axis_start(&col_layout, pinned_left_cols), canvas_width);
+    double right_w = fmin(axis_total(&col_layout) - axis_start(&col_layout, grid_cols - pinned_right_cols),
+                          canvas_width - left_w);
+
+    set_fixed_segment(&row_segments[SEG_FROZEN], 0, frozen_rows, 0.0, frozen_h);
+    set_fixed_segment(&col_segments[SEG_LEFT], 0, pinned_left_cols, 0.0, left_w);
+    set_fixed_segment(&col_segments[SEG_RIGHT], grid_cols - pinned_right_cols, pinned_right_cols,
+                      canvas_width - right_w, right_w);
+
+    AxisSegment* body = &row_segments[SEG_BODY];
+    body->scrolls = 1;
+    body->screen_start = frozen_h;
+    body->screen_size = canvas_height - frozen_h;
+    AxisSegment* center = &col_segments[SEG_CENTER];
+    center->scrolls = 1;
+    center->screen_start = left_w;
+    center->screen_size = canvas_width - left_w - right_w;
+
+    for (int r = 0; r < ROW_SEGMENTS; r++) invalidate_segment(&row_segments[r]);
+    for (int c = 0; c < COL_SEGMENTS; c++) invalidate_segment(&col_segments[c]);
+}
+
+// Resets every row/col to the default size that fits view_rows x view_cols
+// on the canvas, then re-clamps the scroll position and rebuilds the bands.
+static void update_view(void) {
+    view_rows = requested_view_rows > 0 && requested_view_rows < grid_rows ? requested_view_rows : grid_rows;
+    view_cols = requested_view_cols > 0 && requested_view_cols < grid_cols ? requested_view_cols : grid_cols;
+    if (view_rows <= 0 || view_cols <= 0) return;
+    axis_init(&row_layout, grid_rows, (double)canvas_height / view_rows);
+    axis_init(&col_layout, grid_cols, (double)canvas_width / view_cols);
+    update_segments();
+    set_scroll_px(scroll_x, scroll_y);
+    ensure_band(1);
+}
+
+// Uploads texels [start, end) of the window table. A run can wrap rows,
+// so it goes up as a partial first row, the whole rows in between
+// (contiguous in both memory and texture), and a partial last row.
+static void upload_color_span(int start, int end) {
+    while (start < end) {
+        int row = start / color_cap_cols;
+        int col = start % color_cap_cols;
+        int width, height;
+        if (col == 0 && end - start >= color_cap_cols) {
+            width = color_cap_cols;
+            height = (end - start) / color_cap_cols;
+        } else {
+            width = color_cap_cols - col;
+            if (width > end - start) width = end - start;
+            height = 1;
         }
+        glTexSubImage2D(GL_TEXTURE_2D, 0, col, row, width, height,
+                        GL_RGBA, GL_UNSIGNED_BYTE, view_colors + start * 4);
+        start += width * height;
     }
+}
 
-    glGenTextures(1, &font_texture);
-    glBindTexture(GL_TEXTURE_2D, font_texture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, FONT_ATLAS_W, FONT_ATLAS_H, 0,
-                 GL_LUMINANCE, GL_UNSIGNED_BYTE, pixels);
+static unsigned char* lut_pixels = NULL;
+static int lut_pixels_cap = 0;
+
+// Writes one RGBA texel per segment pixel along an axis: RG = segment-relative
+// index (16-bit), B = 255 where the pixel lies in the gap between items.
+// Returns the number of texels written (clamped to the max texture size).
+static int build_axis_lut(const AxisLayout* axis, int first, int count, float inset,
+                          GLuint texture) {
+    double origin = axis_start(axis, first);
+    int size = (int)ceil(axis_start(axis, first + count) - origin);
+    if (size > max_texture_size) size = max_texture_size;
+    if (size < 1) size = 1;
+    if (size > lut_pixels_cap) {
+        if (lut_pixels) free(lut_pixels);
+        lut_pixels = (unsigned char*)malloc(size * 4);
+        lut_pixels_cap = size;
+    }
+
+    int item = 0;
+    for (int p = 0; p < size; p++) {
+        double center = origin + p + 0.5;
+        while (item < count - 1 && center >= axis_start(axis, first + item + 1)) item++;
+        double local = center - axis_start(axis, first + item);
+        int gap = local < inset || local > axis_size(axis, first + item) - inset;
+        unsigned char* texel = lut_pixels + p * 4;
+        texel[0] = (unsigned char)(item & 0xFF);
+        texel[1] = (unsigned char)(item >> 8);
+        texel[2] = gap ? 255 : 0;
+        texel[3] = 255;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, lut_pixels);
+    return size;
+}
+
+static GLuint create_lut_texture(void) {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    return texture;
+}
 
-    free(pixels);
+static void build_segment_lut(AxisSegment* seg, const AxisLayout* axis, float inset) {
+    if (!seg->lut) seg->lut = create_lut_texture();
+    seg->lut_size = build_axis_lut(axis, seg->first, seg->count, inset, seg->lut);
+    seg->lut_dirty = 0;
 }
 
-// Batch all character quads into one draw call per frame
-#define MAX_TEXT_VERTS (MAX_ROWS * MAX_COLS * MAX_CELL_LEN * 6)
-// text_batch is forward-declared near the top so init_grid can free it on resize
-static int text_batch_count = 0;
+EMSCRIPTEN_KEEPALIVE
+int init_grid(int rows, int cols) {
+    ensure_context();
+    // Cells are addressed as row * cols + col (set_cell_numbers, get_cell_at)
+    if (rows < 0 || cols < 0 || (cols > 0 && rows > INT_MAX / cols)) return 0;
 
-static void render_text(void) {
-    if (!text_program) {
-        text_program = create_program(text_vertex_src, text_fragment_src);
-        if (!text_program) return;
+    if (!grid_program) {
+        grid_program = create_program(grid_vertex_src, grid_fragment_src, grid_attribs,
+                                      grid_uniform_names, grid_uniforms);
+        if (!grid_program) return 0;
+        // Uniforms that never change are set once
+        glUseProgram(grid_program);
+        glUniform3fv(glGetUniformLocation(grid_program, "u_header_color"), 1, grid_header_color);
+        glUniform3fv(glGetUniformLocation(grid_program, "u_stripe_even"), 1, grid_stripe_even);
+        glUniform3fv(glGetUniformLocation(grid_program, "u_stripe_odd"), 1, grid_stripe_odd);
+        glUniform1i(glGetUniformLocation(grid_program, "u_colors"), 0);
+        glUniform1i(glGetUniformLocation(grid_program, "u_col_lut"), 1);
+        glUniform1i(glGetUniformLocation(grid_program, "u_row_lut"), 2);
     }
-    init_font_texture();
-    if (!font_texture) return;
-
-    // Allocate batch buffer lazily
-    if (!text_batch) {
-        int max_chars = grid_rows * grid_cols * MAX_CELL_LEN;
-        // 6 verts * 4 floats (x,y,u,v)
-        text_batch = (float*)malloc(max_chars * 6 * 4 * sizeof(float));
-    }
-    text_batch_count = 0;
-
-    float atlas_w = (float)FONT_ATLAS_W;
-    float atlas_h = (float)FONT_ATLAS_H;
-
-    for (int row = 0; row < grid_rows; row++) {
-        for (int col = 0; col < grid_cols; col++) {
-            const char* str = cell_text[row][col];
-            if (str[0] == '\0') continue;
-
-            float x1, y1, x2, y2;
-            cell_to_clip(row, col, grid_rows, grid_cols, &x1, &y1, &x2, &y2);
-
-            float cw = x2 - x1;
-            float ch = y2 - y1;
-
-            int len = strlen(str);
-            if (len > MAX_CELL_LEN) len = MAX_CELL_LEN;
-
-            // Scale chars to fit cell: use ~70% of cell height, auto-width
-            float char_h = ch * 0.65f;
-            float char_w = char_h * (5.0f / 7.0f);
-
-            // Center text horizontally and vertically
-            float total_w = len * char_w * 0.85f;
-            float start_x = x1 + (cw - total_w) * 0.5f;
-            float start_y = y1 + (ch - char_h) * 0.5f;
-
-            float cx = start_x;
-            float cy = start_y;
-
-            for (int i = 0; i < len; i++) {
-                int ci = char_to_index(str[i]);
-                if (ci < 0) { cx += char_w * 0.85f; continue; }
-
-                int atlas_col_idx = ci % FONT_COLS;
-                int atlas_row_idx = ci / FONT_COLS;
-
-                float u0 = (atlas_col_idx * 6.0f) / atlas_w;
-                float u1 = (atlas_col_idx * 6.0f + 5.0f) / atlas_w;
-                float v0 = (atlas_row_idx * 8.0f) / atlas_h;
-                float v1 = (atlas_row_idx * 8.0f + 7.0f) / atlas_h;
-
-                int b = text_batch_count * 4;
-                // Triangle 1
-                text_batch[b +  0] = cx;          text_batch[b +  1] = cy;
-                text_batch[b +  2] = u0;          text_batch[b +  3] = v1;
-                text_batch[b +  4] = cx + char_w; text_batch[b +  5] = cy;
-                text_batch[b +  6] = u1;          text_batch[b +  7] = v1;
-                text_batch[b +  8] = cx + char_w; text_batch[b +  9] = cy + char_h;
-                text_batch[b + 10] = u1;          text_batch[b + 11] = v0;
-                // Triangle 2
-                text_batch[b + 12] = cx;          text_batch[b + 13] = cy;
-                text_batch[b + 14] = u0;          text_batch[b + 15] = v1;
-                text_batch[b + 16] = cx + char_w; text_batch[b + 17] = cy + char_h;
-                text_batch[b + 18] = u1;          text_batch[b + 19] = v0;
-                text_batch[b + 20] = cx;          text_batch[b + 21] = cy + char_h;
-                text_batch[b + 22] = u0;          text_batch[b + 23] = v0;
-
-                text_batch_count += 6;
-                cx += char_w * 0.85f;
-
-                if (cx + char_w > x2) break;
+    if (!solid_program) {
+        solid_program = create_program(solid_vertex_src, solid_fragment_src, solid_attribs,
+                                       solid_uniform_names, &solid_translate);
+        if (!solid_program) return 0;
+    }
+    if (!quad_vbo) {
+        glGenBuffers(1, &quad_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, quad_vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(fullscreen_quad), fullscreen_quad, GL_STATIC_DRAW);
+        grid_vao = create_vao();
+        glEnableVertexAttribArray(GRID_A_POSITION);
+        glVertexAttribPointer(GRID_A_POSITION, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glBindVertexArrayOES(0);
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+        for (int r = 0; r < ROW_SEGMENTS; r++) {
+            for (int c = 0; c < COL_SEGMENTS; c++) {
+                layers[r * COL_SEGMENTS + c].rows = &row_segments[r];
+                layers[r * COL_SEGMENTS + c].cols = &col_segments[c];
             }
         }
     }
 
-    if (text_batch_count == 0) return;
-
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    glUseProgram(text_program);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, font_texture);
-    glUniform1i(glGetUniformLocation(text_program, "u_texture"), 0);
-    glUniform3f(glGetUniformLocation(text_program, "u_color"), 1.0f, 1.0f, 1.0f);
+    // A new grid starts with default styles everywhere; the logical
+    // override table is only allocated once something is overridden.
+    if (cell_colors) { free(cell_colors); cell_colors = NULL; }
+    if (cell_format_bg) { free(cell_format_bg); cell_format_bg = NULL; }
+    override_count = 0;
+    clear_header_spans();
 
-    if (!text_vbo) glGenBuffers(1, &text_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, text_vbo);
-    glBufferData(GL_ARRAY_BUFFER, text_batch_count * 4 * sizeof(float), text_batch, GL_DYNAMIC_DRAW);
+    // Per-column tables are sized to the new grid; if one can't be
+    // allocated the grid is left empty
+    grid_rows = rows;
+    grid_cols = cols;
+    if (!drop_format_rules(cols) || !resize_header_spans(cols) || !resize_cell_text(rows, cols)) {
+        grid_rows = grid_cols = 0;
+        update_view();
+        return 0;
+    }
+    scroll_x = scroll_y = 0.0;
+    update_view();
+    return 1;
+}
 
-    GLint a_pos = glGetAttribLocation(text_program, "a_position");
-    GLint a_uv = glGetAttribLocation(text_program, "a_uv");
-    glEnableVertexAttribArray(a_pos);
-    glEnableVertexAttribArray(a_uv);
-    glVertexAttribPointer(a_pos, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    glVertexAttribPointer(a_uv, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+static unsigned char* cell_override(int row, int col) {
+    if (row < 0 || row >= grid_rows || col < 0 || col >= grid_cols) return NULL;
+    if (!cell_colors) {
+        cell_colors = (unsigned char*)calloc(grid_rows * grid_cols, 4);
+        if (!cell_colors) return NULL;
+    }
+    return cell_colors + (row * grid_cols + col) * 4;
+}
 
-    glDrawArrays(GL_TRIANGLES, 0, text_batch_count);
-    glDisableVertexAttribArray(a_pos);
-    glDisableVertexAttribArray(a_uv);
+// Mirrors a cell's background into view_colors if its cell is built
+static void sync_view_color(int row, int col) {
+    GridLayer* layer = layer_of(row, col);
+    if (!layer) return;
+    int texel = (layer->rows->tex_base + row - layer->rows->first) * color_cap_cols +
+                layer->cols->tex_base + col - layer->cols->first;
+    memcpy(view_colors + texel * 4, cell_background(row, col), 4);
+    mark_cell_dirty(texel);
+    damage_cells(SURFACE_BACKGROUND, layer, row, col, row, col);
+}
 
-    glDisable(GL_BLEND);
+// total_cols is kept for existing callers; the grid's own column count
+// decides the layout of the override table.
+EMSCRIPTEN_KEEPALIVE
+void set_cell_color(int row, int col, int total_cols, float r, float g, float b) {
+    (void)total_cols;
+    unsigned char* color = cell_override(row, col);
+    if (!color) return;
+    if (color[3] == 0) override_count++;
+    color[0] = unit_to_byte(r);
+    color[1] = unit_to_byte(g);
+    color[2] = unit_to_byte(b);
+    color[3] = 255;
+    sync_view_color(row, col);
+    invalidate_header_cell(row, col);
 }
 
+// Drops a cell's override so it falls back to the header/stripe default
 EMSCRIPTEN_KEEPALIVE
-void set_cell_text(int row, int col, const char* text) {
-    if (row < 0 || row >= MAX_ROWS || col < 0 || col >= MAX_COLS || !text) return;
-    strncpy(cell_text[row][col], text, MAX_CELL_LEN - 1);
-    cell_text[row][col][MAX_CELL_LEN - 1] = '\0';
+void clear_cell_color(int row, int col) {
+    if (!cell_colors) return;
+    unsigned char* color = cell_override(row, col);
+    if (!color || color[3] == 0) return;
+    override_count--;
+    memset(color, 0, 4);
+    sync_view_color(row, col);
+    invalidate_header_cell(row, col);
 }
 
-// ============================================================
-// CURSOR - thin vertical bar drawn in the editing cell
-// ============================================================
+// Uploads only the cells changed since the last call: one texture upload
+// per contiguous run of dirty cells, or one full upload when most of the
+// window changed or the runs are too fragmented to be worth it.
+EMSCRIPTEN_KEEPALIVE
+void update_grid_buffer(void) {
+    if (!view_colors || !grid_color_texture) return;
+    if (grid_dirty_count == 0 && !view_colors_stale) return;
+    ensure_context();
+    glBindTexture(GL_TEXTURE_2D, grid_color_texture);
+
+    int used = (row_segments[SEG_FROZEN].count + row_segments[SEG_BODY].count) * color_cap_cols;
+    if (view_colors_stale || grid_dirty_count * GRID_DIRTY_FULL_FRACTION >= used) {
+        upload_color_span(0, used);
+        clear_grid_dirty();
+        view_colors_stale = 0;
+        return;
+    }
 
-static int cursor_row = -1;
-static int cursor_col = -1;
-static int cursor_pos = 0;
-static int cursor_visible = 0;
+    int span_start[GRID_DIRTY_MAX_SPANS];
+    int span_end[GRID_DIRTY_MAX_SPANS];
+    int spans = 0;
+    int i = grid_dirty_min;
+    while (i <= grid_dirty_max) {
+        if (!is_cell_dirty(i)) { i++; continue; }
+        int start = i;
+        while (i <= grid_dirty_max && is_cell_dirty(i)) i++;
+        if (spans == GRID_DIRTY_MAX_SPANS) {
+            // Too fragmented: one upload covering the whole dirty window
+            spans = 1;
+            span_start[0] = grid_dirty_min;
+            span_end[0] = grid_dirty_max + 1;
+            break;
+        }
+        span_start[spans] = start;
+        span_end[spans] = i;
+        spans++;
+    }
 
-EMSCRIPTEN_KEEPALIVE
-void set_cursor(int row, int col, int pos, int visible) {
-    cursor_row = row;
-    cursor_col = col;
-    cursor_pos = pos;
-    cursor_visible = visible;
+    for (int s = 0; s < spans; s++) {
+        upload_color_span(span_start[s], span_end[s]);
+    }
+    clear_grid_dirty();
 }
 
-static GLuint cursor_vbo = 0;
+// Uploads changed cell colors and rebuilds moved segment LUTs
+static void update_grid_bg(void) {
+    if (view_rows <= 0 || view_cols <= 0) return;
+    update_grid_buffer();
 
-static void render_cursor(void) {
-    if (!cursor_visible || cursor_row < 0 || cursor_col < 0) return;
-    if (!grid_program) return;
+    for (int r = 0; r < ROW_SEGMENTS; r++) {
+        if (row_segments[r].lut_dirty)
+            build_segment_lut(&row_segments[r], &row_layout, GRID_CELL_INSET * 0.5f * canvas_height);
+    }
+    for (int c = 0; c < COL_SEGMENTS; c++) {
+        if (col_segments[c].lut_dirty)
+            build_segment_lut(&col_segments[c], &col_layout, GRID_CELL_INSET * 0.5f * canvas_width);
+    }
+}
 
-    float x1, y1, x2, y2;
-    cell_to_clip(cursor_row, cursor_col, grid_rows, grid_cols, &x1, &y1, &x2, &y2);
-
-    float cw = x2 - x1;
-    float ch = y2 - y1;
-
-    // Match text layout from render_text
-    const char* str = cell_text[cursor_row][cursor_col];
-    int len = strlen(str);
-    float char_h = ch * 0.65f;
-    float char_w = char_h * (5.0f / 7.0f);
-    float total_w = len * char_w * 0.85f;
-    float start_x = x1 + (cw - total_w) * 0.5f;
-    float start_y = y1 + (ch - char_h) * 0.5f;
-
-    float cx = start_x + cursor_pos * char_w * 0.85f;
-    float bar_w = char_w * 0.15f;
-
-    float verts[] = {
-        cx,         start_y,              1, 1, 1,
-        cx + bar_w, start_y,              1, 1, 1,
-        cx + bar_w, start_y + char_h,     1, 1, 1,
-        cx,         start_y,              1, 1, 1,
-        cx + bar_w, start_y + char_h,     1, 1, 1,
-        cx,         start_y + char_h,     1, 1, 1,
-    };
+static void render_grid_bg(void) {
+    if (view_rows <= 0 || view_cols <= 0) return;
 
     glUseProgram(grid_program);
-    if (!cursor_vbo) glGenBuffers(1, &cursor_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, cursor_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(verts), verts, GL_DYNAMIC_DRAW);
-
-    GLint a_pos = glGetAttribLocation(grid_program, "a_position");
-    GLint a_col = glGetAttribLocation(grid_program, "a_color");
-    glEnableVertexAttribArray(a_pos);
-    glEnableVertexAttribArray(a_col);
-    glVertexAttribPointer(a_pos, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glVertexAttribPointer(a_col, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(2 * sizeof(float)));
-    glDrawArrays(GL_TRIANGLES, 0, 6);
-    glDisableVertexAttribArray(a_pos);
-    glDisableVertexAttribArray(a_col);
+    glUniform2f(grid_uniforms[GRID_U_RESOLUTION], (float)canvas_width, (float)canvas_height);
+    glUniform1f(grid_uniforms[GRID_U_HEADER_ROWS], (float)frozen_rows);
+    glUniform2f(grid_uniforms[GRID_U_COLORS_SIZE], (float)color_cap_cols, (float)color_cap_rows);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, grid_color_texture);
+    glBindVertexArrayOES(grid_vao);
+
+    // One quad per layer, clipped to the layer's screen rectangle. The
+    // shader maps canvas pixels to segment pixels by subtracting the
+    // segment origins.
+    glEnable(GL_SCISSOR_TEST);
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        const GridLayer* layer = &layers[i];
+        if (!segment_visible(layer->rows) || !segment_visible(layer->cols)) continue;
+        if (!layer_scissor(layer)) continue;
+        glUniform2f(grid_uniforms[GRID_U_SCROLL],
+                    -(float)col_segment_origin(layer->cols), -(float)row_segment_origin(layer->rows));
+        glUniform2f(grid_uniforms[GRID_U_BAND], (float)layer->cols->first, (float)layer->rows->first);
+        glUniform2f(grid_uniforms[GRID_U_CELL_BASE], (float)layer->cols->tex_base, (float)layer->rows->tex_base);
+        glUniform2f(grid_uniforms[GRID_U_LUT_SIZE], (float)layer->cols->lut_size, (float)layer->rows->lut_size);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, layer->cols->lut);
+        glActiveTexture(GL_TEXTURE2);
+        glBindTexture(GL_TEXTURE_2D, layer->rows->lut);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    glDisable(GL_SCISSOR_TEST);
+    glActiveTexture(GL_TEXTURE0);
 }
 
 // ============================================================
-// RENDER (backgrounds + text + cursor in one call)
+// VIEWPORT - scrolling and sizing over the logical grid
 // ============================================================
 
+// Sets how many rows/cols fit on the canvas (0 = show the whole grid) and
+// resets every row height and column width to the matching default size.
 EMSCRIPTEN_KEEPALIVE
-void render_grid(void) {
+void set_viewport(int visible_rows, int visible_cols) {
+    ensure_context();
+    requested_view_rows = visible_rows;
+    requested_view_cols = visible_cols;
+    update_view();
+}
+
+// Freezes the top `rows` rows and pins `left_cols`/`right_cols` columns to
+// the canvas edges. They are drawn as their own layers and never scroll;
+// the header color applies to the frozen rows.
+EMSCRIPTEN_KEEPALIVE
+void set_frozen(int rows, int left_cols, int right_cols) {
+    requested_frozen_rows = rows > 0 ? rows : 0;
+    requested_pinned_left = left_cols > 0 ? left_cols : 0;
+    requested_pinned_right = right_cols > 0 ? right_cols : 0;
+    if (view_rows <= 0 || view_cols <= 0) return;
     ensure_context();
+    update_segments();
+    set_scroll_px(scroll_x, scroll_y);
+    ensure_band(1);
+}
 
-    // Defensively reset GL state to prevent cross-call contamination.
-    // JS event handlers (click, blink timer, price tick) can all invoke
-    // render_grid at arbitrary points; stale attrib/buffer bindings from
-    // a prior call or from update_grid_buffer cause the "prism" artefact.
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glDisableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
-    glUseProgram(0);
-    glDisable(GL_BLEND);
+// Scrolls the body to a pixel position (the content shown at the top-left
+// of the scrolling area). Returns 1 if the view actually moved. Within the
+// overscan band this is just a uniform change at draw time; no geometry is
+// rebuilt, and the frozen/pinned layers are never touched.
+EMSCRIPTEN_KEEPALIVE
+int scroll_to_px(double x, double y) {
+    return set_scroll_px(x, y);
+}
 
-    glClearColor(0.08f, 0.08f, 0.14f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT);
-    render_grid_bg();
-    render_text();
-    render_cursor();
+EMSCRIPTEN_KEEPALIVE
+int scroll_by_px(double dx, double dy) {
+    return set_scroll_px(scroll_x + dx, scroll_y + dy);
 }
 
-// ============================================================
-// HIT TESTING (canvas click → cell coordinates)
-// ============================================================
+// Moves the window so first_row/first_col are the top-left visible body cell
+EMSCRIPTEN_KEEPALIVE
+int scroll_to(int first_row, int first_col) {
+    int last_col = grid_cols - pinned_right_cols - 1;
+    if (first_row >= grid_rows) first_row = grid_rows - 1;
+    if (first_col > last_col) first_col = last_col;
+    if (first_row < frozen_rows) first_row = frozen_rows;
+    if (first_col < pinned_left_cols) first_col = pinned_left_cols;
+    return set_scroll_px(axis_start(&col_layout, first_col) - axis_start(&col_layout, pinned_left_cols),
+                         axis_start(&row_layout, first_row) - axis_start(&row_layout, frozen_rows));
+}
 
 EMSCRIPTEN_KEEPALIVE
-int get_cell_at(float clip_x, float clip_y) {
-    if (grid_rows <= 0 || grid_cols <= 0) return -1;
-    float cell_w = 2.0f / grid_cols;
-    float cell_h = 2.0f / grid_rows;
-    int col = (int)((clip_x + 1.0f) / cell_w);
-    int row = (int)((1.0f - clip_y) / cell_h);
-    if (col >= 0 && col < grid_cols && row >= 0 && row < grid_rows)
-        return row * 256 + col;
-    return -1;
+int scroll_by(int delta_rows, int delta_cols) {
+    return scroll_to(scroll_row + delta_rows, scroll_col + delta_cols);
+}
+
+// Minimum scroll along one axis that brings [start, end) into a scrolling
+// area of the given size. Frozen and pinned items are always on screen.
+static double scroll_to_reveal(double scroll, double start, double end, double size) {
+    if (start < scroll) return start;
+    if (end > scroll + size) return end - size;
+    return scroll;
+}
+
+// Scrolls the minimum distance needed to bring a whole cell on screen
+EMSCRIPTEN_KEEPALIVE
+int scroll_cell_into_view(int row, int col) {
+    if (row < 0 || row >= grid_rows || col < 0 || col >= grid_cols) return 0;
+    double x = scroll_x, y = scroll_y;
+    if (col >= pinned_left_cols && col < grid_cols - pinned_right_cols) {
+        double left = axis_start(&col_layout, col) - axis_start(&col_layout, pinned_left_cols);
+        x = scroll_to_reveal(x, left, left + axis_size(&col_layout, col), col_segments[SEG_CENTER].screen_size);
+    }
+    if (row >= frozen_rows) {
+        double top = axis_start(&row_layout, row) - axis_start(&row_layout, frozen_rows);
+        y = scroll_to_reveal(y, top, top + axis_size(&row_layout, row), row_segments[SEG_BODY].screen_size);
+    }
+    return set_scroll_px(x, y);
+}
+
+// Resizing updates the prefix sums from that item on. A frozen/pinned item
+// changes the screen split, so every layer is laid out again; a size inside
+// a band changes only that band's layers. Items before a band just move its
+// origin, which the translation uniforms already account for, but the
+// content under the unchanged scroll position moves, so its layers are
+// repainted.
+static void after_resize(AxisSegment* segs, int count, int item) {
+    for (int i = 0; i < count; i++) {
+        if (!segment_contains(&segs[i], item)) continue;
+        if (segs[i].scrolls) invalidate_segment(&segs[i]);
+        else update_segments();
+        break;
+    }
+    set_scroll_px(scroll_x, scroll_y);
+    for (int i = 0; i < count; i++) {
+        if (!segs[i].scrolls || item >= segs[i].first) continue;
+        for (int l = 0; l < LAYER_COUNT; l++) {
+            const GridLayer* layer = &layers[l];
+            if (layer->rows != &segs[i] && layer->cols != &segs[i]) continue;
+            damage_layer(SURFACE_BACKGROUND, layer);
+            damage_layer(text_surface(layer), layer);
+            damage_layer(SURFACE_OVERLAY, layer);
+        }
+    }
+}
+
+EMSCRIPTEN_KEEPALIVE
+void set_column_width(int col, float width) {
+    if (col < 0 || col >= grid_cols || width < 0.0f) return;
+    axis_resize_item(&col_layout, col, width);
+    after_resize(col_segments, COL_SEGMENTS, col);
+}
+
+EMSCRIPTEN_KEEPALIVE
+void set_row_height(int row, float height) {
+    if (row < 0 || row >= grid_rows || height < 0.0f) return;
+    axis_resize_item(&row_layout, row, height);
+    after_resize(row_segments, ROW_SEGMENTS, row);
+}
+
+EMSCRIPTEN_KEEPALIVE
+int get_scroll_row(void) {
+    return scroll_row;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int get_scroll_col(void) {
+    return scroll_col;
+}
+
+// ============================================================
+// HEADERS - multi-level header rows with column spans
+// ============================================================
+//
+// Header rows are ordinary grid rows, normally the frozen ones. In the first
+// HEADER_MAX_ROWS rows a span merges a run of leaf columns into one cell
+// with a centered label, e.g. a parent "PRICES" header over BID and ASK.
+// Each span is one merged quad drawn over the procedural background from a
+// small per-layer buffer, rebuilt only when the span config or the layer's
+// segments change. Cell text under a span is hidden, and hit testing
+// returns the span's first column.
+
+#define HEADER_MAX_ROWS 4
+#define HEADER_MAX_SPANS 64
+#define HEADER_LABEL_LEN 32
+
+typedef struct {
+    int row;
+    int first_col;
+    int cols;
+    char label[HEADER_LABEL_LEN];
+} HeaderSpan;
+
+static HeaderSpan header_spans[HEADER_MAX_SPANS];
+static int header_span_count = 0;
+static unsigned char* header_span_slot = NULL;  // HEADER_MAX_ROWS rows of grid_cols: span index + 1, 0 = none
+
+static const HeaderSpan* header_span_of(int row, int col) {
+    if (row < 0 || row >= HEADER_MAX_ROWS || col < 0 || col >= grid_cols || !header_span_slot) return NULL;
+    int slot = header_span_slot[(size_t)row * grid_cols + col];
+    return slot ? &header_spans[slot - 1] : NULL;
+}
+
+// Sizes the span lookup to a grid of `cols` columns, with no spans
+static int resize_header_spans(int cols) {
+    if (header_span_slot) free(header_span_slot);
+    header_span_slot = (unsigned char*)calloc((size_t)HEADER_MAX_ROWS * cols, 1);
+    return header_span_slot || cols == 0;
+}
+
+static int span_in_layer(const HeaderSpan* span, const GridLayer* layer) {
+    return segment_contains(layer->rows, span->row) &&
+           span->first_col < layer->cols->first + layer->cols->count &&
+           span->first_col + span->cols > layer->cols->first;
+}
+
+// Merged clip rectangle in layer space. A span that runs past the layer's
+// segment simply extends beyond it; the layer's scissor clips it.
+static void span_to_clip(const GridLayer* layer, const HeaderSpan* span,
+                         float* x1, float* y1, float* x2, float* y2) {
+    float unused_x, unused_y1, unused_y2;
+    cell_to_clip(layer, span->row, span->first_col, x1, y1, &unused_x, y2);
+    cell_to_clip(layer, span->row, span->first_col + span->cols - 1, &unused_x, &unused_y1, x2, &unused_y2);
+}
+
+static void invalidate_header_row(int row) {
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        if (segment_contains(layers[i].rows, row)) layers[i].text_dirty = layers[i].spans_dirty = 1;
+    }
+}
+
+// A span takes its color from the override on its first cell
+static void invalidate_header_cell(int row, int col) {
+    const HeaderSpan* span = header_span_of(row, col);
+    if (span && span->first_col == col) invalidate_header_row(row);
+}
+
+// Merges columns [first_col, first_col + cols) of header row `row` under one
+// label. Returns 0 if the span is out of range or overlaps an existing one.
+EMSCRIPTEN_KEEPALIVE
+int set_header_span(int row, int first_col, int cols, const char* label) {
+    if (row < 0 || row >= HEADER_MAX_ROWS || row >= grid_rows) return 0;
+    if (first_col < 0 || cols < 1 || first_col + cols > grid_cols) return 0;
+    if (header_span_count == HEADER_MAX_SPANS || !header_span_slot) return 0;
+    unsigned char* slots = header_span_slot + (size_t)row * grid_cols;
+    for (int c = first_col; c < first_col + cols; c++) {
+        if (slots[c]) return 0;
+    }
+
+    HeaderSpan* span = &header_spans[header_span_count++];
+    span->row = row;
+    span->first_col = first_col;
+    span->cols = cols;
+    strncpy(span->label, label ? label : "", HEADER_LABEL_LEN - 1);
+    span->label[HEADER_LABEL_LEN - 1] = '\0';
+    for (int c = first_col; c < first_col + cols; c++) {
+        slots[c] = (unsigned char)header_span_count;
+    }
+    invalidate_header_row(row);
+    return 1;
+}
+
+EMSCRIPTEN_KEEPALIVE
+void clear_header_spans(void) {
+    if (header_span_count == 0) return;
+    header_span_count = 0;
+    memset(header_span_slot, 0, (size_t)HEADER_MAX_ROWS * grid_cols);
+    for (int row = 0; row < HEADER_MAX_ROWS; row++) invalidate_header_row(row);
+}
+
+static void build_span_quads(GridLayer* layer) {
+    static float verts[HEADER_MAX_SPANS * 6 * 5];
+    int count = 0;
+    for (int i = 0; i < header_span_count; i++) {
+        const HeaderSpan* span = &header_spans[i];
+        if (!span_in_layer(span, layer)) continue;
+
+        float x1, y1, x2, y2;
+        span_to_clip(layer, span, &x1, &y1, &x2, &y2);
+        const unsigned char* override = cell_background(span->row, span->first_col);
+        float color[3];
+        if (override[3]) {
+            for (int k = 0; k < 3; k++) color[k] = override[k] / 255.0f;
+        } else {
+            const float* base = span->row < frozen_rows ? grid_header_color
+                              : (span->row % 2 == 0 ? grid_stripe_even : grid_stripe_odd);
+            memcpy(color, base, sizeof(color));
+        }
+
+        const float corners[6][2] = {
+            {x1, y1}, {x2, y1}, {x2, y2},
+            {x1, y1}, {x2, y2}, {x1, y2}
+        };
+        for (int v = 0; v < 6; v++) {
+            float* out = verts + (count + v) * 5;
+            out[0] = corners[v][0];
+            out[1] = corners[v][1];
+            memcpy(out + 2, color, sizeof(color));
+        }
+        count += 6;
+    }
+
+    if (!layer->span_vbo) {
+        glGenBuffers(1, &layer->span_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, layer->span_vbo);
+        layer->span_vao = create_vao();
+        glEnableVertexAttribArray(SOLID_A_POSITION);
+        glEnableVertexAttribArray(SOLID_A_COLOR);
+        glVertexAttribPointer(SOLID_A_POSITION, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+        glVertexAttribPointer(SOLID_A_COLOR, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(2 * sizeof(float)));
+        glBindVertexArrayOES(0);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, layer->span_vbo);
+    glBufferData(GL_ARRAY_BUFFER, count * 5 * sizeof(float), verts, GL_DYNAMIC_DRAW);
+    layer->span_vertex_count = count;
+    layer->spans_dirty = 0;
+}
+
+static void update_header_spans(void) {
+    if (!solid_program) return;
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        GridLayer* layer = &layers[i];
+        if (!segment_visible(layer->rows) || !segment_visible(layer->cols)) continue;
+        if (!layer->spans_dirty) continue;
+        if (header_span_count > 0) {
+            build_span_quads(layer);
+        } else {
+            // Cleared: nothing to upload, just stop drawing the old quads
+            layer->span_vertex_count = 0;
+            layer->spans_dirty = 0;
+        }
+    }
+}
+
+static void render_header_spans(void) {
+    if (header_span_count == 0 || !solid_program) return;
+
+    glUseProgram(solid_program);
+    glEnable(GL_SCISSOR_TEST);
+
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        GridLayer* layer = &layers[i];
+        if (!segment_visible(layer->rows) || !segment_visible(layer->cols)) continue;
+        if (layer->span_vertex_count == 0) continue;
+        if (!layer_scissor(layer)) continue;
+
+        float tx, ty;
+        layer_translation(layer, &tx, &ty);
+        glUniform2f(solid_translate, tx, ty);
+        glBindVertexArrayOES(layer->span_vao);
+        glDrawArrays(GL_TRIANGLES, 0, layer->span_vertex_count);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+}
+
+// ============================================================
+// TEXT RENDERING - Signed-distance-field font atlas
+// ============================================================
+//
+// How this works:
+//   1. tools/gen_font_sdf.py renders printable ASCII and Latin-1 offline
+//      into signed-distance-field glyphs, embedded run-length encoded in
+//      font_sdf.h.
+//   2. A glyph cache decodes glyphs into the atlas texture the first time
+//      laid out text uses them, evicting the least recently used glyph no
+//      text refers to when the atlas is full. See GLYPH CACHE below.
+//   3. Each texel stores the distance to the glyph edge (128 = on the
+//      edge), and the fragment shaders turn it into antialiased coverage
+//      about one screen pixel wide, so text stays crisp at any cell height.
+#include "font_sdf.h"
+
+// Cap height as a fraction of the cell height
+#define TEXT_CAP_FRACTION 0.65f
+#define MAX_CELL_LEN 32
+
+// Horizontal extent of a cell's text in characters, measured when the
+// text is stored so layout and the cursor never rescan the string. It is
+// kept in characters rather than pixels so column resizes don't invalidate
+// it: the font is monospaced, so pixel offsets follow from the cell rect.
+typedef struct {
+    unsigned char len;   // characters, up to MAX_CELL_LEN
+    unsigned char dot;   // index of the first '.', len if none
+} TextExtent;
+
+// Cell text store. Every written cell has a 20-byte record: strings up to
+// CELL_INLINE_BYTES live in the record itself (prices and most labels),
+// longer ones in text_arena. The record also keeps the byte length and the
+// extent, so nothing rescans the string per frame.
+//
+// Records are kept in pages of CELL_PAGE_ROWS whole rows, allocated on the
+// first write to one of their rows; an unwritten page reads as empty. A
+// sparse grid only pays for the row blocks that hold text, plus one
+// pointer per page.
+//
+// Arena blocks are rounded up to TEXT_ARENA_BLOCK bytes, and a string that
+// still fits its block is rewritten in place. Replaced blocks are counted
+// as garbage; when the arena would otherwise grow with half of it garbage,
+// the live blocks are compacted into a fresh buffer first.
+#define CELL_INLINE_BYTES 15
+#define CELL_TEXT_MAX 255  // bytes kept per cell
+#define TEXT_ARENA_BLOCK 16
+#define CELL_PAGE_ROWS 64
+
+typedef struct {
+    union {
+        char text[CELL_INLINE_BYTES + 1];  // len <= CELL_INLINE_BYTES
+        unsigned int offset;                // longer: block in text_arena
+    } u;
+    unsigned char len;                      // bytes, without the terminator
+    TextExtent extent;
+} CellString;
+
+static CellString** cell_pages = NULL;  // one per CELL_PAGE_ROWS rows, NULL until written
+static int cell_page_count = 0;
+static const CellString empty_cell_string;
+static char* text_arena = NULL;
+static size_t arena_used = 0;
+static size_t arena_cap = 0;
+static size_t arena_garbage = 0;
+
+// Per-column alignment. Decimal alignment puts the decimal point of every
+// cell in the column at the same x: `fraction` character cells (the point
+// included) are reserved to the right of it.
+#define TEXT_ALIGN_CENTER 0
+#define TEXT_ALIGN_LEFT 1
+#define TEXT_ALIGN_RIGHT 2
+#define TEXT_ALIGN_DECIMAL 3
+#define TEXT_PAD_ADVANCES 0.5f  // left/right inset, in advances
+
+typedef struct {
+    unsigned char align;
+    unsigned char fraction;
+} ColumnText;
+
+static ColumnText* column_text = NULL;  // grid_cols entries
+
+// Text style index of every logical cell, allocated on first non-default
+// style. A style selects a color from the text palette (see TEXT STYLES).
+// cell_styles holds set_cell_style's explicit styles, cell_format_styles the
+// styles format rules chose; a cell shows the explicit one unless it is 0.
+static unsigned char* cell_styles = NULL;
+static unsigned char* cell_format_styles = NULL;
+
+static int resize_cell_text(int rows, int cols) {
+    for (int i = 0; i < cell_page_count; i++) free(cell_pages[i]);
+    free(cell_pages);
+    cell_page_count = (rows + CELL_PAGE_ROWS - 1) / CELL_PAGE_ROWS;
+    cell_pages = (CellString**)calloc((size_t)cell_page_count, sizeof(CellString*));
+    if (!cell_pages) cell_page_count = 0;
+    if (text_arena) { free(text_arena); text_arena = NULL; }
+    arena_used = arena_cap = arena_garbage = 0;
+    if (cell_styles) { free(cell_styles); cell_styles = NULL; }
+    if (cell_format_styles) { free(cell_format_styles); cell_format_styles = NULL; }
+    if (column_text) free(column_text);
+    column_text = (ColumnText*)calloc((size_t)cols, sizeof(ColumnText));
+    return (cell_pages || rows == 0) && (column_text || cols == 0);
+}
+
+static int cell_style_at(int row, int col) {
+    size_t i = (size_t)row * grid_cols + col;
+    int style = cell_styles ? cell_styles[i] : 0;
+    if (!style && cell_format_styles) style = cell_format_styles[i];
+    return style;
+}
+
+static const CellString* cell_string(int row, int col) {
+    const CellString* page = cell_pages[row / CELL_PAGE_ROWS];
+    return page ? &page[(size_t)(row % CELL_PAGE_ROWS) * grid_cols + col] : &empty_cell_string;
+}
+
+// The cell's record for writing, allocating its page; NULL if out of memory
+static CellString* writable_cell_string(int row, int col) {
+    CellString** page = &cell_pages[row / CELL_PAGE_ROWS];
+    if (!*page) {
+        *page = (CellString*)calloc((size_t)CELL_PAGE_ROWS * grid_cols, sizeof(CellString));
+        if (!*page) return NULL;
+    }
+    return &(*page)[(size_t)(row % CELL_PAGE_ROWS) * grid_cols + col];
+}
+
+// The cell's text, valid until the next store_cell_text
+static const char* cell_text_at(int row, int col) {
+    const CellString* cell = cell_string(row, col);
+    return cell->len > CELL_INLINE_BYTES ? text_arena + cell->u.offset : cell->u.text;
+}
+
+static size_t arena_block_size(int len) {
+    return ((size_t)len + TEXT_ARENA_BLOCK) & ~(size_t)(TEXT_ARENA_BLOCK - 1);
+}
+
+// Moves every live block into a fresh buffer, in cell order
+static void compact_text_arena(void) {
+    char* fresh = (char*)malloc(arena_cap);
+    if (!fresh) return;
+    size_t used = 0;
+    size_t page_cells = (size_t)CELL_PAGE_ROWS * grid_cols;
+    for (int p = 0; p < cell_page_count; p++) {
+        if (!cell_pages[p]) continue;
+        for (size_t i = 0; i < page_cells; i++) {
+            CellString* cell = &cell_pages[p][i];
+            if (cell->len <= CELL_INLINE_BYTES) continue;
+            size_t size = arena_block_size(cell->len);
+            memcpy(fresh + used, text_arena + cell->u.offset, size);
+            cell->u.offset = (unsigned int)used;
+            used += size;
+        }
+    }
+    free(text_arena);
+    text_arena = fresh;
+    arena_used = used;
+    arena_garbage = 0;
+}
+
+// Returns the offset of a new block of size bytes, or -1
+static long alloc_arena_block(size_t size) {
+    if (arena_used + size > arena_cap && arena_garbage * 2 >= arena_used) compact_text_arena();
+    if (arena_used + size > arena_cap) {
+        size_t cap = arena_cap ? arena_cap * 2 : 4096;
+        while (cap < arena_used + size) cap *= 2;
+        char* grown = (char*)realloc(text_arena, cap);
+        if (!grown) return -1;
+        text_arena = grown;
+        arena_cap = cap;
+    }
+    long offset = (long)arena_used;
+    arena_used += size;
+    return offset;
+}
+
+// Empties a cell, returning its arena block (if any) as garbage
+static void clear_cell_string(CellString* cell) {
+    if (cell->len > CELL_INLINE_BYTES) arena_garbage += arena_block_size(cell->len);
+    cell->len = 0;
+    cell->u.text[0] = '\0';
+}
+
+// Decodes the next character of a UTF-8 string and advances *s past it.
+// Returns its code point, 0 at the end, or -1 for characters outside
+// Latin-1, which layout treats like a character the font lacks.
+static int next_code_point(const char** s) {
+    const unsigned char* p = (const unsigned char*)*s;
+    if (p[0] < 0x80) {
+        if (p[0]) (*s)++;
+        return p[0];
+    }
+    int n = 1;
+    while ((p[n] & 0xC0) == 0x80) n++;
+    *s += n;
+    if ((p[0] == 0xC2 || p[0] == 0xC3) && n == 2) return ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+    return -1;
+}
+
+// Characters in a string, up to max
+static int text_length(const char* s, int max) {
+    int len = 0;
+    while (len < max && next_code_point(&s) != 0) len++;
+    return len;
+}
+
+static TextExtent measure_text(const char* s) {
+    TextExtent ext = {0, 0};
+    int dot = -1, cp;
+    while (ext.len < MAX_CELL_LEN && (cp = next_code_point(&s)) != 0) {
+        if (cp == '.' && dot < 0) dot = ext.len;
+        ext.len++;
+    }
+    ext.dot = (unsigned char)(dot < 0 ? ext.len : dot);
+    return ext;
+}
+
+static TextExtent cell_extent_at(int row, int col) {
+    return cell_string(row, col)->extent;
+}
+
+// Where a run starts within its cell, independent of the cell's size: the
+// pen is at an anchor (0 = left inset, 1 = center, 2 = right inset) moved
+// left by `lead` half advances. The GPU layout reads the same two bytes
+// from the glyph texture.
+typedef struct {
+    unsigned char anchor;
+    unsigned char lead;
+} RunPlacement;
+
+static RunPlacement run_placement(TextExtent ext, ColumnText column) {
+    RunPlacement p;
+    switch (column.align) {
+    case TEXT_ALIGN_LEFT:    p.anchor = 0; p.lead = 0; break;
+    case TEXT_ALIGN_RIGHT:   p.anchor = 2; p.lead = (unsigned char)(2 * ext.len); break;
+    case TEXT_ALIGN_DECIMAL: p.anchor = 2; p.lead = (unsigned char)(2 * (ext.dot + column.fraction)); break;
+    default:                 p.anchor = 1; p.lead = ext.len; break;
+    }
+    return p;
+}
+
+static RunPlacement centered_run(const char* s) {
+    ColumnText center = {TEXT_ALIGN_CENTER, 0};
+    return run_placement(measure_text(s), center);
+}
+
+// Places a run in a w x h pixel rect at (x, y). All glyphs share the
+// advance (the font is monospaced); scale is screen pixels per atlas texel.
+// A run wider than its cell starts at the cell's left edge, so truncation
+// always keeps the head of the text. Shared by layout_text_run, the GPU
+// layout shader and the overlay caret.
+typedef struct {
+    float scale;
+    float advance;
+    float pen_x;     // first glyph's pen position
+    float baseline;
+    float cap;       // cap height in pixels
+} TextRun;
+
+static TextRun text_run_metrics(float x, float y, float w, float h, RunPlacement place) {
+    TextRun run;
+    run.cap = h * TEXT_CAP_FRACTION;
+    run.scale = run.cap / FONT_SDF_CAP_HEIGHT;
+    run.advance = FONT_SDF_ADVANCE * run.scale;
+    float pad = TEXT_PAD_ADVANCES * run.advance;
+    float anchor = place.anchor == 0 ? pad : place.anchor == 1 ? w * 0.5f : w - pad;
+    float pen = anchor - place.lead * 0.5f * run.advance;
+    run.pen_x = x + (pen > 0.0f ? pen : 0.0f);
+    run.baseline = y + (h + run.cap) * 0.5f;
+    return run;
+}
+
+// Text is drawn as instanced quads: one unit-quad corner per vertex and one
+// compact GlyphInstance per character. The vertex shader derives the quad
+// corners from the glyph's top-left and height, and the atlas UVs from its
+// index, so a glyph costs 8 bytes instead of 6 vertices of (x,y,u,v).
+#define GLYPH_SUBPIXEL 4  // GlyphInstance x/y are in 1/4 pixel units
+// The shaders divide by the same constant, pasted into their source
+#define GLSL_STR(x) #x
+#define GLSL_FLOAT(x) GLSL_STR(x) ".0"
+
+typedef struct GlyphInstance {
+    short x, y;            // top-left in layer pixels * GLYPH_SUBPIXEL
+    unsigned char glyph;   // glyph cache slot
+    unsigned char style;   // text style, 0 = default
+    unsigned char height;  // cap height in pixels, 0 = empty
+    unsigned char pad;
+} GlyphInstance;
+
+static const char* text_vertex_src =
+    "attribute vec2 a_corner;\n"
+    "attribute vec2 a_origin;\n"
+    "attribute vec4 a_glyph;\n"
+    "uniform vec2 u_resolution;\n"
+    "uniform vec2 u_translate;\n"
+    "uniform vec2 u_atlas_size;\n"
+    "uniform float u_atlas_cols;\n"
+    "uniform vec2 u_cell_size;\n"
+    "uniform float u_cap_height;\n"
+    "varying vec2 v_uv;\n"
+    "varying float v_scale;\n"
+    "varying float v_style;\n"
+    "void main() {\n"
+    "    v_scale = a_glyph.z / u_cap_height;\n"
+    "    v_style = a_glyph.y;\n"
+    "    vec2 px = a_origin / " GLSL_FLOAT(GLYPH_SUBPIXEL) " + a_corner * u_cell_size * v_scale;\n"
+    "    float row = floor((a_glyph.x + 0.5) / u_atlas_cols);\n"
+    "    vec2 cell = vec2(a_glyph.x - row * u_atlas_cols, row);\n"
+    "    v_uv = (cell + a_corner) * u_cell_size / u_atlas_size;\n"
+    "    vec2 clip = vec2(-1.0, 1.0) + px * vec2(2.0, -2.0) / u_resolution;\n"
+    "    gl_Position = vec4(clip + u_translate, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* text_fragment_src =
+    "precision mediump float;\n"
+    "varying vec2 v_uv;\n"
+    "varying float v_scale;\n"
+    "varying float v_style;\n"
+    "uniform sampler2D u_texture;\n"
+    "uniform sampler2D u_palette;\n"
+    "uniform float u_styles;\n"
+    "uniform float u_sdf_range;\n"
+    "void main() {\n"
+    "    float d = texture2D(u_texture, v_uv).r;\n"
+    "    // Distance in screen pixels, covering one pixel across the edge\n"
+    "    float a = clamp((d - 0.5) * u_sdf_range * v_scale + 0.5, 0.0, 1.0);\n"
+    "    vec3 color = texture2D(u_palette, vec2((v_style + 0.5) / u_styles, 0.5)).rgb;\n"
+    "    gl_FragColor = vec4(color, a);\n"
+    "}\n";
+
+// GPU text layout: one instanced quad per cell slot, and the fragment shader
+// resolves which glyph and which atlas texel each pixel shows. The strings
+// themselves live in a LUMINANCE texture of glyph indices, GLYPH_ROW_TEXELS
+// texels per slot: texels [0, MAX_CELL_LEN) hold the characters (255 =
+// skip), then the run placement, the text style and the string length. The
+// placement, advance and truncation match text_run_metrics and
+// layout_text_run, so both layouts show the same characters.
+#define GLYPH_ROW_SLOTS 16  // slots per glyph texture row
+#define GLYPH_ROW_TEXELS (MAX_CELL_LEN + 4)
+#define GLYPH_ROW_CHARS MAX_CELL_LEN
+#define GLYPH_ROW_ANCHOR (GLYPH_ROW_TEXELS - 4)
+#define GLYPH_ROW_LEAD (GLYPH_ROW_TEXELS - 3)
+#define GLYPH_ROW_STYLE (GLYPH_ROW_TEXELS - 2)
+#define GLYPH_ROW_LEN (GLYPH_ROW_TEXELS - 1)
+#define GLYPH_SKIP 255
+
+typedef struct {
+    short x, y, w, h;       // inset cell rect in layer pixels * GLYPH_SUBPIXEL
+    unsigned short slot;
+    unsigned short pad;
+} CellInstance;
+
+static const char* text_grid_vertex_src =
+    "attribute vec2 a_corner;\n"
+    "attribute vec4 a_rect;\n"
+    "attribute float a_slot;\n"
+    "uniform vec2 u_resolution;\n"
+    "uniform vec2 u_translate;\n"
+    "uniform float u_row_slots;\n"
+    "varying vec2 v_local;\n"
+    "varying vec2 v_size;\n"
+    "varying vec2 v_slot;\n"
+    "void main() {\n"
+    "    v_size = a_rect.zw / " GLSL_FLOAT(GLYPH_SUBPIXEL) ";\n"
+    "    v_local = a_corner * v_size;\n"
+    "    float row = floor((a_slot + 0.5) / u_row_slots);\n"
+    "    v_slot = vec2(a_slot - row * u_row_slots, row);\n"
+    "    vec2 px = a_rect.xy / " GLSL_FLOAT(GLYPH_SUBPIXEL) " + v_local;\n"
+    "    vec2 clip = vec2(-1.0, 1.0) + px * vec2(2.0, -2.0) / u_resolution;\n"
+    "    gl_Position = vec4(clip + u_translate, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* text_grid_fragment_src =
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"
+    "precision highp float;\n"
+    "#else\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "uniform sampler2D u_texture;\n"
+    "uniform sampler2D u_glyphs;\n"
+    "uniform vec2 u_glyphs_size;\n"
+    "uniform float u_row_texels;\n"
+    "uniform vec2 u_atlas_size;\n"
+    "uniform float u_atlas_cols;\n"
+    "uniform vec2 u_cell_size;\n"
+    "uniform float u_cap_height;\n"
+    "uniform float u_cap_fraction;\n"
+    "uniform float u_advance;\n"
+    "uniform float u_baseline;\n"
+    "uniform float u_origin_x;\n"
+    "uniform float u_pad;\n"
+    "uniform float u_sdf_range;\n"
+    "uniform sampler2D u_palette;\n"
+    "uniform float u_styles;\n"
+    "varying vec2 v_local;\n"
+    "varying vec2 v_size;\n"
+    "varying vec2 v_slot;\n"
+    "float glyph_at(float i) {\n"
+    "    vec2 texel = vec2(v_slot.x * u_row_texels + i, v_slot.y) + 0.5;\n"
+    "    return floor(texture2D(u_glyphs, texel / u_glyphs_size).r * 255.0 + 0.5);\n"
+    "}\n"
+    "// Distance sample of glyph k at p (relative to the first pen position and\n"
+    "// the atlas cell top), 0 outside its atlas cell\n"
+    "float glyph_dist(float k, vec2 p, float scale, float advance, float len, float pen_x) {\n"
+    "    if (k < 0.0 || k >= len) return 0.0;\n"
+    "    if (k > 0.0 && pen_x + (k + 1.0) * advance > v_size.x) return 0.0;\n"
+    "    float g = glyph_at(k);\n"
+    "    if (g > 254.5) return 0.0;\n"
+    "    vec2 local = (p - vec2(k * advance, 0.0)) / scale + vec2(u_origin_x, 0.0);\n"
+    "    if (local.x < 0.0 || local.y < 0.0 || local.x >= u_cell_size.x || local.y >= u_cell_size.y) return 0.0;\n"
+    "    float row = floor((g + 0.5) / u_atlas_cols);\n"
+    "    vec2 cell = vec2(g - row * u_atlas_cols, row);\n"
+    "    return texture2D(u_texture, (cell * u_cell_size + local) / u_atlas_size).r;\n"
+    "}\n"
+    "void main() {\n"
+    "    float len = glyph_at(u_row_texels - 1.0);\n"
+    "    float style = glyph_at(u_row_texels - 2.0);\n"
+    "    float anchor = glyph_at(u_row_texels - 4.0);\n"
+    "    float lead = glyph_at(u_row_texels - 3.0);\n"
+    "    float cap = v_size.y * u_cap_fraction;\n"
+    "    float scale = cap / u_cap_height;\n"
+    "    float advance = u_advance * scale;\n"
+    "    float pad = u_pad * advance;\n"
+    "    float start = anchor < 0.5 ? pad : anchor < 1.5 ? v_size.x * 0.5 : v_size.x - pad;\n"
+    "    float pen_x = max(start - lead * 0.5 * advance, 0.0);\n"
+    "    float top = (v_size.y + cap) * 0.5 - u_baseline * scale;\n"
+    "    vec2 p = v_local - vec2(pen_x, top);\n"
+    "    // Atlas cells are wider than the advance: glyphs k - 1 and k + 1 reach\n"
+    "    // into this pen interval too\n"
+    "    float k = floor(p.x / advance);\n"
+    "    float d = max(glyph_dist(k, p, scale, advance, len, pen_x),\n"
+    "                  max(glyph_dist(k - 1.0, p, scale, advance, len, pen_x),\n"
+    "                      glyph_dist(k + 1.0, p, scale, advance, len, pen_x)));\n"
+    "    float a = clamp((d - 0.5) * u_sdf_range * scale + 0.5, 0.0, 1.0);\n"
+    "    if (a <= 0.0) discard;\n"
+    "    vec3 color = texture2D(u_palette, vec2((style + 0.5) / u_styles, 0.5)).rgb;\n"
+    "    gl_FragColor = vec4(color, a);\n"
+    "}\n";
+
+static const float glyph_corners[6][2] = {
+    {0, 0}, {1, 0}, {1, 1},
+    {0, 0}, {1, 1}, {0, 1}
+};
+
+enum { TEXT_A_CORNER, TEXT_A_ORIGIN, TEXT_A_GLYPH };
+static const char* const text_attribs[] = { "a_corner", "a_origin", "a_glyph", NULL };
+enum { TEXT_GRID_A_CORNER, TEXT_GRID_A_RECT, TEXT_GRID_A_SLOT };
+static const char* const text_grid_attribs[] = { "a_corner", "a_rect", "a_slot", NULL };
+// Per-frame uniforms of both text programs; text_program has no u_glyphs_size
+enum { TEXT_U_RESOLUTION, TEXT_U_TRANSLATE, TEXT_U_GLYPHS_SIZE, TEXT_UNIFORMS };
+static const char* const text_uniform_names[] = { "u_resolution", "u_translate", "u_glyphs_size", NULL };
+
+static GLuint text_program = 0;
+static GLint text_uniforms[TEXT_UNIFORMS];
+static GLuint text_grid_program = 0;
+static GLint text_grid_uniforms[TEXT_UNIFORMS];
+static GLuint font_texture = 0;
+static GLuint glyph_corner_vbo = 0;
+static int gpu_text_layout = 0;
+
+// ============================================================
+// GLYPH CACHE
+// ============================================================
+//
+// The atlas texture has room for GLYPH_CACHE_SLOTS glyph cells. A code
+// point -> slot table finds a cached glyph; a miss decodes the glyph from
+// font_sdf.h into a CPU copy of the atlas and marks its atlas row for a
+// glTexSubImage2D before text is drawn. Each slot counts the laid out text
+// slots that use it: only unreferenced glyphs are evicted (least recently
+// used first), so text already on screen never changes under its layout.
+// Glyphs are only looked up when text is laid out, never per frame.
+//
+// SDF cells are all the same size (the font is monospaced and the spread
+// is fixed), so the atlas is packed as a grid of slots rather than by
+// glyph bounding boxes. GLYPH_CACHE_ROWS is derived from the font so every
+// glyph has a slot: layout never runs out of slots, and eviction is only a
+// safeguard should the atlas be made smaller than the font. Slot indices
+// are stored in a byte, with GLYPH_SKIP reserved.
+#define GLYPH_CACHE_COLS 16
+#define GLYPH_CACHE_ROWS ((FONT_SDF_GLYPH_COUNT + GLYPH_CACHE_COLS - 1) / GLYPH_CACHE_COLS)
+#define GLYPH_CACHE_SLOTS (GLYPH_CACHE_COLS * GLYPH_CACHE_ROWS)
+_Static_assert(GLYPH_CACHE_SLOTS <= GLYPH_SKIP, "glyph cache slots must fit a byte below GLYPH_SKIP");
+_Static_assert(GLYPH_CACHE_ROWS <= 32, "atlas_rows_dirty has one bit per slot row");
+#define GLYPH_ATLAS_W (GLYPH_CACHE_COLS * FONT_SDF_CELL_W)
+#define GLYPH_ATLAS_H (GLYPH_CACHE_ROWS * FONT_SDF_CELL_H)
+
+static short font_glyph_of[256];   // code point -> font_sdf.h glyph, -1 = none
+static short cache_slot_of[256];   // code point -> atlas slot, -1 = not cached
+static short slot_code[GLYPH_CACHE_SLOTS];          // code point, -1 = free
+static int slot_refs[GLYPH_CACHE_SLOTS];
+static unsigned int slot_used[GLYPH_CACHE_SLOTS];   // glyph_clock at last use
+static unsigned int glyph_clock = 0;
+static unsigned char* glyph_atlas = NULL;          // CPU copy of the atlas
+static unsigned int atlas_rows_dirty = 0;          // one bit per slot row
+
+// PackBits: n < 128 copies n + 1 literal bytes, n > 128 repeats the next
+// byte 257 - n times. Returns the bytes written.
+static int decode_packbits(const unsigned char* src, int src_len, unsigned char* dst, int dst_len) {
+    int i = 0, out = 0;
+    while (i < src_len && out < dst_len) {
+        int n = src[i++];
+        int count = n < 128 ? n + 1 : 257 - n;
+        if (count > dst_len - out) count = dst_len - out;
+        if (n < 128) {
+            memcpy(dst + out, src + i, count);
+            i += n + 1;
+        } else if (n > 128) {
+            memset(dst + out, src[i++], count);
+        } else {
+            continue;
+        }
+        out += count;
+    }
+    return out;
+}
+
+static void init_font_texture(void) {
+    if (font_texture) return;
+
+    glyph_atlas = (unsigned char*)calloc(GLYPH_ATLAS_W * GLYPH_ATLAS_H, 1);
+    memset(font_glyph_of, 0xFF, sizeof(font_glyph_of));
+    memset(cache_slot_of, 0xFF, sizeof(cache_slot_of));
+    memset(slot_code, 0xFF, sizeof(slot_code));
+    for (int i = 0; i < FONT_SDF_GLYPH_COUNT; i++) font_glyph_of[font_sdf_codes[i]] = (short)i;
+
+    glGenTextures(1, &font_texture);
+    glBindTexture(GL_TEXTURE_2D, font_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, GLYPH_ATLAS_W, GLYPH_ATLAS_H, 0,
+                 GL_LUMINANCE, GL_UNSIGNED_BYTE, glyph_atlas);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+// Decodes a font_sdf.h glyph into an atlas slot. Returns 0 if its data is
+// truncated, leaving the atlas untouched.
+static int load_glyph(int slot, int glyph) {
+    static unsigned char cell[FONT_SDF_CELL_W * FONT_SDF_CELL_H];
+    unsigned int start = font_sdf_offsets[glyph];
+    int n = decode_packbits(font_sdf_rle + start, (int)(font_sdf_offsets[glyph + 1] - start),
+                            cell, (int)sizeof(cell));
+    if (n != (int)sizeof(cell)) return 0;
+
+    int ox = (slot % GLYPH_CACHE_COLS) * FONT_SDF_CELL_W;
+    int oy = (slot / GLYPH_CACHE_COLS) * FONT_SDF_CELL_H;
+    for (int y = 0; y < FONT_SDF_CELL_H; y++) {
+        memcpy(glyph_atlas + (oy + y) * GLYPH_ATLAS_W + ox, cell + y * FONT_SDF_CELL_W, FONT_SDF_CELL_W);
+    }
+    atlas_rows_dirty |= 1u << (slot / GLYPH_CACHE_COLS);
+    return 1;
+}
+
+// Atlas slot showing code point cp, loaded on first use, with one more
+// reference held by the caller. Returns -1 for whitespace and characters
+// the font lacks (or whose data is corrupt); the cache holds every glyph of
+// the font, so a glyph is never refused for want of a slot.
+static int acquire_glyph(int cp) {
+    if (cp <= ' ' || cp == 0xA0 || cp > 0xFF) return -1;
+    int slot = cache_slot_of[cp];
+    if (slot < 0) {
+        int glyph = font_glyph_of[cp];
+        if (glyph < 0) return -1;
+        // A free slot, else the least recently used unreferenced one
+        for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+            if (slot_code[i] < 0) { slot = i; break; }
+            if (slot_refs[i] == 0 && (slot < 0 || slot_used[i] < slot_used[slot])) slot = i;
+        }
+        if (slot < 0) return -1;
+        if (!load_glyph(slot, glyph)) {
+            font_glyph_of[cp] = -1;  // treat it as missing from then on
+            return -1;
+        }
+        if (slot_code[slot] >= 0) cache_slot_of[slot_code[slot]] = -1;
+        slot_code[slot] = (short)cp;
+        cache_slot_of[cp] = (short)slot;
+    }
+    slot_used[slot] = ++glyph_clock;
+    slot_refs[slot]++;
+    return slot;
+}
+
+static void release_glyph(int slot) {
+    if (slot_refs[slot] > 0) slot_refs[slot]--;
+}
+
+// Uploads the atlas rows glyphs were loaded into, one call per run of rows
+static void upload_glyph_atlas(void) {
+    if (!atlas_rows_dirty) return;
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, font_texture);
+    int row = 0;
+    while (row < GLYPH_CACHE_ROWS) {
+        if (!(atlas_rows_dirty & (1u << row))) { row++; continue; }
+        int start = row;
+        while (row < GLYPH_CACHE_ROWS && (atlas_rows_dirty & (1u << row))) row++;
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, start * FONT_SDF_CELL_H, GLYPH_ATLAS_W,
+                        (row - start) * FONT_SDF_CELL_H, GL_LUMINANCE, GL_UNSIGNED_BYTE,
+                        glyph_atlas + start * FONT_SDF_CELL_H * GLYPH_ATLAS_W);
+    }
+    atlas_rows_dirty = 0;
+}
+
+// ============================================================
+// TEXT STYLES
+// ============================================================
+//
+// Every cell has a style index (0 = default) carried into the text pass
+// per glyph instance (CPU layout) or per glyph texture row (GPU layout).
+// The fragment shaders look its color up in a TEXT_STYLE_COUNT x 1 palette
+// texture on unit 2, so styled text is still one draw call per layer.
+#define TEXT_STYLE_COUNT 8
+
+static unsigned char text_palette[TEXT_STYLE_COUNT][4] = {
+    { 255, 255, 255, 255 },  // 0: default
+    { 200, 235, 255, 255 },  // 1: header
+    {   0, 255, 136, 255 },  // 2: up / positive
+    { 255, 107, 107, 255 },  // 3: down / negative
+    { 119, 136, 153, 255 },  // 4: muted
+    {   0, 212, 255, 255 },  // 5: accent
+    { 255, 159,  28, 255 },  // 6: warning
+    { 255, 255, 255, 255 },  // 7: spare
+};
+static GLuint palette_texture = 0;
+static int palette_dirty = 1;
+
+// Binds the palette on unit 2, uploading it first if a style changed
+static void bind_text_palette(void) {
+    glActiveTexture(GL_TEXTURE2);
+    if (!palette_texture) {
+        glGenTextures(1, &palette_texture);
+        glBindTexture(GL_TEXTURE_2D, palette_texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    glBindTexture(GL_TEXTURE_2D, palette_texture);
+    if (palette_dirty) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, TEXT_STYLE_COUNT, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, text_palette);
+        palette_dirty = 0;
+    }
+    glActiveTexture(GL_TEXTURE0);
+}
+
+static short to_glyph_coord(float px) {
+    float v = px * GLYPH_SUBPIXEL;
+    if (v > 32767.0f) v = 32767.0f;
+    if (v < -32768.0f) v = -32768.0f;
+    return (short)floorf(v + 0.5f);
+}
+
+// The run of a string of the given placement in a clip rectangle, in pixels
+static TextRun clip_text_run(RunPlacement place, float x1, float y1, float x2, float y2) {
+    float px_per_clip_x = canvas_width * 0.5f;
+    float px_per_clip_y = canvas_height * 0.5f;
+    return text_run_metrics((x1 + 1.0f) * px_per_clip_x, (1.0f - y2) * px_per_clip_y,
+                            (x2 - x1) * px_per_clip_x, (y2 - y1) * px_per_clip_y, place);
+}
+
+// Lays out one text run of len characters in the given clip rectangle,
+// writing one GlyphInstance per character in layer pixels. Each glyph holds
+// a glyph cache reference until release_text_slot. Returns the glyph count.
+static int layout_text_run(GlyphInstance* out, const char* str, int len, RunPlacement place,
+                           int style, float x1, float y1, float x2, float y2) {
+    float right = (x2 + 1.0f) * canvas_width * 0.5f;
+    TextRun run = clip_text_run(place, x1, y1, x2, y2);
+    float top = run.baseline - FONT_SDF_BASELINE * run.scale;
+    unsigned char cap_h = run.cap >= 255.0f ? 255 : (unsigned char)(run.cap + 0.5f);
+    if (cap_h == 0) return 0;
+    float pen = run.pen_x;
+    int count = 0;
+
+    for (int i = 0; i < len; i++) {
+        int ci = acquire_glyph(next_code_point(&str));
+        if (ci >= 0) {
+            GlyphInstance* g = &out[count++];
+            g->x = to_glyph_coord(pen - FONT_SDF_ORIGIN_X * run.scale);
+            g->y = to_glyph_coord(top);
+            g->glyph = (unsigned char)ci;
+            g->style = (unsigned char)style;
+            g->height = cap_h;
+            g->pad = 0;
+        }
+
+        pen += run.advance;
+
+        if (pen + run.advance > right) break;
+    }
+    return count;
+}
+
+// Each layer keeps its glyph instances in one persistent buffer drawn with
+// one call. Every built cell owns a slot, laid out in layer space. The
+// slot's glyphs are packed into text_vbo in a range sized to its glyph count
+// rounded up to TEXT_SLOT_ALIGN; the spare instances have height 0. An
+// empty cell costs no instances, and a price costs about its length.
+// set_cell_text only marks the cell's slot, and render_text re-lays out and
+// glBufferSubData's just the marked slots' ranges, so frames where no text
+// changed (cursor blink, scrolling within a band) do no text work at all. A
+// slot that outgrows its range repacks the layer; the whole buffer is also
+// rebuilt when one of the layer's segments moves or the header spans change.
+//
+// Header span labels get one extra slot per span after the cell slots.
+// Cells under a span keep an empty slot.
+#define TEXT_SLOT_GLYPHS MAX_CELL_LEN
+#define TEXT_SLOT_ALIGN 4
+#define TEXT_DIRTY_MAX_SPANS 32
+
+static int text_slot_of(const GridLayer* layer, int row, int col) {
+    return (row - layer->rows->first) * layer->cols->count + (col - layer->cols->first);
+}
+
+static void mark_text_slot_dirty(GridLayer* layer, int slot) {
+    unsigned int bit = 1u << (slot & 31);
+    unsigned int* word = &layer->text_slot_dirty[slot >> 5];
+    if (*word & bit) return;
+    *word |= bit;
+    if (slot < layer->text_dirty_min) layer->text_dirty_min = slot;
+    if (slot > layer->text_dirty_max) layer->text_dirty_max = slot;
+}
+
+static int is_text_slot_dirty(const GridLayer* layer, int slot) {
+    return (layer->text_slot_dirty[slot >> 5] >> (slot & 31)) & 1u;
+}
+
+static void clear_text_slots_dirty(GridLayer* layer) {
+    if (layer->text_dirty_max >= layer->text_dirty_min) {
+        int first = layer->text_dirty_min >> 5;
+        int last = layer->text_dirty_max >> 5;
+        memset(layer->text_slot_dirty + first, 0, (last - first + 1) * sizeof(unsigned int));
+    }
+    layer->text_dirty_min = layer->text_slots;
+    layer->text_dirty_max = -1;
+}
+
+// Encodes a slot's string as atlas slots plus its placement, style and
+// length (GPU layout)
+static void encode_glyph_row(GridLayer* layer, int slot, const char* str, RunPlacement place,
+                             int style) {
+    unsigned char* row = layer->glyph_rows + (size_t)slot * GLYPH_ROW_TEXELS;
+    int len = 0;
+    if (str) {
+        int cp;
+        for (; len < GLYPH_ROW_CHARS && (cp = next_code_point(&str)) != 0; len++) {
+            int ci = acquire_glyph(cp);
+            row[len] = ci < 0 ? GLYPH_SKIP : (unsigned char)ci;
+        }
+    }
+    memset(row + len, GLYPH_SKIP, GLYPH_ROW_CHARS - len);
+    row[GLYPH_ROW_ANCHOR] = place.anchor;
+    row[GLYPH_ROW_LEAD] = place.lead;
+    row[GLYPH_ROW_STYLE] = (unsigned char)style;
+    row[GLYPH_ROW_LEN] = (unsigned char)len;
+}
+
+// The string a slot shows: a cell's text, or a header span's label
+static const char* slot_text(const GridLayer* layer, int slot) {
+    int cells = layer->rows->count * layer->cols->count;
+    if (slot < cells) {
+        int row = layer->rows->first + slot / layer->cols->count;
+        int col = layer->cols->first + slot % layer->cols->count;
+        return header_span_of(row, col) ? NULL : cell_text_at(row, col);
+    }
+    const HeaderSpan* span = &header_spans[slot - cells];
+    return span_in_layer(span, layer) ? span->label : NULL;
+}
+
+// A slot's placement: cells follow their column's alignment from their
+// cached extent, span labels are centered
+static RunPlacement slot_placement(const GridLayer* layer, int slot) {
+    int cells = layer->rows->count * layer->cols->count;
+    if (slot < cells) {
+        int row = layer->rows->first + slot / layer->cols->count;
+        int col = layer->cols->first + slot % layer->cols->count;
+        return run_placement(cell_extent_at(row, col), column_text[col]);
+    }
+    const HeaderSpan* span = &header_spans[slot - cells];
+    return centered_run(span_in_layer(span, layer) ? span->label : "");
+}
+
+// A slot's text style; a span takes the style of its first cell
+static int slot_style(const GridLayer* layer, int slot) {
+    int cells = layer->rows->count * layer->cols->count;
+    if (slot < cells) {
+        return cell_style_at(layer->rows->first + slot / layer->cols->count,
+                             layer->cols->first + slot % layer->cols->count);
+    }
+    const HeaderSpan* span = &header_spans[slot - cells];
+    return cell_style_at(span->row, span->first_col);
+}
+
+// Drops the glyph cache references held by a slot's current layout
+static void release_text_slot(const GridLayer* layer, int slot) {
+    if (gpu_text_layout) {
+        const unsigned char* row = layer->glyph_rows + (size_t)slot * GLYPH_ROW_TEXELS;
+        for (int i = 0; i < row[GLYPH_ROW_LEN]; i++) {
+            if (row[i] != GLYPH_SKIP) release_glyph(row[i]);
+        }
+        return;
+    }
+    const GlyphInstance* glyphs = layer->text_batch + (size_t)slot * TEXT_SLOT_GLYPHS;
+    for (int i = 0; i < TEXT_SLOT_GLYPHS && glyphs[i].height; i++) release_glyph(glyphs[i].glyph);
+}
+
+static void release_layer_text(GridLayer* layer) {
+    for (int slot = 0; slot < layer->text_slots; slot++) release_text_slot(layer, slot);
+}
+
+static void layout_text_slot(GridLayer* layer, int slot) {
+    if (gpu_text_layout) {
+        encode_glyph_row(layer, slot, slot_text(layer, slot), slot_placement(layer, slot),
+                         slot_style(layer, slot));
+        return;
+    }
+    const AxisSegment* rows = layer->rows;
+    const AxisSegment* cols = layer->cols;
+    GlyphInstance* out = layer->text_batch + (size_t)slot * TEXT_SLOT_GLYPHS;
+    float x1, y1, x2, y2;
+    int count = 0;
+
+    int cells = rows->count * cols->count;
+    if (slot < cells) {
+        int row = rows->first + slot / cols->count;
+        int col = cols->first + slot % cols->count;
+        const char* str = cell_text_at(row, col);
+        if (str[0] != '\0' && !header_span_of(row, col)) {
+            TextExtent ext = cell_extent_at(row, col);
+            cell_to_clip(layer, row, col, &x1, &y1, &x2, &y2);
+            count = layout_text_run(out, str, ext.len, run_placement(ext, column_text[col]),
+                                    cell_style_at(row, col), x1, y1, x2, y2);
+        }
+    } else {
+        const HeaderSpan* span = &header_spans[slot - cells];
+        if (span_in_layer(span, layer) && span->label[0] != '\0') {
+            span_to_clip(layer, span, &x1, &y1, &x2, &y2);
+            count = layout_text_run(out, span->label, text_length(span->label, MAX_CELL_LEN),
+                                    centered_run(span->label),
+                                    cell_style_at(span->row, span->first_col), x1, y1, x2, y2);
+        }
+    }
+    memset(out + count, 0, (TEXT_SLOT_GLYPHS - count) * sizeof(GlyphInstance));
+    layer->text_slot_glyphs[slot] = (unsigned char)count;
+}
+
+// Copies a slot's glyphs into its packed range, padding it with empty
+// instances. Returns 0 if they no longer fit the range.
+static int pack_text_slot(GridLayer* layer, int slot) {
+    int first = layer->text_slot_offset[slot];
+    int size = layer->text_slot_offset[slot + 1] - first;
+    int count = layer->text_slot_glyphs[slot];
+    if (count > size) return 0;
+    if (size == 0) return 1;
+    GlyphInstance* out = layer->text_packed + first;
+    memcpy(out, layer->text_batch + (size_t)slot * TEXT_SLOT_GLYPHS, count * sizeof(GlyphInstance));
+    memset(out + count, 0, (size - count) * sizeof(GlyphInstance));
+    return 1;
+}
+
+// Sizes every slot's range to its current glyphs and re-specifies text_vbo
+static void pack_text_batch(GridLayer* layer) {
+    int total = 0;
+    for (int slot = 0; slot < layer->text_slots; slot++) {
+        layer->text_slot_offset[slot] = total;
+        total += (layer->text_slot_glyphs[slot] + TEXT_SLOT_ALIGN - 1) / TEXT_SLOT_ALIGN * TEXT_SLOT_ALIGN;
+    }
+    layer->text_slot_offset[layer->text_slots] = total;
+    if (total > layer->text_packed_cap) {
+        int cap = layer->text_packed_cap ? layer->text_packed_cap : 1024;
+        while (cap < total) cap *= 2;
+        GlyphInstance* grown = (GlyphInstance*)realloc(layer->text_packed, (size_t)cap * sizeof(GlyphInstance));
+        if (!grown) {
+            // Out of memory: every range empty, so nothing stale is drawn
+            memset(layer->text_slot_offset, 0, ((size_t)layer->text_slots + 1) * sizeof(int));
+            return;
+        }
+        layer->text_packed = grown;
+        layer->text_packed_cap = cap;
+    }
+    for (int slot = 0; slot < layer->text_slots; slot++) pack_text_slot(layer, slot);
+    glBindBuffer(GL_ARRAY_BUFFER, layer->text_vbo);
+    glBufferData(GL_ARRAY_BUFFER, (size_t)total * sizeof(GlyphInstance), layer->text_packed, GL_DYNAMIC_DRAW);
+}
+
+static void clip_rect_to_instance(float x1, float y1, float x2, float y2, CellInstance* out) {
+    out->x = to_glyph_coord((x1 + 1.0f) * canvas_width * 0.5f);
+    out->y = to_glyph_coord((1.0f - y2) * canvas_height * 0.5f);
+    out->w = to_glyph_coord((x2 - x1) * canvas_width * 0.5f);
+    out->h = to_glyph_coord((y2 - y1) * canvas_height * 0.5f);
+}
+
+// GPU layout: one rect per slot (rebuilt only when the layer's segments
+// move) and the glyph texture, re-specified whole
+static void build_glyph_grid(GridLayer* layer, int slots) {
+    int cells = layer->rows->count * layer->cols->count;
+    CellInstance* rects = (CellInstance*)calloc(slots > 0 ? slots : 1, sizeof(CellInstance));
+    for (int slot = 0; slot < slots; slot++) {
+        float x1, y1, x2, y2;
+        if (slot < cells) {
+            cell_to_clip(layer, layer->rows->first + slot / layer->cols->count,
+                         layer->cols->first + slot % layer->cols->count, &x1, &y1, &x2, &y2);
+        } else {
+            const HeaderSpan* span = &header_spans[slot - cells];
+            if (!span_in_layer(span, layer)) continue;
+            span_to_clip(layer, span, &x1, &y1, &x2, &y2);
+        }
+        clip_rect_to_instance(x1, y1, x2, y2, &rects[slot]);
+        rects[slot].slot = (unsigned short)slot;
+    }
+    if (!layer->cell_vbo) {
+        glGenBuffers(1, &layer->cell_vbo);
+        layer->cell_vao = create_vao();
+        glBindBuffer(GL_ARRAY_BUFFER, glyph_corner_vbo);
+        glEnableVertexAttribArray(TEXT_GRID_A_CORNER);
+        glVertexAttribPointer(TEXT_GRID_A_CORNER, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glBindBuffer(GL_ARRAY_BUFFER, layer->cell_vbo);
+        glEnableVertexAttribArray(TEXT_GRID_A_RECT);
+        glEnableVertexAttribArray(TEXT_GRID_A_SLOT);
+        glVertexAttribPointer(TEXT_GRID_A_RECT, 4, GL_SHORT, GL_FALSE, sizeof(CellInstance), (void*)0);
+        glVertexAttribPointer(TEXT_GRID_A_SLOT, 1, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(CellInstance),
+                              (void*)offsetof(CellInstance, slot));
+        glVertexAttribDivisorANGLE(TEXT_GRID_A_RECT, 1);
+        glVertexAttribDivisorANGLE(TEXT_GRID_A_SLOT, 1);
+        glBindVertexArrayOES(0);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, layer->cell_vbo);
+    glBufferData(GL_ARRAY_BUFFER, (size_t)slots * sizeof(CellInstance), rects, GL_STATIC_DRAW);
+    free(rects);
+
+    if (!layer->glyph_texture) {
+        glGenTextures(1, &layer->glyph_texture);
+        glBindTexture(GL_TEXTURE_2D, layer->glyph_texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    glBindTexture(GL_TEXTURE_2D, layer->glyph_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, GLYPH_ROW_SLOTS * GLYPH_ROW_TEXELS,
+                 layer->text_slot_cap / GLYPH_ROW_SLOTS, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, layer->glyph_rows);
+}
+
+// Lays out every slot and re-specifies the whole buffer
+static void build_text_batch(GridLayer* layer) {
+    release_layer_text(layer);
+    int slots = layer->rows->count * layer->cols->count + header_span_count;
+    if (slots > layer->text_slot_cap) {
+        // Whole glyph texture rows, so the texture is always fully backed
+        int cap = (slots + GLYPH_ROW_SLOTS - 1) / GLYPH_ROW_SLOTS * GLYPH_ROW_SLOTS;
+        if (layer->text_batch) free(layer->text_batch);
+        if (layer->text_slot_offset) free(layer->text_slot_offset);
+        if (layer->text_slot_glyphs) free(layer->text_slot_glyphs);
+        if (layer->glyph_rows) free(layer->glyph_rows);
+        if (layer->text_slot_dirty) free(layer->text_slot_dirty);
+        layer->text_batch = (GlyphInstance*)malloc((size_t)cap * TEXT_SLOT_GLYPHS * sizeof(GlyphInstance));
+        layer->text_slot_offset = (int*)calloc((size_t)cap + 1, sizeof(int));
+        layer->text_slot_glyphs = (unsigned char*)calloc((size_t)cap, 1);
+        layer->glyph_rows = (unsigned char*)calloc((size_t)cap, GLYPH_ROW_TEXELS);
+        layer->text_slot_dirty = (unsigned int*)calloc((cap + 31) / 32, sizeof(unsigned int));
+        layer->text_slot_cap = cap;
+        layer->text_dirty_max = -1;
+    }
+    clear_text_slots_dirty(layer);
+    layer->text_slots = slots;
+    layer->text_dirty_min = slots;
+
+    for (int slot = 0; slot < slots; slot++) layout_text_slot(layer, slot);
+    layer->text_dirty = 0;
+
+    if (gpu_text_layout) {
+        build_glyph_grid(layer, slots);
+        return;
+    }
+    if (!layer->text_vbo) {
+        glGenBuffers(1, &layer->text_vbo);
+        layer->text_vao = create_vao();
+        glBindBuffer(GL_ARRAY_BUFFER, glyph_corner_vbo);
+        glEnableVertexAttribArray(TEXT_A_CORNER);
+        glVertexAttribPointer(TEXT_A_CORNER, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glBindBuffer(GL_ARRAY_BUFFER, layer->text_vbo);
+        glEnableVertexAttribArray(TEXT_A_ORIGIN);
+        glEnableVertexAttribArray(TEXT_A_GLYPH);
+        glVertexAttribPointer(TEXT_A_ORIGIN, 2, GL_SHORT, GL_FALSE, sizeof(GlyphInstance), (void*)0);
+        glVertexAttribPointer(TEXT_A_GLYPH, 4, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(GlyphInstance),
+                              (void*)offsetof(GlyphInstance, glyph));
+        glVertexAttribDivisorANGLE(TEXT_A_ORIGIN, 1);
+        glVertexAttribDivisorANGLE(TEXT_A_GLYPH, 1);
+        glBindVertexArrayOES(0);
+    }
+    pack_text_batch(layer);
+}
+
+// Uploads slots [start, end). In GPU layout mode that is glyph texture rows:
+// a partial first row, the whole rows in between and a partial last row.
+static void upload_text_slots(const GridLayer* layer, int start, int end) {
+    if (!gpu_text_layout) {
+        int first = layer->text_slot_offset[start];
+        int last = layer->text_slot_offset[end];
+        if (last > first) {
+            glBufferSubData(GL_ARRAY_BUFFER, (size_t)first * sizeof(GlyphInstance),
+                            (size_t)(last - first) * sizeof(GlyphInstance), layer->text_packed + first);
+        }
+        return;
+    }
+    while (start < end) {
+        int row = start / GLYPH_ROW_SLOTS;
+        int col = start % GLYPH_ROW_SLOTS;
+        int width, height;
+        if (col == 0 && end - start >= GLYPH_ROW_SLOTS) {
+            width = GLYPH_ROW_SLOTS;
+            height = (end - start) / GLYPH_ROW_SLOTS;
+        } else {
+            width = GLYPH_ROW_SLOTS - col;
+            if (width > end - start) width = end - start;
+            height = 1;
+        }
+        glTexSubImage2D(GL_TEXTURE_2D, 0, col * GLYPH_ROW_TEXELS, row, width * GLYPH_ROW_TEXELS, height,
+                        GL_LUMINANCE, GL_UNSIGNED_BYTE, layer->glyph_rows + (size_t)start * GLYPH_ROW_TEXELS);
+        start += width * height;
+    }
+}
+
+// Re-lays out the marked slots and uploads them, one glBufferSubData per
+// contiguous run, or one covering the whole dirty range when fragmented. In
+// CPU layout a slot that outgrew its packed range repacks the whole layer.
+static void update_text_slots(GridLayer* layer) {
+    if (layer->text_dirty_max < layer->text_dirty_min) return;
+    int repack = 0;
+    for (int slot = layer->text_dirty_min; slot <= layer->text_dirty_max; slot++) {
+        if (!is_text_slot_dirty(layer, slot)) continue;
+        release_text_slot(layer, slot);
+        layout_text_slot(layer, slot);
+        if (!gpu_text_layout && !pack_text_slot(layer, slot)) repack = 1;
+    }
+    if (repack) {
+        pack_text_batch(layer);
+        clear_text_slots_dirty(layer);
+        return;
+    }
+
+    if (gpu_text_layout) glBindTexture(GL_TEXTURE_2D, layer->glyph_texture);
+    else glBindBuffer(GL_ARRAY_BUFFER, layer->text_vbo);
+    int runs = 0;
+    int slot = layer->text_dirty_min;
+    while (slot <= layer->text_dirty_max) {
+        if (!is_text_slot_dirty(layer, slot)) { slot++; continue; }
+        int start = slot;
+        if (runs == TEXT_DIRTY_MAX_SPANS) {
+            // Too fragmented: upload the rest as one range
+            upload_text_slots(layer, start, layer->text_dirty_max + 1);
+            break;
+        }
+        while (slot <= layer->text_dirty_max && is_text_slot_dirty(layer, slot)) slot++;
+        upload_text_slots(layer, start, slot);
+        runs++;
+    }
+    clear_text_slots_dirty(layer);
+}
+
+// Uniforms shared by both text programs that never change, set once after
+// linking with the program in use
+static void set_text_constants(GLuint prog) {
+    glUniform1i(glGetUniformLocation(prog, "u_texture"), 0);
+    glUniform1i(glGetUniformLocation(prog, "u_palette"), 2);
+    glUniform1f(glGetUniformLocation(prog, "u_styles"), (float)TEXT_STYLE_COUNT);
+    glUniform2f(glGetUniformLocation(prog, "u_atlas_size"), (float)GLYPH_ATLAS_W, (float)GLYPH_ATLAS_H);
+    glUniform1f(glGetUniformLocation(prog, "u_atlas_cols"), (float)GLYPH_CACHE_COLS);
+    glUniform2f(glGetUniformLocation(prog, "u_cell_size"), (float)FONT_SDF_CELL_W, (float)FONT_SDF_CELL_H);
+    glUniform1f(glGetUniformLocation(prog, "u_cap_height"), FONT_SDF_CAP_HEIGHT);
+    glUniform1f(glGetUniformLocation(prog, "u_sdf_range"), 2.0f * FONT_SDF_SPREAD);
+}
+
+// Draws the glyph instances of the layers on the given row segment (CPU layout)
+static void render_glyph_instances(const AxisSegment* rows) {
+    if (!text_program) {
+        text_program = create_program(text_vertex_src, text_fragment_src, text_attribs,
+                                      text_uniform_names, text_uniforms);
+        if (!text_program) return;
+        glUseProgram(text_program);
+        set_text_constants(text_program);
+    }
+
+    glUseProgram(text_program);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, font_texture);
+    glUniform2f(text_uniforms[TEXT_U_RESOLUTION], (float)canvas_width, (float)canvas_height);
+
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        GridLayer* layer = &layers[i];
+        if (layer->rows != rows || !segment_visible(layer->rows) || !segment_visible(layer->cols)) continue;
+        if (layer->text_slots == 0) continue;
+        int glyphs = layer->text_slot_offset[layer->text_slots];
+        if (glyphs == 0 || !layer_scissor(layer)) continue;
+
+        float tx, ty;
+        layer_translation(layer, &tx, &ty);
+        glUniform2f(text_uniforms[TEXT_U_TRANSLATE], tx, ty);
+        glBindVertexArrayOES(layer->text_vao);
+        glDrawArraysInstancedANGLE(GL_TRIANGLES, 0, 6, glyphs);
+    }
+}
+
+// Draws one quad per cell slot of the layers on the given row segment and
+// lets the fragment shader lay the text out from the glyph texture (GPU
+// layout)
+static void render_glyph_grid(const AxisSegment* rows) {
+    if (!text_grid_program) {
+        text_grid_program = create_program(text_grid_vertex_src, text_grid_fragment_src, text_grid_attribs,
+                                           text_uniform_names, text_grid_uniforms);
+        if (!text_grid_program) return;
+        GLuint prog = text_grid_program;
+        glUseProgram(prog);
+        set_text_constants(prog);
+        glUniform1i(glGetUniformLocation(prog, "u_glyphs"), 1);
+        glUniform1f(glGetUniformLocation(prog, "u_cap_fraction"), TEXT_CAP_FRACTION);
+        glUniform1f(glGetUniformLocation(prog, "u_advance"), FONT_SDF_ADVANCE);
+        glUniform1f(glGetUniformLocation(prog, "u_baseline"), (float)FONT_SDF_BASELINE);
+        glUniform1f(glGetUniformLocation(prog, "u_origin_x"), (float)FONT_SDF_ORIGIN_X);
+        glUniform1f(glGetUniformLocation(prog, "u_pad"), TEXT_PAD_ADVANCES);
+        glUniform1f(glGetUniformLocation(prog, "u_row_slots"), (float)GLYPH_ROW_SLOTS);
+        glUniform1f(glGetUniformLocation(prog, "u_row_texels"), (float)GLYPH_ROW_TEXELS);
+    }
+
+    glUseProgram(text_grid_program);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, font_texture);
+    glUniform2f(text_grid_uniforms[TEXT_U_RESOLUTION], (float)canvas_width, (float)canvas_height);
+
+    // Glyph textures are sampled on unit 1
+    glActiveTexture(GL_TEXTURE1);
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        GridLayer* layer = &layers[i];
+        if (layer->rows != rows || !segment_visible(layer->rows) || !segment_visible(layer->cols)) continue;
+        if (layer->text_slots == 0) continue;
+        if (!layer_scissor(layer)) continue;
+
+        float tx, ty;
+        layer_translation(layer, &tx, &ty);
+        glUniform2f(text_grid_uniforms[TEXT_U_TRANSLATE], tx, ty);
+        glUniform2f(text_grid_uniforms[TEXT_U_GLYPHS_SIZE],
+                    (float)(GLYPH_ROW_SLOTS * GLYPH_ROW_TEXELS), (float)(layer->text_slot_cap / GLYPH_ROW_SLOTS));
+
+        glBindTexture(GL_TEXTURE_2D, layer->glyph_texture);
+        glBindVertexArrayOES(layer->cell_vao);
+        glDrawArraysInstancedANGLE(GL_TRIANGLES, 0, 6, layer->text_slots);
+    }
+    glActiveTexture(GL_TEXTURE0);
+}
+
+// Lays out changed text in every visible layer, then uploads any glyphs
+// that layout loaded into the atlas
+static void update_text(void) {
+    // GPU layout updates the glyph textures on unit 1, where they are sampled
+    if (gpu_text_layout) glActiveTexture(GL_TEXTURE1);
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        GridLayer* layer = &layers[i];
+        if (!segment_visible(layer->rows) || !segment_visible(layer->cols)) continue;
+        if (layer->text_dirty) build_text_batch(layer);
+        else update_text_slots(layer);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    upload_glyph_atlas();
+}
+
+// Creates the font resources on first use and lays out changed text
+static void prepare_text(void) {
+    init_font_texture();
+    if (!font_texture) return;
+    if (!glyph_corner_vbo) {
+        glGenBuffers(1, &glyph_corner_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, glyph_corner_vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(glyph_corners), glyph_corners, GL_STATIC_DRAW);
+    }
+    update_text();
+}
+
+// Draws the text of the layers on one row segment into its text surface
+static void render_text(const AxisSegment* rows) {
+    if (!font_texture) return;
+    bind_text_palette();
+
+    // Surfaces hold premultiplied color, see SURFACES
+    glEnable(GL_BLEND);
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_SCISSOR_TEST);
+    if (gpu_text_layout) render_glyph_grid(rows);
+    else render_glyph_instances(rows);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_BLEND);
+}
+
+// Switches between CPU layout (one instanced quad per glyph) and GPU layout
+// (one quad per cell, text resolved in the fragment shader from a glyph
+// index texture). With GPU layout a text update is a single GLYPH_ROW_TEXELS
+// byte texture row upload whatever the string length.
+EMSCRIPTEN_KEEPALIVE
+void set_gpu_text_layout(int enabled) {
+    enabled = enabled ? 1 : 0;
+    if (enabled == gpu_text_layout) return;
+    // Release glyphs while the layers still hold the old mode's layout
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        release_layer_text(&layers[i]);
+        layers[i].text_slots = 0;
+        layers[i].text_dirty = 1;
+    }
+    gpu_text_layout = enabled;
+}
+
+static void mark_cell_text_dirty(int row, int col) {
+    GridLayer* layer = layer_of(row, col);
+    if (!layer || layer->text_dirty) return;
+    mark_text_slot_dirty(layer, text_slot_of(layer, row, col));
+    // A header span's text is laid out across the whole span
+    const HeaderSpan* span = header_span_of(row, col);
+    int surface = text_surface(layer);
+    if (span) damage_cells(surface, layer, row, span->first_col, row, span->first_col + span->cols - 1);
+    else damage_cells(surface, layer, row, col, row, col);
+}
+
+// Stores len bytes of text (not necessarily terminated), truncated to
+// CELL_TEXT_MAX, and marks the cell's slot if the text changed (price ticks
+// often round to the text already shown)
+static void store_cell_text(int row, int col, const char* text, int len) {
+    if (len > CELL_TEXT_MAX) len = CELL_TEXT_MAX;
+    const CellString* current = cell_string(row, col);
+    if (current->len == len && memcmp(cell_text_at(row, col), text, len) == 0) return;
+    CellString* cell = writable_cell_string(row, col);
+    if (!cell) return;
+
+    char* dst;
+    if (len > CELL_INLINE_BYTES && cell->len > CELL_INLINE_BYTES &&
+        arena_block_size(len) == arena_block_size(cell->len)) {
+        dst = text_arena + cell->u.offset;
+    } else {
+        clear_cell_string(cell);
+        long offset = len > CELL_INLINE_BYTES ? alloc_arena_block(arena_block_size(len)) : -1;
+        if (offset >= 0) {
+            cell->u.offset = (unsigned int)offset;
+            dst = text_arena + offset;
+        } else {
+            if (len > CELL_INLINE_BYTES) len = CELL_INLINE_BYTES;  // out of memory
+            dst = cell->u.text;
+        }
+    }
+    memcpy(dst, text, len);
+    dst[len] = '\0';
+    cell->len = (unsigned char)len;
+    cell->extent = measure_text(dst);
+    mark_cell_text_dirty(row, col);
+}
+
+EMSCRIPTEN_KEEPALIVE
+void set_cell_text(int row, int col, const char* text) {
+    if (!cell_pages || row < 0 || row >= grid_rows || col < 0 || col >= grid_cols || !text) return;
+    store_cell_text(row, col, text, (int)strlen(text));
+}
+
+// Bulk form of set_cell_text for whole-grid refreshes: one call applies a
+// buffer the caller packed straight into the WASM heap:
+//
+//   int32 count, int32 arena_bytes
+//   count records of int32 row, col, offset, len
+//   arena_bytes of UTF-8 text; each record's text is [offset, offset + len)
+//
+// Records outside the grid or the arena are skipped. Returns the number of
+// records applied.
+EMSCRIPTEN_KEEPALIVE
+int set_cells_text(const void* buffer, int size) {
+    if (!cell_pages || !buffer || size < 8) return 0;
+    const int* header = (const int*)buffer;
+    int count = header[0];
+    int arena_bytes = header[1];
+    if (count < 0 || arena_bytes < 0 || count > (size - 8) / 16 ||
+        arena_bytes > size - 8 - count * 16) return 0;
+
+    const int* records = header + 2;
+    const char* arena = (const char*)(records + count * 4);
+    int applied = 0;
+    for (int i = 0; i < count; i++) {
+        const int* r = records + i * 4;
+        int row = r[0], col = r[1], offset = r[2], len = r[3];
+        if (row < 0 || row >= grid_rows || col < 0 || col >= grid_cols) continue;
+        if (offset < 0 || len < 0 || offset > arena_bytes || len > arena_bytes - offset) continue;
+        store_cell_text(row, col, arena + offset, len);
+        applied++;
+    }
+    return applied;
+}
+
+// Sets the color of text style `style` (components 0..1)
+EMSCRIPTEN_KEEPALIVE
+void set_text_style(int style, float r, float g, float b) {
+    if (style < 0 || style >= TEXT_STYLE_COUNT) return;
+    text_palette[style][0] = unit_to_byte(r);
+    text_palette[style][1] = unit_to_byte(g);
+    text_palette[style][2] = unit_to_byte(b);
+    palette_dirty = 1;
+}
+
+// Sets a cell's entry in one of the style tables, allocating it on first
+// use, and re-lays out the cell if the style it shows changed
+static void store_style_entry(unsigned char** table, int row, int col, int style) {
+    size_t i = (size_t)row * grid_cols + col;
+    if ((*table ? (*table)[i] : 0) == style) return;
+    if (!*table) {
+        *table = (unsigned char*)calloc((size_t)grid_rows * grid_cols, 1);
+        if (!*table) return;
+    }
+    int shown = cell_style_at(row, col);
+    (*table)[i] = (unsigned char)style;
+    if (cell_style_at(row, col) == shown) return;
+    mark_cell_text_dirty(row, col);
+    invalidate_header_cell(row, col);
+}
+
+EMSCRIPTEN_KEEPALIVE
+void set_cell_style(int row, int col, int style) {
+    if (!cell_pages || row < 0 || row >= grid_rows || col < 0 || col >= grid_cols) return;
+    if (style < 0 || style >= TEXT_STYLE_COUNT) style = 0;
+    store_style_entry(&cell_styles, row, col, style);
+}
+
+// Sets column col's text alignment (TEXT_ALIGN_*). For decimal alignment,
+// fraction is the number of characters kept right of the decimal point,
+// the point included (3 for two decimals). Re-lays out the column's layers.
+EMSCRIPTEN_KEEPALIVE
+void set_column_align(int col, int align, int fraction) {
+    if (col < 0 || col >= grid_cols) return;
+    if (align < TEXT_ALIGN_CENTER || align > TEXT_ALIGN_DECIMAL) align = TEXT_ALIGN_CENTER;
+    if (fraction < 0) fraction = 0;
+    if (fraction > MAX_CELL_LEN) fraction = MAX_CELL_LEN;
+    ColumnText* column = &column_text[col];
+    if (column->align == align && column->fraction == fraction) return;
+    column->align = (unsigned char)align;
+    column->fraction = (unsigned char)fraction;
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        if (segment_contains(layers[i].cols, col)) layers[i].text_dirty = 1;
+    }
+}
+
+// Numbers are formatted here rather than in JS, so a price tick is one call
+// with a double instead of toFixed, a JS string and a UTF-8 copy.
+#define NUMBER_MAX_DECIMALS 9
+#define NUMBER_MAX_CHARS 330  // sign, 309 integer digits, point, decimals
+
+static const double pow10_table[NUMBER_MAX_DECIMALS + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+};
+
+// Formats value with a fixed number of decimals, like JS toFixed for
+// |value| < 1e21. The integer part is split off exactly and the fraction
+// rounded to `decimals` digits; the rounding is decided on the exact
+// product, not the rounded one: fma gives the sign of
+// frac * 10^decimals - (n + 0.5) with a single rounding, and exact ties
+// round up as toFixed does. out must hold NUMBER_MAX_CHARS bytes.
+// Returns the length.
+static int format_fixed(char* out, double value, int decimals) {
+    if (decimals < 0) decimals = 0;
+    if (decimals > NUMBER_MAX_DECIMALS) decimals = NUMBER_MAX_DECIMALS;
+    if (value != value) { memcpy(out, "NaN", 4); return 3; }
+
+    int len = 0;
+    if (value < 0.0) {
+        out[len++] = '-';
+        value = -value;
+    }
+    if (isinf(value)) {
+        memcpy(out + len, "Infinity", 9);
+        return len + 8;
+    }
+
+    double whole = floor(value);
+    double frac = value - whole;
+    double scale = pow10_table[decimals];
+    double n = floor(frac * scale);
+    if (fma(frac, scale, -(n + 0.5)) >= 0.0) n += 1.0;
+    if (n >= scale) {
+        whole += 1.0;
+        n = 0.0;
+    }
+
+    if (whole < 1e18) {
+        unsigned long long w = (unsigned long long)whole;
+        char digits[24];
+        int count = 0;
+        do {
+            digits[count++] = (char)('0' + w % 10);
+            w /= 10;
+        } while (w > 0);
+        while (count > 0) out[len++] = digits[--count];
+    } else {
+        // Past exact 64-bit integers; whole is integral, so this is exact
+        len += snprintf(out + len, NUMBER_MAX_CHARS - len, "%.0f", whole);
+    }
+    if (decimals > 0) {
+        unsigned int f = (unsigned int)n;
+        out[len++] = '.';
+        for (int i = decimals - 1; i >= 0; i--) {
+            out[len + i] = (char)('0' + f % 10);
+            f /= 10;
+        }
+        len += decimals;
+    }
+    out[len] = '\0';
+    return len;
+}
+
+static void apply_format_rules(int row, int col, double value);
+
+static void store_cell_number(int row, int col, double value, int decimals) {
+    apply_format_rules(row, col, value);
+    char text[NUMBER_MAX_CHARS];
+    store_cell_text(row, col, text, format_fixed(text, value, decimals));
+}
+
+EMSCRIPTEN_KEEPALIVE
+void set_cell_number(int row, int col, double value, int decimals) {
+    if (!cell_pages || row < 0 || row >= grid_rows || col < 0 || col >= grid_cols) return;
+    store_cell_number(row, col, value, decimals);
+}
+
+// Batch form: cells[i] is row * cols + col for values[i]. Both arrays live
+// in the WASM heap (HEAP32/HEAPF64), so a whole tick is one call.
+EMSCRIPTEN_KEEPALIVE
+void set_cell_numbers(const int* cells, const double* values, int count, int decimals) {
+    if (!cell_pages || !cells || !values) return;
+    int total = grid_rows * grid_cols;
+    for (int i = 0; i < count; i++) {
+        int cell = cells[i];
+        if (cell < 0 || cell >= total) continue;
+        store_cell_number(cell / grid_cols, cell % grid_cols, values[i], decimals);
+    }
+}
+
+// ============================================================
+// CONDITIONAL FORMATTING - per-column rules evaluated on number updates
+// ============================================================
+//
+// Rules live in one compact table grouped by column, grown as rules are
+// added. Each rule tests a cell's new value (against thresholds, its sign,
+// or the column's previous value for that row) and picks a text style
+// and/or a background style.
+// Rules run only for the cells set_cell_number/set_cell_numbers touch: for
+// each style, the first matching rule that sets it wins, and a cell no rule
+// matches goes back to the defaults. Text styles are the TEXT STYLES
+// palette and show unless the cell has an explicit set_cell_style; background
+// styles index format_backgrounds and show unless the cell has an explicit
+// set_cell_color override. Both reach the GPU through the existing dirty
+// tracking, so a tick recolors without any JS calls.
+#define FORMAT_BG_COUNT 8
+
+enum {
+    FORMAT_ABOVE,     // value > a
+    FORMAT_BELOW,     // value < a
+    FORMAT_BETWEEN,   // a <= value <= b
+    FORMAT_OUTSIDE,   // value < a or value > b
+    FORMAT_NEGATIVE,  // value < 0
+    FORMAT_POSITIVE,  // value > 0
+    FORMAT_UP,        // value > previous value
+    FORMAT_DOWN,      // value < previous value
+    FORMAT_OP_COUNT
+};
+
+typedef struct {
+    double a, b;
+    int col;
+    unsigned char op;
+    unsigned char text_style;  // 0 = leave to later rules
+    unsigned char bg_style;    // 0 = leave to later rules
+} FormatRule;
+
+static FormatRule* format_rules = NULL;
+static int format_rule_count = 0;
+static int format_rule_cap = 0;
+static int* column_rule_first = NULL;  // per column, format_cols entries
+static int* column_rule_count = NULL;
+static double** column_values = NULL;  // previous value per row, ruled columns only
+static int format_cols = 0;
+
+static unsigned char format_backgrounds[FORMAT_BG_COUNT][4] = {
+    {   0,   0,   0,   0 },  // 0: none
+    {   0,  90,  60, 255 },  // 1: green
+    { 110,  30,  40, 255 },  // 2: red
+    { 110,  80,   0, 255 },  // 3: amber
+    {  30,  60, 110, 255 },  // 4: blue
+    {  70,  70,  90, 255 },  // 5: grey
+    {  90,  30, 100, 255 },  // 6: purple
+    {   0,  80,  90, 255 },  // 7: teal
+};
+
+// The color a cell's background shows: an explicit override, else the
+// background its format rules chose; alpha 0 means the default stripe
+static const unsigned char* cell_background(int row, int col) {
+    size_t i = (size_t)row * grid_cols + col;
+    if (cell_colors && cell_colors[i * 4 + 3]) return cell_colors + i * 4;
+    return format_backgrounds[cell_format_bg ? cell_format_bg[i] : 0];
+}
+
+static void store_format_bg(int row, int col, int bg) {
+    size_t i = (size_t)row * grid_cols + col;
+    if ((cell_format_bg ? cell_format_bg[i] : 0) == bg) return;
+    if (!cell_format_bg) {
+        cell_format_bg = (unsigned char*)calloc((size_t)grid_rows * grid_cols, 1);
+        if (!cell_format_bg) return;
+        // From now on refresh_view_colors merges rule backgrounds too
+        refresh_view_colors();
+    }
+    cell_format_bg[i] = (unsigned char)bg;
+    sync_view_color(row, col);
+    invalidate_header_cell(row, col);
+}
+
+static int format_rule_matches(const FormatRule* rule, double value, double previous) {
+    switch (rule->op) {
+        case FORMAT_ABOVE:    return value > rule->a;
+        case FORMAT_BELOW:    return value < rule->a;
+        case FORMAT_BETWEEN:  return value >= rule->a && value <= rule->b;
+        case FORMAT_OUTSIDE:  return value < rule->a || value > rule->b;
+        case FORMAT_NEGATIVE: return value < 0.0;
+        case FORMAT_POSITIVE: return value > 0.0;
+        case FORMAT_UP:       return value > previous;   // false while previous is NaN
+        case FORMAT_DOWN:     return value < previous;
+    }
+    return 0;
+}
+
+static void apply_format_rules(int row, int col, double value) {
+    int count = column_rule_count[col];
+    if (count == 0) return;
+    double* previous = &column_values[col][row];
+    int text = 0, bg = 0;
+    const FormatRule* rule = &format_rules[column_rule_first[col]];
+    for (int i = 0; i < count && !(text && bg); i++, rule++) {
+        if (!format_rule_matches(rule, value, *previous)) continue;
+        if (!text) text = rule->text_style;
+        if (!bg) bg = rule->bg_style;
+    }
+    *previous = value;
+    store_style_entry(&cell_format_styles, row, col, text);
+    store_format_bg(row, col, bg);
+}
+
+static void index_format_rules(void) {
+    if (format_cols) memset(column_rule_count, 0, format_cols * sizeof(int));
+    for (int i = format_rule_count - 1; i >= 0; i--) {
+        column_rule_first[format_rules[i].col] = i;
+        column_rule_count[format_rules[i].col]++;
+    }
+}
+
+// Forgets every rule without touching cell styles (init_grid frees those)
+// and sizes the per-column tables to a grid of `cols` columns
+static int drop_format_rules(int cols) {
+    for (int c = 0; c < format_cols; c++) {
+        if (column_values[c]) free(column_values[c]);
+    }
+    free(column_rule_first);
+    free(column_rule_count);
+    free(column_values);
+    column_rule_first = (int*)calloc((size_t)cols, sizeof(int));
+    column_rule_count = (int*)calloc((size_t)cols, sizeof(int));
+    column_values = (double**)calloc((size_t)cols, sizeof(double*));
+    int ok = cols == 0 || (column_rule_first && column_rule_count && column_values);
+    format_cols = ok ? cols : 0;
+    format_rule_count = 0;
+    index_format_rules();
+    return ok;
+}
+
+// Appends a rule to column col's list. Styles of 0 leave that style to the
+// column's later rules. Returns 0 if the rule is invalid or out of memory.
+EMSCRIPTEN_KEEPALIVE
+int add_format_rule(int col, int op, double a, double b, int text_style, int bg_style) {
+    if (col < 0 || col >= grid_cols || op < 0 || op >= FORMAT_OP_COUNT) return 0;
+    if (text_style < 0 || text_style >= TEXT_STYLE_COUNT || bg_style < 0 || bg_style >= FORMAT_BG_COUNT) return 0;
+    if (format_rule_count == format_rule_cap) {
+        int cap = format_rule_cap ? format_rule_cap * 2 : 64;
+        FormatRule* grown = (FormatRule*)realloc(format_rules, (size_t)cap * sizeof(FormatRule));
+        if (!grown) return 0;
+        format_rules = grown;
+        format_rule_cap = cap;
+    }
+    if (!column_values[col]) {
+        column_values[col] = (double*)malloc((size_t)grid_rows * sizeof(double));
+        if (!column_values[col]) return 0;
+        for (int r = 0; r < grid_rows; r++) column_values[col][r] = NAN;
+    }
+
+    // Keep the table grouped by column: insert after the column's last rule
+    int at = column_rule_count[col] ? column_rule_first[col] + column_rule_count[col] : format_rule_count;
+    memmove(&format_rules[at + 1], &format_rules[at], (format_rule_count - at) * sizeof(FormatRule));
+    FormatRule* rule = &format_rules[at];
+    rule->a = a;
+    rule->b = b;
+    rule->col = col;
+    rule->op = (unsigned char)op;
+    rule->text_style = (unsigned char)text_style;
+    rule->bg_style = (unsigned char)bg_style;
+    format_rule_count++;
+    index_format_rules();
+    return 1;
+}
+
+// Removes column col's rules (every column's if col < 0) and the styles
+// they set
+EMSCRIPTEN_KEEPALIVE
+void clear_format_rules(int col) {
+    for (int c = 0; c < grid_cols; c++) {
+        if ((col >= 0 && c != col) || !column_values[c]) continue;
+        free(column_values[c]);
+        column_values[c] = NULL;
+        for (int r = 0; r < grid_rows; r++) {
+            if (cell_format_styles) store_style_entry(&cell_format_styles, r, c, 0);
+            if (cell_format_bg) store_format_bg(r, c, 0);
+        }
+    }
+    int kept = 0;
+    for (int i = 0; i < format_rule_count; i++) {
+        if (col < 0 || format_rules[i].col == col) continue;
+        format_rules[kept++] = format_rules[i];
+    }
+    format_rule_count = kept;
+    index_format_rules();
+}
+
+// Sets background style bg (1..FORMAT_BG_COUNT - 1; components 0..1)
+EMSCRIPTEN_KEEPALIVE
+void set_format_background(int bg, float r, float g, float b) {
+    if (bg < 1 || bg >= FORMAT_BG_COUNT) return;
+    format_backgrounds[bg][0] = unit_to_byte(r);
+    format_backgrounds[bg][1] = unit_to_byte(g);
+    format_backgrounds[bg][2] = unit_to_byte(b);
+    format_backgrounds[bg][3] = 255;
+    if (cell_format_bg) {
+        refresh_view_colors();
+        for (int row = 0; row < HEADER_MAX_ROWS; row++) invalidate_header_row(row);
+    }
+}
+
+// ============================================================
+// OVERLAY - selection range, active cell and caret
+// ============================================================
+//
+// Drawn last, translucent, from one small vertex buffer with a per-layer
+// range, so a selection crossing the frozen rows or pinned columns is cut
+// at the layer edges like everything else. The geometry is rebuilt only
+// when the selection, the caret or the layout of a layer changes; scrolling
+// within a band just moves it with the translation uniforms.
+//
+// The caret blinks in the vertex shader: its vertices carry a blink flag,
+// and u_time (milliseconds since the caret last moved) hides them for the
+// second half of every OVERLAY_BLINK_MS * 2 period. A blink frame is one
+// draw call with no geometry or text work, and the caret is always solid
+// right after it moves.
+#define OVERLAY_BLINK_MS 530.0
+#define OVERLAY_BORDER_PX 2.0f
+#define OVERLAY_MAX_QUADS 12  // per layer: range fill + outline, active fill + outline, caret
+#define OVERLAY_FLOATS 7      // x, y, r, g, b, a, blink
+
+static const char* overlay_vertex_src =
+    "attribute vec2 a_position;\n"
+    "attribute vec4 a_color;\n"
+    "attribute float a_blink;\n"
+    "uniform vec2 u_translate;\n"
+    "uniform float u_time;\n"
+    "uniform float u_blink_ms;\n"
+    "varying vec4 v_color;\n"
+    "void main() {\n"
+    "    float off = a_blink * step(u_blink_ms, mod(u_time, 2.0 * u_blink_ms));\n"
+    "    v_color = vec4(a_color.rgb, a_color.a * (1.0 - off));\n"
+    "    gl_Position = vec4(a_position + u_translate, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* overlay_fragment_src =
+    "precision mediump float;\n"
+    "varying vec4 v_color;\n"
+    "void main() {\n"
+    "    if (v_color.a <= 0.0) discard;\n"
+    "    gl_FragColor = v_color;\n"
+    "}\n";
+
+static const float range_fill[4] = {0.3f, 0.6f, 1.0f, 0.18f};
+static const float range_border[4] = {0.3f, 0.6f, 1.0f, 0.9f};
+static const float active_fill[4] = {0.0f, 1.0f, 0.5f, 0.25f};
+static const float active_border[4] = {0.0f, 1.0f, 0.5f, 1.0f};
+static const float caret_color[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+static int cursor_row = -1;
+static int cursor_col = -1;
+static int cursor_pos = 0;
+static int cursor_visible = 0;
+static double cursor_epoch = 0.0;  // emscripten_get_now() when the caret last moved
+
+static int sel_row = -1;  // active cell, -1 = no selection
+static int sel_col = -1;
+static int sel_row1 = 0, sel_col1 = 0, sel_row2 = -1, sel_col2 = -1;  // range, inclusive
+
+enum { OVERLAY_A_POSITION, OVERLAY_A_COLOR, OVERLAY_A_BLINK };
+static const char* const overlay_attribs[] = { "a_position", "a_color", "a_blink", NULL };
+enum { OVERLAY_U_TRANSLATE, OVERLAY_U_TIME, OVERLAY_UNIFORMS };
+static const char* const overlay_uniform_names[] = { "u_translate", "u_time", NULL };
+
+static GLuint overlay_program = 0;
+static GLint overlay_uniforms[OVERLAY_UNIFORMS];
+static GLuint overlay_vbo = 0;
+static GLuint overlay_vao = 0;
+static float overlay_verts[LAYER_COUNT * OVERLAY_MAX_QUADS * 6 * OVERLAY_FLOATS];
+static int overlay_first[LAYER_COUNT];
+static int overlay_count[LAYER_COUNT];
+static RunPlacement overlay_caret_place;  // the caret cell's placement when built
+static int drawn_blink_phase = -1;        // caret phase last drawn: 1 = hidden, -1 = no caret
+static DamageRect overlay_extent[LAYER_COUNT];  // layer pixels covered when built
+static DamageRect caret_extent;
+static int caret_layer = -1;
+
+// Milliseconds into the current blink period
+static double caret_blink_time(void) {
+    return fmod(emscripten_get_now() - cursor_epoch, 2.0 * OVERLAY_BLINK_MS);
+}
+
+static int caret_blink_phase(double blink_time) {
+    return cursor_visible ? blink_time >= OVERLAY_BLINK_MS : -1;
+}
+
+// Shows the caret at character pos of (row, col); visible = 0 hides it.
+// Every call restarts the blink with the caret on.
+EMSCRIPTEN_KEEPALIVE
+void set_cursor(int row, int col, int pos, int visible) {
+    cursor_epoch = emscripten_get_now();
+    if (row == cursor_row && col == cursor_col && pos == cursor_pos && visible == cursor_visible) return;
+    cursor_row = row;
+    cursor_col = col;
+    cursor_pos = pos;
+    cursor_visible = visible;
+    overlay_dirty = 1;
+}
+
+// Selects the rectangle between (anchor_row, anchor_col) and the active
+// cell (row, col), both inclusive. row < 0 clears the selection.
+EMSCRIPTEN_KEEPALIVE
+void set_selection(int anchor_row, int anchor_col, int row, int col) {
+    if (row < 0 || col < 0 || row >= grid_rows || col >= grid_cols) {
+        sel_row = sel_col = -1;
+    } else {
+        if (anchor_row < 0 || anchor_row >= grid_rows) anchor_row = row;
+        if (anchor_col < 0 || anchor_col >= grid_cols) anchor_col = col;
+        sel_row = row;
+        sel_col = col;
+        sel_row1 = anchor_row < row ? anchor_row : row;
+        sel_row2 = anchor_row < row ? row : anchor_row;
+        sel_col1 = anchor_col < col ? anchor_col : col;
+        sel_col2 = anchor_col < col ? col : anchor_col;
+    }
+    overlay_dirty = 1;
+}
+
+static float* push_overlay_quad(float* v, float x1, float y1, float x2, float y2,
+                                const float* color, float blink) {
+    const float corners[6][2] = {{x1, y1}, {x2, y1}, {x2, y2}, {x1, y1}, {x2, y2}, {x1, y2}};
+    for (int i = 0; i < 6; i++) {
+        v[0] = corners[i][0];
+        v[1] = corners[i][1];
+        memcpy(v + 2, color, 4 * sizeof(float));
+        v[6] = blink;
+        v += OVERLAY_FLOATS;
+    }
+    return v;
+}
+
+// Fills rows [r1, r2] x cols [c1, c2] as cut by the layer, and outlines the
+// edges of the cut piece that are edges of the whole rectangle
+static float* push_overlay_rect(float* v, const GridLayer* layer, int r1, int c1, int r2, int c2,
+                                const float* fill, const float* border) {
+    int first_row = layer->rows->first, end_row = first_row + layer->rows->count;
+    int first_col = layer->cols->first, end_col = first_col + layer->cols->count;
+    int pr1 = r1 > first_row ? r1 : first_row;
+    int pc1 = c1 > first_col ? c1 : first_col;
+    int pr2 = r2 < end_row - 1 ? r2 : end_row - 1;
+    int pc2 = c2 < end_col - 1 ? c2 : end_col - 1;
+    if (pr1 > pr2 || pc1 > pc2) return v;
+
+    float x1, y1, x2, y2, ax1, ay1, ax2, ay2;
+    cell_to_clip(layer, pr1, pc1, &x1, &ay1, &ax2, &y2);
+    cell_to_clip(layer, pr2, pc2, &ax1, &y1, &x2, &ay2);
+    v = push_overlay_quad(v, x1, y1, x2, y2, fill, 0.0f);
+
+    float bx = OVERLAY_BORDER_PX * 2.0f / canvas_width;
+    float by = OVERLAY_BORDER_PX * 2.0f / canvas_height;
+    if (pr1 == r1) v = push_overlay_quad(v, x1, y2 - by, x2, y2, border, 0.0f);
+    if (pr2 == r2) v = push_overlay_quad(v, x1, y1, x2, y1 + by, border, 0.0f);
+    if (pc1 == c1) v = push_overlay_quad(v, x1, y1, x1 + bx, y2, border, 0.0f);
+    if (pc2 == c2) v = push_overlay_quad(v, x2 - bx, y1, x2, y2, border, 0.0f);
+    return v;
+}
+
+// Caret bar at the cell's cached text layout, in pixels, then back to clip space
+static float* push_caret(float* v, const GridLayer* layer) {
+    float x1, y1, x2, y2;
+    cell_to_clip(layer, cursor_row, cursor_col, &x1, &y1, &x2, &y2);
+    float px_per_clip_x = canvas_width * 0.5f;
+    float px_per_clip_y = canvas_height * 0.5f;
+    TextRun run = clip_text_run(overlay_caret_place, x1, y1, x2, y2);
+
+    float cx = (run.pen_x + cursor_pos * run.advance) / px_per_clip_x - 1.0f;
+    float bar_w = run.advance * 0.15f / px_per_clip_x;
+    float start_y = 1.0f - run.baseline / px_per_clip_y;
+    float char_h = run.cap / px_per_clip_y;
+    return push_overlay_quad(v, cx, start_y, cx + bar_w, start_y + char_h, caret_color, 1.0f);
+}
+
+// Layer pixel bounds of the overlay vertices [from, to)
+static DamageRect vertex_extent(const float* from, const float* to) {
+    DamageRect r = { 0, 0, 0, 0 };
+    if (from == to) return r;
+    float x0 = from[0], x1 = from[0], y0 = from[1], y1 = from[1];
+    for (const float* p = from; p < to; p += OVERLAY_FLOATS) {
+        x0 = fminf(x0, p[0]);
+        x1 = fmaxf(x1, p[0]);
+        y0 = fminf(y0, p[1]);
+        y1 = fmaxf(y1, p[1]);
+    }
+    r.x0 = (int)floorf((x0 + 1.0f) * 0.5f * canvas_width);
+    r.x1 = (int)ceilf((x1 + 1.0f) * 0.5f * canvas_width);
+    r.y0 = (int)floorf((1.0f - y1) * 0.5f * canvas_height);
+    r.y1 = (int)ceilf((1.0f - y0) * 0.5f * canvas_height);
+    return r;
+}
+
+static void damage_extent(int layer, const DamageRect* r) {
+    if (!rect_empty(r)) damage_layer_px(SURFACE_OVERLAY, &layers[layer], r->x0, r->y0, r->x1, r->y1);
+}
+
+// The caret's pixels change when it blinks
+static void damage_caret(void) {
+    if (caret_layer >= 0) damage_extent(caret_layer, &caret_extent);
+}
+
+// Rebuilds the geometry, damaging what the old geometry covered and what
+// the new one does
+static void build_overlay(void) {
+    for (int i = 0; i < LAYER_COUNT; i++) damage_extent(i, &overlay_extent[i]);
+    caret_layer = -1;
+
+    int has_caret = cursor_visible && cursor_row >= 0 && cursor_row < grid_rows &&
+                    cursor_col >= 0 && cursor_col < grid_cols;
+    if (has_caret) {
+        overlay_caret_place = run_placement(cell_extent_at(cursor_row, cursor_col), column_text[cursor_col]);
+    }
+    // The active cell covers its whole header span
+    int active_c1 = sel_col, active_c2 = sel_col;
+    const HeaderSpan* span = sel_row >= 0 ? header_span_of(sel_row, sel_col) : NULL;
+    if (span) {
+        active_c1 = span->first_col;
+        active_c2 = span->first_col + span->cols - 1;
+    }
+
+    float* v = overlay_verts;
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        const GridLayer* layer = &layers[i];
+        float* start = v;
+        if (segment_visible(layer->rows) && segment_visible(layer->cols)) {
+            if (sel_row >= 0 && (sel_row1 != sel_row2 || sel_col1 != sel_col2)) {
+                v = push_overlay_rect(v, layer, sel_row1, sel_col1, sel_row2, sel_col2, range_fill, range_border);
+            }
+            if (sel_row >= 0) {
+                v = push_overlay_rect(v, layer, sel_row, active_c1, sel_row, active_c2, active_fill, active_border);
+            }
+            if (has_caret && layer_of(cursor_row, cursor_col) == layer) {
+                float* caret = v;
+                v = push_caret(v, layer);
+                caret_extent = vertex_extent(caret, v);
+                caret_layer = i;
+            }
+        }
+        overlay_first[i] = (int)(start - overlay_verts) / OVERLAY_FLOATS;
+        overlay_count[i] = (int)(v - start) / OVERLAY_FLOATS;
+        overlay_extent[i] = vertex_extent(start, v);
+        damage_extent(i, &overlay_extent[i]);
+    }
+
+    if (!overlay_vbo) {
+        glGenBuffers(1, &overlay_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, overlay_vbo);
+        overlay_vao = create_vao();
+        glEnableVertexAttribArray(OVERLAY_A_POSITION);
+        glEnableVertexAttribArray(OVERLAY_A_COLOR);
+        glEnableVertexAttribArray(OVERLAY_A_BLINK);
+        glVertexAttribPointer(OVERLAY_A_POSITION, 2, GL_FLOAT, GL_FALSE, OVERLAY_FLOATS * sizeof(float), (void*)0);
+        glVertexAttribPointer(OVERLAY_A_COLOR, 4, GL_FLOAT, GL_FALSE, OVERLAY_FLOATS * sizeof(float),
+                              (void*)(2 * sizeof(float)));
+        glVertexAttribPointer(OVERLAY_A_BLINK, 1, GL_FLOAT, GL_FALSE, OVERLAY_FLOATS * sizeof(float),
+                              (void*)(6 * sizeof(float)));
+        glBindVertexArrayOES(0);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, overlay_vbo);
+    glBufferData(GL_ARRAY_BUFFER, (v - overlay_verts) * sizeof(float), overlay_verts, GL_DYNAMIC_DRAW);
+    overlay_dirty = 0;
+}
+
+static void update_overlay(void) {
+    // Editing moves the caret's text under it without a set_cursor call
+    if (!overlay_dirty && cursor_visible && cursor_row >= 0 && cursor_row < grid_rows &&
+        cursor_col >= 0 && cursor_col < grid_cols) {
+        RunPlacement place = run_placement(cell_extent_at(cursor_row, cursor_col), column_text[cursor_col]);
+        if (place.anchor != overlay_caret_place.anchor || place.lead != overlay_caret_place.lead) overlay_dirty = 1;
+    }
+    if (overlay_dirty) build_overlay();
+}
+
+static void render_overlay(double blink_time) {
+    if (!overlay_program) {
+        overlay_program = create_program(overlay_vertex_src, overlay_fragment_src, overlay_attribs,
+                                         overlay_uniform_names, overlay_uniforms);
+        if (!overlay_program) return;
+        glUseProgram(overlay_program);
+        glUniform1f(glGetUniformLocation(overlay_program, "u_blink_ms"), (float)OVERLAY_BLINK_MS);
+    }
+
+    glUseProgram(overlay_program);
+    glUniform1f(overlay_uniforms[OVERLAY_U_TIME], (float)blink_time);
+    glBindVertexArrayOES(overlay_vao);
+    glEnable(GL_BLEND);
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_SCISSOR_TEST);
+
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        if (overlay_count[i] == 0) continue;
+        if (!layer_scissor(&layers[i])) continue;
+        float tx, ty;
+        layer_translation(&layers[i], &tx, &ty);
+        glUniform2f(overlay_uniforms[OVERLAY_U_TRANSLATE], tx, ty);
+        glDrawArrays(GL_TRIANGLES, overlay_first[i], overlay_count[i]);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_BLEND);
+}
+
+// ============================================================
+// SURFACES - retained framebuffer textures composited per frame
+// ============================================================
+//
+// Each surface is a canvas-sized RGBA texture behind a framebuffer, holding
+// one kind of content between frames: SURFACE_BACKGROUND the cell
+// backgrounds and header spans (opaque), the two text surfaces the header
+// and body text, SURFACE_OVERLAY the selection and caret. A surface is
+// repainted only where it is damaged, so a price tick repaints one cell of
+// the body text, vertical scrolling leaves the header text alone, and the
+// overlay - selection moves, caret blinks - never re-renders text.
+//
+// Text and overlay surfaces are cleared to transparent and blended into
+// with premultiplied alpha, and one fullscreen pass composites all four
+// onto the canvas.
+
+static const char* composite_vertex_src =
+    "attribute vec2 a_position;\n"
+    "varying vec2 v_uv;\n"
+    "void main() {\n"
+    "    v_uv = a_position * 0.5 + 0.5;\n"
+    "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* composite_fragment_src =
+    "precision mediump float;\n"
+    "uniform sampler2D u_background;\n"
+    "uniform sampler2D u_header_text;\n"
+    "uniform sampler2D u_body_text;\n"
+    "uniform sampler2D u_overlay;\n"
+    "varying vec2 v_uv;\n"
+    "vec4 over(vec4 top, vec4 below) {\n"
+    "    return top + below * (1.0 - top.a);\n"
+    "}\n"
+    "void main() {\n"
+    "    vec4 color = texture2D(u_background, v_uv);\n"
+    "    color = over(texture2D(u_header_text, v_uv), color);\n"
+    "    color = over(texture2D(u_body_text, v_uv), color);\n"
+    "    gl_FragColor = over(texture2D(u_overlay, v_uv), color);\n"
+    "}\n";
+
+static const char* const composite_attribs[] = { "a_position", NULL };
+static const char* const composite_uniform_names[] = { NULL };
+
+static GLuint composite_program = 0;
+static int surface_width = 0;
+static int surface_height = 0;
+
+// (Re)allocates the surfaces at the canvas size. Returns 0 if they cannot
+// be drawn to.
+static int ensure_surfaces(void) {
+    if (surface_width == canvas_width && surface_height == canvas_height) return composite_program != 0;
+    if (!composite_program) {
+        composite_program = create_program(composite_vertex_src, composite_fragment_src, composite_attribs,
+                                           composite_uniform_names, NULL);
+        if (!composite_program) return 0;
+        glUseProgram(composite_program);
+        glUniform1i(glGetUniformLocation(composite_program, "u_background"), SURFACE_BACKGROUND);
+        glUniform1i(glGetUniformLocation(composite_program, "u_header_text"), SURFACE_HEADER_TEXT);
+        glUniform1i(glGetUniformLocation(composite_program, "u_body_text"), SURFACE_BODY_TEXT);
+        glUniform1i(glGetUniformLocation(composite_program, "u_overlay"), SURFACE_OVERLAY);
+    }
+
+    for (int i = 0; i < SURFACES; i++) {
+        Surface* surf = &surfaces[i];
+        if (!surf->texture) {
+            glGenTextures(1, &surf->texture);
+            glBindTexture(GL_TEXTURE_2D, surf->texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        }
+        glBindTexture(GL_TEXTURE_2D, surf->texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, canvas_width, canvas_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        if (!surf->fbo) {
+            glGenFramebuffers(1, &surf->fbo);
+            glBindFramebuffer(GL_FRAMEBUFFER, surf->fbo);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, surf->texture, 0);
+            if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+                printf("Surface framebuffer is incomplete\n");
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                return 0;
+            }
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    surface_width = canvas_width;
+    surface_height = canvas_height;
+    damage_all();
+    return 1;
+}
+
+// Clears damage_clip of a surface and runs its passes inside it. Each pass
+// binds its own program and vertex arrays and restores blend and scissor,
+// so no state from a previous pass needs resetting.
+static void paint_surface(int surface, double blink_time) {
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(damage_clip.x0, canvas_height - damage_clip.y1,
+              damage_clip.x1 - damage_clip.x0, damage_clip.y1 - damage_clip.y0);
+    if (surface == SURFACE_BACKGROUND) glClearColor(0.08f, 0.08f, 0.14f, 1.0f);
+    else glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+
+    switch (surface) {
+    case SURFACE_BACKGROUND:
+        render_grid_bg();
+        render_header_spans();
+        break;
+    case SURFACE_HEADER_TEXT:
+        render_text(&row_segments[SEG_FROZEN]);
+        break;
+    case SURFACE_BODY_TEXT:
+        render_text(&row_segments[SEG_BODY]);
+        break;
+    case SURFACE_OVERLAY:
+        render_overlay(blink_time);
+        break;
+    }
+}
+
+// Repaints a surface's damage, or all of it past DAMAGE_FULL_FRACTION.
+// Returns 0 if it had none.
+static int repaint_surface(int surface, double blink_time) {
+    Surface* surf = &surfaces[surface];
+    long canvas_area = (long)canvas_width * canvas_height;
+    int full = damage_full || surf->full || damage_area(surf) > canvas_area * DAMAGE_FULL_FRACTION;
+    if (!full && surf->count == 0) return 0;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, surf->fbo);
+    if (full) {
+        DamageRect canvas = { 0, 0, canvas_width, canvas_height };
+        damage_clip = canvas;
+        paint_surface(surface, blink_time);
+    } else {
+        for (int i = 0; i < surf->count; i++) {
+            damage_clip = surf->rects[i];
+            paint_surface(surface, blink_time);
+        }
+    }
+    surf->count = 0;
+    surf->full = 0;
+    return 1;
+}
+
+// Draws the four surfaces onto the canvas in one fullscreen pass
+static void composite_surfaces(void) {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glUseProgram(composite_program);
+    for (int i = 0; i < SURFACES; i++) {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, surfaces[i].texture);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArrayOES(grid_vao);  // the fullscreen quad
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+}
+
+// ============================================================
+// RENDER (backgrounds + text + overlay in one call)
+// ============================================================
+
+static double drawn_scroll_x = -1.0;  // scroll position of the surfaces' pixels
+static double drawn_scroll_y = -1.0;
+
+// Damage implied by dirty state rather than recorded where it changed.
+// Moved segments damage everything; scrolling damages the layers that
+// scroll in every surface; a layer whose text or spans are rebuilt whole
+// damages the layer in the surface they are drawn to.
+static void collect_damage(int blink_phase) {
+    for (int r = 0; r < ROW_SEGMENTS; r++) {
+        if (row_segments[r].lut_dirty) damage_all();
+    }
+    for (int c = 0; c < COL_SEGMENTS; c++) {
+        if (col_segments[c].lut_dirty) damage_all();
+    }
+    if (view_colors_stale) damage_surface(SURFACE_BACKGROUND);
+    if (palette_dirty) {
+        damage_surface(SURFACE_HEADER_TEXT);
+        damage_surface(SURFACE_BODY_TEXT);
+    }
+
+    int moved_x = scroll_x != drawn_scroll_x;
+    int moved_y = scroll_y != drawn_scroll_y;
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        const GridLayer* layer = &layers[i];
+        if (!segment_visible(layer->rows) || !segment_visible(layer->cols)) continue;
+        if ((moved_x && layer->cols->scrolls) || (moved_y && layer->rows->scrolls)) {
+            damage_layer(SURFACE_BACKGROUND, layer);
+            damage_layer(text_surface(layer), layer);
+            damage_layer(SURFACE_OVERLAY, layer);
+            continue;
+        }
+        if (layer->text_dirty) damage_layer(text_surface(layer), layer);
+        // Repaint where spans are drawn now or were drawn before (a clear)
+        if (layer->spans_dirty && (header_span_count > 0 || layer->span_vertex_count > 0)) {
+            damage_layer(SURFACE_BACKGROUND, layer);
+        }
+    }
+    if (blink_phase != drawn_blink_phase) damage_caret();
+}
+
+EMSCRIPTEN_KEEPALIVE
+void render_grid(void) {
+    ensure_context();
+    if (!grid_vao || !ensure_surfaces()) return;
+    double blink_time = caret_blink_time();
+    int blink_phase = caret_blink_phase(blink_time);
+    collect_damage(blink_phase);
+
+    // Uploads and rebuilds happen once, however many rectangles are painted
+    update_grid_bg();
+    update_header_spans();
+    prepare_text();
+    update_overlay();
+
+    int painted = 0;
+    for (int i = 0; i < SURFACES; i++) painted |= repaint_surface(i, blink_time);
+    if (painted) composite_surfaces();
+    damage_full = 0;
+    drawn_blink_phase = blink_phase;
+    drawn_scroll_x = scroll_x;
+    drawn_scroll_y = scroll_y;
+}
+
+// ============================================================
+// FRAME LOOP - at most one render per display frame
+// ============================================================
+//
+// Input handlers and price ticks call request_render() instead of
+// render_grid(): a burst of keystrokes and ticks within one display frame
+// costs one render. The requestAnimationFrame loop only runs while there is
+// something to draw - a pending request, or a visible caret, which needs a
+// frame each time its blink phase flips - and stops itself otherwise.
+
+static int render_requested = 0;
+static int frame_loop_running = 0;
+
+static EM_BOOL frame_tick(double time, void* user_data) {
+    (void)time;
+    (void)user_data;
+    int phase = caret_blink_phase(caret_blink_time());
+    if (render_requested || phase != drawn_blink_phase) {
+        render_requested = 0;
+        render_grid();
+    }
+    frame_loop_running = render_requested || phase >= 0;
+    return frame_loop_running;
+}
+
+EMSCRIPTEN_KEEPALIVE
+void request_render(void) {
+    render_requested = 1;
+    if (frame_loop_running) return;
+    frame_loop_running = 1;
+    emscripten_request_animation_frame_loop(frame_tick, NULL);
+}
+
+// ============================================================
+// HIT TESTING (canvas click → cell coordinates)
+// ============================================================
+
+// Canvas pixel -> logical item along one axis. Fixed segments map their
+// screen area directly; the scrolling one adds the scroll offset. Returns -1
+// past the end of the content.
+static int find_item_at(const AxisSegment* segs, int count, const AxisLayout* axis,
+                        int content_start, double scroll, double pos) {
+    for (int i = 0; i < count; i++) {
+        const AxisSegment* seg = &segs[i];
+        if (pos < seg->screen_start || pos >= seg->screen_start + seg->screen_size) continue;
+        double p = seg->scrolls
+            ? axis_start(axis, content_start) + scroll + (pos - seg->screen_start)
+            : axis_start(axis, seg->first) + (pos - seg->screen_start);
+        if (p >= axis_total(axis)) return -1;
+        return axis_find(axis, p);
+    }
+    return -1;
+}
+
+// Returns the cell under a clip-space point as row * grid_cols + col (the
+// cell index set_cell_numbers takes), or -1 outside the grid
+EMSCRIPTEN_KEEPALIVE
+int get_cell_at(float clip_x, float clip_y) {
+    if (view_rows <= 0 || view_cols <= 0) return -1;
+    if (clip_x < -1.0f || clip_x > 1.0f || clip_y < -1.0f || clip_y > 1.0f) return -1;
+    double px = (clip_x + 1.0f) * 0.5f * canvas_width;
+    double py = (1.0f - clip_y) * 0.5f * canvas_height;
+    int col = find_item_at(col_segments, COL_SEGMENTS, &col_layout, pinned_left_cols, scroll_x, px);
+    int row = find_item_at(row_segments, ROW_SEGMENTS, &row_layout, frozen_rows, scroll_y, py);
+    if (row < 0 || col < 0) return -1;
+    const HeaderSpan* span = header_span_of(row, col);
+    if (span) col = span->first_col;
+    return row * grid_cols + col;
 }
@@ -4,15 +4,74 @@ import type { WebGLModule } from '../wasm'
 
 const CANVAS_WIDTH = 1200
 const CANVAS_HEIGHT = 800
-const CURSOR_BLINK_MS = 530
+const VISIBLE_ROWS = 25
+const WHEEL_LINE_PX = 32
 
 function setCellText(mod: WebGLModule, row: number, col: number, text: string) {
   mod.ccall('set_cell_text', null, ['number', 'number', 'string'], [row, col, text])
 }
 
-function defaultCellColor(row: number): [number, number, number] {
-  if (row === 0) return [0.0, 0.5, 0.7]
-  return row % 2 === 0 ? [0.15, 0.15, 0.25] : [0.2, 0.2, 0.32]
+const PRICE_DECIMALS = 2
+const HEADER_STYLE = 1 // text palette index, see TEXT STYLES in webgl.c
+const UP_STYLE = 2
+const DOWN_STYLE = 3
+
+// Conditional formatting ops, matching the FORMAT_* enum in webgl.c
+const FORMAT_UP = 6
+const FORMAT_DOWN = 7
+
+const ALIGN_DECIMAL = 3 // TEXT_ALIGN_DECIMAL in webgl.c
+
+const textEncoder = new TextEncoder()
+
+interface CellText {
+  row: number
+  col: number
+  text: string
+}
+
+// Packs cells into the set_cells_text layout in the WASM heap and applies
+// them with one call: a [count, arenaBytes] header, (row, col, offset, len)
+// records, then the UTF-8 arena.
+function setCellsText(mod: WebGLModule, cells: CellText[]) {
+  if (cells.length === 0) return
+  const headerBytes = 8 + cells.length * 16
+  let arenaCapacity = 0
+  for (const cell of cells) arenaCapacity += cell.text.length * 3
+  const ptr = mod._malloc(headerBytes + arenaCapacity)
+  const heap32 = mod.HEAP32
+  const arena = mod.HEAPU8.subarray(ptr + headerBytes, ptr + headerBytes + arenaCapacity)
+  const base = ptr >> 2
+  let used = 0
+  cells.forEach((cell, i) => {
+    const { written } = textEncoder.encodeInto(cell.text, arena.subarray(used))
+    const record = base + 2 + i * 4
+    heap32[record] = cell.row
+    heap32[record + 1] = cell.col
+    heap32[record + 2] = used
+    heap32[record + 3] = written
+    used += written
+  })
+  heap32[base] = cells.length
+  heap32[base + 1] = used
+  mod._set_cells_text(ptr, headerBytes + used)
+  mod._free(ptr)
+}
+
+// Cell indices and values for set_cell_numbers, kept in the WASM heap
+interface NumberBatch {
+  cells: number
+  values: number
+  capacity: number
+}
+
+function ensureNumberBatch(mod: WebGLModule, batch: NumberBatch | null, count: number): NumberBatch {
+  if (batch && batch.capacity >= count) return batch
+  if (batch) {
+    mod._free(batch.cells)
+    mod._free(batch.values)
+  }
+  return { cells: mod._malloc(count * 4), values: mod._malloc(count * 8), capacity: count }
 }
 
 export default function WebGLGrid() {
@@ -29,11 +88,11 @@ export default function WebGLGrid() {
   const updateIntervalRef = useRef<ReturnType<typeof setInterval> | null>(null)
   const updateCountRef = useRef(0)
   const lastUpdateTimeRef = useRef(0)
+  const numberBatchRef = useRef<NumberBatch | null>(null)
 
   const selRef = useRef({ row: -1, col: -1 })
+  const anchorRef = useRef({ row: -1, col: -1 })
   const editRef = useRef({ active: false, buffer: '', cursorPos: 0 })
-  const blinkRef = useRef<ReturnType<typeof setInterval> | null>(null)
-  const blinkOn = useRef(true)
   const moduleRef = useRef<WebGLModule | null>(null)
   const gridRef = useRef({ rows: 8, cols: 5 })
 
@@ -50,44 +109,56 @@ export default function WebGLGrid() {
     return priceDataRef.current[key]?.toFixed(2) ?? ''
   }, [])
 
+  // Two calls for the whole grid: text cells in one packed buffer, prices
+  // in one number batch
   const syncAllText = useCallback((mod: WebGLModule, prices: Record<string, number>, rows: number, cols: number) => {
     const cd = cellDataRef.current
+    const texts: CellText[] = []
+    const batch = ensureNumberBatch(mod, numberBatchRef.current, rows * cols)
+    numberBatchRef.current = batch
+    let numbers = 0
     for (let row = 0; row < rows; row++) {
       for (let col = 0; col < cols; col++) {
         const key = `${row}-${col}`
         const edited = cd[key]
-        const value =
-          edited !== undefined
-            ? edited
-            : row === 0
-              ? `Col ${col + 1}`
-              : (prices[key] ?? 100 + Math.random() * 900).toFixed(2)
-        setCellText(mod, row, col, value)
+        if (edited !== undefined) {
+          texts.push({ row, col, text: edited })
+        } else if (row === 0) {
+          texts.push({ row, col, text: `Col ${col + 1}` })
+        } else {
+          mod.HEAP32[(batch.cells >> 2) + numbers] = row * cols + col
+          mod.HEAPF64[(batch.values >> 3) + numbers] = prices[key] ?? 100 + Math.random() * 900
+          numbers++
+        }
       }
     }
+    setCellsText(mod, texts)
+    mod._set_cell_numbers(batch.cells, batch.values, numbers, PRICE_DECIMALS)
+    for (let col = 0; col < cols; col++) mod._set_cell_style(0, col, HEADER_STYLE)
   }, [])
 
-  const selectCell = useCallback((row: number, col: number) => {
+  // The selection is drawn by the overlay in webgl.c; extend keeps the
+  // anchor and selects the rectangle up to (row, col)
+  const selectCell = useCallback((row: number, col: number, extend = false) => {
     const mod = moduleRef.current
     if (!mod) return
-    const { cols } = gridRef.current
-    const prev = selRef.current
 
     if (editRef.current.active) {
       commitEdit()
     }
 
-    if (prev.row >= 0 && prev.col >= 0) {
-      const [r, g, b] = defaultCellColor(prev.row)
-      mod._set_cell_color(prev.row, prev.col, cols, r, g, b)
-    }
-
+    if (!extend || anchorRef.current.row < 0) anchorRef.current = { row, col }
+    const anchor = anchorRef.current
     selRef.current = { row, col }
-    mod._set_cell_color(row, col, cols, 0.0, 1.0, 0.5)
-    mod._update_grid_buffer()
+    mod._scroll_cell_into_view(row, col)
+    mod._set_selection(anchor.row, anchor.col, row, col)
     mod._set_cursor(row, col, 0, 0)
-    mod._render_grid()
-    setStats(`Selected: Row ${row}, Col ${col} — press Enter to edit, arrows to move`)
+    mod._request_render()
+    setStats(
+      anchor.row === row && anchor.col === col
+        ? `Selected: Row ${row}, Col ${col} — press Enter to edit, arrows to move`
+        : `Selected: [${anchor.row},${anchor.col}] to [${row},${col}]`
+    )
   }, [])
 
   const startEdit = useCallback(() => {
@@ -97,7 +168,7 @@ export default function WebGLGrid() {
 
     const value = getCellValue(row, col)
     editRef.current = { active: true, buffer: value, cursorPos: value.length }
-    startBlink()
+    showCaret()
     setStats(`Editing [${row},${col}]: "${value}" — type to replace, Esc to cancel`)
   }, [getCellValue])
 
@@ -111,9 +182,8 @@ export default function WebGLGrid() {
     cellDataRef.current = { ...cellDataRef.current, [key]: buffer }
     setCellText(mod, row, col, buffer)
     editRef.current = { active: false, buffer: '', cursorPos: 0 }
-    stopBlink()
     mod._set_cursor(row, col, 0, 0)
-    mod._render_grid()
+    mod._request_render()
     setStats(`Committed [${row},${col}] = "${buffer}"`)
   }, [])
 
@@ -125,43 +195,20 @@ export default function WebGLGrid() {
     const originalValue = getCellValue(row, col)
     setCellText(mod, row, col, originalValue)
     editRef.current = { active: false, buffer: '', cursorPos: 0 }
-    stopBlink()
     mod._set_cursor(row, col, 0, 0)
-    mod._render_grid()
+    mod._request_render()
     setStats(`Cancelled edit on [${row},${col}]`)
   }, [getCellValue])
 
-  const startBlink = useCallback(() => {
-    stopBlink()
-    blinkOn.current = true
-    blinkRef.current = setInterval(() => {
-      blinkOn.current = !blinkOn.current
-      const mod = moduleRef.current
-      const { row, col } = selRef.current
-      if (mod && row >= 0) {
-        mod._set_cursor(row, col, editRef.current.cursorPos, blinkOn.current ? 1 : 0)
-        mod._render_grid()
-      }
-    }, CURSOR_BLINK_MS)
-  }, [])
-
-  const stopBlink = useCallback(() => {
-    if (blinkRef.current) {
-      clearInterval(blinkRef.current)
-      blinkRef.current = null
-    }
-  }, [])
-
-  const resetBlink = useCallback(() => {
-    blinkOn.current = true
+  // Shows the caret at the edit position, restarting its blink. The module
+  // blinks it and schedules the frames itself.
+  const showCaret = useCallback(() => {
     const mod = moduleRef.current
     const { row, col } = selRef.current
-    if (mod && row >= 0) {
-      mod._set_cursor(row, col, editRef.current.cursorPos, 1)
-      mod._render_grid()
-    }
-    startBlink()
-  }, [startBlink])
+    if (!mod || row < 0) return
+    mod._set_cursor(row, col, editRef.current.cursorPos, 1)
+    mod._request_render()
+  }, [])
 
   // Init grid when module loads or grid size changes
   useEffect(() => {
@@ -171,7 +218,21 @@ export default function WebGLGrid() {
     const id = requestAnimationFrame(() => {
       if (!canvas.isConnected) return
       module._init_webgl(canvas.width, canvas.height)
-      module._init_grid(gridRows, gridCols)
+      if (!module._init_grid(gridRows, gridCols)) {
+        setStats(`Could not allocate a ${gridRows}×${gridCols} grid`)
+        return
+      }
+      module._set_frozen(1, 0, 0)
+      // Price ticks color themselves in C: green when up, red when down.
+      // Decimal points line up down each column.
+      for (let col = 0; col < gridCols; col++) {
+        module._set_column_align(col, ALIGN_DECIMAL, PRICE_DECIMALS + 1)
+        if (!module._add_format_rule(col, FORMAT_UP, 0, 0, UP_STYLE, 0) ||
+            !module._add_format_rule(col, FORMAT_DOWN, 0, 0, DOWN_STYLE, 0)) {
+          console.warn(`add_format_rule failed for column ${col}`)
+        }
+      }
+      module._set_viewport(Math.min(gridRows, VISIBLE_ROWS), 0)
 
       const newPrices: Record<string, number> = {}
       for (let row = 1; row < gridRows; row++) {
@@ -185,11 +246,13 @@ export default function WebGLGrid() {
       priceDataRef.current = newPrices
 
       syncAllText(module, newPrices, gridRows, gridCols)
-      module._render_grid()
 
       selRef.current = { row: -1, col: -1 }
+      anchorRef.current = { row: -1, col: -1 }
       editRef.current = { active: false, buffer: '', cursorPos: 0 }
-      stopBlink()
+      module._set_selection(-1, -1, -1, -1)
+      module._set_cursor(-1, -1, 0, 0)
+      module._request_render()
       setStats(`${gridRows}×${gridCols} grid — click a cell or use arrow keys`)
       canvas.focus()
     })
@@ -197,9 +260,28 @@ export default function WebGLGrid() {
     return () => {
       cancelAnimationFrame(id)
       if (updateIntervalRef.current) clearInterval(updateIntervalRef.current)
-      stopBlink()
     }
-  }, [module, gridRows, gridCols, syncAllText, stopBlink])
+  }, [module, gridRows, gridCols, syncAllText])
+
+  // Wheel/trackpad scrolls by pixels; needs a non-passive listener to stop the page scrolling
+  useEffect(() => {
+    const canvas = canvasRef.current
+    if (!canvas) return
+
+    const onWheel = (e: WheelEvent) => {
+      const mod = moduleRef.current
+      if (!mod) return
+      e.preventDefault()
+      const scale =
+        e.deltaMode === WheelEvent.DOM_DELTA_LINE ? WHEEL_LINE_PX
+          : e.deltaMode === WheelEvent.DOM_DELTA_PAGE ? canvas.height
+            : 1
+      if (mod._scroll_by_px(e.deltaX * scale, e.deltaY * scale)) mod._request_render()
+    }
+
+    canvas.addEventListener('wheel', onWheel, { passive: false })
+    return () => canvas.removeEventListener('wheel', onWheel)
+  }, [status])
 
   const handleCanvasClick = useCallback((e: React.MouseEvent<HTMLCanvasElement>) => {
     const mod = moduleRef.current
@@ -215,8 +297,9 @@ export default function WebGLGrid() {
     const encoded = mod._get_cell_at(clipX, clipY)
     if (encoded < 0) return
 
-    const row = Math.floor(encoded / 256)
-    const col = encoded % 256
+    const { cols } = gridRef.current
+    const row = Math.floor(encoded / cols)
+    const col = encoded % cols
 
     if (selRef.current.row === row && selRef.current.col === col) {
       if (!editRef.current.active) startEdit()
@@ -247,7 +330,7 @@ export default function WebGLGrid() {
           if (e.key === 'ArrowDown') nr = Math.min(rows - 1, nr + 1)
           if (e.key === 'ArrowLeft') nc = Math.max(0, nc - 1)
           if (e.key === 'ArrowRight') nc = Math.min(cols - 1, nc + 1)
-          selectCell(nr, nc)
+          selectCell(nr, nc, e.shiftKey)
           return
         }
         case 'Enter':
@@ -263,7 +346,7 @@ export default function WebGLGrid() {
             delete cellDataRef.current[key]
             const original = row === 0 ? `Col ${col + 1}` : priceDataRef.current[key]?.toFixed(2) ?? ''
             setCellText(mod, row, col, original)
-            mod._render_grid()
+            mod._request_render()
             setStats(`Cleared [${row},${col}]`)
           }
           return
@@ -284,8 +367,7 @@ export default function WebGLGrid() {
           if (e.key.length === 1 && !e.ctrlKey && !e.metaKey && !e.altKey && row >= 0) {
             editRef.current = { active: true, buffer: e.key, cursorPos: 1 }
             setCellText(mod, row, col, e.key)
-            startBlink()
-            mod._render_grid()
+            showCaret()
             setStats(`Editing [${row},${col}]: "${e.key}"`)
             e.preventDefault()
           }
@@ -312,7 +394,7 @@ export default function WebGLGrid() {
           editRef.current.buffer = next
           editRef.current.cursorPos = cursorPos - 1
           setCellText(mod, row, col, next)
-          resetBlink()
+          showCaret()
           setStats(`Editing [${row},${col}]: "${next}"`)
         }
         return
@@ -323,7 +405,7 @@ export default function WebGLGrid() {
           const next = buffer.slice(0, cursorPos) + buffer.slice(cursorPos + 1)
           editRef.current.buffer = next
           setCellText(mod, row, col, next)
-          resetBlink()
+          showCaret()
           setStats(`Editing [${row},${col}]: "${next}"`)
         }
         return
@@ -332,25 +414,25 @@ export default function WebGLGrid() {
         e.preventDefault()
         if (cursorPos > 0) {
           editRef.current.cursorPos = cursorPos - 1
-          resetBlink()
+          showCaret()
         }
         return
       case 'ArrowRight':
         e.preventDefault()
         if (cursorPos < buffer.length) {
           editRef.current.cursorPos = cursorPos + 1
-          resetBlink()
+          showCaret()
         }
         return
       case 'Home':
         e.preventDefault()
         editRef.current.cursorPos = 0
-        resetBlink()
+        showCaret()
         return
       case 'End':
         e.preventDefault()
         editRef.current.cursorPos = buffer.length
-        resetBlink()
+        showCaret()
         return
       case 'Tab': {
         e.preventDefault()
@@ -371,12 +453,12 @@ export default function WebGLGrid() {
           editRef.current.buffer = next
           editRef.current.cursorPos = cursorPos + 1
           setCellText(mod, row, col, next)
-          resetBlink()
+          showCaret()
           setStats(`Editing [${row},${col}]: "${next}"`)
         }
         return
     }
-  }, [selectCell, startEdit, commitEdit, cancelEdit, resetBlink])
+  }, [selectCell, startEdit, commitEdit, cancelEdit, showCaret])
 
   // Live price updates
   const toggleUpdates = () => {
@@ -404,6 +486,14 @@ export default function WebGLGrid() {
     const editRow = selRef.current.row
     const editCol = selRef.current.col
 
+    const batch = ensureNumberBatch(mod, numberBatchRef.current, rows * cols)
+    numberBatchRef.current = batch
+    // Views can be replaced when memory grows: fetch them after allocating
+    const cellsView = mod.HEAP32
+    const valuesView = mod.HEAPF64
+    const cellsBase = batch.cells >> 2
+    const valuesBase = batch.values >> 3
+
     for (let row = 1; row < rows; row++) {
       for (let col = 0; col < cols; col++) {
         const key = `${row}-${col}`
@@ -415,13 +505,15 @@ export default function WebGLGrid() {
         const newPrice = Math.max(0.01, oldPrice + change)
         pd[key] = newPrice
 
-        setCellText(mod, row, col, newPrice.toFixed(2))
+        cellsView[cellsBase + cellsUpdated] = row * cols + col
+        valuesView[valuesBase + cellsUpdated] = newPrice
         cellsUpdated++
       }
     }
+    mod._set_cell_numbers(batch.cells, batch.values, cellsUpdated, PRICE_DECIMALS)
 
     priceDataRef.current = pd
-    mod._render_grid()
+    mod._request_render()
 
     updateCountRef.current++
     const elapsed = performance.now() - startTime
@@ -2,6 +2,7 @@ export interface WebGLModule {
   _init_webgl: (width: number, height: number) => number
   _init_grid: (rows: number, cols: number) => number
   _render_grid: () => void
+  _request_render: () => void
   _set_cell_color: (
     row: number,
     col: number,
@@ -10,9 +11,46 @@ export interface WebGLModule {
     g: number,
     b: number
   ) => void
+  _clear_cell_color: (row: number, col: number) => void
+  _set_cell_number: (row: number, col: number, value: number, decimals: number) => void
+  _set_cell_numbers: (cellsPtr: number, valuesPtr: number, count: number, decimals: number) => void
+  _set_cells_text: (bufferPtr: number, size: number) => number
+  _set_cell_style: (row: number, col: number, style: number) => void
+  _set_text_style: (style: number, r: number, g: number, b: number) => void
+  _add_format_rule: (
+    col: number,
+    op: number,
+    a: number,
+    b: number,
+    textStyle: number,
+    bgStyle: number
+  ) => number
+  _clear_format_rules: (col: number) => void
+  _set_format_background: (bg: number, r: number, g: number, b: number) => void
+  _set_column_align: (col: number, align: number, fraction: number) => void
   _update_grid_buffer: () => void
   _get_cell_at: (clipX: number, clipY: number) => number
   _set_cursor: (row: number, col: number, pos: number, visible: number) => void
+  _set_selection: (anchorRow: number, anchorCol: number, row: number, col: number) => void
+  _set_viewport: (visibleRows: number, visibleCols: number) => void
+  _set_frozen: (rows: number, leftCols: number, rightCols: number) => void
+  _set_header_span: (row: number, firstCol: number, cols: number, labelPtr: number) => number
+  _clear_header_spans: () => void
+  _set_gpu_text_layout: (enabled: number) => void
+  _scroll_to_px: (x: number, y: number) => number
+  _scroll_by_px: (dx: number, dy: number) => number
+  _scroll_to: (firstRow: number, firstCol: number) => number
+  _scroll_by: (deltaRows: number, deltaCols: number) => number
+  _scroll_cell_into_view: (row: number, col: number) => number
+  _set_column_width: (col: number, width: number) => void
+  _set_row_height: (row: number, height: number) => void
+  _get_scroll_row: () => number
+  _get_scroll_col: () => number
+  _malloc: (size: number) => number
+  _free: (ptr: number) => void
+  HEAPU8: Uint8Array
+  HEAP32: Int32Array
+  HEAPF64: Float64Array
   ccall: (
     ident: string,
     returnType: string | null,
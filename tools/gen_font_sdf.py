@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+"""Generates c/font_sdf.h: signed-distance-field glyphs for printable ASCII
+and Latin-1.
+
+Usage: python3 tools/gen_font_sdf.py [font.ttf] [out.h]
+
+Pure Python (no PIL/freetype): reads the TrueType outlines directly,
+flattens the quadratic curves and computes, for every atlas texel, the
+distance to the nearest edge (positive inside the glyph). Distances are
+mapped to 0..255 with 128 on the edge and saturate SPREAD texels away.
+Every glyph is a same-size cell, PackBits run-length encoded on its own
+(most texels are saturated) so the grid's glyph cache can decode just the
+glyphs it needs into its atlas.
+
+Defaults to DejaVu Sans Mono (Bitstream Vera license), which is monospaced
+like the grid's fixed-advance text layout.
+"""
+
+import math
+import struct
+import sys
+
+CODE_POINTS = list(range(32, 127)) + list(range(160, 256))
+EM_TEXELS = 24     # texels per em
+SPREAD = 3         # distance range in texels on each side of the edge
+CURVE_STEPS = 6
+
+
+class Font:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num_tables = struct.unpack_from(">H", self.data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em = struct.unpack_from(">H", self.data, head + 18)[0]
+        self.long_loca = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+        self.num_glyphs = struct.unpack_from(">H", self.data, self.tables["maxp"][0] + 4)[0]
+        self.num_hmetrics = struct.unpack_from(">H", self.data, self.tables["hhea"][0] + 34)[0]
+        self.cmap = self._read_cmap()
+
+    def _read_cmap(self):
+        base = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", self.data, base + 4 + 8 * i)
+            if platform == 3 and encoding in (0, 1):
+                sub = base + offset
+                if struct.unpack_from(">H", self.data, sub)[0] == 4:
+                    return self._read_cmap4(sub)
+        raise ValueError("no Unicode BMP cmap subtable")
+
+    def _read_cmap4(self, sub):
+        seg_count = struct.unpack_from(">H", self.data, sub + 6)[0] // 2
+        ends = sub + 14
+        starts = ends + 2 * seg_count + 2
+        deltas = starts + 2 * seg_count
+        range_offsets = deltas + 2 * seg_count
+        cmap = {}
+        for s in range(seg_count):
+            end = struct.unpack_from(">H", self.data, ends + 2 * s)[0]
+            start = struct.unpack_from(">H", self.data, starts + 2 * s)[0]
+            delta = struct.unpack_from(">h", self.data, deltas + 2 * s)[0]
+            ro_addr = range_offsets + 2 * s
+            ro = struct.unpack_from(">H", self.data, ro_addr)[0]
+            for c in range(start, min(end, 0xFFFE) + 1):
+                if ro == 0:
+                    g = (c + delta) & 0xFFFF
+                else:
+                    g = struct.unpack_from(">H", self.data, ro_addr + ro + 2 * (c - start))[0]
+                    if g:
+                        g = (g + delta) & 0xFFFF
+                cmap[c] = g
+        return cmap
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        index = min(glyph, self.num_hmetrics - 1)
+        return struct.unpack_from(">H", self.data, hmtx + 4 * index)[0]
+
+    def _glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            a, b = struct.unpack_from(">II", self.data, loca + 4 * glyph)
+        else:
+            a, b = struct.unpack_from(">HH", self.data, loca + 2 * glyph)
+            a, b = a * 2, b * 2
+        glyf = self.tables["glyf"][0]
+        return glyf + a, b - a
+
+    def contours(self, glyph):
+        """List of contours, each a list of (x, y, on_curve)."""
+        offset, length = self._glyph_range(glyph)
+        if length == 0:
+            return []
+        n = struct.unpack_from(">h", self.data, offset)[0]
+        if n < 0:
+            return self._composite(offset)
+        p = offset + 10
+        end_pts = struct.unpack_from(">%dH" % n, self.data, p)
+        p += 2 * n
+        p += 2 + struct.unpack_from(">H", self.data, p)[0]
+        count = end_pts[-1] + 1 if n else 0
+
+        flags = []
+        while len(flags) < count:
+            flag = self.data[p]
+            p += 1
+            flags.append(flag)
+            if flag & 8:
+                repeat = self.data[p]
+                p += 1
+                flags.extend([flag] * repeat)
+
+        def coords(short_bit, same_bit, p):
+            values, v = [], 0
+            for flag in flags:
+                if flag & short_bit:
+                    d = self.data[p]
+                    p += 1
+                    v += d if flag & same_bit else -d
+                elif not flag & same_bit:
+                    v += struct.unpack_from(">h", self.data, p)[0]
+                    p += 2
+                values.append(v)
+            return values, p
+
+        xs, p = coords(2, 16, p)
+        ys, p = coords(4, 32, p)
+        result, start = [], 0
+        for end in end_pts:
+            result.append([(xs[i], ys[i], flags[i] & 1) for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def _composite(self, offset):
+        p = offset + 10
+        result = []
+        while True:
+            flags, glyph = struct.unpack_from(">HH", self.data, p)
+            p += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from(">hh", self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, p)
+                p += 2
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from(">h", self.data, p)[0] / 16384.0
+                p += 2
+            elif flags & 0x40:
+                a, d = (v / 16384.0 for v in struct.unpack_from(">hh", self.data, p))
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384.0 for v in struct.unpack_from(">hhhh", self.data, p))
+                p += 8
+            for contour in self.contours(glyph):
+                result.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+            if not flags & 0x20:
+                return result
+
+
+def flatten(contour):
+    """Closed polyline of a TrueType quadratic contour."""
+    pts = list(contour)
+    if not pts:
+        return []
+    # Start on an on-curve point, inserting implied midpoints between
+    # consecutive off-curve points.
+    expanded = []
+    for i, (x, y, on) in enumerate(pts):
+        nx, ny, non = pts[(i + 1) % len(pts)]
+        expanded.append((x, y, on))
+        if not on and not non:
+            expanded.append(((x + nx) / 2.0, (y + ny) / 2.0, 1))
+    while not expanded[0][2]:
+        expanded.append(expanded.pop(0))
+
+    line = [expanded[0][:2]]
+    i = 1
+    n = len(expanded)
+    while i <= n:
+        x, y, on = expanded[i % n]
+        if on:
+            line.append((x, y))
+            i += 1
+        else:
+            x0, y0 = line[-1]
+            x2, y2 = expanded[(i + 1) % n][:2]
+            for s in range(1, CURVE_STEPS + 1):
+                t = s / float(CURVE_STEPS)
+                u = 1 - t
+                line.append((u * u * x0 + 2 * u * t * x + t * t * x2,
+                             u * u * y0 + 2 * u * t * y + t * t * y2))
+            i += 2
+    return line
+
+
+def segment_distance(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    length = dx * dx + dy * dy
+    t = 0.0 if length == 0 else max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / length))
+    ex, ey = ax + t * dx - px, ay + t * dy - py
+    return math.sqrt(ex * ex + ey * ey)
+
+
+def winding(px, py, segments):
+    w = 0
+    for ax, ay, bx, by in segments:
+        if ay <= py < by or by <= py < ay:
+            x = ax + (py - ay) * (bx - ax) / (by - ay)
+            if x > px:
+                w += 1 if by > ay else -1
+    return w
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run > 2:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out += bytes([i - start - 1]) + data[start:i]
+    return bytes(out)
+
+
+def main():
+    font_path = sys.argv[1] if len(sys.argv) > 1 else "/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf"
+    out_path = sys.argv[2] if len(sys.argv) > 2 else "c/font_sdf.h"
+    font = Font(font_path)
+    scale = EM_TEXELS / float(font.units_per_em)
+
+    chars = [c for c in CODE_POINTS if c in font.cmap]
+    outlines = {}
+    y_min, y_max = 0.0, 0.0
+    for c in chars:
+        segments = []
+        for contour in font.contours(font.cmap.get(c, 0)):
+            line = [(x * scale, y * scale) for x, y in flatten(contour)]
+            for (ax, ay), (bx, by) in zip(line, line[1:] + line[:1]):
+                if (ax, ay) != (bx, by):
+                    segments.append((ax, ay, bx, by))
+                    y_min, y_max = min(y_min, ay), max(y_max, ay)
+        outlines[c] = segments
+
+    advance = font.advance(font.cmap[ord("M")]) * scale
+    cap_height = max(max(ay, by) for _, ay, _, by in outlines[ord("H")])
+    cell_w = int(math.ceil(advance)) + 2 * SPREAD
+    cell_h = int(math.ceil(y_max) - math.floor(y_min)) + 2 * SPREAD
+    baseline = int(math.ceil(y_max)) + SPREAD   # texels from the cell top
+    cells = []
+    for c in chars:
+        segments = outlines[c]
+        cell = bytearray(cell_w * cell_h)
+        for ty in range(cell_h):
+            gy = baseline - (ty + 0.5)
+            for tx in range(cell_w):
+                gx = tx + 0.5 - SPREAD
+                if not segments:
+                    d = -SPREAD
+                else:
+                    d = min(segment_distance(gx, gy, *s) for s in segments)
+                    if winding(gx, gy, segments) == 0:
+                        d = -d
+                v = 0.5 + d / (2.0 * SPREAD)
+                cell[ty * cell_w + tx] = max(0, min(255, int(round(v * 255))))
+        cells.append(packbits(bytes(cell)))
+
+    offsets = [0]
+    for cell in cells:
+        offsets.append(offsets[-1] + len(cell))
+    blob = b"".join(cells)
+
+    def write_array(f, decl, values, fmt, per_line):
+        f.write("%s = {\n" % decl)
+        for i in range(0, len(values), per_line):
+            f.write("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",\n")
+        f.write("};\n\n")
+
+    with open(out_path, "w") as f:
+        f.write("// Generated by tools/gen_font_sdf.py from %s. Do not edit.\n" % font_path.split("/")[-1])
+        f.write("//\n// Signed-distance-field glyphs for printable ASCII and Latin-1, one\n")
+        f.write("// FONT_SDF_CELL_W x FONT_SDF_CELL_H cell each, PackBits encoded per glyph.\n")
+        f.write("// 128 is the glyph edge; values saturate FONT_SDF_SPREAD texels away.\n")
+        f.write("// Metrics are in texels; the pen origin is FONT_SDF_ORIGIN_X from a cell's\n// left edge and the baseline FONT_SDF_BASELINE from its top.\n\n")
+        f.write("#define FONT_SDF_GLYPH_COUNT %d\n" % len(chars))
+        f.write("#define FONT_SDF_CELL_W %d\n" % cell_w)
+        f.write("#define FONT_SDF_CELL_H %d\n" % cell_h)
+        f.write("#define FONT_SDF_SPREAD %d\n" % SPREAD)
+        f.write("#define FONT_SDF_ORIGIN_X %d\n" % SPREAD)
+        f.write("#define FONT_SDF_BASELINE %d\n" % baseline)
+        f.write("#define FONT_SDF_ADVANCE %.4ff\n" % advance)
+        f.write("#define FONT_SDF_CAP_HEIGHT %.4ff\n\n" % cap_height)
+        f.write("// Code point of each glyph\n")
+        write_array(f, "static const unsigned char font_sdf_codes[%d]" % len(chars), chars, "%d", 16)
+        f.write("// Glyph i is font_sdf_rle[font_sdf_offsets[i], font_sdf_offsets[i + 1])\n")
+        write_array(f, "static const unsigned int font_sdf_offsets[%d]" % len(offsets), offsets, "%d", 12)
+        write_array(f, "static const unsigned char font_sdf_rle[%d]" % len(blob), blob, "0x%02X", 20)
+    print("%s: %d glyphs of %dx%d, %d bytes -> %d bytes encoded"
+          % (out_path, len(chars), cell_w, cell_h, len(chars) * cell_w * cell_h, len(blob)))
+
+
+if __name__ == "__main__":
+    main()